@@ -496,6 +496,7 @@ LOCAL_SRC_FILES := \
   src/ndn-cpp/src/lite/data-lite.cpp \
   src/ndn-cpp/src/lite/delegation-set-lite.cpp \
   src/ndn-cpp/src/lite/exclude-lite.cpp \
+  src/ndn-cpp/src/lite/face-lite.cpp \
   src/ndn-cpp/src/lite/forwarding-flags-lite.cpp \
   src/ndn-cpp/src/lite/interest-lite.cpp \
   src/ndn-cpp/src/lite/key-locator-lite.cpp \
@@ -569,6 +570,8 @@ LOCAL_SRC_FILES := \
   src/ndn-cpp/src/security/v2/certificate-v2.cpp \
   src/ndn-cpp/src/transport/async-tcp-transport.cpp \
   src/ndn-cpp/src/transport/async-unix-transport.cpp \
+  src/ndn-cpp/src/transport/loopback-forwarder.cpp \
+  src/ndn-cpp/src/transport/loopback-transport.cpp \
   src/ndn-cpp/src/transport/tcp-transport.cpp \
   src/ndn-cpp/src/transport/transport.cpp \
   src/ndn-cpp/src/transport/udp-transport.cpp \
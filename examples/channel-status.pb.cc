@@ -0,0 +1,530 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: channel-status.proto
+
+#include "channel-status.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR ChannelStatusMessage_ChannelStatus::ChannelStatusMessage_ChannelStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.local_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ChannelStatusMessage_ChannelStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelStatusMessage_ChannelStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelStatusMessage_ChannelStatusDefaultTypeInternal() {}
+  union {
+    ChannelStatusMessage_ChannelStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelStatusMessage_ChannelStatusDefaultTypeInternal _ChannelStatusMessage_ChannelStatus_default_instance_;
+PROTOBUF_CONSTEXPR ChannelStatusMessage::ChannelStatusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.channel_status_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChannelStatusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelStatusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelStatusMessageDefaultTypeInternal() {}
+  union {
+    ChannelStatusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelStatusMessageDefaultTypeInternal _ChannelStatusMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_channel_2dstatus_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_channel_2dstatus_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_channel_2dstatus_2eproto = nullptr;
+
+const uint32_t TableStruct_channel_2dstatus_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ChannelStatusMessage_ChannelStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ChannelStatusMessage_ChannelStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ChannelStatusMessage_ChannelStatus, _impl_.local_uri_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ChannelStatusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::ChannelStatusMessage, _impl_.channel_status_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::ndn_message::ChannelStatusMessage_ChannelStatus)},
+  { 8, -1, -1, sizeof(::ndn_message::ChannelStatusMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_ChannelStatusMessage_ChannelStatus_default_instance_._instance,
+  &::ndn_message::_ChannelStatusMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_channel_2dstatus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024channel-status.proto\022\013ndn_message\"\205\001\n\024"
+  "ChannelStatusMessage\022H\n\016channel_status\030\202"
+  "\001 \003(\0132/.ndn_message.ChannelStatusMessage"
+  ".ChannelStatus\032#\n\rChannelStatus\022\022\n\tlocal"
+  "_uri\030\201\001 \002(\t"
+  ;
+static ::_pbi::once_flag descriptor_table_channel_2dstatus_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_channel_2dstatus_2eproto = {
+    false, false, 171, descriptor_table_protodef_channel_2dstatus_2eproto,
+    "channel-status.proto",
+    &descriptor_table_channel_2dstatus_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_channel_2dstatus_2eproto::offsets,
+    file_level_metadata_channel_2dstatus_2eproto, file_level_enum_descriptors_channel_2dstatus_2eproto,
+    file_level_service_descriptors_channel_2dstatus_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_channel_2dstatus_2eproto_getter() {
+  return &descriptor_table_channel_2dstatus_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_channel_2dstatus_2eproto(&descriptor_table_channel_2dstatus_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class ChannelStatusMessage_ChannelStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChannelStatusMessage_ChannelStatus>()._impl_._has_bits_);
+  static void set_has_local_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ChannelStatusMessage_ChannelStatus::ChannelStatusMessage_ChannelStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ChannelStatusMessage.ChannelStatus)
+}
+ChannelStatusMessage_ChannelStatus::ChannelStatusMessage_ChannelStatus(const ChannelStatusMessage_ChannelStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelStatusMessage_ChannelStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.local_uri_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_local_uri()) {
+    _this->_impl_.local_uri_.Set(from._internal_local_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ChannelStatusMessage.ChannelStatus)
+}
+
+inline void ChannelStatusMessage_ChannelStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.local_uri_){}
+  };
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelStatusMessage_ChannelStatus::~ChannelStatusMessage_ChannelStatus() {
+  // @@protoc_insertion_point(destructor:ndn_message.ChannelStatusMessage.ChannelStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelStatusMessage_ChannelStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.local_uri_.Destroy();
+}
+
+void ChannelStatusMessage_ChannelStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelStatusMessage_ChannelStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ChannelStatusMessage.ChannelStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.local_uri_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelStatusMessage_ChannelStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string local_uri = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_local_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.ChannelStatusMessage.ChannelStatus.local_uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelStatusMessage_ChannelStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ChannelStatusMessage.ChannelStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string local_uri = 129;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_local_uri().data(), static_cast<int>(this->_internal_local_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.ChannelStatusMessage.ChannelStatus.local_uri");
+    target = stream->WriteStringMaybeAliased(
+        129, this->_internal_local_uri(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ChannelStatusMessage.ChannelStatus)
+  return target;
+}
+
+size_t ChannelStatusMessage_ChannelStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ChannelStatusMessage.ChannelStatus)
+  size_t total_size = 0;
+
+  // required string local_uri = 129;
+  if (_internal_has_local_uri()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_local_uri());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelStatusMessage_ChannelStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelStatusMessage_ChannelStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelStatusMessage_ChannelStatus::GetClassData() const { return &_class_data_; }
+
+
+void ChannelStatusMessage_ChannelStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelStatusMessage_ChannelStatus*>(&to_msg);
+  auto& from = static_cast<const ChannelStatusMessage_ChannelStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ChannelStatusMessage.ChannelStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_local_uri()) {
+    _this->_internal_set_local_uri(from._internal_local_uri());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelStatusMessage_ChannelStatus::CopyFrom(const ChannelStatusMessage_ChannelStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ChannelStatusMessage.ChannelStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelStatusMessage_ChannelStatus::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ChannelStatusMessage_ChannelStatus::InternalSwap(ChannelStatusMessage_ChannelStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.local_uri_, lhs_arena,
+      &other->_impl_.local_uri_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelStatusMessage_ChannelStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_channel_2dstatus_2eproto_getter, &descriptor_table_channel_2dstatus_2eproto_once,
+      file_level_metadata_channel_2dstatus_2eproto[0]);
+}
+
+// ===================================================================
+
+class ChannelStatusMessage::_Internal {
+ public:
+};
+
+ChannelStatusMessage::ChannelStatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.ChannelStatusMessage)
+}
+ChannelStatusMessage::ChannelStatusMessage(const ChannelStatusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelStatusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channel_status_){from._impl_.channel_status_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.ChannelStatusMessage)
+}
+
+inline void ChannelStatusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channel_status_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ChannelStatusMessage::~ChannelStatusMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.ChannelStatusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChannelStatusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_status_.~RepeatedPtrField();
+}
+
+void ChannelStatusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChannelStatusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.ChannelStatusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.channel_status_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChannelStatusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ndn_message.ChannelStatusMessage.ChannelStatus channel_status = 130;
+      case 130:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_channel_status(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1042>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChannelStatusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.ChannelStatusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.ChannelStatusMessage.ChannelStatus channel_status = 130;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_channel_status_size()); i < n; i++) {
+    const auto& repfield = this->_internal_channel_status(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(130, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.ChannelStatusMessage)
+  return target;
+}
+
+size_t ChannelStatusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.ChannelStatusMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.ChannelStatusMessage.ChannelStatus channel_status = 130;
+  total_size += 2UL * this->_internal_channel_status_size();
+  for (const auto& msg : this->_impl_.channel_status_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelStatusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelStatusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelStatusMessage::GetClassData() const { return &_class_data_; }
+
+
+void ChannelStatusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelStatusMessage*>(&to_msg);
+  auto& from = static_cast<const ChannelStatusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.ChannelStatusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.channel_status_.MergeFrom(from._impl_.channel_status_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChannelStatusMessage::CopyFrom(const ChannelStatusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.ChannelStatusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChannelStatusMessage::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.channel_status_))
+    return false;
+  return true;
+}
+
+void ChannelStatusMessage::InternalSwap(ChannelStatusMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.channel_status_.InternalSwap(&other->_impl_.channel_status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelStatusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_channel_2dstatus_2eproto_getter, &descriptor_table_channel_2dstatus_2eproto_once,
+      file_level_metadata_channel_2dstatus_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::ChannelStatusMessage_ChannelStatus*
+Arena::CreateMaybeMessage< ::ndn_message::ChannelStatusMessage_ChannelStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ChannelStatusMessage_ChannelStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::ChannelStatusMessage*
+Arena::CreateMaybeMessage< ::ndn_message::ChannelStatusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::ChannelStatusMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,528 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: channel-status.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_channel_2dstatus_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_channel_2dstatus_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_channel_2dstatus_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_channel_2dstatus_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_channel_2dstatus_2eproto;
+namespace ndn_message {
+class ChannelStatusMessage;
+struct ChannelStatusMessageDefaultTypeInternal;
+extern ChannelStatusMessageDefaultTypeInternal _ChannelStatusMessage_default_instance_;
+class ChannelStatusMessage_ChannelStatus;
+struct ChannelStatusMessage_ChannelStatusDefaultTypeInternal;
+extern ChannelStatusMessage_ChannelStatusDefaultTypeInternal _ChannelStatusMessage_ChannelStatus_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::ChannelStatusMessage* Arena::CreateMaybeMessage<::ndn_message::ChannelStatusMessage>(Arena*);
+template<> ::ndn_message::ChannelStatusMessage_ChannelStatus* Arena::CreateMaybeMessage<::ndn_message::ChannelStatusMessage_ChannelStatus>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class ChannelStatusMessage_ChannelStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ChannelStatusMessage.ChannelStatus) */ {
+ public:
+  inline ChannelStatusMessage_ChannelStatus() : ChannelStatusMessage_ChannelStatus(nullptr) {}
+  ~ChannelStatusMessage_ChannelStatus() override;
+  explicit PROTOBUF_CONSTEXPR ChannelStatusMessage_ChannelStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelStatusMessage_ChannelStatus(const ChannelStatusMessage_ChannelStatus& from);
+  ChannelStatusMessage_ChannelStatus(ChannelStatusMessage_ChannelStatus&& from) noexcept
+    : ChannelStatusMessage_ChannelStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelStatusMessage_ChannelStatus& operator=(const ChannelStatusMessage_ChannelStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelStatusMessage_ChannelStatus& operator=(ChannelStatusMessage_ChannelStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelStatusMessage_ChannelStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelStatusMessage_ChannelStatus* internal_default_instance() {
+    return reinterpret_cast<const ChannelStatusMessage_ChannelStatus*>(
+               &_ChannelStatusMessage_ChannelStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ChannelStatusMessage_ChannelStatus& a, ChannelStatusMessage_ChannelStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelStatusMessage_ChannelStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelStatusMessage_ChannelStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelStatusMessage_ChannelStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelStatusMessage_ChannelStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelStatusMessage_ChannelStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelStatusMessage_ChannelStatus& from) {
+    ChannelStatusMessage_ChannelStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelStatusMessage_ChannelStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ChannelStatusMessage.ChannelStatus";
+  }
+  protected:
+  explicit ChannelStatusMessage_ChannelStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLocalUriFieldNumber = 129,
+  };
+  // required string local_uri = 129;
+  bool has_local_uri() const;
+  private:
+  bool _internal_has_local_uri() const;
+  public:
+  void clear_local_uri();
+  const std::string& local_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_local_uri();
+  PROTOBUF_NODISCARD std::string* release_local_uri();
+  void set_allocated_local_uri(std::string* local_uri);
+  private:
+  const std::string& _internal_local_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_uri(const std::string& value);
+  std::string* _internal_mutable_local_uri();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ChannelStatusMessage.ChannelStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_uri_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_channel_2dstatus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelStatusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ChannelStatusMessage) */ {
+ public:
+  inline ChannelStatusMessage() : ChannelStatusMessage(nullptr) {}
+  ~ChannelStatusMessage() override;
+  explicit PROTOBUF_CONSTEXPR ChannelStatusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelStatusMessage(const ChannelStatusMessage& from);
+  ChannelStatusMessage(ChannelStatusMessage&& from) noexcept
+    : ChannelStatusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelStatusMessage& operator=(const ChannelStatusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelStatusMessage& operator=(ChannelStatusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelStatusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelStatusMessage* internal_default_instance() {
+    return reinterpret_cast<const ChannelStatusMessage*>(
+               &_ChannelStatusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ChannelStatusMessage& a, ChannelStatusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelStatusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelStatusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelStatusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelStatusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelStatusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelStatusMessage& from) {
+    ChannelStatusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelStatusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ChannelStatusMessage";
+  }
+  protected:
+  explicit ChannelStatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ChannelStatusMessage_ChannelStatus ChannelStatus;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelStatusFieldNumber = 130,
+  };
+  // repeated .ndn_message.ChannelStatusMessage.ChannelStatus channel_status = 130;
+  int channel_status_size() const;
+  private:
+  int _internal_channel_status_size() const;
+  public:
+  void clear_channel_status();
+  ::ndn_message::ChannelStatusMessage_ChannelStatus* mutable_channel_status(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ChannelStatusMessage_ChannelStatus >*
+      mutable_channel_status();
+  private:
+  const ::ndn_message::ChannelStatusMessage_ChannelStatus& _internal_channel_status(int index) const;
+  ::ndn_message::ChannelStatusMessage_ChannelStatus* _internal_add_channel_status();
+  public:
+  const ::ndn_message::ChannelStatusMessage_ChannelStatus& channel_status(int index) const;
+  ::ndn_message::ChannelStatusMessage_ChannelStatus* add_channel_status();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ChannelStatusMessage_ChannelStatus >&
+      channel_status() const;
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ChannelStatusMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ChannelStatusMessage_ChannelStatus > channel_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_channel_2dstatus_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ChannelStatusMessage_ChannelStatus
+
+// required string local_uri = 129;
+inline bool ChannelStatusMessage_ChannelStatus::_internal_has_local_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ChannelStatusMessage_ChannelStatus::has_local_uri() const {
+  return _internal_has_local_uri();
+}
+inline void ChannelStatusMessage_ChannelStatus::clear_local_uri() {
+  _impl_.local_uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ChannelStatusMessage_ChannelStatus::local_uri() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ChannelStatusMessage.ChannelStatus.local_uri)
+  return _internal_local_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelStatusMessage_ChannelStatus::set_local_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.local_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ChannelStatusMessage.ChannelStatus.local_uri)
+}
+inline std::string* ChannelStatusMessage_ChannelStatus::mutable_local_uri() {
+  std::string* _s = _internal_mutable_local_uri();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ChannelStatusMessage.ChannelStatus.local_uri)
+  return _s;
+}
+inline const std::string& ChannelStatusMessage_ChannelStatus::_internal_local_uri() const {
+  return _impl_.local_uri_.Get();
+}
+inline void ChannelStatusMessage_ChannelStatus::_internal_set_local_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.local_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelStatusMessage_ChannelStatus::_internal_mutable_local_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.local_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelStatusMessage_ChannelStatus::release_local_uri() {
+  // @@protoc_insertion_point(field_release:ndn_message.ChannelStatusMessage.ChannelStatus.local_uri)
+  if (!_internal_has_local_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.local_uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ChannelStatusMessage_ChannelStatus::set_allocated_local_uri(std::string* local_uri) {
+  if (local_uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.local_uri_.SetAllocated(local_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_uri_.IsDefault()) {
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ChannelStatusMessage.ChannelStatus.local_uri)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelStatusMessage
+
+// repeated .ndn_message.ChannelStatusMessage.ChannelStatus channel_status = 130;
+inline int ChannelStatusMessage::_internal_channel_status_size() const {
+  return _impl_.channel_status_.size();
+}
+inline int ChannelStatusMessage::channel_status_size() const {
+  return _internal_channel_status_size();
+}
+inline void ChannelStatusMessage::clear_channel_status() {
+  _impl_.channel_status_.Clear();
+}
+inline ::ndn_message::ChannelStatusMessage_ChannelStatus* ChannelStatusMessage::mutable_channel_status(int index) {
+  // @@protoc_insertion_point(field_mutable:ndn_message.ChannelStatusMessage.channel_status)
+  return _impl_.channel_status_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ChannelStatusMessage_ChannelStatus >*
+ChannelStatusMessage::mutable_channel_status() {
+  // @@protoc_insertion_point(field_mutable_list:ndn_message.ChannelStatusMessage.channel_status)
+  return &_impl_.channel_status_;
+}
+inline const ::ndn_message::ChannelStatusMessage_ChannelStatus& ChannelStatusMessage::_internal_channel_status(int index) const {
+  return _impl_.channel_status_.Get(index);
+}
+inline const ::ndn_message::ChannelStatusMessage_ChannelStatus& ChannelStatusMessage::channel_status(int index) const {
+  // @@protoc_insertion_point(field_get:ndn_message.ChannelStatusMessage.channel_status)
+  return _internal_channel_status(index);
+}
+inline ::ndn_message::ChannelStatusMessage_ChannelStatus* ChannelStatusMessage::_internal_add_channel_status() {
+  return _impl_.channel_status_.Add();
+}
+inline ::ndn_message::ChannelStatusMessage_ChannelStatus* ChannelStatusMessage::add_channel_status() {
+  ::ndn_message::ChannelStatusMessage_ChannelStatus* _add = _internal_add_channel_status();
+  // @@protoc_insertion_point(field_add:ndn_message.ChannelStatusMessage.channel_status)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ndn_message::ChannelStatusMessage_ChannelStatus >&
+ChannelStatusMessage::channel_status() const {
+  // @@protoc_insertion_point(field_list:ndn_message.ChannelStatusMessage.channel_status)
+  return _impl_.channel_status_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_channel_2dstatus_2eproto
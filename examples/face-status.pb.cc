@@ -0,0 +1,1205 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: face-status.proto
+
+#include "face-status.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ndn_message {
+PROTOBUF_CONSTEXPR FaceStatusMessage_FaceStatus::FaceStatusMessage_FaceStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.local_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.face_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.expiration_period_)*/uint64_t{0u}
+  , /*decltype(_impl_.face_scope_)*/uint64_t{0u}
+  , /*decltype(_impl_.face_persistency_)*/uint64_t{0u}
+  , /*decltype(_impl_.link_type_)*/uint64_t{0u}
+  , /*decltype(_impl_.base_congestion_marking_interval_)*/uint64_t{0u}
+  , /*decltype(_impl_.default_congestion_threshold_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_in_interests_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_in_datas_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_out_interests_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_out_datas_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_in_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_out_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_in_nacks_)*/uint64_t{0u}
+  , /*decltype(_impl_.n_out_nacks_)*/uint64_t{0u}} {}
+struct FaceStatusMessage_FaceStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FaceStatusMessage_FaceStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FaceStatusMessage_FaceStatusDefaultTypeInternal() {}
+  union {
+    FaceStatusMessage_FaceStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FaceStatusMessage_FaceStatusDefaultTypeInternal _FaceStatusMessage_FaceStatus_default_instance_;
+PROTOBUF_CONSTEXPR FaceStatusMessage::FaceStatusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.face_status_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FaceStatusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FaceStatusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FaceStatusMessageDefaultTypeInternal() {}
+  union {
+    FaceStatusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FaceStatusMessageDefaultTypeInternal _FaceStatusMessage_default_instance_;
+}  // namespace ndn_message
+static ::_pb::Metadata file_level_metadata_face_2dstatus_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_face_2dstatus_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_face_2dstatus_2eproto = nullptr;
+
+const uint32_t TableStruct_face_2dstatus_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.face_id_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.local_uri_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.expiration_period_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.face_scope_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.face_persistency_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.link_type_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.base_congestion_marking_interval_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.default_congestion_threshold_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_in_interests_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_in_datas_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_in_nacks_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_out_interests_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_out_datas_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_out_nacks_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_in_bytes_),
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage_FaceStatus, _impl_.n_out_bytes_),
+  2,
+  0,
+  1,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  15,
+  11,
+  12,
+  16,
+  13,
+  14,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ndn_message::FaceStatusMessage, _impl_.face_status_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 23, -1, sizeof(::ndn_message::FaceStatusMessage_FaceStatus)},
+  { 40, -1, -1, sizeof(::ndn_message::FaceStatusMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ndn_message::_FaceStatusMessage_FaceStatus_default_instance_._instance,
+  &::ndn_message::_FaceStatusMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_face_2dstatus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021face-status.proto\022\013ndn_message\"\372\003\n\021Fac"
+  "eStatusMessage\022\?\n\013face_status\030\200\001 \003(\0132).n"
+  "dn_message.FaceStatusMessage.FaceStatus\032"
+  "\243\003\n\nFaceStatus\022\017\n\007face_id\030i \002(\004\022\013\n\003uri\030r"
+  " \002(\t\022\022\n\tlocal_uri\030\201\001 \002(\t\022\031\n\021expiration_p"
+  "eriod\030m \001(\004\022\023\n\nface_scope\030\204\001 \002(\004\022\031\n\020face"
+  "_persistency\030\205\001 \002(\004\022\022\n\tlink_type\030\206\001 \002(\004\022"
+  ")\n base_congestion_marking_interval\030\207\001 \001"
+  "(\004\022%\n\034default_congestion_threshold\030\210\001 \001("
+  "\004\022\027\n\016n_in_interests\030\220\001 \002(\004\022\023\n\nn_in_datas"
+  "\030\221\001 \002(\004\022\023\n\nn_in_nacks\030\227\001 \002(\004\022\030\n\017n_out_in"
+  "terests\030\222\001 \002(\004\022\024\n\013n_out_datas\030\223\001 \002(\004\022\024\n\013"
+  "n_out_nacks\030\230\001 \002(\004\022\023\n\nn_in_bytes\030\224\001 \002(\004\022"
+  "\024\n\013n_out_bytes\030\225\001 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_face_2dstatus_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_face_2dstatus_2eproto = {
+    false, false, 541, descriptor_table_protodef_face_2dstatus_2eproto,
+    "face-status.proto",
+    &descriptor_table_face_2dstatus_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_face_2dstatus_2eproto::offsets,
+    file_level_metadata_face_2dstatus_2eproto, file_level_enum_descriptors_face_2dstatus_2eproto,
+    file_level_service_descriptors_face_2dstatus_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_face_2dstatus_2eproto_getter() {
+  return &descriptor_table_face_2dstatus_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_face_2dstatus_2eproto(&descriptor_table_face_2dstatus_2eproto);
+namespace ndn_message {
+
+// ===================================================================
+
+class FaceStatusMessage_FaceStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FaceStatusMessage_FaceStatus>()._impl_._has_bits_);
+  static void set_has_face_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_local_uri(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_expiration_period(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_face_scope(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_face_persistency(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_link_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_base_congestion_marking_interval(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_default_congestion_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_n_in_interests(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_n_in_datas(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_n_in_nacks(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_n_out_interests(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_n_out_datas(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_n_out_nacks(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_n_in_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_n_out_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0001fe77) ^ 0x0001fe77) != 0;
+  }
+};
+
+FaceStatusMessage_FaceStatus::FaceStatusMessage_FaceStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FaceStatusMessage.FaceStatus)
+}
+FaceStatusMessage_FaceStatus::FaceStatusMessage_FaceStatus(const FaceStatusMessage_FaceStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FaceStatusMessage_FaceStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.face_id_){}
+    , decltype(_impl_.expiration_period_){}
+    , decltype(_impl_.face_scope_){}
+    , decltype(_impl_.face_persistency_){}
+    , decltype(_impl_.link_type_){}
+    , decltype(_impl_.base_congestion_marking_interval_){}
+    , decltype(_impl_.default_congestion_threshold_){}
+    , decltype(_impl_.n_in_interests_){}
+    , decltype(_impl_.n_in_datas_){}
+    , decltype(_impl_.n_out_interests_){}
+    , decltype(_impl_.n_out_datas_){}
+    , decltype(_impl_.n_in_bytes_){}
+    , decltype(_impl_.n_out_bytes_){}
+    , decltype(_impl_.n_in_nacks_){}
+    , decltype(_impl_.n_out_nacks_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uri()) {
+    _this->_impl_.uri_.Set(from._internal_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_local_uri()) {
+    _this->_impl_.local_uri_.Set(from._internal_local_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.face_id_, &from._impl_.face_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.n_out_nacks_) -
+    reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.n_out_nacks_));
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FaceStatusMessage.FaceStatus)
+}
+
+inline void FaceStatusMessage_FaceStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uri_){}
+    , decltype(_impl_.local_uri_){}
+    , decltype(_impl_.face_id_){uint64_t{0u}}
+    , decltype(_impl_.expiration_period_){uint64_t{0u}}
+    , decltype(_impl_.face_scope_){uint64_t{0u}}
+    , decltype(_impl_.face_persistency_){uint64_t{0u}}
+    , decltype(_impl_.link_type_){uint64_t{0u}}
+    , decltype(_impl_.base_congestion_marking_interval_){uint64_t{0u}}
+    , decltype(_impl_.default_congestion_threshold_){uint64_t{0u}}
+    , decltype(_impl_.n_in_interests_){uint64_t{0u}}
+    , decltype(_impl_.n_in_datas_){uint64_t{0u}}
+    , decltype(_impl_.n_out_interests_){uint64_t{0u}}
+    , decltype(_impl_.n_out_datas_){uint64_t{0u}}
+    , decltype(_impl_.n_in_bytes_){uint64_t{0u}}
+    , decltype(_impl_.n_out_bytes_){uint64_t{0u}}
+    , decltype(_impl_.n_in_nacks_){uint64_t{0u}}
+    , decltype(_impl_.n_out_nacks_){uint64_t{0u}}
+  };
+  _impl_.uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.local_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FaceStatusMessage_FaceStatus::~FaceStatusMessage_FaceStatus() {
+  // @@protoc_insertion_point(destructor:ndn_message.FaceStatusMessage.FaceStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FaceStatusMessage_FaceStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uri_.Destroy();
+  _impl_.local_uri_.Destroy();
+}
+
+void FaceStatusMessage_FaceStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FaceStatusMessage_FaceStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FaceStatusMessage.FaceStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.uri_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.local_uri_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.face_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.base_congestion_marking_interval_) -
+        reinterpret_cast<char*>(&_impl_.face_id_)) + sizeof(_impl_.base_congestion_marking_interval_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.default_congestion_threshold_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.n_in_nacks_) -
+        reinterpret_cast<char*>(&_impl_.default_congestion_threshold_)) + sizeof(_impl_.n_in_nacks_));
+  }
+  _impl_.n_out_nacks_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FaceStatusMessage_FaceStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 face_id = 105;
+      case 105:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_face_id(&has_bits);
+          _impl_.face_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 expiration_period = 109;
+      case 109:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_expiration_period(&has_bits);
+          _impl_.expiration_period_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string uri = 114;
+      case 114:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.FaceStatusMessage.FaceStatus.uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string local_uri = 129;
+      case 129:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_local_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ndn_message.FaceStatusMessage.FaceStatus.local_uri");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 face_scope = 132;
+      case 132:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_face_scope(&has_bits);
+          _impl_.face_scope_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 face_persistency = 133;
+      case 133:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_face_persistency(&has_bits);
+          _impl_.face_persistency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 link_type = 134;
+      case 134:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_link_type(&has_bits);
+          _impl_.link_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 base_congestion_marking_interval = 135;
+      case 135:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_base_congestion_marking_interval(&has_bits);
+          _impl_.base_congestion_marking_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 default_congestion_threshold = 136;
+      case 136:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_default_congestion_threshold(&has_bits);
+          _impl_.default_congestion_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_in_interests = 144;
+      case 144:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_n_in_interests(&has_bits);
+          _impl_.n_in_interests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_in_datas = 145;
+      case 145:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_n_in_datas(&has_bits);
+          _impl_.n_in_datas_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_out_interests = 146;
+      case 146:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_n_out_interests(&has_bits);
+          _impl_.n_out_interests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_out_datas = 147;
+      case 147:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_n_out_datas(&has_bits);
+          _impl_.n_out_datas_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_in_bytes = 148;
+      case 148:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_n_in_bytes(&has_bits);
+          _impl_.n_in_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_out_bytes = 149;
+      case 149:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_n_out_bytes(&has_bits);
+          _impl_.n_out_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_in_nacks = 151;
+      case 151:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _Internal::set_has_n_in_nacks(&has_bits);
+          _impl_.n_in_nacks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 n_out_nacks = 152;
+      case 152:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 192)) {
+          _Internal::set_has_n_out_nacks(&has_bits);
+          _impl_.n_out_nacks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FaceStatusMessage_FaceStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FaceStatusMessage.FaceStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 face_id = 105;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(105, this->_internal_face_id(), target);
+  }
+
+  // optional uint64 expiration_period = 109;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(109, this->_internal_expiration_period(), target);
+  }
+
+  // required string uri = 114;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_uri().data(), static_cast<int>(this->_internal_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.FaceStatusMessage.FaceStatus.uri");
+    target = stream->WriteStringMaybeAliased(
+        114, this->_internal_uri(), target);
+  }
+
+  // required string local_uri = 129;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_local_uri().data(), static_cast<int>(this->_internal_local_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ndn_message.FaceStatusMessage.FaceStatus.local_uri");
+    target = stream->WriteStringMaybeAliased(
+        129, this->_internal_local_uri(), target);
+  }
+
+  // required uint64 face_scope = 132;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(132, this->_internal_face_scope(), target);
+  }
+
+  // required uint64 face_persistency = 133;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(133, this->_internal_face_persistency(), target);
+  }
+
+  // required uint64 link_type = 134;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(134, this->_internal_link_type(), target);
+  }
+
+  // optional uint64 base_congestion_marking_interval = 135;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(135, this->_internal_base_congestion_marking_interval(), target);
+  }
+
+  // optional uint64 default_congestion_threshold = 136;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(136, this->_internal_default_congestion_threshold(), target);
+  }
+
+  // required uint64 n_in_interests = 144;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(144, this->_internal_n_in_interests(), target);
+  }
+
+  // required uint64 n_in_datas = 145;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(145, this->_internal_n_in_datas(), target);
+  }
+
+  // required uint64 n_out_interests = 146;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(146, this->_internal_n_out_interests(), target);
+  }
+
+  // required uint64 n_out_datas = 147;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(147, this->_internal_n_out_datas(), target);
+  }
+
+  // required uint64 n_in_bytes = 148;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(148, this->_internal_n_in_bytes(), target);
+  }
+
+  // required uint64 n_out_bytes = 149;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(149, this->_internal_n_out_bytes(), target);
+  }
+
+  // required uint64 n_in_nacks = 151;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(151, this->_internal_n_in_nacks(), target);
+  }
+
+  // required uint64 n_out_nacks = 152;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(152, this->_internal_n_out_nacks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FaceStatusMessage.FaceStatus)
+  return target;
+}
+
+size_t FaceStatusMessage_FaceStatus::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:ndn_message.FaceStatusMessage.FaceStatus)
+  size_t total_size = 0;
+
+  if (_internal_has_uri()) {
+    // required string uri = 114;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uri());
+  }
+
+  if (_internal_has_local_uri()) {
+    // required string local_uri = 129;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_local_uri());
+  }
+
+  if (_internal_has_face_id()) {
+    // required uint64 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_id());
+  }
+
+  if (_internal_has_face_scope()) {
+    // required uint64 face_scope = 132;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_scope());
+  }
+
+  if (_internal_has_face_persistency()) {
+    // required uint64 face_persistency = 133;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_persistency());
+  }
+
+  if (_internal_has_link_type()) {
+    // required uint64 link_type = 134;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_link_type());
+  }
+
+  if (_internal_has_n_in_interests()) {
+    // required uint64 n_in_interests = 144;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_interests());
+  }
+
+  if (_internal_has_n_in_datas()) {
+    // required uint64 n_in_datas = 145;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_datas());
+  }
+
+  if (_internal_has_n_out_interests()) {
+    // required uint64 n_out_interests = 146;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_interests());
+  }
+
+  if (_internal_has_n_out_datas()) {
+    // required uint64 n_out_datas = 147;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_datas());
+  }
+
+  if (_internal_has_n_in_bytes()) {
+    // required uint64 n_in_bytes = 148;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_bytes());
+  }
+
+  if (_internal_has_n_out_bytes()) {
+    // required uint64 n_out_bytes = 149;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_bytes());
+  }
+
+  if (_internal_has_n_in_nacks()) {
+    // required uint64 n_in_nacks = 151;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_nacks());
+  }
+
+  if (_internal_has_n_out_nacks()) {
+    // required uint64 n_out_nacks = 152;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_nacks());
+  }
+
+  return total_size;
+}
+size_t FaceStatusMessage_FaceStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FaceStatusMessage.FaceStatus)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0001fe77) ^ 0x0001fe77) == 0) {  // All required fields are present.
+    // required string uri = 114;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uri());
+
+    // required string local_uri = 129;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_local_uri());
+
+    // required uint64 face_id = 105;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_id());
+
+    // required uint64 face_scope = 132;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_scope());
+
+    // required uint64 face_persistency = 133;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_face_persistency());
+
+    // required uint64 link_type = 134;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_link_type());
+
+    // required uint64 n_in_interests = 144;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_interests());
+
+    // required uint64 n_in_datas = 145;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_datas());
+
+    // required uint64 n_out_interests = 146;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_interests());
+
+    // required uint64 n_out_datas = 147;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_datas());
+
+    // required uint64 n_in_bytes = 148;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_bytes());
+
+    // required uint64 n_out_bytes = 149;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_bytes());
+
+    // required uint64 n_in_nacks = 151;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_in_nacks());
+
+    // required uint64 n_out_nacks = 152;
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_n_out_nacks());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 expiration_period = 109;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_expiration_period());
+  }
+
+  // optional uint64 base_congestion_marking_interval = 135;
+  if (cached_has_bits & 0x00000080u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_base_congestion_marking_interval());
+  }
+
+  // optional uint64 default_congestion_threshold = 136;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_default_congestion_threshold());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FaceStatusMessage_FaceStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FaceStatusMessage_FaceStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FaceStatusMessage_FaceStatus::GetClassData() const { return &_class_data_; }
+
+
+void FaceStatusMessage_FaceStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FaceStatusMessage_FaceStatus*>(&to_msg);
+  auto& from = static_cast<const FaceStatusMessage_FaceStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FaceStatusMessage.FaceStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_uri(from._internal_uri());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_local_uri(from._internal_local_uri());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.face_id_ = from._impl_.face_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.expiration_period_ = from._impl_.expiration_period_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.face_scope_ = from._impl_.face_scope_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.face_persistency_ = from._impl_.face_persistency_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.link_type_ = from._impl_.link_type_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.base_congestion_marking_interval_ = from._impl_.base_congestion_marking_interval_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.default_congestion_threshold_ = from._impl_.default_congestion_threshold_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.n_in_interests_ = from._impl_.n_in_interests_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.n_in_datas_ = from._impl_.n_in_datas_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.n_out_interests_ = from._impl_.n_out_interests_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.n_out_datas_ = from._impl_.n_out_datas_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.n_in_bytes_ = from._impl_.n_in_bytes_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.n_out_bytes_ = from._impl_.n_out_bytes_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.n_in_nacks_ = from._impl_.n_in_nacks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_n_out_nacks(from._internal_n_out_nacks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FaceStatusMessage_FaceStatus::CopyFrom(const FaceStatusMessage_FaceStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FaceStatusMessage.FaceStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FaceStatusMessage_FaceStatus::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void FaceStatusMessage_FaceStatus::InternalSwap(FaceStatusMessage_FaceStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uri_, lhs_arena,
+      &other->_impl_.uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.local_uri_, lhs_arena,
+      &other->_impl_.local_uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FaceStatusMessage_FaceStatus, _impl_.n_out_nacks_)
+      + sizeof(FaceStatusMessage_FaceStatus::_impl_.n_out_nacks_)
+      - PROTOBUF_FIELD_OFFSET(FaceStatusMessage_FaceStatus, _impl_.face_id_)>(
+          reinterpret_cast<char*>(&_impl_.face_id_),
+          reinterpret_cast<char*>(&other->_impl_.face_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FaceStatusMessage_FaceStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_face_2dstatus_2eproto_getter, &descriptor_table_face_2dstatus_2eproto_once,
+      file_level_metadata_face_2dstatus_2eproto[0]);
+}
+
+// ===================================================================
+
+class FaceStatusMessage::_Internal {
+ public:
+};
+
+FaceStatusMessage::FaceStatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ndn_message.FaceStatusMessage)
+}
+FaceStatusMessage::FaceStatusMessage(const FaceStatusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FaceStatusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.face_status_){from._impl_.face_status_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ndn_message.FaceStatusMessage)
+}
+
+inline void FaceStatusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.face_status_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FaceStatusMessage::~FaceStatusMessage() {
+  // @@protoc_insertion_point(destructor:ndn_message.FaceStatusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FaceStatusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.face_status_.~RepeatedPtrField();
+}
+
+void FaceStatusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FaceStatusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ndn_message.FaceStatusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.face_status_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FaceStatusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ndn_message.FaceStatusMessage.FaceStatus face_status = 128;
+      case 128:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_face_status(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<1026>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FaceStatusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ndn_message.FaceStatusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.FaceStatusMessage.FaceStatus face_status = 128;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_face_status_size()); i < n; i++) {
+    const auto& repfield = this->_internal_face_status(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(128, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ndn_message.FaceStatusMessage)
+  return target;
+}
+
+size_t FaceStatusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ndn_message.FaceStatusMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ndn_message.FaceStatusMessage.FaceStatus face_status = 128;
+  total_size += 2UL * this->_internal_face_status_size();
+  for (const auto& msg : this->_impl_.face_status_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FaceStatusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FaceStatusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FaceStatusMessage::GetClassData() const { return &_class_data_; }
+
+
+void FaceStatusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FaceStatusMessage*>(&to_msg);
+  auto& from = static_cast<const FaceStatusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ndn_message.FaceStatusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.face_status_.MergeFrom(from._impl_.face_status_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FaceStatusMessage::CopyFrom(const FaceStatusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ndn_message.FaceStatusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FaceStatusMessage::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.face_status_))
+    return false;
+  return true;
+}
+
+void FaceStatusMessage::InternalSwap(FaceStatusMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.face_status_.InternalSwap(&other->_impl_.face_status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FaceStatusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_face_2dstatus_2eproto_getter, &descriptor_table_face_2dstatus_2eproto_once,
+      file_level_metadata_face_2dstatus_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ndn_message::FaceStatusMessage_FaceStatus*
+Arena::CreateMaybeMessage< ::ndn_message::FaceStatusMessage_FaceStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FaceStatusMessage_FaceStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ndn_message::FaceStatusMessage*
+Arena::CreateMaybeMessage< ::ndn_message::FaceStatusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ndn_message::FaceStatusMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
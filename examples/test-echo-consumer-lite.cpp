@@ -25,91 +25,55 @@
  * test-publish-async-nfd-lite .
  * This uses the API for NDN-CPP Lite instead of the full NDN-CPP. Note that
  * this does not use the C++ Standard Library, or exceptions, or virtual
- * methods or malloc (except in the sendInterest functions which you can
- * change to not use malloc). Therefore the lightweight C++ code maps
- * directly onto the inner pure C functions, but has advantages of C++ such as
- * namespaces, inheritance, overloaded methods, "this" pointers, and calling
- * destructors automatically.
+ * methods or malloc. Therefore the lightweight C++ code maps directly onto the
+ * inner pure C functions, but has advantages of C++ such as namespaces,
+ * inheritance, overloaded methods, "this" pointers, and calling destructors
+ * automatically.
  */
 
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #include <ndn-cpp/lite/transport/tcp-transport-lite.hpp>
-#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
-#include <ndn-cpp/lite/util/dynamic-malloc-uint8-array-lite.hpp>
+#include <ndn-cpp/lite/face-lite.hpp>
 
 using namespace ndn;
 
 /**
- * The ElementReceiver class extends ElementListenerLite and has an
- * onReceivedElement to process the incoming Data packet.
+ * The Counter class holds the count of callbacks, which is passed as the
+ * context to the FaceLite callbacks.
  */
-class ElementReceiver : public ElementListenerLite {
+class Counter {
 public:
-  /**
-   * Create an ElementReceiver.
-   * @param originalInterest The original Interest so that onReceivedElement can
-   * check if the incoming Data packet matches. This does not make a copy; the
-   * referenced object must remain valid.
-   */
-  ElementReceiver(const InterestLite& originalInterest)
-  : ElementListenerLite(&onReceivedElementWrapper),
-    originalInterest_(originalInterest),
-    callbackCount_(0)
+  Counter()
+  : callbackCount_(0)
   {
   }
 
   /**
-   * This is called when an entire packet is received. If this is a Data packet
-   * for the original Interest that was sent, display its name and content.
-   * @param element pointer to the element. This buffer is only valid during
-   * this call.  If you need the data later, you must copy.
-   * @param elementLength length of element
+   * This is called by FaceLite when the Data packet for the Interest is
+   * received. Display its name and content.
    */
-  void
-  onReceivedElement(const uint8_t *element, size_t elementLength);
-
-  int callbackCount_;
-
-private:
-  const InterestLite& originalInterest_;
+  static void
+  onData
+    (FaceLite& face, const InterestLite& interest, const DataLite& data,
+     void* context);
 
+  /**
+   * This is called by FaceLite when the Interest times out.
+   */
   static void
-  onReceivedElementWrapper
-    (ElementListenerLite *self, const uint8_t *element, size_t elementLength);
+  onTimeout(FaceLite& face, const InterestLite& interest, void* context);
+
+  int callbackCount_;
 };
 
 void
-ElementReceiver::onReceivedElement(const uint8_t *element, size_t elementLength)
+Counter::onData
+  (FaceLite& face, const InterestLite& interest, const DataLite& data,
+   void* context)
 {
-  if (*element != 6)
-    // Not a TLV Data packet.
-    return;
-
-  // Reserve space for a large maximum number of name components. If you know
-  // your application requires less, you can use a smaller maximum.
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent keyNameComponents[100];
-  DataLite data
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]),
-     keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
-
-  size_t signedPortionBeginOffset;
-  size_t signedPortionEndOffset;
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeData
-       (data, element, elementLength, &signedPortionBeginOffset,
-        &signedPortionEndOffset))) {
-    printf("Error decoding data: %s\n", ndn_getErrorString(error));
-    return;
-  }
-
-  if (!originalInterest_.getName().match(data.getName()))
-    // We got a Data packet that is not for us.
-    return;
-
-  ++callbackCount_;
+  ++((Counter*)context)->callbackCount_;
   printf("Got data packet with name ");
   for (size_t iComponent = 0; iComponent < data.getName().size(); ++iComponent) {
     printf("/");
@@ -125,16 +89,13 @@ ElementReceiver::onReceivedElement(const uint8_t *element, size_t elementLength)
 }
 
 void
-ElementReceiver::onReceivedElementWrapper
-  (ElementListenerLite *self, const uint8_t *element, size_t elementLength)
+Counter::onTimeout
+  (FaceLite& face, const InterestLite& interest, void* context)
 {
-  // Simply call the onReceivedElement method.
-  ((ElementReceiver*)self)->onReceivedElement(element, elementLength);
+  ++((Counter*)context)->callbackCount_;
+  printf("Time out for interest\n");
 }
 
-ndn_Error
-sendInterest(const InterestLite& interest, TcpTransportLite& transport);
-
 int
 main(int argc, char** argv)
 {
@@ -161,32 +122,38 @@ main(int argc, char** argv)
     (elementBufferBytes, sizeof(elementBufferBytes), 0);
   TcpTransportLite transport(elementBuffer);
 
-  // Set up the ElementReceiver to receive the Data packet and connect.
-  ElementReceiver elementReceiver(interest);
+  // Create the FaceLite with a pending interest table for one Interest. This
+  // doesn't receive Interests or use callLater, so omit those tables. Set the
+  // encoding buffer smaller if you expect a smaller max encoding size.
+  FaceLite::PendingInterest pendingInterestTable[1];
+  uint8_t encodingBuffer[MAX_NDN_PACKET_SIZE];
+  FaceLite face
+    (transport, pendingInterestTable,
+     sizeof(pendingInterestTable) / sizeof(pendingInterestTable[0]), 0, 0, 0,
+     0, encodingBuffer, sizeof(encodingBuffer));
+
+  // The FaceLite is the element listener which receives the Data packet.
   ndn_Error error;
-  if ((error = transport.connect("localhost", 6363, elementReceiver))) {
+  if ((error = transport.connect("localhost", 6363, face))) {
     printf("Error in transport connect: %s\n", ndn_getErrorString(error));
     return error;
   }
 
   printf("Express name testecho/%s\n", word);
 
-  if ((error = sendInterest(interest, transport))) {
-    printf("Error in sendInterest: %s\n", ndn_getErrorString(error));
+  Counter counter;
+  if ((error = face.expressInterest
+       (interest, &Counter::onData, &Counter::onTimeout, 0, &counter, 0))) {
+    printf("Error in expressInterest: %s\n", ndn_getErrorString(error));
     return error;
   }
 
-  // The main event loop. 
-  // We're not using the Pending Interest Table in the main NDN-CPP Face object,
-  // so there is no automatic check for timeout. To keep this example
-  // lightweight, we loop forever waiting for the Data packet. To check for
-  // timeout, we could use ndn_getNowMilliseconds() to get the start time, then
-  // check the elapsed time with ndn_getNowMilliseconds() in the loop.
-  while (elementReceiver.callbackCount_ < 1) {
+  // The main event loop.
+  while (counter.callbackCount_ < 1) {
     // processEvents will use whatever buffer size is provided. A larger buffer
     // is more efficient but takes more memory.
     uint8_t buffer[1000];
-    if ((error = transport.processEvents(buffer, sizeof(buffer)))) {
+    if ((error = face.processEvents(buffer, sizeof(buffer)))) {
       printf("Error in processEvents: %s\n", ndn_getErrorString(error));
       return error;
     }
@@ -199,37 +166,3 @@ main(int argc, char** argv)
 
   return 0;
 }
-
-/**
- * Encode the interest and send it through the transport.
- * @param interest The Interest to encode and send.
- * @param transport This calls transport.send.
- * @return 0 for success, else an error code.
- */
-ndn_Error
-sendInterest(const InterestLite& interest, TcpTransportLite& transport)
-{
-  // Here we use a DynamicMallocUInt8ArrayLite. If your platform doesn't support
-  // malloc then set "#if 0" to use DynamicUInt8ArrayLite directly with a
-  // fixed-size array.
-#if 1
-  DynamicMallocUInt8ArrayLite encoding(50);
-#else
-  // Set this smaller if you expect a smaller max encoding size.
-  uint8_t encodingBuffer[MAX_NDN_PACKET_SIZE];
-  DynamicUInt8ArrayLite encoding(encodingBuffer, sizeof(encodingBuffer), 0);
-#endif
-
-  ndn_Error error;
-  size_t encodingLength;
-  size_t dummySignedPortionBeginOffset, dummySignedPortionEndOffset;
-  if ((error = Tlv0_2WireFormatLite::encodeInterest
-       (interest, &dummySignedPortionBeginOffset, &dummySignedPortionEndOffset,
-        encoding, &encodingLength)))
-    return error;
-
-  if ((error = transport.send(encoding.getArray(), encodingLength)))
-    return error;
-
-  return NDN_ERROR_success;
-}
@@ -0,0 +1,306 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+/**
+ * This benchmarks two Face objects in one process which exchange Interest and
+ * Data packets through a LoopbackForwarder, so that it doesn't need NFD. The
+ * results include the encoding, the forwarder and the Face dispatch, but not
+ * the network.
+ */
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <vector>
+#include <sys/time.h>
+#include <ndn-cpp/face.hpp>
+#include <ndn-cpp/security/key-chain.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+static double
+getNowSeconds()
+{
+  struct timeval t;
+  gettimeofday(&t, 0);
+  return t.tv_sec + t.tv_usec / 1000000.0;
+}
+
+/**
+ * The Producer answers each Interest with a Data packet which has a fixed
+ * content, signed with a SHA-256 digest so that signing doesn't dominate the
+ * results. If isDeferred is true, it saves the Interest names for
+ * putPendingData instead.
+ */
+class Producer {
+public:
+  Producer(KeyChain& keyChain, size_t contentSize)
+  : keyChain_(keyChain), content_(vector<uint8_t>(contentSize, 'x')),
+    isDeferred_(false), onInterestCallCount_(0)
+  {
+  }
+
+  void
+  onInterest
+    (const ptr_lib::shared_ptr<const Name>& prefix,
+     const ptr_lib::shared_ptr<const Interest>& interest, Face& face,
+     uint64_t interestFilterId,
+     const ptr_lib::shared_ptr<const InterestFilter>& filter)
+  {
+    ++onInterestCallCount_;
+    if (isDeferred_) {
+      pendingNames_.push_back(interest->getName());
+      return;
+    }
+
+    Data data(interest->getName());
+    data.setContent(content_);
+    keyChain_.signWithSha256(data);
+    face.putData(data);
+  }
+
+  KeyChain& keyChain_;
+  Blob content_;
+  bool isDeferred_;
+  int onInterestCallCount_;
+  vector<Name> pendingNames_;
+};
+
+class Consumer {
+public:
+  Consumer()
+  : onDataCallCount_(0), onTimeoutCallCount_(0)
+  {
+  }
+
+  void
+  onData(const ptr_lib::shared_ptr<const Interest>& interest,
+         const ptr_lib::shared_ptr<Data>& data)
+  {
+    ++onDataCallCount_;
+  }
+
+  void
+  onTimeout(const ptr_lib::shared_ptr<const Interest>& interest)
+  {
+    ++onTimeoutCallCount_;
+  }
+
+  int onDataCallCount_;
+  int onTimeoutCallCount_;
+};
+
+static void
+onRegisterFailed(const ptr_lib::shared_ptr<const Name>& prefix)
+{
+  // Face catches exceptions from callbacks, so exit instead of throwing.
+  cout << "Register failed for prefix " << prefix->toUri() << endl;
+  exit(1);
+}
+
+static void
+onRegisterSuccess
+  (const ptr_lib::shared_ptr<const Name>& prefix, uint64_t registeredPrefixId,
+   bool* isRegistered)
+{
+  *isRegistered = true;
+}
+
+static Name
+makeInterestName(const Name& prefix, int sequenceNo)
+{
+  // Use a timestamp so that runs don't share names.
+  static uint64_t runId = (uint64_t)(getNowSeconds() * 1000000.0);
+  return Name(prefix).appendVersion(runId).appendSequenceNumber(sequenceNo);
+}
+
+/**
+ * Express one Interest at a time and wait for the Data before expressing the
+ * next, which measures the expressInterest to onData round trip.
+ * @param nIterations The number of Interests to express.
+ * @return The number of seconds for all iterations.
+ */
+static double
+benchmarkRoundTripSeconds
+  (int nIterations, Face& consumerFace, Face& producerFace, const Name& prefix)
+{
+  Consumer consumer;
+  double start = getNowSeconds();
+  for (int i = 0; i < nIterations; ++i) {
+    consumerFace.expressInterest
+      (makeInterestName(prefix, i), bind(&Consumer::onData, &consumer, _1, _2),
+       bind(&Consumer::onTimeout, &consumer, _1));
+
+    while (consumer.onDataCallCount_ + consumer.onTimeoutCallCount_ <= i) {
+      producerFace.processEvents();
+      consumerFace.processEvents();
+    }
+  }
+  double finish = getNowSeconds();
+
+  if (consumer.onDataCallCount_ != nIterations)
+    throw runtime_error("benchmarkRoundTripSeconds: Did not receive all Data");
+  return finish - start;
+}
+
+/**
+ * Keep up to windowSize Interests outstanding, which measures the throughput.
+ * @param nIterations The number of Interests to express.
+ * @param windowSize The maximum number of outstanding Interests.
+ * @return The number of seconds for all iterations.
+ */
+static double
+benchmarkThroughputSeconds
+  (int nIterations, int windowSize, Face& consumerFace, Face& producerFace,
+   const Name& prefix)
+{
+  Consumer consumer;
+  int nExpressed = 0;
+  double start = getNowSeconds();
+  while (consumer.onDataCallCount_ + consumer.onTimeoutCallCount_ <
+         nIterations) {
+    while (nExpressed < nIterations &&
+           nExpressed - consumer.onDataCallCount_ -
+             consumer.onTimeoutCallCount_ < windowSize) {
+      consumerFace.expressInterest
+        (makeInterestName(prefix, nExpressed),
+         bind(&Consumer::onData, &consumer, _1, _2),
+         bind(&Consumer::onTimeout, &consumer, _1));
+      ++nExpressed;
+    }
+
+    producerFace.processEvents();
+    consumerFace.processEvents();
+  }
+  double finish = getNowSeconds();
+
+  if (consumer.onDataCallCount_ != nIterations)
+    throw runtime_error("benchmarkThroughputSeconds: Did not receive all Data");
+  return finish - start;
+}
+
+/**
+ * Have the consumer express nIterations Interests and let the producer save
+ * them, then time only the producer's calls to putData.
+ * @param nIterations The number of Data packets to put.
+ * @return The number of seconds for the calls to putData.
+ */
+static double
+benchmarkPutDataSeconds
+  (int nIterations, Face& consumerFace, Face& producerFace, Producer& producer,
+   const Name& prefix)
+{
+  Consumer consumer;
+  producer.isDeferred_ = true;
+  producer.pendingNames_.clear();
+  for (int i = 0; i < nIterations; ++i)
+    consumerFace.expressInterest
+      (makeInterestName(prefix, i), bind(&Consumer::onData, &consumer, _1, _2),
+       bind(&Consumer::onTimeout, &consumer, _1));
+  while ((int)producer.pendingNames_.size() < nIterations)
+    producerFace.processEvents();
+  producer.isDeferred_ = false;
+
+  // Prepare the Data packets so that the timing only includes putData.
+  vector<ptr_lib::shared_ptr<Data> > dataList;
+  for (size_t i = 0; i < producer.pendingNames_.size(); ++i) {
+    ptr_lib::shared_ptr<Data> data(new Data(producer.pendingNames_[i]));
+    data->setContent(producer.content_);
+    producer.keyChain_.signWithSha256(*data);
+    dataList.push_back(data);
+  }
+
+  double start = getNowSeconds();
+  for (size_t i = 0; i < dataList.size(); ++i)
+    producerFace.putData(*dataList[i]);
+  double finish = getNowSeconds();
+
+  while (consumer.onDataCallCount_ + consumer.onTimeoutCallCount_ < nIterations)
+    consumerFace.processEvents();
+  if (consumer.onDataCallCount_ != nIterations)
+    throw runtime_error("benchmarkPutDataSeconds: Did not receive all Data");
+  return finish - start;
+}
+
+int
+main(int argc, char** argv)
+{
+  try {
+    ptr_lib::shared_ptr<LoopbackForwarder> forwarder(new LoopbackForwarder());
+    Face consumerFace
+      (ptr_lib::make_shared<LoopbackTransport>(),
+       ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>(forwarder));
+    Face producerFace
+      (ptr_lib::make_shared<LoopbackTransport>(),
+       ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>(forwarder));
+
+    KeyChain keyChain("pib-memory:", "tpm-memory:");
+    keyChain.createIdentityV2(Name("/benchmark/identity"));
+    producerFace.setCommandSigningInfo
+      (keyChain, keyChain.getDefaultCertificateName());
+
+    Name prefix("/benchmark/loopback");
+    Producer producer(keyChain, 100);
+    bool isRegistered = false;
+    producerFace.registerPrefix
+      (prefix,
+       bind(&Producer::onInterest, &producer, _1, _2, _3, _4, _5),
+       onRegisterFailed, bind(&onRegisterSuccess, _1, _2, &isRegistered));
+    while (!isRegistered)
+      producerFace.processEvents();
+
+    {
+      int nIterations = 50000;
+      double duration = benchmarkRoundTripSeconds
+        (nIterations, consumerFace, producerFace, prefix);
+      cout << "expressInterest to onData round trip: Duration sec, Hz: "
+           << duration << ", " << (nIterations / duration)
+           << ", mean RTT usec: " << (duration * 1000000.0 / nIterations)
+           << endl;
+    }
+    {
+      int nIterations = 100000;
+      int windowSize = 100;
+      double duration = benchmarkThroughputSeconds
+        (nIterations, windowSize, consumerFace, producerFace, prefix);
+      cout << "Interest/Data throughput, window " << windowSize
+           << ": Duration sec, Hz: " << duration << ", "
+           << (nIterations / duration) << endl;
+    }
+    {
+      // The consumer Face checks each Data against all its pending Interests,
+      // so keep this small.
+      int nIterations = 2000;
+      double duration = benchmarkPutDataSeconds
+        (nIterations, consumerFace, producerFace, producer, prefix);
+      cout << "putData: Duration sec, Hz: " << duration << ", "
+           << (nIterations / duration) << endl;
+    }
+  } catch (std::exception& e) {
+    cout << "exception: " << e.what() << endl;
+  }
+  return 0;
+}
@@ -69,6 +69,13 @@ public:
   const ndn::Blob&
   getOther() const { return other_; }
 
+  /**
+   * Get the total size of the segmented content.
+   * @return The content size in bytes. If not specified, return 0.
+   */
+  uint64_t
+  getContentSize() const { return contentSize_; }
+
   /**
    * Set the content type.
    * @param contentType The content type.
@@ -117,6 +124,19 @@ public:
     return *this;
   }
 
+  /**
+   * Set the total size of the segmented content. A fetcher can use this to
+   * preallocate the buffer for the content.
+   * @param contentSize The content size in bytes, or 0 if not specified.
+   * @return This ContentMetaInfo so that you can chain calls to update values.
+   */
+  ContentMetaInfo&
+  setContentSize(uint64_t contentSize)
+  {
+    contentSize_ = contentSize;
+    return *this;
+  }
+
   /**
    * Set all the fields to their default unspecified values.
    */
@@ -163,6 +183,7 @@ private:
   ndn::MillisecondsSince1970 timestamp_;
   bool hasSegments_;
   ndn::Blob other_;
+  uint64_t contentSize_;
 };
 
 }
@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_GENERALIZED_CONTENT_PUBLISHER_HPP
+#define NDN_GENERALIZED_CONTENT_PUBLISHER_HPP
+
+#include <list>
+#include <map>
+#include <ndn-cpp/face.hpp>
+#include <ndn-cpp/security/key-chain.hpp>
+#include "content-meta-info.hpp"
+
+namespace ndntools {
+
+/**
+ * GeneralizedContentPublisher serves the _meta packet and the segments of a
+ * file as Generalized Content, in the same format as
+ * GeneralizedContent::publish. Unlike publish, this does not load the whole
+ * content into memory or sign every segment up front. It keeps the file open,
+ * reads and signs a segment Data packet when it is first requested, and keeps
+ * only a bounded number of the most recently used signed segments. The _meta
+ * packet is signed in the constructor so that it is served immediately. If the
+ * file is truncated while it is published, a request for a missing segment
+ * fails and is logged by onInterest.
+ * Use onInterest as the OnInterestCallback for Face::registerPrefix or
+ * Face::setInterestFilter, or as the onDataNotFound callback for
+ * MemoryContentCache::registerPrefix.
+ * @note The support for GeneralizedContent is experimental and the API is not finalized.
+ */
+class GeneralizedContentPublisher {
+public:
+  /**
+   * Create a GeneralizedContentPublisher for the file and sign the _meta packet.
+   * @param prefix The Name prefix for the published Data packets.
+   * @param freshnessPeriod The freshness period in milliseconds for the packets.
+   * @param signingKeyChain This calls signingKeyChain.sign to sign the _meta
+   * packet and signingKeyChain.signWithSha256 for the segments. This does not
+   * make a copy of the KeyChain; the object must remain valid for the life of
+   * this object. If signingKeyChain is null, the packets are not signed.
+   * @param signingCertificateName The certificate name of the key used to sign
+   * the _meta packet. If this is an empty Name, use the default certificate.
+   * @param metaInfo The ContentMetaInfo for the _meta packet. If
+   * metaInfo.getHasSegments() is false then only the _meta packet is served.
+   * @param filePath The path of the file with the content to publish.
+   * @param contentSegmentSize The the number of bytes for each segment of the
+   * content. The final segment may be smaller than this.
+   * @param maxSignedSegmentCount (optional) The maximum number of signed
+   * segment Data packets to keep. When this is exceeded, discard the least
+   * recently used segment. If omitted, use 64.
+   * @throws runtime_error if the file can't be opened or its size doesn't fit
+   * in a size_t, or if contentSegmentSize is zero.
+   */
+  GeneralizedContentPublisher
+    (const ndn::Name& prefix, ndn::Milliseconds freshnessPeriod,
+     ndn::KeyChain* signingKeyChain, const ndn::Name& signingCertificateName,
+     const ContentMetaInfo& metaInfo, const std::string& filePath,
+     size_t contentSegmentSize, size_t maxSignedSegmentCount = 64);
+
+  /**
+   * Close the file.
+   */
+  ~GeneralizedContentPublisher();
+
+  /**
+   * If the Interest is for the _meta packet or a segment, send the Data packet
+   * with face.putData, creating and signing the segment if it is not already
+   * cached. Otherwise do nothing. This has the signature of an
+   * OnInterestCallback so that it can be used with bind, for example
+   * bind(&GeneralizedContentPublisher::onInterest, &publisher, _1, _2, _3, _4, _5) .
+   */
+  void
+  onInterest
+    (const ndn::ptr_lib::shared_ptr<const ndn::Name>& prefix,
+     const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest,
+     ndn::Face& face, uint64_t interestFilterId,
+     const ndn::ptr_lib::shared_ptr<const ndn::InterestFilter>& filter);
+
+  /**
+   * Get the Data packet which answers the Interest.
+   * @param interest The Interest for the _meta packet or a segment.
+   * @return The _meta packet or the segment Data packet, or null if the
+   * Interest doesn't match. If the Interest name is the prefix, return the
+   * first segment, or the final segment if the ChildSelector is 1.
+   */
+  ndn::ptr_lib::shared_ptr<ndn::Data>
+  getData(const ndn::Interest& interest);
+
+  /**
+   * Get the segment Data packet, creating and signing it if it is not cached.
+   * @param segmentNumber The segment number.
+   * @return The segment Data packet, or null if segmentNumber is not less than
+   * getSegmentCount().
+   * @throws runtime_error if the segment can't be read from the file, for
+   * example if the file was truncated.
+   */
+  ndn::ptr_lib::shared_ptr<ndn::Data>
+  getSegment(uint64_t segmentNumber);
+
+  /**
+   * Get the signed _meta Data packet.
+   * @return The _meta Data packet.
+   */
+  const ndn::ptr_lib::shared_ptr<ndn::Data>&
+  getMetaData() const { return metaData_; }
+
+  /**
+   * Get the number of segments, which is zero if metaInfo.getHasSegments() is
+   * false or the file is empty.
+   * @return The number of segments.
+   */
+  uint64_t
+  getSegmentCount() const { return segmentCount_; }
+
+  /**
+   * Get the number of signed segment Data packets currently cached.
+   * @return The number of cached segments.
+   */
+  size_t
+  getCachedSegmentCount() const { return segmentCache_.size(); }
+
+private:
+  typedef std::list<std::pair<uint64_t, ndn::ptr_lib::shared_ptr<ndn::Data> > >
+    SegmentList;
+
+  /**
+   * Open the file and set fileDescriptor_, contentSize_, segmentCount_ and
+   * finalBlockId_.
+   */
+  void
+  openFile(const std::string& filePath);
+
+  /**
+   * Read the segment from the file and make and sign the Data packet.
+   */
+  ndn::ptr_lib::shared_ptr<ndn::Data>
+  makeSegment(uint64_t segmentNumber);
+
+  // Disable the copy constructor and assignment operator.
+  GeneralizedContentPublisher(const GeneralizedContentPublisher& other);
+  GeneralizedContentPublisher& operator=(const GeneralizedContentPublisher& other);
+
+  ndn::Name prefix_;
+  ndn::Milliseconds freshnessPeriod_;
+  ndn::KeyChain* signingKeyChain_;
+  size_t contentSegmentSize_;
+  size_t maxSignedSegmentCount_;
+  ndn::ptr_lib::shared_ptr<ndn::Data> metaData_;
+  ndn::Name::Component finalBlockId_;
+  int fileDescriptor_;
+  size_t contentSize_;
+  uint64_t segmentCount_;
+  // The most recently used segment is at the front.
+  SegmentList segmentLru_;
+  std::map<uint64_t, SegmentList::iterator> segmentCache_;
+};
+
+}
+
+#endif
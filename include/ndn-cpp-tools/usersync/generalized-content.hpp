@@ -22,6 +22,7 @@
 #ifndef NDN_GENERALIZED_CONTENT_HPP
 #define NDN_GENERALIZED_CONTENT_HPP
 
+#include <map>
 #include <ndn-cpp/face.hpp>
 #include <ndn-cpp/util/segment-fetcher.hpp>
 #include <ndn-cpp/util/memory-content-cache.hpp>
@@ -42,9 +43,18 @@ public:
     DATA_HAS_NO_SEGMENT = 2,
     SEGMENT_VERIFICATION_FAILED = 3,
 
-    META_INFO_DECODING_FAILED = 4
+    META_INFO_DECODING_FAILED = 4,
+    CONTENT_SIZE_MISMATCH = 5,
+    OUTPUT_FILE_ERROR = 6,
+    NETWORK_NACK = 7
   };
 
+  /**
+   * The number of times fetchParallel re-expresses a segment Interest which
+   * times out before calling onError with INTEREST_TIMEOUT.
+   */
+  static const int MAX_SEGMENT_RETRIES = 3;
+
   typedef ndn::func_lib::function<void
     (const ndn::ptr_lib::shared_ptr<ContentMetaInfo>& metaInfo,
      const ndn::Blob& content)> OnComplete;
@@ -116,18 +126,80 @@ public:
      const OnComplete& onComplete, const OnError& onError,
      ndn::Milliseconds interestLifetimeMilliseconds = 4000.0);
 
+  /**
+   * Initiate meta info and segmented content fetching like fetch, but keep
+   * up to maxOutstandingInterests segment Interests outstanding at once. The
+   * ContentSize in the _meta info is used to preallocate the content buffer
+   * (or the output file) and each segment is written in place as it arrives,
+   * so there is no final concatenation copy. This first fetches segment 0 to
+   * learn the segment size, then fetches the remaining segments in parallel.
+   * The output is only allocated after the FinalBlockId of segment 0 confirms
+   * the ContentSize, so a bad _meta packet can't make this allocate more than
+   * the segments hold. A segment Interest which times out is re-expressed up
+   * to MAX_SEGMENT_RETRIES times. If the _meta info has no ContentSize then
+   * this falls back to fetching one segment at a time as in fetch.
+   * @param face This calls face.expressInterest to fetch the _meta info and
+   * segments.
+   * @param prefix The prefix of the Data packets before the _meta or segment
+   * number components.
+   * @param validatorKeyChain When a Data packet is received this calls
+   * validatorKeyChain->verifyData(data). If validation fails then abort
+   * fetching and call onError with SEGMENT_VERIFICATION_FAILED. This does not
+   * make a copy of the KeyChain; the object must remain valid while fetching.
+   * If validatorKeyChain is null, this does not validate the data packet.
+   * @param onComplete When all segments are received, call
+   * onComplete(metaInfo, content) where metaInfo is the decoded ContentMetaInfo
+   * object and content is the fetched content. If outputFilePath is not empty,
+   * the content is in the file and content is null.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onError Call onError(errorCode, message) for timeout or an error
+   * processing segments. CONTENT_SIZE_MISMATCH means that the segments don't
+   * agree with the ContentSize in the _meta info, including when segment 0
+   * has no FinalBlockId. OUTPUT_FILE_ERROR means that the output file can't be
+   * created or mapped. NETWORK_NACK means that a segment Interest got a
+   * network Nack. On error, this removes the outstanding segment Interests.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param interestLifetimeMilliseconds The Interest lifetime in milliseconds
+   * for fetching the _meta info and segments.
+   * @param maxOutstandingInterests The maximum number of segment Interests to
+   * keep outstanding.
+   * @param outputFilePath (optional) If not empty, create or truncate this file
+   * to the content size, memory-map it and write the segments into it instead
+   * of into memory. If omitted, fetch into a memory buffer.
+   */
+  static void
+  fetchParallel
+    (ndn::Face& face, const ndn::Name& prefix, ndn::KeyChain* validatorKeyChain,
+     const OnComplete& onComplete, const OnError& onError,
+     ndn::Milliseconds interestLifetimeMilliseconds,
+     size_t maxOutstandingInterests, const std::string& outputFilePath = "");
+
+  ~GeneralizedContent();
+
 private:
   /**
    * Create a new GeneralizedContent to use the Face. See the static fetch method
-   * for details. After creating the SegmentFetcher, call fetchMetaInfo.
+   * for details. If maxOutstandingInterests is zero, use SegmentFetcher,
+   * otherwise see fetchParallel. After creating the GeneralizedContent, call
+   * fetchMetaInfo.
    */
   GeneralizedContent
     (ndn::Face& face, const ndn::Name& prefix, ndn::KeyChain* validatorKeyChain,
      const OnComplete& onComplete, const OnError& onError,
-     ndn::Milliseconds interestLifetimeMilliseconds)
+     ndn::Milliseconds interestLifetimeMilliseconds,
+     size_t maxOutstandingInterests = 0,
+     const std::string& outputFilePath = "")
   : face_(face), prefix_(prefix), validatorKeyChain_(validatorKeyChain),
     onComplete_(onComplete), onError_(onError),
-    interestLifetimeMilliseconds_(interestLifetimeMilliseconds)
+    interestLifetimeMilliseconds_(interestLifetimeMilliseconds),
+    maxOutstandingInterests_(maxOutstandingInterests),
+    outputFilePath_(outputFilePath), output_(0), contentSize_(0),
+    isOutputMapped_(false), segmentSize_(0), segmentCount_(0),
+    nextSegmentNumber_(0), receivedSegmentCount_(0), isFinished_(false)
   {
   }
 
@@ -149,6 +221,64 @@ private:
   onSegmentFetcherError
     (ndn::SegmentFetcher::ErrorCode errorCode, const std::string& message);
 
+  /**
+   * Check the ContentSize in the _meta info and fetch segment 0.
+   */
+  void
+  startParallelFetch();
+
+  /**
+   * Allocate the output for contentSize_ bytes. If this can't create the
+   * output file, call abortParallelFetch.
+   * @return True for success, false if aborted.
+   */
+  bool
+  allocateOutput();
+
+  /**
+   * Express Interests for more segments until there are
+   * maxOutstandingInterests_ outstanding or all segments are requested.
+   */
+  void
+  fetchMoreSegments();
+
+  void
+  expressSegmentInterest(uint64_t segmentNumber);
+
+  void
+  onParallelSegmentReceived
+    (const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest,
+     const ndn::ptr_lib::shared_ptr<ndn::Data>& data);
+
+  void
+  onParallelSegmentVerified(const ndn::ptr_lib::shared_ptr<ndn::Data>& data);
+
+  void
+  onParallelSegmentValidationFailed
+    (const ndn::ptr_lib::shared_ptr<ndn::Data>& data, const std::string& reason);
+
+  void
+  onParallelSegmentTimeout
+    (const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest);
+
+  void
+  onParallelSegmentNetworkNack
+    (const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest,
+     const ndn::ptr_lib::shared_ptr<ndn::NetworkNack>& networkNack);
+
+  /**
+   * Set isFinished_, remove the outstanding segment Interests, release the
+   * output and call onError_.
+   */
+  void
+  abortParallelFetch(ErrorCode errorCode, const std::string& message);
+
+  /**
+   * Unmap the output file if it is mapped.
+   */
+  void
+  releaseOutput();
+
   ndn::Face& face_;
   ndn::Name prefix_;
   ndn::KeyChain* validatorKeyChain_;
@@ -156,6 +286,26 @@ private:
   OnError onError_;
   ndn::Milliseconds interestLifetimeMilliseconds_;
   ndn::ptr_lib::shared_ptr<ContentMetaInfo> metaInfo_;
+
+  // The following are used by fetchParallel.
+  size_t maxOutstandingInterests_;
+  std::string outputFilePath_;
+  ndn::ptr_lib::shared_ptr<std::vector<uint8_t> > contentBuffer_;
+  // output_ points into contentBuffer_ or the mapped output file.
+  uint8_t* output_;
+  size_t contentSize_;
+  bool isOutputMapped_;
+  size_t segmentSize_;
+  uint64_t segmentCount_;
+  uint64_t nextSegmentNumber_;
+  uint64_t receivedSegmentCount_;
+  // The key is the segment number and the value is the pending Interest ID.
+  std::map<uint64_t, uint64_t> pendingInterestIds_;
+  // The key is the segment number and the value is the number of retries.
+  std::map<uint64_t, int> retryCounts_;
+  std::vector<bool> isSegmentReceived_;
+  ndn::ptr_lib::shared_ptr<ndn::InterestTemplate> segmentInterestTemplate_;
+  bool isFinished_;
 };
 
 }
@@ -85,7 +85,11 @@ typedef enum {
   NDN_ERROR_Incorrect_initial_vector_size,
   NDN_ERROR_Incorrect_digest_size,
   NDN_ERROR_An_Interest_may_not_have_a_selected_delegation_when_encoding_a_forwarding_hint,
-  NDN_ERROR_An_Interest_may_not_have_a_link_object_when_encoding_a_forwarding_hint
+  NDN_ERROR_An_Interest_may_not_have_a_link_object_when_encoding_a_forwarding_hint,
+  NDN_ERROR_SocketTransport_error_in_setsockopt,
+  NDN_ERROR_FaceLite_the_pending_interest_table_is_full,
+  NDN_ERROR_FaceLite_the_interest_filter_table_is_full,
+  NDN_ERROR_FaceLite_the_delayed_call_table_is_full
 } ndn_Error;
 
 /**
@@ -55,9 +55,14 @@ struct ndn_LpPacketHeaderField {
 
 /**
  * An ndn_LpPacket holds a list of LP packet header fields and an optional
- * fragment wire encoding.
+ * fragment wire encoding. The Sequence, FragIndex and FragCount fields for
+ * fragmentation are kept separately from the header fields list.
  */
 struct ndn_LpPacket {
+  int hasSequence;      /**< 1 if the packet has a Sequence field, else 0. */
+  uint64_t sequence;    /**< The Sequence field, used only if hasSequence. */
+  uint64_t fragIndex;   /**< The FragIndex field, 0 if not specified. */
+  uint64_t fragCount;   /**< The FragCount field, 1 if not specified. */
   struct ndn_Blob fragmentWireEncoding; /**< A Blob whose value is a pointer to
     * a pre-allocated buffer for the fragment wire encoding. */
   struct ndn_LpPacketHeaderField *headerFields; /**< pointer to the array of ndn_LpPacketHeaderField. */
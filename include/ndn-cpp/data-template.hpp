@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_DATA_TEMPLATE_HPP
+#define NDN_DATA_TEMPLATE_HPP
+
+#include "data.hpp"
+#include "lite/util/blob-lite.hpp"
+#include "security/key-chain.hpp"
+
+namespace ndn {
+
+/**
+ * A DataTemplate holds the pre-encoded TLV of the parts of a Data packet which
+ * are the same for a stream of segments under one prefix: the name prefix, the
+ * MetaInfo content type and freshness period, and the SignatureInfo. To encode
+ * and sign a segment, it writes the outer lengths, the final name component,
+ * the optional FinalBlockId and the content from the caller's buffers into a
+ * reusable output buffer. The result can be sent with Face::send.
+ */
+class DataTemplate {
+public:
+  /**
+   * Create a DataTemplate by signing and encoding the given Data.
+   * @param data The Data with the name prefix and the MetaInfo to use for each
+   * segment. This makes a copy. The content and MetaInfo FinalBlockId of data
+   * are ignored.
+   * @param keyChain The KeyChain used to sign each segment. This keeps a
+   * pointer to the KeyChain, so it must remain valid while this DataTemplate
+   * is used.
+   * @param params (optional) The signing parameters. If omitted, use
+   * a default SigningInfo() which signs with the default identity.
+   * @param wireFormat (optional) A WireFormat object used to encode. If
+   * omitted, use WireFormat getDefaultWireFormat().
+   * @throws runtime_error If wireFormat is not an NDN-TLV 0.2 wire format.
+   * @throws KeyChain::InvalidSigningInfoError If the signing key cannot be
+   * determined from params.
+   */
+  DataTemplate
+    (const Data& data, KeyChain& keyChain,
+     const SigningInfo& params = SigningInfo(),
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
+  /**
+   * Get the name prefix of the Data given to the constructor.
+   * @return The name prefix. You must not change the object.
+   */
+  const Name&
+  getPrefix() const { return prefix_; }
+
+  /**
+   * Encode and sign a Data packet with the name prefix plus finalComponent,
+   * gathering the content from the list of slices (like writev with an array
+   * of struct iovec) so that the caller does not need to copy the content
+   * into one buffer first. This reuses the capacity of output, so if you pass
+   * the same vector each time then this does not allocate after the vector has
+   * grown to the size of the encoding. The encoding is written at the end of
+   * output, starting at the returned offset.
+   * @param finalComponent The name component to append to the prefix, for
+   * example Name::Component::fromSegment(segment).
+   * @param finalBlockId If not null, set the MetaInfo FinalBlockId to this.
+   * @param contentSlices An array of BlobLite which point to the pieces of the
+   * content, in order. This does not keep a pointer to the array.
+   * @param nContentSlices The number of entries in contentSlices.
+   * @param output The vector which is resized and receives the encoding.
+   * @return The offset in output of the beginning of the encoding, which
+   * continues to output.size(). For example, call
+   * face.send(&output[offset], output.size() - offset) .
+   * @throws runtime_error If the key given to the constructor is no longer in
+   * the TPM.
+   */
+  size_t
+  wireEncode
+    (const Name::Component& finalComponent, const Name::Component* finalBlockId,
+     const BlobLite* contentSlices, size_t nContentSlices,
+     std::vector<uint8_t>& output);
+
+  /**
+   * Encode and sign a Data packet with the name prefix plus finalComponent
+   * and the content from one buffer. This is the same as wireEncode with one
+   * content slice.
+   * @param finalComponent The name component to append to the prefix.
+   * @param finalBlockId If not null, set the MetaInfo FinalBlockId to this.
+   * @param content The content bytes.
+   * @param contentLength The number of bytes in content.
+   * @param output The vector which is resized and receives the encoding.
+   * @return The offset in output of the beginning of the encoding, which
+   * continues to output.size().
+   */
+  size_t
+  wireEncode
+    (const Name::Component& finalComponent, const Name::Component* finalBlockId,
+     const uint8_t* content, size_t contentLength, std::vector<uint8_t>& output)
+  {
+    BlobLite contentSlice(content, contentLength);
+    return wireEncode(finalComponent, finalBlockId, &contentSlice, 1, output);
+  }
+
+private:
+  Name prefix_;
+  KeyChain* keyChain_;
+  // The signing key resolved once from the SigningInfo in the constructor.
+  Name keyName_;
+  DigestAlgorithm digestAlgorithm_;
+  // The encoded components of the name prefix (the value of the Name TLV).
+  Blob prefixComponents_;
+  // The MetaInfo ContentType and FreshnessPeriod TLVs.
+  Blob metaInfoFields_;
+  // The SignatureInfo TLV.
+  Blob signatureInfo_;
+};
+
+}
+
+#endif
@@ -111,6 +111,38 @@ public:
     wireDecode(&input[0], input.size(), wireFormat);
   }
 
+  /**
+   * Decode the TLV input like wireDecode(input, *TlvWireFormat::get()), but
+   * only make the Name object now. This checks the whole encoding the same as
+   * wireDecode, so a malformed packet is rejected here. The MetaInfo, content
+   * and signature are made from the retained input on the first call to a
+   * method which needs them. This is much faster for a packet where only the
+   * name is checked, for example an incoming Data packet which doesn't match
+   * a pending Interest. Note that calling the non-const getName() also decodes
+   * the other fields since the caller may change the name. A lazily decoded
+   * Data is not thread-safe until finishLazyDecode() is called.
+   * @param input The input byte array to be decoded as an immutable Blob. This
+   * keeps a pointer to the Blob without copying.
+   * @throws runtime_error for error decoding the input.
+   */
+  void
+  wireDecodeLazy(const Blob& input);
+
+  /**
+   * If this was decoded with wireDecodeLazy, decode the remaining fields now.
+   * Until the fields are decoded, the first call to a const method which needs
+   * them modifies this object, so a lazily decoded Data is not safe to read
+   * from multiple threads. After calling this, the const methods don't modify
+   * this object. If this was not lazily decoded, do nothing.
+   * @throws runtime_error for error decoding the remaining fields.
+   */
+  void
+  finishLazyDecode()
+  {
+    if (!lazyWireEncoding_.isNull())
+      decodeLazyFields();
+  }
+
   /**
    * Set dataLite to point to the values in this Data object, without copying
    * any memory.
@@ -130,24 +162,49 @@ public:
   set(const DataLite& dataLite);
 
   const Signature*
-  getSignature() const { return signature_.get(); }
+  getSignature() const
+  {
+    ensureDecoded();
+    return signature_.get();
+  }
 
   Signature*
-  getSignature() { return signature_.get(); }
+  getSignature()
+  {
+    ensureDecoded();
+    return signature_.get();
+  }
 
   const Name&
   getName() const { return name_.get(); }
 
   Name&
-  getName() { return name_.get(); }
+  getName()
+  {
+    // The caller may change the name, so first finish a lazy decode.
+    ensureDecoded();
+    return name_.get();
+  }
 
   const MetaInfo&
-  getMetaInfo() const { return metaInfo_.get(); }
+  getMetaInfo() const
+  {
+    ensureDecoded();
+    return metaInfo_.get();
+  }
 
-  MetaInfo& getMetaInfo() { return metaInfo_.get(); }
+  MetaInfo& getMetaInfo()
+  {
+    ensureDecoded();
+    return metaInfo_.get();
+  }
 
   const Blob&
-  getContent() const { return content_; }
+  getContent() const
+  {
+    ensureDecoded();
+    return content_;
+  }
 
   /**
    * Get the incoming face ID according to the incoming packet header.
@@ -209,6 +266,7 @@ public:
   Data&
   setSignature(const Signature& signature)
   {
+    ensureDecoded();
     signature_.set(signature.clone());
     ++changeCount_;
     return *this;
@@ -230,6 +288,7 @@ public:
   Data&
   setMetaInfo(const MetaInfo& metaInfo)
   {
+    ensureDecoded();
     metaInfo_.set(metaInfo);
     ++changeCount_;
     return *this;
@@ -255,6 +314,7 @@ public:
   Data&
   setContent(const Blob& content)
   {
+    ensureDecoded();
     content_ = content;
     ++changeCount_;
     return *this;
@@ -295,6 +355,24 @@ public:
   }
 
 private:
+  /**
+   * If wireDecodeLazy retained an encoding whose fields are not yet decoded,
+   * decode them now. This can be called on a const object, so it is not
+   * thread-safe. See finishLazyDecode().
+   */
+  void
+  ensureDecoded() const
+  {
+    if (!lazyWireEncoding_.isNull())
+      const_cast<Data*>(this)->decodeLazyFields();
+  }
+
+  /**
+   * Decode all the fields from lazyWireEncoding_ and clear it.
+   */
+  void
+  decodeLazyFields();
+
   void
   setDefaultWireEncoding
     (const SignedBlob& defaultWireEncoding,
@@ -317,6 +395,7 @@ private:
   uint64_t getDefaultWireEncodingChangeCount_;
   ptr_lib::shared_ptr<LpPacket> lpPacket_;
   uint64_t changeCount_;
+  Blob lazyWireEncoding_; /**< The TLV encoding from wireDecodeLazy, or isNull if all fields are decoded. */
 };
 
 }
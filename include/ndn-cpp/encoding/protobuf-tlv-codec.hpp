@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_PROTOBUF_TLV_CODEC_HPP
+#define NDN_PROTOBUF_TLV_CODEC_HPP
+
+#include <typeinfo>
+#include <ndn-cpp/c/util/blob-types.h>
+#include <ndn-cpp/util/blob.hpp>
+
+namespace google { namespace protobuf { class Message; } }
+
+namespace ndn {
+
+class TlvEncoder;
+class TlvDecoder;
+
+/**
+ * ProtobufTlvCodec has the Encoder and Decoder used by the code which
+ * protoc-gen-ndntlv generates for a .proto file, and a registry of the
+ * generated codecs. The generated code encodes and decodes each message type
+ * directly through its generated accessors, with the same wire format as the
+ * reflection-based ProtobufTlv, and encodes each nested message once after
+ * computing its length. Each generated .tlv.cc file registers its codecs when
+ * it is loaded, and ProtobufTlv::encode and decode use a registered codec for
+ * the message's type if there is one. To generate the code, use:
+ * protoc --plugin=protoc-gen-ndntlv=/path/to/protoc-gen-ndntlv --ndntlv_out=. my.proto
+ * The output is my.tlv.cc, to compile with my.pb.cc, and my.tlv.h which
+ * declares encodeTlv and decodeTlv for each message type.
+ */
+class ProtobufTlvCodec {
+public:
+  typedef Blob (*EncodeFunction)(const google::protobuf::Message& message);
+  typedef void (*DecodeFunction)
+    (google::protobuf::Message& message, const uint8_t *input,
+     size_t inputLength);
+
+  /**
+   * An Encoder writes TLVs in order into an output buffer whose length was
+   * computed in advance by the size methods.
+   */
+  class Encoder {
+  public:
+    /**
+     * Create an Encoder for an encoding of exactly the given length.
+     * @param length The length of the encoding.
+     */
+    Encoder(size_t length);
+
+    void
+    writeTypeAndLength(unsigned int type, size_t length);
+
+    void
+    writeNonNegativeIntegerTlv(unsigned int type, uint64_t value);
+
+    void
+    writeBlobTlv(unsigned int type, const std::string& value);
+
+    /**
+     * Return the encoding.
+     * @return The encoding as a Blob.
+     * @throws runtime_error If the number of bytes written is not the length
+     * given to the constructor.
+     */
+    Blob
+    finish();
+
+    static size_t
+    sizeOfTypeAndLength(unsigned int type, size_t length);
+
+    static size_t
+    sizeOfNonNegativeIntegerTlv(unsigned int type, uint64_t value);
+
+    static size_t
+    sizeOfBlobTlv(unsigned int type, size_t valueLength);
+
+  private:
+    ptr_lib::shared_ptr<TlvEncoder> encoder_;
+    size_t length_;
+  };
+
+  /**
+   * A Decoder reads TLVs in order from an input buffer, the same as the
+   * decoder used by ProtobufTlv.
+   */
+  class Decoder {
+  public:
+    Decoder(const uint8_t *input, size_t inputLength);
+
+    size_t
+    readNestedTlvsStart(unsigned int expectedType);
+
+    void
+    finishNestedTlvs(size_t endOffset);
+
+    bool
+    peekType(unsigned int expectedType, size_t endOffset);
+
+    uint64_t
+    readNonNegativeIntegerTlv(unsigned int expectedType);
+
+    struct ndn_Blob
+    readBlobTlv(unsigned int expectedType);
+
+    bool
+    readBooleanTlv(unsigned int expectedType, size_t endOffset);
+
+  private:
+    ptr_lib::shared_ptr<TlvDecoder> decoder_;
+  };
+
+  /**
+   * Register the generated codec for a Protobuf message class so that
+   * ProtobufTlv::encode and decode use it. This is called by the generated
+   * code when it is loaded.
+   * @param messageType The typeid of the generated Protobuf message class.
+   * @param encode The function to encode a message of this class.
+   * @param decode The function to decode into a message of this class.
+   * @return True, so that the generated code can call this in the initializer
+   * of a static variable.
+   */
+  static bool
+  registerCodec
+    (const std::type_info& messageType, EncodeFunction encode,
+     DecodeFunction decode);
+
+  /**
+   * Find the codec registered for the class of the message.
+   * @param message The Protobuf message object.
+   * @param encode Set encode to the registered encode function, or 0 if not
+   * found.
+   * @param decode Set decode to the registered decode function, or 0 if not
+   * found.
+   * @return True if found, false if not.
+   */
+  static bool
+  findCodec
+    (const google::protobuf::Message& message, EncodeFunction& encode,
+     DecodeFunction& decode);
+};
+
+}
+
+#endif
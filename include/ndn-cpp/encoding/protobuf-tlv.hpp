@@ -41,6 +41,9 @@ namespace ndn {
  * Protobuf has no "outer" message type, so you need to put your TLV message
  * inside an outer "typeless" message.
  *
+ * By default this uses Protobuf reflection. If the code generated by
+ * protoc-gen-ndntlv for the message's .proto file is linked in, then this uses
+ * the generated code instead, which is faster. See ProtobufTlvCodec.
  */
 class ProtobufTlv {
 public:
@@ -91,6 +94,29 @@ public:
     decode(message, input.buf(), input.size());
   }
 
+  /**
+   * Encode the Protobuf Message object as NDN-TLV using Protobuf reflection,
+   * even if code generated by protoc-gen-ndntlv is registered for its class.
+   * This is mainly to check that the generated code gives the same encoding.
+   * @param message The Protobuf Message object. This calls
+   * message.CheckInitialized() to ensure that all required fields are present.
+   * @return The encoded byte array as a Blob.
+   */
+  static Blob
+  encodeWithReflection(const google::protobuf::Message& message);
+
+  /**
+   * Decode the input as NDN-TLV using Protobuf reflection, even if code
+   * generated by protoc-gen-ndntlv is registered for the message's class.
+   * @param message The Protobuf Message object. This does not first clear
+   * the object.
+   * @param input A pointer to the input buffer to decode.
+   * @param inputLength The number of bytes in input.
+   */
+  static void
+  decodeWithReflection
+    (google::protobuf::Message& message, const uint8_t *input, size_t inputLength);
+
   /**
    * Return a Name made from the component array in a Protobuf message object,
    * assuming that it was defined with "repeated bytes". For example:
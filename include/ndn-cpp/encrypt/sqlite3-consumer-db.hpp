@@ -34,6 +34,8 @@ struct sqlite3;
 
 namespace ndn {
 
+class Sqlite3StatementCache;
+
 /**
  * Sqlite3ConsumerDb extends ConsumerDb to implement the storage of decryption
  * keys for the consumer using SQLite3.
@@ -47,6 +49,49 @@ public:
    */
   Sqlite3ConsumerDb(const std::string& databaseFilePath);
 
+  virtual
+  ~Sqlite3ConsumerDb();
+
+  /**
+   * Begin a transaction so that the changes until the matching
+   * commitTransaction() are written to the database in one commit. This is much
+   * faster when adding many keys. A transaction can be nested in another, in
+   * which case its changes are only written when the outer transaction commits.
+   */
+  void
+  beginTransaction();
+
+  /**
+   * Commit the transaction begun by the matching beginTransaction().
+   * @throws ConsumerDb::Error if there is no transaction or the commit fails.
+   */
+  void
+  commitTransaction();
+
+  /**
+   * Roll back the changes since the matching beginTransaction(). If this is a
+   * nested transaction, the outer transaction can still be committed. If there
+   * is no transaction, do nothing.
+   */
+  void
+  rollbackTransaction();
+
+  /**
+   * Set the database to use write-ahead logging instead of the default rollback
+   * journal. This makes each commit faster because it appends to the log
+   * instead of rewriting the database file. SQLite keeps the log in files named
+   * like the database file with "-wal" and "-shm" appended, so an application
+   * which deletes the database file should also delete these.
+   * @param synchronous (optional) The SQLite synchronous mode "OFF", "NORMAL"
+   * or "FULL". If omitted, use "NORMAL" which only syncs at checkpoints. (With
+   * write-ahead logging, NORMAL does not risk corrupting the database, but a
+   * power failure may roll back the last commits.)
+   * @throws ConsumerDb::Error if synchronous is not recognized, if a transaction
+   * is begun, or if setting the journal mode fails.
+   */
+  void
+  enableWriteAheadLogging(const std::string& synchronous = "NORMAL");
+
   /**
    * Get the key with keyName from the database.
    * @param keyName The key name.
@@ -78,6 +123,7 @@ public:
 
 private:
   struct sqlite3 *database_;
+  ptr_lib::shared_ptr<Sqlite3StatementCache> statementCache_;
 };
 
 }
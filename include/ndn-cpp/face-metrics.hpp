@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_FACE_METRICS_HPP
+#define NDN_FACE_METRICS_HPP
+
+#include <string>
+#include "common.hpp"
+
+namespace ndn {
+
+class MetricsRecorder;
+
+/**
+ * A FaceMetrics object is a snapshot of the packet counters and the
+ * Interest-to-Data round trip time histogram which a Face records when
+ * metrics are enabled with Face::setMetricsEnabled(true). Get it with
+ * Face::getMetrics(). The values are the totals since the Face was created or
+ * since the last call to Face::resetMetrics(), so to get a rate you can
+ * subtract the values of two snapshots.
+ */
+class FaceMetrics {
+public:
+  /**
+   * The number of buckets in the round trip time histogram.
+   */
+  static const size_t N_RTT_BUCKETS = 14;
+
+  /**
+   * Create a FaceMetrics with all values zero.
+   */
+  FaceMetrics();
+
+  /**
+   * Get the number of Interest packets sent by expressInterest and send.
+   * @return The number of Interest packets.
+   */
+  uint64_t
+  getOutInterests() const { return outInterests_; }
+
+  /**
+   * Get the number of Data packets sent by putData and send.
+   * @return The number of Data packets.
+   */
+  uint64_t
+  getOutData() const { return outData_; }
+
+  /**
+   * Get the total number of bytes given to the Transport to send.
+   * @return The number of bytes.
+   */
+  uint64_t
+  getOutBytes() const { return outBytes_; }
+
+  /**
+   * Get the number of Interest packets received.
+   * @return The number of Interest packets.
+   */
+  uint64_t
+  getInInterests() const { return inInterests_; }
+
+  /**
+   * Get the number of Data packets received, including unsolicited Data.
+   * @return The number of Data packets.
+   */
+  uint64_t
+  getInData() const { return inData_; }
+
+  /**
+   * Get the number of received Data packets which did not match a pending
+   * Interest.
+   * @return The number of unsolicited Data packets.
+   */
+  uint64_t
+  getInUnsolicitedData() const { return inUnsolicitedData_; }
+
+  /**
+   * Get the number of network Nack packets received.
+   * @return The number of network Nack packets.
+   */
+  uint64_t
+  getInNacks() const { return inNacks_; }
+
+  /**
+   * Get the total number of bytes received from the Transport, counting each
+   * element (including each NDNLPv2 fragment) once.
+   * @return The number of bytes.
+   */
+  uint64_t
+  getInBytes() const { return inBytes_; }
+
+  /**
+   * Get the number of pending Interests which timed out.
+   * @return The number of timeouts.
+   */
+  uint64_t
+  getTimeouts() const { return timeouts_; }
+
+  /**
+   * Get the number of received elements which could not be decoded.
+   * @return The number of decoding errors.
+   */
+  uint64_t
+  getDecodeErrors() const { return decodeErrors_; }
+
+  /**
+   * Get the number of entries in the pending interest table when the snapshot
+   * was taken.
+   * @return The number of pending Interests.
+   */
+  uint64_t
+  getPendingInterestCount() const { return pendingInterestCount_; }
+
+  /**
+   * Get the number of round trip times recorded, which is the number of
+   * pending Interests satisfied by a Data packet.
+   * @return The number of round trip times.
+   */
+  uint64_t
+  getRttCount() const { return rttCount_; }
+
+  /**
+   * Get the mean of the recorded round trip times.
+   * @return The mean in milliseconds, or 0 if getRttCount() is 0.
+   */
+  Milliseconds
+  getRttMean() const;
+
+  /**
+   * Get the maximum of the recorded round trip times.
+   * @return The maximum in milliseconds, or 0 if getRttCount() is 0.
+   */
+  Milliseconds
+  getRttMax() const { return rttMaxMicroseconds_ / 1000.0; }
+
+  /**
+   * Get the number of round trip times in the histogram bucket.
+   * @param i The index of the bucket, from 0 to N_RTT_BUCKETS - 1.
+   * @return The number of round trip times in the bucket.
+   */
+  uint64_t
+  getRttBucketCount(size_t i) const { return rttBuckets_[i]; }
+
+  /**
+   * Get the upper bound of the histogram bucket. Bucket i holds the round trip
+   * times greater than the upper bound of bucket i - 1 and less than or equal
+   * to the upper bound of bucket i. The upper bounds are
+   * 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000 and 10000
+   * milliseconds, and the last bucket has no upper bound.
+   * @param i The index of the bucket, from 0 to N_RTT_BUCKETS - 1.
+   * @return The upper bound in milliseconds, or -1 for the last bucket.
+   */
+  static Milliseconds
+  getRttBucketUpperBound(size_t i);
+
+  /**
+   * Estimate the round trip time percentile from the histogram, as the upper
+   * bound of the bucket which contains the percentile. For example,
+   * getRttPercentile(99) returns the bucket upper bound below which 99% of the
+   * round trip times fall.
+   * @param percentile The percentile from 0 to 100.
+   * @return The estimated percentile in milliseconds, or getRttMax() if the
+   * percentile is in the last bucket, or 0 if getRttCount() is 0.
+   */
+  Milliseconds
+  getRttPercentile(double percentile) const;
+
+  /**
+   * Return a text representation of the metrics with one "name value" pair per
+   * line, suitable for logging or export to a monitoring system.
+   * @return The text representation.
+   */
+  std::string
+  toString() const;
+
+private:
+  friend class MetricsRecorder;
+
+  /**
+   * Get the index of the histogram bucket for the round trip time.
+   * @param rttMicroseconds The round trip time in microseconds.
+   * @return The bucket index, from 0 to N_RTT_BUCKETS - 1.
+   */
+  static size_t
+  getRttBucketIndex(uint64_t rttMicroseconds);
+
+  static const uint64_t rttBucketUpperBoundsMicroseconds_[N_RTT_BUCKETS - 1];
+
+  uint64_t outInterests_;
+  uint64_t outData_;
+  uint64_t outBytes_;
+  uint64_t inInterests_;
+  uint64_t inData_;
+  uint64_t inUnsolicitedData_;
+  uint64_t inNacks_;
+  uint64_t inBytes_;
+  uint64_t timeouts_;
+  uint64_t decodeErrors_;
+  uint64_t pendingInterestCount_;
+  uint64_t rttCount_;
+  uint64_t rttSumMicroseconds_;
+  uint64_t rttMaxMicroseconds_;
+  uint64_t rttBuckets_[N_RTT_BUCKETS];
+};
+
+}
+
+#endif
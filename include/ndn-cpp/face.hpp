@@ -23,11 +23,13 @@
 #define NDN_FACE_HPP
 
 #include "interest.hpp"
+#include "interest-template.hpp"
 #include "data.hpp"
 #include "network-nack.hpp"
 #include "forwarding-flags.hpp"
 #include "encoding/wire-format.hpp"
 #include "interest-filter.hpp"
+#include "face-metrics.hpp"
 #include "transport/transport.hpp"
 
 namespace ndn {
@@ -344,6 +346,52 @@ public:
       (name, 0, onData, onTimeout, OnNetworkNack(), wireFormat);
   }
 
+  /**
+   * Make an Interest from interestTemplate with the name prefix plus
+   * finalComponent and a new nonce. Send the Interest through the transport,
+   * read the entire response and call onData, onTimeout or onNetworkNack as
+   * described below. Since the InterestTemplate has the pre-encoded prefix,
+   * selectors and lifetime, this only needs to encode the final component and
+   * nonce, which is faster than encoding a whole Interest for consumers which
+   * send a sequence of Interests for the same prefix.
+   * @param interestTemplate The InterestTemplate with the name prefix and
+   * the other Interest fields. This copies the InterestTemplate, which is cheap.
+   * @param finalComponent The name component to append to the prefix.
+   * @param onData  When a matching data packet is received, this calls
+   * onData(interest, data) where interest is the Interest made from the
+   * template and data is the received Data object. This copies the function
+   * object, so you may need to use func_lib::ref() as appropriate.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onTimeout (optional) If the interest times out according to the
+   * interest lifetime, this calls onTimeout(interest) where interest is the
+   * Interest made from the template. If onTimeout is omitted or an empty
+   * OnTimeout(), this does not use it. This copies the function object, so you
+   * may need to use func_lib::ref() as appropriate.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onNetworkNack (optional) When a network Nack packet for the
+   * interest is received and onNetworkNack is not null, this calls
+   * onNetworkNack(interest, networkNack) and does not call onTimeout. If
+   * onNetworkNack is omitted or an empty OnNetworkNack(), do nothing and wait
+   * for the interest to time out. This copies the function object, so you may
+   * need to use func_lib::ref() as appropriate.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @return The pending interest ID which can be used with removePendingInterest.
+   * @throws runtime_error If the encoded interest size exceeds
+   * getMaxNdnPacketSize().
+   */
+  virtual uint64_t
+  expressInterest
+    (const InterestTemplate& interestTemplate,
+     const Name::Component& finalComponent, const OnData& onData,
+     const OnTimeout& onTimeout = OnTimeout(),
+     const OnNetworkNack& onNetworkNack = OnNetworkNack());
+
   /**
    * Remove the pending interest entry with the pendingInterestId from the pending interest table.
    * This does not affect another pending interest with a different pendingInterestId, even if it has the same interest name.
@@ -656,6 +704,107 @@ public:
   static size_t
   getMaxNdnPacketSize() { return MAX_NDN_PACKET_SIZE; }
 
+  /**
+   * Enable or disable recording the packet counters and the Interest-to-Data
+   * round trip time histogram which are returned by getMetrics(). When
+   * disabled, recording costs only a check of the flag for each packet.
+   * Metrics are disabled when the Face is created. Disabling does not reset
+   * the recorded values.
+   * @param enabled True to enable recording metrics, false to disable.
+   */
+  void
+  setMetricsEnabled(bool enabled);
+
+  /**
+   * Check if recording metrics is enabled.
+   * @return True if enabled.
+   */
+  bool
+  getMetricsEnabled();
+
+  /**
+   * Get a snapshot of the metrics recorded since the Face was created or since
+   * the last call to resetMetrics(). You can call this from any thread, for
+   * example to periodically log getMetrics().toString().
+   * @return A copy of the current metrics.
+   */
+  FaceMetrics
+  getMetrics();
+
+  /**
+   * Set all the recorded packet counters and the round trip time histogram to
+   * zero.
+   */
+  void
+  resetMetrics();
+
+  /**
+   * Enable or disable lazy decoding of incoming packets. When enabled, an
+   * incoming Interest or Data packet is decoded with wireDecodeLazy which
+   * checks the encoding but only makes the Name object, and the other fields
+   * are made on first access. A packet which doesn't match an interest filter
+   * or pending Interest is then dropped without making the other fields. A
+   * malformed packet is rejected the same as without lazy decoding. A matching
+   * packet is fully decoded before it is passed to your callback. Lazy
+   * decoding is disabled when the Face is created.
+   * @param enabled True to enable lazy decoding, false to disable.
+   */
+  void
+  setLazyDecoding(bool enabled);
+
+  /**
+   * Check if lazy decoding of incoming packets is enabled.
+   * @return True if enabled.
+   */
+  bool
+  getLazyDecoding();
+
+  /**
+   * Enable or disable Interest aggregation. When enabled, if expressInterest is
+   * called with an Interest which has the same name and selectors as an
+   * Interest which was already sent and is still pending (ignoring the nonce
+   * and lifetime), then the new Interest is added to the pending interest table
+   * but is not sent. When the Data arrives, it is passed to the onData callback
+   * of each pending Interest. A network Nack for the sent Interest is also
+   * passed to the aggregated Interests. If the sent Interest times out, then
+   * one of the aggregated Interests which has not timed out is sent. Each
+   * Interest still gets its own onTimeout callback. Interest aggregation is
+   * disabled when the Face is created.
+   * @param enabled True to enable Interest aggregation, false to disable.
+   */
+  void
+  setInterestAggregation(bool enabled);
+
+  /**
+   * Check if Interest aggregation is enabled.
+   * @return True if enabled.
+   */
+  bool
+  getInterestAggregation();
+
+  /**
+   * Set the capacity of the Data cache. If the capacity is greater than 0, then
+   * each received Data which satisfies a pending Interest is saved in the
+   * cache, and when expressInterest is called with an Interest which matches a
+   * cached Data, the Interest is not sent and the onData callback is called
+   * with a copy of the Data from the next call to processEvents. A cached Data
+   * only matches an Interest with MustBeFresh if its FreshnessPeriod has not
+   * expired since it was received, and the ChildSelector chooses between
+   * multiple matching Data. When the cache is full, the least recently used
+   * Data is removed. The capacity is 0 (disabled) when the Face is created.
+   * @param capacity The maximum number of Data packets to cache, or 0 to
+   * disable and clear the cache.
+   */
+  void
+  setDataCacheCapacity(size_t capacity);
+
+  /**
+   * Get the capacity of the Data cache given to setDataCacheCapacity.
+   * @return The maximum number of Data packets to cache, or 0 if disabled.
+   */
+  size_t
+  getDataCacheCapacity();
+
   /**
    * Face::Callback is used internally in callLater.
    */
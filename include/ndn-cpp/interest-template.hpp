@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_INTEREST_TEMPLATE_HPP
+#define NDN_INTEREST_TEMPLATE_HPP
+
+#include "interest.hpp"
+
+namespace ndn {
+
+/**
+ * An InterestTemplate holds the pre-encoded TLV of an Interest whose name is a
+ * prefix, so that an Interest for the prefix plus one more name component can
+ * be encoded by writing only the final component, the nonce and the outer
+ * lengths. This is for consumers which send a sequence of Interests which only
+ * differ in the final name component, such as segment fetching. Use it with
+ * Face::expressInterest(const InterestTemplate&, ...) or call wireEncode to
+ * encode into your own reusable buffer. (This is different from the
+ * interestTemplate argument of Face::expressInterest which is an Interest
+ * whose selectors are copied.)
+ * An InterestTemplate is not modified after it is constructed, so it can be
+ * shared between threads. Copying an InterestTemplate is cheap since it only
+ * copies pointers to the pre-encoded parts.
+ */
+class InterestTemplate {
+public:
+  /**
+   * Create an InterestTemplate by encoding the given interest.
+   * @param interest The Interest with the name prefix, selectors, lifetime,
+   * forwarding hint, etc. to use for each new Interest. This makes a copy. The
+   * nonce of the interest is ignored. This should not be a signed interest
+   * since the signature would not cover the final component.
+   * @param wireFormat (optional) A WireFormat object used to encode. If
+   * omitted, use WireFormat getDefaultWireFormat().
+   * @throws runtime_error If wireFormat is not an NDN-TLV 0.2 wire format.
+   */
+  InterestTemplate
+    (const Interest& interest,
+     WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
+
+  /**
+   * Get the Interest given to the constructor, which has the name prefix.
+   * @return The Interest. You must not change the object. If you need to
+   * change it then make a copy.
+   */
+  const Interest&
+  getInterest() const { return *interest_; }
+
+  /**
+   * Get the name prefix of the Interest given to the constructor.
+   * @return The name prefix. You must not change the object.
+   */
+  const Name&
+  getPrefix() const { return interest_->getName(); }
+
+  /**
+   * Get the WireFormat given to the constructor.
+   * @return The WireFormat.
+   */
+  WireFormat&
+  getWireFormat() const { return *wireFormat_; }
+
+  /**
+   * Encode an Interest with the name prefix plus the finalComponent and the
+   * given nonce, writing into output. This reuses the capacity of output, so
+   * if you pass the same vector each time then this does not allocate after
+   * the vector has grown to the size of the encoding.
+   * @param finalComponent The name component to append to the prefix.
+   * @param nonce The nonce bytes, of length getNonceLength().
+   * @param output The vector which is resized and receives the encoding.
+   */
+  void
+  wireEncode
+    (const Name::Component& finalComponent, const uint8_t* nonce,
+     std::vector<uint8_t>& output) const
+  {
+    size_t prefixComponentsOffset;
+    encode(finalComponent, nonce, output, &prefixComponentsOffset);
+  }
+
+  /**
+   * Make a new Interest with the name prefix plus the finalComponent and a new
+   * random nonce, and set its default wire encoding to the encoding from this
+   * template so that Interest::wireEncode does not need to encode it again.
+   * This does not copy the template Interest. The new Interest copies the
+   * selectors and lifetime, and if the template Interest has a KeyLocator,
+   * Exclude, forwarding hint or Link then these are decoded from the encoding
+   * when first needed, as with Interest::wireDecodeLazy.
+   * @param finalComponent The name component to append to the prefix.
+   * @return The new Interest.
+   */
+  ptr_lib::shared_ptr<Interest>
+  makeInterest(const Name::Component& finalComponent) const;
+
+  /**
+   * Make a new Interest with the name prefix plus the finalComponent and the
+   * given nonce, and set its default wire encoding to the encoding from this
+   * template, as in makeInterest(finalComponent). Face uses this with nonces
+   * which it generates in batches.
+   * @param finalComponent The name component to append to the prefix.
+   * @param nonce The nonce, of length getNonceLength(). The new Interest
+   * shares this Blob.
+   * @return The new Interest.
+   * @throws runtime_error If the nonce length is not getNonceLength().
+   */
+  ptr_lib::shared_ptr<Interest>
+  makeInterest
+    (const Name::Component& finalComponent, const Blob& nonce) const;
+
+  /**
+   * Get the length of the nonce in the encoding.
+   * @return The nonce length.
+   */
+  static size_t
+  getNonceLength() { return NONCE_LENGTH; }
+
+private:
+  /**
+   * Do the work of wireEncode.
+   * @param prefixComponentsOffset Set this to the offset in output of the
+   * first name component.
+   */
+  void
+  encode
+    (const Name::Component& finalComponent, const uint8_t* nonce,
+     std::vector<uint8_t>& output, size_t* prefixComponentsOffset) const;
+
+  static const size_t NONCE_LENGTH = 4;
+
+  ptr_lib::shared_ptr<const Interest> interest_;
+  WireFormat* wireFormat_;
+  // The encoded components of the name prefix (the value of the Name TLV).
+  Blob prefixComponents_;
+  // The encoding of the Interest fields after the Name TLV, up to the end.
+  Blob afterName_;
+  // The offset of the nonce value in afterName_.
+  size_t nonceOffset_;
+};
+
+}
+
+#endif
@@ -76,7 +76,9 @@ public:
     linkWireEncoding_(interest.linkWireEncoding_),
     linkWireEncodingFormat_(interest.linkWireEncodingFormat_),
     selectedDelegationIndex_(interest.selectedDelegationIndex_),
-    changeCount_(0)
+    changeCount_(0),
+    // If interest is lazily decoded, then this copy is also lazily decoded.
+    lazyWireEncoding_(interest.lazyWireEncoding_)
   {
     if (interest.link_.get())
       link_.set(ptr_lib::make_shared<Link>(*interest.link_.get()));
@@ -149,6 +151,38 @@ public:
     wireDecode(&input[0], input.size(), wireFormat);
   }
 
+  /**
+   * Decode the TLV input like wireDecode(input, *TlvWireFormat::get()), but
+   * only make the Name object now. This checks the whole encoding the same as
+   * wireDecode, so a malformed packet is rejected here. The selectors, nonce
+   * and other fields are made from the retained input on the first call to a
+   * method which needs them. This is much faster for a packet where only the
+   * name is checked, for example an incoming Interest which doesn't match an
+   * interest filter. Note that calling the non-const getName() also decodes
+   * the other fields since the caller may change the name. A lazily decoded
+   * Interest is not thread-safe until finishLazyDecode() is called.
+   * @param input The input byte array to be decoded as an immutable Blob. This
+   * keeps a pointer to the Blob without copying.
+   * @throws runtime_error for error decoding the input.
+   */
+  void
+  wireDecodeLazy(const Blob& input);
+
+  /**
+   * If this was decoded with wireDecodeLazy, decode the remaining fields now.
+   * Until the fields are decoded, the first call to a const method which needs
+   * them modifies this object, so a lazily decoded Interest is not safe to read
+   * from multiple threads. After calling this, the const methods don't modify
+   * this object. If this was not lazily decoded, do nothing.
+   * @throws runtime_error for error decoding the remaining fields.
+   */
+  void
+  finishLazyDecode()
+  {
+    if (!lazyWireEncoding_.isNull())
+      decodeLazyFields();
+  }
+
   /**
    * Encode the name according to the "NDN URI Scheme".  If there are interest
    * selectors, append "?" and add the selectors as a query string.  For example
@@ -183,41 +217,82 @@ public:
   set(const InterestLite& interestLite, WireFormat& wireFormat);
 
   Name&
-  getName() { return name_.get(); }
+  getName()
+  {
+    // The caller may change the name, so first finish a lazy decode.
+    ensureDecoded();
+    return name_.get();
+  }
 
   const Name&
   getName() const { return name_.get(); }
 
   int
-  getMinSuffixComponents() const { return minSuffixComponents_; }
+  getMinSuffixComponents() const
+  {
+    ensureDecoded();
+    return minSuffixComponents_;
+  }
 
   int
-  getMaxSuffixComponents() const { return maxSuffixComponents_; }
+  getMaxSuffixComponents() const
+  {
+    ensureDecoded();
+    return maxSuffixComponents_;
+  }
 
   const KeyLocator&
-  getKeyLocator() const { return keyLocator_.get(); }
+  getKeyLocator() const
+  {
+    ensureDecoded();
+    return keyLocator_.get();
+  }
 
   KeyLocator&
-  getKeyLocator() { return keyLocator_.get(); }
+  getKeyLocator()
+  {
+    ensureDecoded();
+    return keyLocator_.get();
+  }
 
   Exclude&
-  getExclude() { return exclude_.get(); }
+  getExclude()
+  {
+    ensureDecoded();
+    return exclude_.get();
+  }
 
   const Exclude&
-  getExclude() const { return exclude_.get(); }
+  getExclude() const
+  {
+    ensureDecoded();
+    return exclude_.get();
+  }
 
   int
-  getChildSelector() const { return childSelector_; }
+  getChildSelector() const
+  {
+    ensureDecoded();
+    return childSelector_;
+  }
 
   /**
    * Return true if the content must be fresh. The default is true.
    * @return true if must be fresh, otherwise false.
    */
   bool
-  getMustBeFresh() const { return mustBeFresh_; }
+  getMustBeFresh() const
+  {
+    ensureDecoded();
+    return mustBeFresh_;
+  }
 
   Milliseconds
-  getInterestLifetimeMilliseconds() const { return interestLifetimeMilliseconds_; }
+  getInterestLifetimeMilliseconds() const
+  {
+    ensureDecoded();
+    return interestLifetimeMilliseconds_;
+  }
 
   /**
    * Return the nonce value from the incoming interest.  If you change any of the fields in this Interest object,
@@ -227,6 +302,7 @@ public:
   const Blob&
   getNonce() const
   {
+    ensureDecoded();
     if (getNonceChangeCount_ != getChangeCount()) {
       // The values have changed, so the existing nonce is invalidated.
       // This method can be called on a const object, but we want to be able to update the default cached value.
@@ -243,10 +319,18 @@ public:
    * @return The forwarding hint as a DelegationSet.
    */
   DelegationSet&
-  getForwardingHint() { return forwardingHint_.get(); }
+  getForwardingHint()
+  {
+    ensureDecoded();
+    return forwardingHint_.get();
+  }
 
   const DelegationSet&
-  getForwardingHint() const { return forwardingHint_.get(); }
+  getForwardingHint() const
+  {
+    ensureDecoded();
+    return forwardingHint_.get();
+  }
 
   /**
    * Check if this interest has a link object (or a link wire encoding which
@@ -257,6 +341,7 @@ public:
   bool
   DEPRECATED_IN_NDN_CPP hasLink() const
   {
+    ensureDecoded();
     return link_.get() || !linkWireEncoding_.isNull();
   }
 
@@ -294,7 +379,11 @@ public:
    * @deprecated Use getForwardingHint.
    */
   int
-  DEPRECATED_IN_NDN_CPP getSelectedDelegationIndex() const { return selectedDelegationIndex_; }
+  DEPRECATED_IN_NDN_CPP getSelectedDelegationIndex() const
+  {
+    ensureDecoded();
+    return selectedDelegationIndex_;
+  }
 
   /**
    * Get the incoming face ID according to the incoming packet header.
@@ -312,6 +401,7 @@ public:
   Interest&
   setName(const Name& name)
   {
+    ensureDecoded();
     name_.set(name);
     ++changeCount_;
     return *this;
@@ -326,6 +416,7 @@ public:
   Interest&
   setMinSuffixComponents(int minSuffixComponents)
   {
+    ensureDecoded();
     minSuffixComponents_ = minSuffixComponents;
     ++changeCount_;
     return *this;
@@ -340,6 +431,7 @@ public:
   Interest&
   setMaxSuffixComponents(int maxSuffixComponents)
   {
+    ensureDecoded();
     maxSuffixComponents_ = maxSuffixComponents;
     ++changeCount_;
     return *this;
@@ -353,6 +445,7 @@ public:
   Interest&
   setChildSelector(int childSelector)
   {
+    ensureDecoded();
     childSelector_ = childSelector;
     ++changeCount_;
     return *this;
@@ -367,6 +460,7 @@ public:
   Interest&
   setMustBeFresh(bool mustBeFresh)
   {
+    ensureDecoded();
     mustBeFresh_ = mustBeFresh;
     ++changeCount_;
     return *this;
@@ -381,6 +475,7 @@ public:
   Interest&
   setInterestLifetimeMilliseconds(Milliseconds interestLifetimeMilliseconds)
   {
+    ensureDecoded();
     interestLifetimeMilliseconds_ = interestLifetimeMilliseconds;
     ++changeCount_;
     return *this;
@@ -392,6 +487,7 @@ public:
   Interest&
   DEPRECATED_IN_NDN_CPP setNonce(const Blob& nonce)
   {
+    ensureDecoded();
     nonce_ = nonce;
     // Set getNonceChangeCount_ so that the next call to getNonce() won't clear nonce_.
     ++changeCount_;
@@ -410,6 +506,7 @@ public:
   Interest&
   setKeyLocator(const KeyLocator& keyLocator)
   {
+    ensureDecoded();
     keyLocator_ = keyLocator;
     ++changeCount_;
     return *this;
@@ -426,6 +523,7 @@ public:
   Interest&
   setExclude(const Exclude& exclude)
   {
+    ensureDecoded();
     exclude_ = exclude;
     ++changeCount_;
     return *this;
@@ -444,6 +542,7 @@ public:
   Interest&
   setForwardingHint(const DelegationSet& forwardingHint)
   {
+    ensureDecoded();
     forwardingHint_ = forwardingHint;
     ++changeCount_;
     return *this;
@@ -466,6 +565,7 @@ public:
     (Blob encoding,
      WireFormat& wireFormat = *WireFormat::getDefaultWireFormat())
   {
+    ensureDecoded();
     linkWireEncoding_ = encoding;
     linkWireEncodingFormat_ = &wireFormat;
 
@@ -498,6 +598,7 @@ public:
   Interest&
   DEPRECATED_IN_NDN_CPP setSelectedDelegationIndex(int selectedDelegationIndex)
   {
+    ensureDecoded();
     selectedDelegationIndex_ = selectedDelegationIndex;
     ++changeCount_;
     return *this;
@@ -599,6 +700,47 @@ public:
   }
 
 private:
+  // InterestTemplate::makeInterest calls setFromTemplate.
+  friend class InterestTemplate;
+
+  /**
+   * Set this new Interest from an InterestTemplate without copying the template
+   * Interest. Set the name to the template name plus finalComponent, set the
+   * nonce and set the default wire encoding to the encoding from the template.
+   * The selectors and lifetime are plain values which are copied. If the
+   * template has a KeyLocator, Exclude, forwarding hint or Link, then instead
+   * of copying these objects, keep the encoding to decode the fields lazily
+   * as in wireDecodeLazy.
+   * @param templateInterest The Interest of the InterestTemplate.
+   * @param finalComponent The name component to append to the template name.
+   * @param nonce The nonce in the encoding.
+   * @param encoding The encoding from the InterestTemplate, with the signed
+   * portion.
+   * @param wireFormat The WireFormat of the encoding.
+   */
+  void
+  setFromTemplate
+    (const Interest& templateInterest, const Name::Component& finalComponent,
+     const Blob& nonce, const SignedBlob& encoding, WireFormat* wireFormat);
+
+  /**
+   * If wireDecodeLazy retained an encoding whose fields are not yet decoded,
+   * decode them now. This can be called on a const object, so it is not
+   * thread-safe. See finishLazyDecode().
+   */
+  void
+  ensureDecoded() const
+  {
+    if (!lazyWireEncoding_.isNull())
+      const_cast<Interest*>(this)->decodeLazyFields();
+  }
+
+  /**
+   * Decode all the fields from lazyWireEncoding_ and clear it.
+   */
+  void
+  decodeLazyFields();
+
   void
   construct()
   {
@@ -643,6 +785,7 @@ private:
   uint64_t getDefaultWireEncodingChangeCount_;
   ptr_lib::shared_ptr<LpPacket> lpPacket_;
   uint64_t changeCount_;
+  Blob lazyWireEncoding_; /**< The TLV encoding from wireDecodeLazy, or isNull if all fields are decoded. */
 };
 
 }
@@ -268,6 +268,20 @@ public:
      size_t signatureInfoLength, const uint8_t *signatureValue,
      size_t signatureValueLength);
 
+  /**
+   * Encode lpPacket as an NDN-TLV LpPacket.
+   * @param lpPacket The LpPacketLite object to encode.
+   * @param output A DynamicUInt8ArrayLite object which receives the encoded
+   * output.  If the output's reallocFunction is null, its array must be large
+   * enough to receive the entire encoding.
+   * @param encodingLength Set encodingLength to the length of the encoded output.
+   * @return 0 for success, else an error code.
+   */
+  static ndn_Error
+  encodeLpPacket
+    (const LpPacketLite& lpPacket, DynamicUInt8ArrayLite& output,
+     size_t* encodingLength);
+
   /**
    * Decode input as a TLV LpPacket and set the fields in the lpPacket object.
    * @param lpPacket The LpPacketLite object whose fields are updated.
@@ -101,6 +101,15 @@ public:
     return Entry::downCast(entries[i]);
   }
 
+  /**
+   * Check if the component matches any of the exclude criteria.
+   * @param component The name component to check.
+   * @return True if the component matches any of the exclude criteria,
+   * otherwise false.
+   */
+  bool
+  matches(const NameLite::Component& component) const;
+
   /**
    * Append a new entry of type ndn_Exclude_ANY.
    * @return 0 for success, or an error code if there is no more room in the
@@ -0,0 +1,406 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_FACE_LITE_HPP
+#define NDN_FACE_LITE_HPP
+
+#include "../c/common.h"
+#include "../c/errors.h"
+#include "common-lite.hpp"
+#include "interest-lite.hpp"
+#include "data-lite.hpp"
+#include "network-nack-lite.hpp"
+#include "encoding/element-listener-lite.hpp"
+#include "util/dynamic-uint8-array-lite.hpp"
+
+namespace ndn {
+
+class FaceLite;
+
+/**
+ * OnDataLite is called when a Data packet matches a pending Interest.
+ * @param face The FaceLite which received the Data.
+ * @param interest The InterestLite given to expressInterest.
+ * @param data The received DataLite. This is only valid during this call. If
+ * you need the data later, you must copy.
+ * @param context The context given to expressInterest.
+ */
+typedef void (*OnDataLite)
+  (FaceLite& face, const InterestLite& interest, const DataLite& data,
+   void* context);
+
+/**
+ * OnTimeoutLite is called when a pending Interest times out.
+ * @param face The FaceLite.
+ * @param interest The InterestLite given to expressInterest.
+ * @param context The context given to expressInterest.
+ */
+typedef void (*OnTimeoutLite)
+  (FaceLite& face, const InterestLite& interest, void* context);
+
+/**
+ * OnNetworkNackLite is called when a network Nack is received for a pending
+ * Interest.
+ * @param face The FaceLite which received the Nack.
+ * @param interest The InterestLite given to expressInterest.
+ * @param networkNack The received NetworkNackLite. This is only valid during
+ * this call.
+ * @param context The context given to expressInterest.
+ */
+typedef void (*OnNetworkNackLite)
+  (FaceLite& face, const InterestLite& interest,
+   const NetworkNackLite& networkNack, void* context);
+
+/**
+ * OnInterestLite is called when an incoming Interest matches an interest
+ * filter.
+ * @param face The FaceLite which received the Interest. You can call
+ * face.putData to send a Data packet.
+ * @param prefix The prefix given to setInterestFilter.
+ * @param interest The received InterestLite. This is only valid during this
+ * call. If you need the interest later, you must copy.
+ * @param context The context given to setInterestFilter.
+ */
+typedef void (*OnInterestLite)
+  (FaceLite& face, const NameLite& prefix, const InterestLite& interest,
+   void* context);
+
+/**
+ * OnDelayedCallLite is called by processEvents when the delay given to
+ * callLater has elapsed.
+ * @param face The FaceLite.
+ * @param context The context given to callLater.
+ */
+typedef void (*OnDelayedCallLite)(FaceLite& face, void* context);
+
+/**
+ * A FaceLite sends Interest and Data packets through a transport such as
+ * TcpTransportLite and dispatches the received packets to callbacks. Unlike
+ * the Face in the full NDN-CPP, this does not use the C++ Standard Library,
+ * exceptions, virtual methods or malloc. The pending interest table, the
+ * interest filter table and the delayed call table are fixed-size arrays
+ * supplied by the caller. An expressInterest or callLater returns an error if
+ * its table is full.
+ * FaceLite is an ElementListenerLite, so pass it to the transport's connect.
+ * Then call FaceLite::processEvents in the event loop instead of the
+ * transport's processEvents.
+ * FaceLite does not register prefixes with the forwarder. Use send to send a
+ * signed command Interest, as in test-publish-async-nfd-lite.
+ */
+class FaceLite : public ElementListenerLite {
+public:
+  /**
+   * A FaceLite::PendingInterest is an entry in the pending interest table. The
+   * caller supplies an array of these to the FaceLite constructor.
+   */
+  class PendingInterest {
+  public:
+    PendingInterest()
+    : pendingInterestId_(0)
+    {
+    }
+
+  private:
+    friend class FaceLite;
+
+    // 0 if this entry is not used.
+    uint64_t pendingInterestId_;
+    const InterestLite* interest_;
+    ndn_MillisecondsSince1970 timeoutTime_;
+    OnDataLite onData_;
+    OnTimeoutLite onTimeout_;
+    OnNetworkNackLite onNetworkNack_;
+    void* context_;
+  };
+
+  /**
+   * A FaceLite::InterestFilter is an entry in the interest filter table. The
+   * caller supplies an array of these to the FaceLite constructor.
+   */
+  class InterestFilter {
+  public:
+    InterestFilter()
+    : interestFilterId_(0)
+    {
+    }
+
+  private:
+    friend class FaceLite;
+
+    // 0 if this entry is not used.
+    uint64_t interestFilterId_;
+    const NameLite* prefix_;
+    OnInterestLite onInterest_;
+    void* context_;
+  };
+
+  /**
+   * A FaceLite::DelayedCall is an entry in the delayed call table. The caller
+   * supplies an array of these to the FaceLite constructor.
+   */
+  class DelayedCall {
+  public:
+    DelayedCall()
+    : delayedCallId_(0)
+    {
+    }
+
+  private:
+    friend class FaceLite;
+
+    // 0 if this entry is not used.
+    uint64_t delayedCallId_;
+    ndn_MillisecondsSince1970 callTime_;
+    OnDelayedCallLite callback_;
+    void* context_;
+  };
+
+  /**
+   * Create a FaceLite to use the given transport and tables.
+   * @param transport The transport such as TcpTransportLite, which must have
+   * the methods send(const uint8_t*, size_t) and
+   * processEvents(uint8_t*, size_t). This does not make a copy; the transport
+   * must remain valid during the life of this object.
+   * @param pendingInterestTable The array of PendingInterest for the pending
+   * interest table. The array must remain valid during the life of this object.
+   * @param maxPendingInterests The number of elements in pendingInterestTable.
+   * @param interestFilterTable The array of InterestFilter for the interest
+   * filter table, or 0 if this does not receive Interests. The array must
+   * remain valid during the life of this object.
+   * @param maxInterestFilters The number of elements in interestFilterTable.
+   * @param delayedCallTable The array of DelayedCall for callLater, or 0 if
+   * callLater is not used. The array must remain valid during the life of
+   * this object.
+   * @param maxDelayedCalls The number of elements in delayedCallTable.
+   * @param encodingBuffer The buffer used to encode the Interest and Data
+   * packets to send. It must be large enough for the largest packet, perhaps
+   * MAX_NDN_PACKET_SIZE bytes. The buffer must remain valid during the life of
+   * this object.
+   * @param encodingBufferLength The number of bytes in encodingBuffer.
+   */
+  template<class Transport>
+  FaceLite
+    (Transport& transport, PendingInterest* pendingInterestTable,
+     size_t maxPendingInterests, InterestFilter* interestFilterTable,
+     size_t maxInterestFilters, DelayedCall* delayedCallTable,
+     size_t maxDelayedCalls, uint8_t* encodingBuffer,
+     size_t encodingBufferLength)
+  : ElementListenerLite(&onReceivedElementWrapper),
+    transport_(&transport), send_(&sendWrapper<Transport>),
+    processEvents_(&processEventsWrapper<Transport>),
+    pendingInterestTable_(pendingInterestTable),
+    maxPendingInterests_(maxPendingInterests),
+    interestFilterTable_(interestFilterTable),
+    maxInterestFilters_(maxInterestFilters),
+    delayedCallTable_(delayedCallTable), maxDelayedCalls_(maxDelayedCalls),
+    encoding_(encodingBuffer, encodingBufferLength, 0), lastEntryId_(0)
+  {
+  }
+
+  /**
+   * Encode the interest, send it through the transport and add it to the
+   * pending interest table. If the interest has no nonce, the encoder adds a
+   * random nonce.
+   * @param interest The InterestLite to send. This does not make a copy; the
+   * interest must remain valid until it is removed from the pending interest
+   * table after calling onData, onTimeout or onNetworkNack, or after calling
+   * removePendingInterest.
+   * @param onData Call onData when a matching Data packet is received.
+   * @param onTimeout Call onTimeout when the interest times out, or 0 for no
+   * callback. If the interest has no lifetime, this uses 4000 milliseconds.
+   * @param onNetworkNack Call onNetworkNack when a network Nack is received
+   * for the interest, or 0 for no callback. If 0, the interest is removed
+   * when the Nack is received and onTimeout is not called.
+   * @param context A pointer which is passed to the callbacks.
+   * @param pendingInterestId If not 0, set this to the ID for
+   * removePendingInterest.
+   * @return 0 for success, or an error code if the pending interest table is
+   * full or there is an error encoding or sending.
+   */
+  ndn_Error
+  expressInterest
+    (const InterestLite& interest, OnDataLite onData, OnTimeoutLite onTimeout,
+     OnNetworkNackLite onNetworkNack, void* context,
+     uint64_t* pendingInterestId);
+
+  /**
+   * Remove the pending interest entry with the pendingInterestId from the
+   * pending interest table, so that its callbacks are not called. If there is
+   * no entry with the pendingInterestId, do nothing.
+   * @param pendingInterestId The ID returned from expressInterest.
+   */
+  void
+  removePendingInterest(uint64_t pendingInterestId);
+
+  /**
+   * Add an entry to the interest filter table so that onInterest is called for
+   * an incoming Interest whose name has the prefix. This does not register the
+   * prefix with the forwarder.
+   * @param prefix The name prefix. This does not make a copy; the prefix must
+   * remain valid until unsetInterestFilter is called.
+   * @param onInterest Call onInterest for a matching Interest.
+   * @param context A pointer which is passed to onInterest.
+   * @param interestFilterId If not 0, set this to the ID for
+   * unsetInterestFilter.
+   * @return 0 for success, or an error code if the interest filter table is
+   * full.
+   */
+  ndn_Error
+  setInterestFilter
+    (const NameLite& prefix, OnInterestLite onInterest, void* context,
+     uint64_t* interestFilterId);
+
+  /**
+   * Remove the interest filter entry with the interestFilterId. If there is no
+   * entry with the interestFilterId, do nothing.
+   * @param interestFilterId The ID returned from setInterestFilter.
+   */
+  void
+  unsetInterestFilter(uint64_t interestFilterId);
+
+  /**
+   * Encode the Data packet and send it through the transport.
+   * @param data The DataLite to send.
+   * @return 0 for success, or an error code if there is an error encoding or
+   * sending.
+   */
+  ndn_Error
+  putData(const DataLite& data);
+
+  /**
+   * Send the encoded packet through the transport.
+   * @param encoding The encoded packet to send.
+   * @param encodingLength The number of bytes in encoding.
+   * @return 0 for success, else an error code.
+   */
+  ndn_Error
+  send(const uint8_t* encoding, size_t encodingLength)
+  {
+    return send_(transport_, encoding, encodingLength);
+  }
+
+  /**
+   * Call callback(face, context) from processEvents after the delay.
+   * @param delayMilliseconds The delay in milliseconds.
+   * @param callback The function to call.
+   * @param context A pointer which is passed to callback.
+   * @return 0 for success, or an error code if the delayed call table is full.
+   */
+  ndn_Error
+  callLater
+    (Milliseconds delayMilliseconds, OnDelayedCallLite callback, void* context);
+
+  /**
+   * Call the transport's processEvents to receive packets and dispatch them,
+   * then call onTimeout for pending interests which have timed out and call
+   * the delayed calls which are due. This is non-blocking.
+   * @param buffer A pointer to a buffer for receiving data, which is passed to
+   * the transport's processEvents.
+   * @param bufferLength The size of buffer.
+   * @return 0 for success, else an error code from the transport.
+   */
+  ndn_Error
+  processEvents(uint8_t* buffer, size_t bufferLength);
+
+  /**
+   * Process an element received by the transport. This is called by the
+   * transport, or you can call it directly to supply a packet.
+   * @param element A pointer to the element. This buffer is only valid during
+   * this call.
+   * @param elementLength The length of element.
+   */
+  void
+  onReceivedElement(const uint8_t *element, size_t elementLength);
+
+private:
+  typedef ndn_Error (*SendLite)
+    (void* transport, const uint8_t* data, size_t dataLength);
+  typedef ndn_Error (*ProcessEventsLite)
+    (void* transport, uint8_t* buffer, size_t bufferLength);
+
+  template<class Transport> static ndn_Error
+  sendWrapper(void* transport, const uint8_t* data, size_t dataLength)
+  {
+    return ((Transport*)transport)->send(data, dataLength);
+  }
+
+  template<class Transport> static ndn_Error
+  processEventsWrapper(void* transport, uint8_t* buffer, size_t bufferLength)
+  {
+    return ((Transport*)transport)->processEvents(buffer, bufferLength);
+  }
+
+  static void
+  onReceivedElementWrapper
+    (ElementListenerLite *self, const uint8_t *element, size_t elementLength);
+
+  /**
+   * Call onData for each pending interest which matches the Data packet and
+   * was expressed before this call, and remove it.
+   */
+  void
+  processData(const uint8_t *element, size_t elementLength);
+
+  /**
+   * Call onInterest for each interest filter which matches the Interest, or if
+   * networkNack is not 0, call onNetworkNack for each pending interest with
+   * the same name and remove it.
+   */
+  void
+  processInterest
+    (const uint8_t *element, size_t elementLength,
+     const NetworkNackLite* networkNack);
+
+  /**
+   * Call onTimeout for each pending interest which has timed out and call each
+   * delayed call which is due.
+   */
+  void
+  processTimers();
+
+  /**
+   * Don't allow the copy constructor.
+   */
+  FaceLite(const FaceLite& other);
+
+  /**
+   * Don't allow the assignment operator.
+   */
+  FaceLite& operator=(const FaceLite& other);
+
+  void* transport_;
+  SendLite send_;
+  ProcessEventsLite processEvents_;
+  PendingInterest* pendingInterestTable_;
+  size_t maxPendingInterests_;
+  InterestFilter* interestFilterTable_;
+  size_t maxInterestFilters_;
+  DelayedCall* delayedCallTable_;
+  size_t maxDelayedCalls_;
+  DynamicUInt8ArrayLite encoding_;
+  // Used for the IDs of all the tables. An entry added while dispatching has a
+  // greater ID so that it is not processed in the same pass.
+  uint64_t lastEntryId_;
+};
+
+}
+
+#endif
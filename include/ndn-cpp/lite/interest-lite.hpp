@@ -243,6 +243,15 @@ public:
     return *this;
   }
 
+  /**
+   * Check if this interest's name matches the given name (using NameLite::match)
+   * and the given name also conforms to the interest selectors.
+   * @param name The name to check.
+   * @return True if the name and interest selectors match, otherwise false.
+   */
+  bool
+  matchesName(const NameLite& name) const;
+
   /**
    * Set this interest object to have the values from the other interest.
    * @param other The other InterestLite to get values from.
@@ -112,6 +112,36 @@ public:
   const BlobLite&
   getFragmentWireEncoding() const { return BlobLite::downCast(fragmentWireEncoding); }
 
+  /**
+   * Check if this packet has a Sequence field.
+   * @return True if the Sequence is specified, false if not.
+   */
+  bool
+  getHasSequence() const { return hasSequence != 0; }
+
+  /**
+   * Get the Sequence field. This assumes you checked getHasSequence().
+   * @return The Sequence number.
+   */
+  uint64_t
+  getSequence() const { return sequence; }
+
+  /**
+   * Get the FragIndex field, which is the zero-based index of this fragment
+   * in the fragmented network-layer packet.
+   * @return The FragIndex, or 0 if not specified.
+   */
+  uint64_t
+  getFragIndex() const { return fragIndex; }
+
+  /**
+   * Get the FragCount field, which is the number of fragments of the
+   * fragmented network-layer packet.
+   * @return The FragCount, or 1 if not specified.
+   */
+  uint64_t
+  getFragCount() const { return fragCount; }
+
   /**
    * Get the number of header fields. This does not include the fragment.
    * @return The number of header fields.
@@ -148,6 +178,31 @@ public:
     BlobLite::downCast(this->fragmentWireEncoding) = fragmentWireEncoding;
   }
 
+  /**
+   * Set the Sequence field.
+   * @param sequence The Sequence number.
+   */
+  void
+  setSequence(uint64_t sequence)
+  {
+    this->sequence = sequence;
+    hasSequence = 1;
+  }
+
+  /**
+   * Set the FragIndex field.
+   * @param fragIndex The zero-based index of this fragment.
+   */
+  void
+  setFragIndex(uint64_t fragIndex) { this->fragIndex = fragIndex; }
+
+  /**
+   * Set the FragCount field.
+   * @param fragCount The number of fragments.
+   */
+  void
+  setFragCount(uint64_t fragCount) { this->fragCount = fragCount; }
+
   /**
    * Downcast the reference to the ndn_LpPacket struct to an LpPacketLite.
    * @param lpPacket A reference to the ndn_LpPacket struct.
@@ -439,7 +439,7 @@ public:
    * returns true if this name is empty.
    */
   bool
-  equals(const NameLite& name);
+  equals(const NameLite& name) const;
 
   /**
    * Check if the N components of this name are the same as the first N
@@ -653,6 +653,7 @@ public:
 private:
   // Declare friends who can downcast to the private base.
   friend class Tlv0_2WireFormatLite;
+  friend class InterestLite;
 
   /**
    * Don't allow the copy constructor. Instead use set(const NameLite&) which
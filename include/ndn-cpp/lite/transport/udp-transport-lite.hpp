@@ -85,15 +85,26 @@ public:
    * @param buffer A pointer to a buffer for receiving data. Note that this is
    * only for temporary use and is not the way that this function supplies data.
    * It supplies the data by calling the onReceivedElement callback.
-   * @param bufferLength The size of buffer. The buffer should be as large as
-   * resources permit up to MAX_NDN_PACKET_SIZE, but smaller sizes will work
-   * however may be less efficient due to multiple calls to socket receive and
-   * more processing by the ElementReader.
+   * @param bufferLength The size of buffer. If bufferLength holds more than one
+   * MAX_NDN_PACKET_SIZE, then this receives a batch of datagrams with one call
+   * to recvmmsg where supported. The buffer should be as large as resources
+   * permit up to 32 * MAX_NDN_PACKET_SIZE, which is the maximum batch.
+   * Smaller sizes will work however may be less efficient due to more calls to
+   * socket receive.
    * @return 0 for success, else an error code.
    */
   ndn_Error
   processEvents(uint8_t *buffer, size_t bufferLength);
 
+  /**
+   * Set the size of the kernel's receive buffer for the socket (SO_RCVBUF).
+   * This must be called after connect.
+   * @param receiveBufferSize The requested size in bytes.
+   * @return 0 for success, else an error code.
+   */
+  ndn_Error
+  setReceiveBufferSize(int receiveBufferSize);
+
   /**
    * Close the socket.
    * @return 0 for success, else an error code.
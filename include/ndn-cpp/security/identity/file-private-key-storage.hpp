@@ -24,15 +24,19 @@
 #define NDN_FILE_PRIVATE_KEY_STORAGE_HPP
 
 #include <string>
+#include <map>
 #include "private-key-storage.hpp"
 
 namespace ndn {
 
 class DerNode;
+class TpmPrivateKey;
 
 /**
  * FilePrivateKeyStorage extends PrivateKeyStorage to implement private key
- * storage using files.
+ * storage using files. By default, sign() reads and decodes the private key
+ * file each time. Call setPrivateKeyCacheEnabled(true) to cache the decoded
+ * private keys.
  */
 class FilePrivateKeyStorage : public PrivateKeyStorage {
 public:
@@ -124,7 +128,45 @@ public:
   virtual bool
   doesKeyExist(const Name& keyName, KeyClass keyClass);
 
+  /**
+   * Enable or disable the cache of decoded private keys which is used by
+   * sign(). The cache is updated by sign() without a lock, so only enable it
+   * if calls to the KeyChain are from one thread (or are serialized by the
+   * application). Disabling the cache clears it.
+   * @param isPrivateKeyCacheEnabled True to enable the cache, false to disable.
+   */
+  void
+  setPrivateKeyCacheEnabled(bool isPrivateKeyCacheEnabled);
+
+  /**
+   * Check if the cache of decoded private keys is enabled.
+   * @return True if the cache is enabled.
+   */
+  bool
+  getPrivateKeyCacheEnabled() const { return isPrivateKeyCacheEnabled_; }
+
+  /**
+   * Get the number of decoded private keys in the cache which is used by
+   * sign().
+   * @return The number of cached private keys.
+   */
+  size_t
+  getPrivateKeyCacheSize() const { return privateKeyCache_.size(); }
+
 private:
+  /**
+   * Get the decoded private key from privateKeyCache_, or read and decode the
+   * private key file and add it to the cache if enabled. Even if the key is
+   * cached, this checks that the private key file still exists, and if not,
+   * removes the key from the cache.
+   * @param keyName The name of the private key.
+   * @return The private key.
+   * @throws SecurityException if the private key file doesn't exist.
+   * @throws TpmPrivateKey::Error if the private key file can't be decoded.
+   */
+  ptr_lib::shared_ptr<TpmPrivateKey>
+  getPrivateKey(const Name& keyName);
+
   std::string
   nameTransform(const std::string& keyName, const std::string& extension);
 
@@ -138,6 +180,10 @@ private:
   maintainMapping(const std::string& keyName);
 
   std::string keyStorePath_;
+  // The key is the key name URI. This saves reading and decoding the file for
+  // each call to sign. This is only used if isPrivateKeyCacheEnabled_.
+  std::map<std::string, ptr_lib::shared_ptr<TpmPrivateKey> > privateKeyCache_;
+  bool isPrivateKeyCacheEnabled_;
 };
 
 }
@@ -23,6 +23,7 @@
 #ifndef NDN_IDENTITY_MANAGER_HPP
 #define NDN_IDENTITY_MANAGER_HPP
 
+#include <map>
 #include "../certificate/identity-certificate.hpp"
 #include "../../interest.hpp"
 #include "identity-storage.hpp"
@@ -35,6 +36,8 @@ class ConfigFile;
 
 /**
  * An IdentityManager is the interface of operations related to identity, keys, and certificates.
+ * Call setSignatureCacheEnabled(true) to cache a signature prototype for each
+ * certificate name used by the sign methods.
  */
 class IdentityManager {
 public:
@@ -488,6 +491,29 @@ public:
   ptr_lib::shared_ptr<IdentityCertificate>
   selfSign(const Name& keyName);
 
+  /**
+   * Enable or disable the cache of a signature prototype for each certificate
+   * name, which saves getting the public key to check the key type for each
+   * call to sign. The cache is updated by the sign methods without a lock, so
+   * only enable it if calls to the KeyChain are from one thread (or are
+   * serialized by the application). Disabling the cache clears it.
+   * @param isSignatureCacheEnabled True to enable the cache, false to disable.
+   */
+  void
+  setSignatureCacheEnabled(bool isSignatureCacheEnabled)
+  {
+    isSignatureCacheEnabled_ = isSignatureCacheEnabled;
+    if (!isSignatureCacheEnabled_)
+      signatureCache_.clear();
+  }
+
+  /**
+   * Check if the cache of signature prototypes is enabled.
+   * @return True if the cache is enabled.
+   */
+  bool
+  getSignatureCacheEnabled() const { return isSignatureCacheEnabled_; }
+
 private:
   /**
    * Generate a key pair for the specified identity.
@@ -504,7 +530,10 @@ private:
 
   /**
    * Return a new Signature object based on the signature algorithm of the
-   * public key with keyName (derived from certificateName).
+   * public key with keyName (derived from certificateName). If
+   * isSignatureCacheEnabled_, this saves a prototype of the Signature for the
+   * certificateName in signatureCache_ so that later calls don't need to get
+   * the public key.
    * @param certificateName The certificate name.
    * @param digestAlgorithm Set digestAlgorithm to the signature algorithm's
    * digest algorithm, e.g. DIGEST_ALGORITHM_SHA256.
@@ -547,6 +576,10 @@ private:
 
   ptr_lib::shared_ptr<IdentityStorage> identityStorage_;
   ptr_lib::shared_ptr<PrivateKeyStorage> privateKeyStorage_;
+  // The key is the certificate name. This is cleared when a key is generated
+  // or deleted. This is only used if isSignatureCacheEnabled_.
+  std::map<Name, ptr_lib::shared_ptr<Signature> > signatureCache_;
+  bool isSignatureCacheEnabled_;
 };
 
 }
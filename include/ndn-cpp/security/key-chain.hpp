@@ -1098,6 +1098,7 @@ public:
 
 private:
   friend class CommandInterestSigner;
+  friend class DataTemplate;
 
   /**
    * Do the work of the constructor to create a KeyChain from the given locators.
@@ -36,6 +36,8 @@ struct sqlite3;
 
 namespace ndn {
 
+class Sqlite3StatementCache;
+
 /**
  * PibSqlite3 extends PibImpl and is used by the Pib class as an implementation
  * of a PIB based on an SQLite3 database. All the contents in the PIB are stored
@@ -67,6 +69,47 @@ public:
   static std::string
   getScheme();
 
+  /**
+   * Begin a transaction so that the changes until the matching
+   * commitTransaction() are written to the database in one commit. This is much
+   * faster when adding many identities, keys or certificates. A transaction can
+   * be nested in another, in which case its changes are only written when the
+   * outer transaction commits.
+   */
+  void
+  beginTransaction();
+
+  /**
+   * Commit the transaction begun by the matching beginTransaction().
+   * @throws PibImpl::Error if there is no transaction or the commit fails.
+   */
+  void
+  commitTransaction();
+
+  /**
+   * Roll back the changes since the matching beginTransaction(). If this is a
+   * nested transaction, the outer transaction can still be committed. If there
+   * is no transaction, do nothing.
+   */
+  void
+  rollbackTransaction();
+
+  /**
+   * Set the database to use write-ahead logging instead of the default rollback
+   * journal. This makes each commit faster because it appends to the log
+   * instead of rewriting the database file. SQLite keeps the log in files named
+   * like the database file with "-wal" and "-shm" appended, so an application
+   * which deletes the database file should also delete these.
+   * @param synchronous (optional) The SQLite synchronous mode "OFF", "NORMAL"
+   * or "FULL". If omitted, use "NORMAL" which only syncs at checkpoints. (With
+   * write-ahead logging, NORMAL does not risk corrupting the database, but a
+   * power failure may roll back the last commits.)
+   * @throws PibImpl::Error if synchronous is not recognized, if a transaction
+   * is begun, or if setting the journal mode fails.
+   */
+  void
+  enableWriteAheadLogging(const std::string& synchronous = "NORMAL");
+
   // TpmLocator management.
 
   /**
@@ -322,6 +365,7 @@ private:
   PibSqlite3& operator=(const PibSqlite3& other);
 
   struct sqlite3 *database_;
+  ptr_lib::shared_ptr<Sqlite3StatementCache> statementCache_;
 };
 
 }
@@ -24,6 +24,7 @@
 #ifndef NDN_CERTIFICATE_CACHE_HPP
 #define NDN_CERTIFICATE_CACHE_HPP
 
+#include <float.h>
 #include <map>
 #include "../certificate/identity-certificate.hpp"
 
@@ -31,21 +32,34 @@ namespace ndn {
 
 /**
  * A CertificateCache is used to save other users' certificate during
- * verification.
+ * verification. The certificates are kept decoded so that a known certificate
+ * is not decoded again for each packet. A certificate which is inserted with
+ * the name of the trust anchor that its chain was verified to is removed at its
+ * NotAfter time. A certificate which is inserted without a trust anchor name
+ * (such as a trust anchor itself) is kept until it is deleted.
  */
 class CertificateCache {
 public:
+  CertificateCache()
+  : nextRefreshTime_(DBL_MAX),
+    nowOffsetMilliseconds_(0)
+  {
+  }
+
   /**
    * Insert the certificate into the cache. Assumes the timestamp is not yet
    * removed from the name.
    * @param certificate The certificate to copy and insert.
+   * @param trustAnchorName (optional) The name of the trust anchor (without
+   * the timestamp) that the certificate chain was verified to. If omitted or
+   * empty, the certificate does not expire in the cache. Otherwise, the
+   * certificate is removed at its NotAfter time, and is not inserted if it has
+   * already expired.
    */
   void
-  insertCertificate(const IdentityCertificate& certificate)
-  {
-    Name certName = certificate.getName().getPrefix(-1);
-    cache_[certName.toUri()] = certificate.wireEncode();
-  }
+  insertCertificate
+    (const IdentityCertificate& certificate,
+     const Name& trustAnchorName = Name());
 
   /**
    * Remove a certificate from the cache. This does nothing if it is not present.
@@ -55,32 +69,30 @@ public:
   void
   deleteCertificate(const Name& certificateName)
   {
-    std::map<std::string, Blob>::iterator entry
-      (cache_.find(certificateName.toUri()));
-    if (entry != cache_.end())
-      cache_.erase(entry);
+    certificatesByName_.erase(certificateName);
   }
 
   /**
    * Fetch a certificate from the cache.
-   * @param certificateName The name of the certificate to remove. Assumes there
+   * @param certificateName The name of the certificate to fetch. Assumes there
    * is no timestamp in the name.
-   * @return A new copy of the IdentityCertificate, or a null shared_ptr if not
-   * found.
+   * @return The IdentityCertificate, or a null shared_ptr if not found or if
+   * it was inserted with a trust anchor name and is not yet valid. You must not
+   * modify the returned object. If you need to modify it, then make a copy.
    */
   ptr_lib::shared_ptr<IdentityCertificate>
-  getCertificate(const Name& certificateName) const
-  {
-    std::map<std::string, Blob>::const_iterator entry
-      (cache_.find(certificateName.toUri()));
-    if (entry == cache_.end())
-      return ptr_lib::shared_ptr<IdentityCertificate>();
-
-    ptr_lib::shared_ptr<IdentityCertificate> cert(new IdentityCertificate());
-    Blob certData = entry->second;
-    cert->wireDecode(certData);
-    return cert;
-  }
+  getCertificate(const Name& certificateName) const;
+
+  /**
+   * Get the name of the trust anchor that was given to insertCertificate for
+   * the certificate.
+   * @param certificateName The name of the certificate. Assumes there is no
+   * timestamp in the name.
+   * @return The trust anchor name, or an empty Name if the certificate is not
+   * found or was inserted without a trust anchor name.
+   */
+  Name
+  getTrustAnchorName(const Name& certificateName) const;
 
   /**
    * Clear all certificates from the store.
@@ -88,12 +100,68 @@ public:
   void
   reset()
   {
-    cache_.clear();
+    certificatesByName_.clear();
+    nextRefreshTime_ = DBL_MAX;
+  }
+
+  /**
+   * Set the offset when insertCertificate() and getCertificate() get the
+   * current time, which should only be used for testing.
+   * @param nowOffsetMilliseconds The offset in milliseconds.
+   */
+  void
+  setNowOffsetMilliseconds_(Milliseconds nowOffsetMilliseconds)
+  {
+    nowOffsetMilliseconds_ = nowOffsetMilliseconds;
   }
 
 private:
-  // The key is the certificate name URI. The value is the wire encoding.
-  std::map<std::string, Blob> cache_;
+  /**
+   * CertificateCache::Entry is the value of the certificatesByName_ map.
+   */
+  class Entry {
+  public:
+    Entry
+      (const ptr_lib::shared_ptr<IdentityCertificate>& certificate,
+       const Name& trustAnchorName, MillisecondsSince1970 notBefore,
+       MillisecondsSince1970 removalTime)
+    : certificate_(certificate), trustAnchorName_(trustAnchorName),
+      notBefore_(notBefore), removalTime_(removalTime)
+    {}
+
+    Entry()
+    : notBefore_(0), removalTime_(0)
+    {}
+
+    ptr_lib::shared_ptr<IdentityCertificate> certificate_;
+    Name trustAnchorName_;
+    MillisecondsSince1970 notBefore_;
+    MillisecondsSince1970 removalTime_;
+  };
+
+  /**
+   * Find the entry for the certificate name, ignoring an entry which has
+   * expired but is not yet removed by refresh.
+   * @param certificateName The certificate name without the timestamp.
+   * @param now The current time in milliseconds since 1970.
+   * @return The iterator for the entry, or certificatesByName_.end() if not
+   * found.
+   */
+  std::map<Name, Entry>::const_iterator
+  findEntry(const Name& certificateName, MillisecondsSince1970 now) const;
+
+  /**
+   * Remove all expired certificate entries. This is called by
+   * insertCertificate. The const get methods ignore expired entries instead.
+   * @param now The current time in milliseconds since 1970.
+   */
+  void
+  refresh(MillisecondsSince1970 now);
+
+  // The key is the certificate name without the timestamp.
+  std::map<Name, Entry> certificatesByName_;
+  MillisecondsSince1970 nextRefreshTime_;
+  Milliseconds nowOffsetMilliseconds_;
 };
 
 }
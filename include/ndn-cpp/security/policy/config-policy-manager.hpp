@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include "certificate-cache.hpp"
 #include "../v2/certificate-cache-v2.hpp"
 #include "policy-manager.hpp"
@@ -36,6 +37,7 @@ class TestVerificationRules_NameRelation_Test;
 class TestVerificationRules_SimpleRegex_Test;
 class TestVerificationRules_Hierarchical_Test;
 class TestVerificationRules_HyperRelation_Test;
+class TestConfigPolicyManager_RemovedTrustAnchor_Test;
 
 namespace ndn {
 
@@ -262,6 +264,7 @@ private:
   friend TestVerificationRules_SimpleRegex_Test;
   friend TestVerificationRules_Hierarchical_Test;
   friend TestVerificationRules_HyperRelation_Test;
+  friend TestConfigPolicyManager_RemovedTrustAnchor_Test;
 
   /**
    * TrustAnchorRefreshManager manages the trust-anchor certificates, including
@@ -366,6 +369,41 @@ private:
   ptr_lib::shared_ptr<CertificateV2>
   lookupCertificateV2(const std::string& certID, bool isPath);
 
+  /**
+   * Find a security v1 certificate among the trust anchors and the cache of
+   * verified certificates, without decoding it again. A verified certificate
+   * is not found if the trust anchor which it chains to has been removed.
+   * @param certificateName The certificate name without the timestamp, as in
+   * the KeyLocator.
+   * @param trustAnchorName Set this to the name of the trust anchor (without
+   * the timestamp) which the certificate chains to. If the certificate is
+   * itself a trust anchor, this is certificateName.
+   * @return The IdentityCertificate, or null if not found. You must not modify
+   * the returned object.
+   */
+  ptr_lib::shared_ptr<IdentityCertificate>
+  findCertificate(const Name& certificateName, Name& trustAnchorName) const;
+
+  /**
+   * Find a security v1 certificate, the same as
+   * findCertificate(certificateName, trustAnchorName) but without returning
+   * the trust anchor name.
+   */
+  ptr_lib::shared_ptr<IdentityCertificate>
+  findCertificate(const Name& certificateName) const
+  {
+    Name trustAnchorName;
+    return findCertificate(certificateName, trustAnchorName);
+  }
+
+  /**
+   * Insert the security v1 certificate, which has been verified, into
+   * certificateCache_ along with the trust anchor of its signer.
+   * @param certificate The verified certificate.
+   */
+  void
+  insertVerifiedCertificate(const IdentityCertificate& certificate);
+
   /**
    * Search the configuration file for the first rule that matches the data or
    * signed interest name. In the case of interests, the name to match should
@@ -423,11 +461,26 @@ private:
     (const Name& keyName, MillisecondsSince1970 timestamp,
      std::string& failureReason) const;
 
+  class KeyTimestampRecord {
+  public:
+    KeyTimestampRecord
+      (const Name& keyName, MillisecondsSince1970 timestamp,
+       MillisecondsSince1970 lastUsed)
+    : keyName_(keyName), timestamp_(timestamp), lastUsed_(lastUsed)
+    {}
+
+    Name keyName_;
+    // The timestamp from the last command interest signed with the key.
+    MillisecondsSince1970 timestamp_;
+    // The local time when the key was last used, for the TTL.
+    MillisecondsSince1970 lastUsed_;
+  };
+
   /**
    * Trim the table size down if necessary, and insert/update the latest
    * interest signing timestamp for the key. Any key which has not been used
-   * within the TTL period is purged. If the table is still too large, the
-   * oldest key is purged.
+   * within the TTL period (by local time, not by interest timestamp) is purged. If the table is still too large, the
+   * least recently used key is purged.
    * @param keyName The name of the public key used to sign the interest.
    * @param timestamp The timestamp extracted from the interest name.
    */
@@ -523,9 +576,13 @@ private:
   //    validation rules so we don't keep loading from files.
   std::map<std::string, std::string> fixedCertificateCache_;
   // keyTimestamps_ stores the timestamps for each public key used in command
-  //   interests to avoid replay attacks.
-  // key is the public key name, value is the last timestamp.
-  std::map<std::string, MillisecondsSince1970> keyTimestamps_;
+  //   interests to avoid replay attacks. The list is ordered by lastUsed_,
+  //   least recent first, so that updateTimestampForKey only purges from the
+  //   front.
+  typedef std::list<KeyTimestampRecord> KeyTimestampList;
+  KeyTimestampList keyTimestamps_;
+  // keyTimestampIndex_ maps the public key name to its entry in keyTimestamps_.
+  std::map<Name, KeyTimestampList::iterator> keyTimestampIndex_;
   ptr_lib::shared_ptr<BoostInfoParser> config_;
   bool requiresVerification_;
   ptr_lib::shared_ptr<TrustAnchorRefreshManager> refreshManager_;
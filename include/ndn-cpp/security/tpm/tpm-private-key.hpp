@@ -190,15 +190,16 @@ private:
    * privateKeyDer and set the private key value. This is necessary because
    * d2i_ECPrivateKey does not seem to work with the "parameterless" private
    * key encoding produced by ndn-cxx.
-   * @param algorithmParameters The parameters from the PKCS #8 AlgorithmIdentifier.
+   * @param algorithmParameters The payload of the curve OID in the parameters
+   * from the PKCS #8 AlgorithmIdentifier, or an isNull() BlobLite if none.
    * @param privateKeyDer The bytes of the inner PKCS #8 private key.
    * @param privateKey The EcPrivateKeyLite to set.
    * @throws TpmPrivateKey::Error if can't decode the private key.
    */
   static void
   decodeEcPrivateKey
-    (const ptr_lib::shared_ptr<DerNode>& algorithmParameters,
-     const Blob& privateKeyDer, EcPrivateKeyLite& privateKey);
+    (const BlobLite& algorithmParameters, const BlobLite& privateKeyDer,
+     EcPrivateKeyLite& privateKey);
 
   /**
    * Get the curve ID from ecPrivateKey and return the OID from EC_KEY_INFO.
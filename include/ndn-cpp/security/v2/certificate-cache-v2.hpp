@@ -50,9 +50,13 @@ public:
    * removed no later than its NotAfter time, or maxLifetimeMilliseconds given
    * to the constructor.
    * @param certificate The certificate object, which is copied.
+   * @param trustAnchorName (optional) The name of the trust anchor certificate
+   * that the certificate chain was verified to, which can be retrieved with
+   * getTrustAnchorName(). If omitted, use an empty Name.
    */
   void
-  insert(const CertificateV2& certificate);
+  insert
+    (const CertificateV2& certificate, const Name& trustAnchorName = Name());
 
   /**
    * Find the certificate by the given key name.
@@ -75,6 +79,16 @@ public:
   ptr_lib::shared_ptr<CertificateV2>
   find(const Interest& interest) const;
 
+  /**
+   * Get the name of the trust anchor that was given to insert() for the
+   * certificate.
+   * @param certificateName The full name of the certificate.
+   * @return The trust anchor name, or an empty Name if the certificate is not
+   * in the cache or was inserted without a trust anchor name.
+   */
+  Name
+  getTrustAnchorName(const Name& certificateName) const;
+
   /**
    * Remove the certificate whose name equals the given name. If no such
    * certificate is in the cache, do nothing.
@@ -122,11 +136,13 @@ private:
      * @param certificate The certificate.
      * @param removalTime The removal time for this entry  as milliseconds since
      * Jan 1, 1970 UTC.
+     * @param trustAnchorName The name of the trust anchor certificate.
      */
     Entry
       (const ptr_lib::shared_ptr<CertificateV2>& certificate,
-       MillisecondsSince1970 removalTime)
-    : certificate_(certificate), removalTime_(removalTime)
+       MillisecondsSince1970 removalTime, const Name& trustAnchorName)
+    : certificate_(certificate), removalTime_(removalTime),
+      trustAnchorName_(trustAnchorName)
     {}
 
     Entry()
@@ -136,6 +152,7 @@ private:
 
     ptr_lib::shared_ptr<CertificateV2> certificate_;
     MillisecondsSince1970 removalTime_;
+    Name trustAnchorName_;
   };
 
   /**
@@ -47,7 +47,25 @@ public:
    * @return The found certificate, or null if not found.
    */
   ptr_lib::shared_ptr<CertificateV2>
-  findTrustedCertificate(const Interest& interestForCertificate);
+  findTrustedCertificate(const Interest& interestForCertificate)
+  {
+    Name trustAnchorName;
+    return findTrustedCertificate(interestForCertificate, trustAnchorName);
+  }
+
+  /**
+   * Find a trusted certificate in the trust anchor container or in the
+   * verified cache, and get the trust anchor which it chains to.
+   * @param interestForCertificate The Interest for the certificate.
+   * @param trustAnchorName Set this to the name of the trust anchor which the
+   * found certificate chains to. If the found certificate is a trust anchor,
+   * this is its name. If the certificate was cached without a trust anchor
+   * name, this is an empty Name.
+   * @return The found certificate, or null if not found.
+   */
+  ptr_lib::shared_ptr<CertificateV2>
+  findTrustedCertificate
+    (const Interest& interestForCertificate, Name& trustAnchorName);
 
   /**
    * Check if the certificate with the given name prefix exists in the verified
@@ -133,11 +151,14 @@ public:
   /**
    * Cache the verified certificate a period of time (1 hour).
    * @param certificate The certificate object, which is copied.
+   * @param trustAnchorName (optional) The name of the trust anchor which the
+   * certificate chain was verified to. If omitted, use an empty Name.
    */
   void
-  cacheVerifiedCertificate(const CertificateV2& certificate)
+  cacheVerifiedCertificate
+    (const CertificateV2& certificate, const Name& trustAnchorName = Name())
   {
-    verifiedCertificateCache_.insert(certificate);
+    verifiedCertificateCache_.insert(certificate, trustAnchorName);
   }
 
   /**
@@ -24,6 +24,7 @@
 #define NDN_TRUST_ANCHOR_GROUP_HPP
 
 #include <set>
+#include <map>
 #include "certificate-v2.hpp"
 
 namespace ndn {
@@ -166,7 +167,11 @@ public:
    * folder is removed, becomes empty, or no longer contains valid certificates,
    * then the anchor group becomes empty.
    *
-   * Upon refresh, the existing certificates are not changed.
+   * Upon refresh, the existing certificates are not changed. Only the files
+   * which were added, removed or modified since the last refresh are read
+   * again. If the system supports inotify, the changed files are reported by
+   * the kernel, otherwise they are found by comparing the modification time
+   * and size of each file.
    *
    * @param certificateContainer A certificate container into which trust
    * anchors from the group will be added.
@@ -185,6 +190,9 @@ public:
      const std::string& path, Milliseconds refreshPeriod,
      bool isDirectory = false);
 
+  virtual
+  ~DynamicTrustAnchorGroup();
+
   /**
    * Request a certificate refresh.
    */
@@ -192,13 +200,82 @@ public:
   refresh();
 
 private:
+  /**
+   * DynamicTrustAnchorGroup::FileInfo is the value of the files_ map.
+   */
+  class FileInfo {
+  public:
+    FileInfo()
+    : modificationTime_(0), size_(0)
+    {}
+
+    MillisecondsSince1970 modificationTime_;
+    uint64_t size_;
+    // The name of the certificate in the file, or empty if it is not valid.
+    Name certificateName_;
+  };
+
+  /**
+   * Check every file under path_ and update the ones whose modification time
+   * or size changed. Remove the anchors of the files which are gone.
+   */
+  void
+  rescan();
+
+  /**
+   * Read the file again if it changed, and update its anchor. If the file is
+   * no longer a regular file, remove its anchor.
+   * @param filePath The path of the file.
+   * @param force If true, read the file even if its modification time and
+   * size did not change.
+   */
+  void
+  updateFile(const std::string& filePath, bool force);
+
+  /**
+   * Forget the file and remove its anchor if no other file has it.
+   * @param filePath The path of the file.
+   */
   void
-  loadCertificate(const std::string& file, std::set<Name>& oldAnchorNames);
+  removeFile(const std::string& filePath);
+
+  /**
+   * Remove the anchor unless another file in files_ has it.
+   * @param certificateName The name of the anchor certificate.
+   */
+  void
+  removeAnchorIfUnused(const Name& certificateName);
+
+  /**
+   * Start an inotify watch on the directory of the anchor files. If inotify
+   * is not supported or the directory doesn't exist, do nothing.
+   */
+  void
+  startWatch();
+
+  /**
+   * Close the inotify watch, if any.
+   */
+  void
+  stopWatch();
+
+  /**
+   * Read the pending inotify events and update the changed files.
+   * @return True if the events were processed, or false if events were lost or
+   * the directory itself was removed so that the caller must call rescan().
+   */
+  bool
+  processWatchEvents();
 
   bool isDirectory_;
   std::string path_;
+  // The directory with the anchor files, which is path_ if isDirectory_.
+  std::string directory_;
   Milliseconds refreshPeriod_;
   Milliseconds expireTime_;
+  // The key is the file path.
+  std::map<std::string, FileInfo> files_;
+  int inotifyFd_;
 };
 
 }
@@ -24,6 +24,7 @@
 #define NDN_VALIDATION_POLICY_COMMAND_INTEREST_HPP
 
 #include <map>
+#include <list>
 #include "validation-policy.hpp"
 
 namespace ndn {
@@ -189,16 +190,23 @@ private:
     (const Interest& interest, const Name& keyName,
      MillisecondsSince1970 timestamp);
 
+  typedef std::list<LastTimestampRecord> RecordList;
+
   /**
    * Find the record in container_ which has the keyName.
    * @param keyName The key name to search for.
-   * @return The index in container_ of the record, or -1 if not found.
+   * @return The iterator in container_ of the record, or container_.end() if
+   * not found.
    */
-  int
+  RecordList::iterator
   findByKeyName(const Name& keyName);
 
   Options options_;
-  std::vector<ptr_lib::shared_ptr<LastTimestampRecord> > container_;
+  // container_ is ordered by lastRefreshed_, oldest first, so that cleanUp only
+  // looks at the front. A refreshed record is moved to the back.
+  RecordList container_;
+  // recordIndex_ maps the key name to its record in container_.
+  std::map<Name, RecordList::iterator> recordIndex_;
   Milliseconds nowOffsetMilliseconds_;
 };
 
@@ -450,6 +450,13 @@ private:
     void
     initialOndata(const google::protobuf::RepeatedPtrField<Sync::SyncState >& content);
 
+    /**
+     * Express the sync interest for the digest tree root, using
+     * syncInterestTemplate_ to encode it.
+     */
+    void
+    expressSyncInterest();
+
     /**
      * This is a do-nothing onData for using expressInterest for timeouts.
      * This should never be called.
@@ -469,6 +476,8 @@ private:
     ptr_lib::shared_ptr<DigestTree> digestTree_;
     std::string applicationDataPrefixUri_;
     const Name applicationBroadcastPrefix_;
+    // The pre-encoded sync interest for the broadcast prefix and syncLifetime_.
+    InterestTemplate syncInterestTemplate_;
     int sessionNo_;
     int initialPreviousSequenceNo_;
     int sequenceNo_;
@@ -102,6 +102,19 @@ public:
      const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
      WireFormat& wireFormat = *WireFormat::getDefaultWireFormat());
 
+  /**
+   * Override to use the ioService given to the constructor to dispatch
+   * expressInterest to be called in a thread-safe manner. This makes the
+   * Interest from the template in the calling thread. See
+   * Face.expressInterest for calling details.
+   */
+  virtual uint64_t
+  expressInterest
+    (const InterestTemplate& interestTemplate,
+     const Name::Component& finalComponent, const OnData& onData,
+     const OnTimeout& onTimeout = OnTimeout(),
+     const OnNetworkNack& onNetworkNack = OnNetworkNack());
+
   uint64_t
   expressInterest
     (const Name& name, const OnData& onData, const OnTimeout& onTimeout = OnTimeout(),
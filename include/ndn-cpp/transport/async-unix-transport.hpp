@@ -30,6 +30,7 @@
 #include <boost/asio.hpp>
 #include "../common.hpp"
 #include "transport.hpp"
+#include "send-queue-options.hpp"
 
 namespace ndn {
 
@@ -113,15 +114,41 @@ public:
      ElementListener& elementListener, const OnConnected& onConnected);
 
   /**
-   * Send data to the host. To be thread-safe, this must be called from a
-   * dispatch to the ioService which was given to the constructor, as is done by
-   * ThreadsafeFace.
+   * Queue data to send to the host and start an asynchronous write if one is
+   * not already in progress. This copies the data and does not block, so a
+   * slow peer does not stall the io_service. See setSendQueueOptions. To be
+   * thread-safe, this must be called from a dispatch to the ioService which was
+   * given to the constructor, as is done by ThreadsafeFace.
    * @param data A pointer to the buffer of data to send.
    * @param dataLength The number of bytes in data.
+   * @throws runtime_error if not connected, or if the send queue is full and
+   * the drop policy is SendQueueOptions::THROW_ERROR.
    */
   virtual void
   send(const uint8_t *data, size_t dataLength);
 
+  /**
+   * Set the limits, drop policy and watermark callbacks of the send queue. To
+   * be thread-safe, this must be called from a dispatch to the ioService.
+   * @param options The SendQueueOptions, which is copied.
+   */
+  void
+  setSendQueueOptions(const SendQueueOptions& options);
+
+  /**
+   * Get the number of bytes which are queued or being written.
+   * @return The number of queued bytes.
+   */
+  size_t
+  getQueuedBytes();
+
+  /**
+   * Get the number of packets dropped because the send queue was full.
+   * @return The number of dropped packets.
+   */
+  uint64_t
+  getDroppedPacketCount();
+
   /**
    * Do nothing since the asio io_service reads the socket.
    */
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_LOOPBACK_FORWARDER_HPP
+#define NDN_LOOPBACK_FORWARDER_HPP
+
+#include <map>
+#include <vector>
+#include "../interest.hpp"
+#include "../data.hpp"
+
+namespace ndn {
+
+class LoopbackTransport;
+
+/**
+ * A LoopbackForwarder is a minimal in-process stand-in for NFD which forwards
+ * packets between LoopbackTransport objects. It has a FIB and a PIT:
+ * - An incoming Interest is sent to each face of the FIB entry with the
+ *   longest matching prefix, except the incoming face. If there is no route,
+ *   a network Nack with reason NoRoute is returned to the incoming face.
+ * - An incoming Data is sent to the incoming face of each matching PIT entry.
+ *   Unsolicited Data is dropped.
+ * - An Interest for /localhost/nfd/rib/register or
+ *   /localhost/nfd/rib/unregister (or /localhop) adds or removes the FIB entry
+ *   for the incoming face and returns a ControlResponse with status code 200.
+ *   The command signature is not checked.
+ * There is no content store and no forwarding strategy. This is not thread
+ * safe.
+ */
+class LoopbackForwarder {
+public:
+  LoopbackForwarder();
+
+  /**
+   * Add the transport as a new face. This is called by
+   * LoopbackTransport::connect.
+   * @param transport The transport, which must call removeFace before it is
+   * destroyed.
+   * @return The new face ID.
+   */
+  uint64_t
+  addFace(LoopbackTransport* transport);
+
+  /**
+   * Remove the face and its FIB and PIT entries. This is called by
+   * LoopbackTransport::close. If the face doesn't exist, do nothing.
+   * @param faceId The face ID returned by addFace.
+   */
+  void
+  removeFace(uint64_t faceId);
+
+  /**
+   * Forward the packet which was sent by the face. This is called by
+   * LoopbackTransport::send.
+   * @param faceId The ID of the face which sent the packet.
+   * @param packet The whole encoded Interest or Data packet.
+   */
+  void
+  onReceivedPacket(uint64_t faceId, const Blob& packet);
+
+  /**
+   * Add a route to the FIB, like registering a prefix.
+   * @param prefix The name prefix.
+   * @param faceId The face ID to forward matching Interests to.
+   */
+  void
+  addRoute(const Name& prefix, uint64_t faceId);
+
+  /**
+   * Remove the route from the FIB. If it doesn't exist, do nothing.
+   * @param prefix The name prefix.
+   * @param faceId The face ID.
+   */
+  void
+  removeRoute(const Name& prefix, uint64_t faceId);
+
+  /**
+   * Get the number of entries in the PIT, including expired entries which
+   * have not been removed yet.
+   * @return The number of PIT entries.
+   */
+  size_t
+  getPitSize() const;
+
+private:
+  /**
+   * A PitEntry holds an Interest and its incoming face.
+   */
+  class PitEntry {
+  public:
+    PitEntry
+      (const ptr_lib::shared_ptr<Interest>& interest, uint64_t faceId,
+       MillisecondsSince1970 expirationTime)
+    : interest_(interest), faceId_(faceId), expirationTime_(expirationTime)
+    {
+    }
+
+    ptr_lib::shared_ptr<Interest> interest_;
+    uint64_t faceId_;
+    MillisecondsSince1970 expirationTime_;
+  };
+
+  void
+  processInterest(uint64_t faceId, const Blob& packet);
+
+  void
+  processData(uint64_t faceId, const Blob& packet);
+
+  /**
+   * Process a RIB register or unregister command and send the response.
+   */
+  void
+  processRibCommand
+    (uint64_t faceId, const Interest& interest, bool isRegister);
+
+  /**
+   * Add the faces of the unexpired entries in pitEntries which match the data
+   * to outFaceIds, and erase the matching and expired entries.
+   */
+  static void
+  extractMatchingEntries
+    (std::vector<PitEntry>& pitEntries, const Data& data,
+     MillisecondsSince1970 now, std::vector<uint64_t>& outFaceIds);
+
+  /**
+   * If now is past nextPruneTime_, remove all expired PIT entries.
+   */
+  void
+  pruneExpiredEntries(MillisecondsSince1970 now);
+
+  /**
+   * Send a network Nack with the reason to the face.
+   */
+  void
+  sendNack(uint64_t faceId, const Blob& interestPacket, int reason);
+
+  /**
+   * Queue the packet for the face, if it exists.
+   */
+  void
+  sendToFace(uint64_t faceId, const Blob& packet);
+
+  std::map<uint64_t, LoopbackTransport*> faces_;
+  uint64_t lastFaceId_;
+  // The key is the prefix. The value is the list of face IDs.
+  std::map<Name, std::vector<uint64_t> > fib_;
+  // The key is the Interest name so that processData only checks the entries
+  // which can match. The value is the list of entries with that name.
+  std::map<Name, std::vector<PitEntry> > pit_;
+  Name localhostRibPrefix_;
+  Name localhopRibPrefix_;
+  MillisecondsSince1970 nextPruneTime_;
+};
+
+}
+
+#endif
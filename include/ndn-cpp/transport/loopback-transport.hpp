@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_LOOPBACK_TRANSPORT_HPP
+#define NDN_LOOPBACK_TRANSPORT_HPP
+
+#include <deque>
+#include "../common.hpp"
+#include "../util/blob.hpp"
+#include "transport.hpp"
+
+namespace ndn {
+
+class LoopbackForwarder;
+
+/**
+ * LoopbackTransport extends the Transport interface to send and receive
+ * packets in memory through a LoopbackForwarder in the same process, so that
+ * Face objects can communicate without NFD. This is useful for tests and
+ * benchmarks. The forwarder queues each packet for the destination transport,
+ * and processEvents delivers the queued packets to the element listener.
+ */
+class LoopbackTransport : public Transport {
+public:
+  /**
+   * A LoopbackTransport::ConnectionInfo extends Transport::ConnectionInfo to
+   * hold the LoopbackForwarder.
+   */
+  class ConnectionInfo : public Transport::ConnectionInfo {
+  public:
+    /**
+     * Create a ConnectionInfo with the given forwarder.
+     * @param forwarder The LoopbackForwarder to connect to.
+     */
+    ConnectionInfo(const ptr_lib::shared_ptr<LoopbackForwarder>& forwarder)
+    : forwarder_(forwarder)
+    {
+    }
+
+    /**
+     * Get the forwarder given to the constructor.
+     * @return The LoopbackForwarder.
+     */
+    const ptr_lib::shared_ptr<LoopbackForwarder>&
+    getForwarder() const { return forwarder_; }
+
+    virtual
+    ~ConnectionInfo();
+
+  private:
+    ptr_lib::shared_ptr<LoopbackForwarder> forwarder_;
+  };
+
+  LoopbackTransport();
+
+  /**
+   * Determine whether this transport connecting according to connectionInfo is
+   * to a node on the current machine. Loopback transports are always local.
+   * @param connectionInfo This is ignored.
+   * @return True because loopback transports are always local.
+   */
+  virtual bool
+  isLocal(const Transport::ConnectionInfo& connectionInfo);
+
+  /**
+   * Override to return false since connect does not need to use the
+   * onConnected callback.
+   * @return False.
+   */
+  virtual bool
+  isAsync();
+
+  /**
+   * Add this transport as a face of the forwarder in connectionInfo.
+   * @param connectionInfo A reference to a LoopbackTransport::ConnectionInfo.
+   * @param elementListener Not a shared_ptr because we assume that it will
+   * remain valid during the life of this object.
+   * @param onConnected If not null, this calls onConnected() when the
+   * connection is established.
+   */
+  virtual void
+  connect
+    (const Transport::ConnectionInfo& connectionInfo,
+     ElementListener& elementListener, const OnConnected& onConnected);
+
+  /**
+   * Give the packet to the forwarder. Each call must send one whole packet,
+   * which is what Face does.
+   * @param data A pointer to the buffer of data to send.
+   * @param dataLength The number of bytes in data.
+   */
+  virtual void
+  send(const uint8_t *data, size_t dataLength);
+
+  /**
+   * Call elementListener.onReceivedElement for each packet which the forwarder
+   * queued for this transport before this call. Packets queued by the
+   * callbacks are delivered by the next call to processEvents.
+   */
+  virtual void
+  processEvents();
+
+  virtual bool
+  getIsConnected();
+
+  /**
+   * Remove this transport from the forwarder and clear the queue.
+   */
+  virtual void
+  close();
+
+  /**
+   * Add the packet to the queue for processEvents. This is called by the
+   * LoopbackForwarder.
+   * @param packet The encoded packet. This keeps a pointer to the Blob.
+   */
+  void
+  queuePacket(const Blob& packet) { queue_.push_back(packet); }
+
+  /**
+   * Get the face ID which the forwarder assigned in connect.
+   * @return The face ID, or 0 if not connected.
+   */
+  uint64_t
+  getFaceId() const { return faceId_; }
+
+  ~LoopbackTransport();
+
+private:
+  ptr_lib::shared_ptr<LoopbackForwarder> forwarder_;
+  ElementListener* elementListener_;
+  uint64_t faceId_;
+  std::deque<Blob> queue_;
+};
+
+}
+
+#endif
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_SEND_QUEUE_OPTIONS_HPP
+#define NDN_SEND_QUEUE_OPTIONS_HPP
+
+#include <limits>
+#include "../common.hpp"
+
+namespace ndn {
+
+/**
+ * SendQueueOptions holds the limits and callbacks for the bounded send queue
+ * of an asynchronous transport such as AsyncTcpTransport. The transport queues
+ * each sent packet and writes queued packets to the socket with a single
+ * gathering asynchronous write, so that a slow peer does not block the
+ * io_service thread. By default the queue has no maximum so that no packet is
+ * dropped, and the application can use the watermark callbacks to slow down.
+ * If setMaxQueuedBytes sets a maximum, getDroppedPacketCount of the transport
+ * reports the packets dropped by the drop policy.
+ */
+class SendQueueOptions {
+public:
+  /**
+   * A DropPolicy says what to do when a packet would make the queued bytes
+   * exceed the maximum.
+   * DROP_NEWEST: Drop the packet being sent.
+   * DROP_OLDEST: Drop the oldest queued packets which are not already being
+   *   written, until the new packet fits.
+   * THROW_ERROR: Throw a runtime_error from send.
+   */
+  enum DropPolicy {
+    DROP_NEWEST = 0,
+    DROP_OLDEST = 1,
+    THROW_ERROR = 2
+  };
+
+  typedef func_lib::function<void()> OnWatermark;
+
+  typedef func_lib::function<void(const std::string& message)> OnWriteError;
+
+  /**
+   * Create a SendQueueOptions with the default values: no maximum of queued
+   * bytes, a high watermark of 1 MiB, a low watermark of 256 KiB, the
+   * DROP_NEWEST policy (which only applies after setMaxQueuedBytes) and no
+   * callbacks.
+   */
+  SendQueueOptions()
+  : maxQueuedBytes_(std::numeric_limits<size_t>::max()),
+    highWatermark_(1024 * 1024), lowWatermark_(256 * 1024),
+    dropPolicy_(DROP_NEWEST)
+  {
+  }
+
+  /**
+   * Get the maximum number of bytes which may be queued, including the bytes
+   * being written.
+   * @return The maximum number of queued bytes, or the largest size_t for no
+   * maximum.
+   */
+  size_t
+  getMaxQueuedBytes() const { return maxQueuedBytes_; }
+
+  /**
+   * Get the number of queued bytes at which onHighWatermark is called.
+   * @return The high watermark in bytes.
+   */
+  size_t
+  getHighWatermark() const { return highWatermark_; }
+
+  /**
+   * Get the number of queued bytes at which onLowWatermark is called after
+   * the queue has reached the high watermark.
+   * @return The low watermark in bytes.
+   */
+  size_t
+  getLowWatermark() const { return lowWatermark_; }
+
+  /**
+   * Get the policy for when the queue is full.
+   * @return The drop policy.
+   */
+  DropPolicy
+  getDropPolicy() const { return dropPolicy_; }
+
+  /**
+   * Get the callback for when the queued bytes reach the high watermark.
+   * @return The OnWatermark callback, or an empty OnWatermark() if not set.
+   */
+  const OnWatermark&
+  getOnHighWatermark() const { return onHighWatermark_; }
+
+  /**
+   * Get the callback for when the queued bytes drain to the low watermark.
+   * @return The OnWatermark callback, or an empty OnWatermark() if not set.
+   */
+  const OnWatermark&
+  getOnLowWatermark() const { return onLowWatermark_; }
+
+  /**
+   * Get the callback for when an asynchronous write fails.
+   * @return The OnWriteError callback, or an empty OnWriteError() if not set.
+   */
+  const OnWriteError&
+  getOnWriteError() const { return onWriteError_; }
+
+  /**
+   * Set the maximum number of bytes which may be queued. When a packet would
+   * exceed this, the drop policy applies. A single packet larger than this is
+   * still sent if the queue is empty.
+   * @param maxQueuedBytes The maximum number of queued bytes.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setMaxQueuedBytes(size_t maxQueuedBytes)
+  {
+    maxQueuedBytes_ = maxQueuedBytes;
+    return *this;
+  }
+
+  /**
+   * Set the high and low watermarks.
+   * @param highWatermark The number of queued bytes at which onHighWatermark
+   * is called.
+   * @param lowWatermark The number of queued bytes at which onLowWatermark is
+   * called after the queue has reached the high watermark. This should be less
+   * than highWatermark.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setWatermarks(size_t highWatermark, size_t lowWatermark)
+  {
+    highWatermark_ = highWatermark;
+    lowWatermark_ = lowWatermark;
+    return *this;
+  }
+
+  /**
+   * Set the policy for when the queue is full.
+   * @param dropPolicy The drop policy.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setDropPolicy(DropPolicy dropPolicy)
+  {
+    dropPolicy_ = dropPolicy;
+    return *this;
+  }
+
+  /**
+   * Set the callback for when the queued bytes reach the high watermark. An
+   * application can use this to stop producing packets for the transport.
+   * This is called on the io_service thread.
+   * @param onHighWatermark The callback, or an empty OnWatermark() for none.
+   * This copies the function object.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setOnHighWatermark(const OnWatermark& onHighWatermark)
+  {
+    onHighWatermark_ = onHighWatermark;
+    return *this;
+  }
+
+  /**
+   * Set the callback for when the queued bytes drain to the low watermark
+   * after reaching the high watermark. An application can use this to resume
+   * producing packets. This is called on the io_service thread.
+   * @param onLowWatermark The callback, or an empty OnWatermark() for none.
+   * This copies the function object.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setOnLowWatermark(const OnWatermark& onLowWatermark)
+  {
+    onLowWatermark_ = onLowWatermark;
+    return *this;
+  }
+
+  /**
+   * Set the callback for when an asynchronous write fails, for example because
+   * the peer closed the connection. Before calling this, the transport closes
+   * the connection and discards the queued packets, so that getIsConnected()
+   * is false. This is called on the io_service thread.
+   * @param onWriteError The callback, or an empty OnWriteError() for none.
+   * This copies the function object.
+   * @return This SendQueueOptions so that you can chain calls to update values.
+   */
+  SendQueueOptions&
+  setOnWriteError(const OnWriteError& onWriteError)
+  {
+    onWriteError_ = onWriteError;
+    return *this;
+  }
+
+private:
+  size_t maxQueuedBytes_;
+  size_t highWatermark_;
+  size_t lowWatermark_;
+  DropPolicy dropPolicy_;
+  OnWatermark onHighWatermark_;
+  OnWatermark onLowWatermark_;
+  OnWriteError onWriteError_;
+};
+
+}
+
+#endif
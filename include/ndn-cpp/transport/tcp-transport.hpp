@@ -146,6 +146,8 @@ public:
 private:
   ptr_lib::shared_ptr<struct ndn_TcpTransport> transport_;
   ptr_lib::shared_ptr<DynamicUInt8Vector> elementBuffer_;
+  // processEvents reuses this buffer for each socket receive.
+  std::vector<uint8_t> receiveBuffer_;
   bool isConnected_;
   ConnectionInfo connectionInfo_;
   bool isLocal_;
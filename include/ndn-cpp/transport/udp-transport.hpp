@@ -28,6 +28,9 @@
 
 struct ndn_UdpTransport;
 
+// Give friend access to the tests.
+class TestUdpTransport_MaxFragmentSize_Test;
+
 namespace ndn {
 
 class DynamicUInt8Vector;
@@ -109,16 +112,61 @@ public:
           ElementListener& elementListener, const OnConnected& onConnected);
 
   /**
-   * Send data to the host
+   * Send data to the host. If getMtu() is not zero and dataLength is greater
+   * than getMtu(), then use NDNLPv2 to split the data into fragments which each
+   * fit in one datagram of getMtu() bytes, and send each fragment.
    * @param data A pointer to the buffer of data to send.
    * @param dataLength The number of bytes in data.
    */
   virtual void
   send(const uint8_t *data, size_t dataLength);
 
+  /**
+   * Get the maximum datagram size for sending, as set by setMtu.
+   * @return The MTU in bytes, or 0 if fragmentation is disabled.
+   */
+  size_t
+  getMtu() const { return mtu_; }
+
+  /**
+   * Set the maximum datagram size for sending. A packet larger than this is
+   * sent as NDNLPv2 fragments so that it is not split by IP fragmentation. The
+   * receiver (such as NFD or a Face using this library) reassembles the
+   * fragments.
+   * @param mtu The MTU in bytes. If 0, disable fragmentation so that each
+   * packet is sent in one datagram (the default).
+   * @throws runtime_error If mtu is not 0 and is too small to hold an NDNLPv2
+   * fragment header and at least one byte of the packet.
+   */
+  void
+  setMtu(size_t mtu);
+
+  /**
+   * Get the size of the kernel's receive buffer requested by
+   * setReceiveBufferSize.
+   * @return The requested size in bytes, or 0 to use the system default.
+   */
+  int
+  getReceiveBufferSize() const { return receiveBufferSize_; }
+
+  /**
+   * Set the size of the kernel's receive buffer for the socket (SO_RCVBUF).
+   * Datagrams which arrive while the buffer is full are dropped by the kernel,
+   * so a larger buffer helps a consumer that receives bursts of Data packets.
+   * If the transport is connected, this applies immediately, otherwise it is
+   * applied by connect. The kernel may limit the size, for example to
+   * net.core.rmem_max on Linux.
+   * @param receiveBufferSize The requested size in bytes, or 0 to use the
+   * system default.
+   * @throws runtime_error If the socket option can't be set.
+   */
+  void
+  setReceiveBufferSize(int receiveBufferSize);
+
   /**
    * Process any data to receive.  For each element received, call
-   * elementListener.onReceivedElement. This is non-blocking and will return
+   * elementListener.onReceivedElement. Where supported, this receives a batch
+   * of datagrams with one call to recvmmsg. This is non-blocking and will return
    * immediately if there is no data to receive. You should normally not call
    * this directly since it is called by Face.processEvents.
    * @throws This may throw an exception for reading data or in the callback for
@@ -138,9 +186,37 @@ public:
   close();
 
 private:
+  // Give friend access to the tests.
+  friend ::TestUdpTransport_MaxFragmentSize_Test;
+
+  /**
+   * Get the maximum number of packet bytes in one NDNLPv2 fragment so that the
+   * encoded LpPacket fits in mtu bytes. The size of the TLV length fields
+   * depends on the fragment size, so this is computed from the MTU.
+   * @param mtu The MTU in bytes.
+   * @return The maximum fragment size, or 0 if mtu is too small for an
+   * LpPacket with at least one byte of the packet.
+   */
+  static size_t
+  getMaxFragmentSize(size_t mtu);
+
+  /**
+   * Split the data into NDNLPv2 fragments of at most mtu_ bytes and send each.
+   * @param data A pointer to the buffer of data to send.
+   * @param dataLength The number of bytes in data.
+   */
+  void
+  sendFragments(const uint8_t *data, size_t dataLength);
+
   ptr_lib::shared_ptr<struct ndn_UdpTransport> transport_;
   ptr_lib::shared_ptr<DynamicUInt8Vector> elementBuffer_;
   bool isConnected_;
+  size_t mtu_;
+  uint64_t nextSequence_;
+  ptr_lib::shared_ptr<DynamicUInt8Vector> fragmentBuffer_;
+  int receiveBufferSize_;
+  // processEvents reuses this buffer, which has a slot for each datagram.
+  std::vector<uint8_t> receiveBuffer_;
 };
 
 }
@@ -132,6 +132,8 @@ public:
 private:
   ptr_lib::shared_ptr<struct ndn_UnixTransport> transport_;
   ptr_lib::shared_ptr<DynamicUInt8Vector> elementBuffer_;
+  // processEvents reuses this buffer for each socket receive.
+  std::vector<uint8_t> receiveBuffer_;
   bool isConnected_;
 };
 
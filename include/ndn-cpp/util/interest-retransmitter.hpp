@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_INTEREST_RETRANSMITTER_HPP
+#define NDN_INTEREST_RETRANSMITTER_HPP
+
+#include <list>
+#include <map>
+#include "../face.hpp"
+#include "rtt-estimator.hpp"
+
+namespace ndn {
+
+/**
+ * An InterestRetransmitter expresses Interests through a Face and retransmits
+ * them using an adaptive timeout instead of a fixed Interest lifetime. It keeps
+ * an RttEstimator for each name prefix, where the prefix is the Interest name
+ * without its final component (for example a segment or sequence number), so
+ * that Interests for the same collection share the RTT measurements. Each
+ * transmission uses the prefix's current RTO as the Interest lifetime. On
+ * timeout, the RTO is backed off and the Interest is sent again with a new
+ * nonce, up to maxRetries times. The RTO is backed off once per loss event,
+ * so when several Interests sent with the same RTO time out together, only
+ * the first doubles it. A network Nack with reason CONGESTION or
+ * DUPLICATE is retried in the same way (a CONGESTION retry waits for the RTO
+ * first). Other Nacks are reported to the caller without retrying.
+ * Unlike ExponentialReExpress, this is a single object which can be shared by
+ * all the callers on a Face so that they benefit from each other's
+ * measurements. To bound memory, this keeps the RttEstimator of at most
+ * maxPrefixCount prefixes and discards the least recently used one.
+ */
+class InterestRetransmitter {
+public:
+  /**
+   * Create an InterestRetransmitter for the Face.
+   * @param face This calls face.expressInterest and face.callLater. The Face
+   * must remain valid while there are outstanding Interests.
+   * @param maxRetries (optional) The maximum number of times to retransmit an
+   * Interest before calling onTimeout. If omitted, use 3.
+   * @param initialRto (optional) The RTO in milliseconds for a prefix with no
+   * measurements. If omitted, use 1000.
+   * @param minRto (optional) The minimum RTO in milliseconds. If omitted, use
+   * 200.
+   * @param maxRto (optional) The maximum RTO in milliseconds. If omitted, use
+   * 60000.
+   * @param maxPrefixCount (optional) The maximum number of prefixes to keep an
+   * RttEstimator for. If omitted, use 1000.
+   */
+  InterestRetransmitter
+    (Face& face, int maxRetries = 3, Milliseconds initialRto = 1000.0,
+     Milliseconds minRto = 200.0, Milliseconds maxRto = 60000.0,
+     size_t maxPrefixCount = 1000)
+  : face_(face), maxRetries_(maxRetries), initialRto_(initialRto),
+    minRto_(minRto), maxRto_(maxRto),
+    maxPrefixCount_(maxPrefixCount > 0 ? maxPrefixCount : 1)
+  {
+  }
+
+  /**
+   * Express the Interest with the prefix's current RTO as the lifetime and
+   * retransmit it as described in the class documentation.
+   * @param interest The Interest to send. This copies the Interest. Its
+   * lifetime is replaced by the RTO for each transmission.
+   * @param onData When a matching Data packet is received, this calls
+   * onData(interest, data) where interest is the Interest given here.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onTimeout If the Interest times out after maxRetries
+   * retransmissions, or if a Nack is not retried and onNetworkNack is an empty
+   * OnNetworkNack(), this calls onTimeout(interest). If onTimeout is an empty
+   * OnTimeout(), this does not use it.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   * @param onNetworkNack (optional) If a network Nack is received and is not
+   * retried, this calls onNetworkNack(interest, networkNack). If omitted, call
+   * onTimeout instead.
+   * NOTE: The library will log any exceptions thrown by this callback, but for
+   * better error handling the callback should catch and properly handle any
+   * exceptions.
+   */
+  void
+  expressInterest
+    (const Interest& interest, const OnData& onData, const OnTimeout& onTimeout,
+     const OnNetworkNack& onNetworkNack = OnNetworkNack());
+
+  /**
+   * Get the RttEstimator for the prefix, creating it if needed, and mark it as
+   * the most recently used.
+   * @param prefix The name prefix, which is the Interest name without its final
+   * component.
+   * @return The RttEstimator. If more than maxPrefixCount other prefixes are
+   * used after this, this InterestRetransmitter discards it and makes a new
+   * one for the prefix.
+   */
+  ptr_lib::shared_ptr<RttEstimator>
+  getRttEstimator(const Name& prefix);
+
+  /**
+   * Get the number of prefixes which have an RttEstimator.
+   * @return The number of prefixes.
+   */
+  size_t
+  getRttEstimatorCount() const { return rttEstimators_.size(); }
+
+private:
+  class Request;
+
+  typedef std::list<std::pair<Name, ptr_lib::shared_ptr<RttEstimator> > >
+    RttEstimatorList;
+
+  Face& face_;
+  int maxRetries_;
+  Milliseconds initialRto_;
+  Milliseconds minRto_;
+  Milliseconds maxRto_;
+  size_t maxPrefixCount_;
+  // The most recently used prefix is at the front.
+  RttEstimatorList rttEstimatorLru_;
+  // The key is the Interest name without its final component.
+  std::map<Name, RttEstimatorList::iterator> rttEstimators_;
+};
+
+}
+
+#endif
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_RTT_ESTIMATOR_HPP
+#define NDN_RTT_ESTIMATOR_HPP
+
+#include "../common.hpp"
+
+namespace ndn {
+
+/**
+ * An RttEstimator keeps the smoothed round-trip time and round-trip time
+ * variation of Interest/Data exchanges and computes the retransmission
+ * timeout (RTO) as described in RFC 6298.
+ */
+class RttEstimator {
+public:
+  /**
+   * Create an RttEstimator with no measurements, where getRto() returns
+   * initialRto.
+   * @param initialRto (optional) The RTO in milliseconds before the first
+   * measurement. If omitted, use 1000 as in RFC 6298.
+   * @param minRto (optional) The minimum RTO in milliseconds. If omitted, use
+   * 200.
+   * @param maxRto (optional) The maximum RTO in milliseconds, which also limits
+   * backoff. If omitted, use 60000.
+   */
+  RttEstimator
+    (Milliseconds initialRto = 1000.0, Milliseconds minRto = 200.0,
+     Milliseconds maxRto = 60000.0)
+  : initialRto_(initialRto), minRto_(minRto), maxRto_(maxRto)
+  {
+    reset();
+  }
+
+  /**
+   * Update the smoothed RTT and RTT variation with a new measurement and
+   * recompute the RTO. Following Karn's algorithm, the caller should not add
+   * a measurement for a retransmitted Interest.
+   * @param rtt The measured round-trip time in milliseconds.
+   */
+  void
+  addMeasurement(Milliseconds rtt);
+
+  /**
+   * Double the RTO, up to the maximum RTO. Call this when a retransmission
+   * timer expires.
+   */
+  void
+  backoff();
+
+  /**
+   * Clear the measurements and set the RTO back to the initial RTO.
+   */
+  void
+  reset();
+
+  /**
+   * Get the current retransmission timeout.
+   * @return The RTO in milliseconds.
+   */
+  Milliseconds
+  getRto() const { return rto_; }
+
+  /**
+   * Get the smoothed round-trip time.
+   * @return The smoothed RTT in milliseconds, or -1 if there are no
+   * measurements.
+   */
+  Milliseconds
+  getSmoothedRtt() const { return smoothedRtt_; }
+
+  /**
+   * Get the round-trip time variation.
+   * @return The RTT variation in milliseconds, or -1 if there are no
+   * measurements.
+   */
+  Milliseconds
+  getRttVariation() const { return rttVariation_; }
+
+  /**
+   * Get the number of measurements added since creation or reset.
+   * @return The number of measurements.
+   */
+  size_t
+  getMeasurementCount() const { return measurementCount_; }
+
+private:
+  Milliseconds
+  clampRto(Milliseconds rto) const
+  {
+    if (rto < minRto_)
+      return minRto_;
+    if (rto > maxRto_)
+      return maxRto_;
+    return rto;
+  }
+
+  Milliseconds initialRto_;
+  Milliseconds minRto_;
+  Milliseconds maxRto_;
+  Milliseconds smoothedRtt_;
+  Milliseconds rttVariation_;
+  Milliseconds rto_;
+  size_t measurementCount_;
+};
+
+}
+
+#endif
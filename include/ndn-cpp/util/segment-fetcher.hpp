@@ -221,6 +221,8 @@ private:
   }
 
   std::vector<Blob> contentParts_;
+  // The template for Interests for the next segment, made by fetchNextSegment.
+  ptr_lib::shared_ptr<InterestTemplate> segmentInterestTemplate_;
   Face& face_;
   KeyChain* validatorKeyChain_;
   VerifySegment verifySegment_;
@@ -107,7 +107,15 @@ ndn_Error ndn_ElementReader_onReceivedData
       }
 
       if (!self->gotPartialDataError) {
-        if (self->partialDataLength + dataLength > MAX_NDN_PACKET_SIZE) {
+        size_t neededLength = self->partialDataLength + dataLength;
+        if (self->tlvStructureDecoder.state ==
+            ndn_TlvStructureDecoder_READ_VALUE_BYTES)
+          // The TLV header is decoded, so we know the length of the whole
+          // element. Check the limit now, and reserve the whole element so that
+          // partialData is not reallocated and copied again for each read.
+          neededLength += self->tlvStructureDecoder.nBytesToRead;
+
+        if (neededLength > MAX_NDN_PACKET_SIZE) {
           // Reset to read a new element on the next call.
           self->usePartialData = 0;
           ndn_TlvStructureDecoder_initialize(&self->tlvStructureDecoder);
@@ -115,7 +123,9 @@ ndn_Error ndn_ElementReader_onReceivedData
           return NDN_ERROR_ElementReader_The_incoming_packet_exceeds_the_maximum_limit_getMaxNdnPacketSize;
         }
 
-        if ((error = ndn_DynamicUInt8Array_copy
+        if ((error = ndn_DynamicUInt8Array_ensureLength
+             (self->partialData, neededLength)) ||
+            (error = ndn_DynamicUInt8Array_copy
              (self->partialData, data, dataLength, self->partialDataLength))) {
           // Set gotPartialDataError so we won't call onReceivedElement with invalid data.
           self->gotPartialDataError = 1;
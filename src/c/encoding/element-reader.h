@@ -30,6 +30,14 @@
 extern "C" {
 #endif
 
+/**
+ * The size of the buffer which a transport should receive into before calling
+ * ndn_ElementReader_onReceivedData. This is larger than MAX_NDN_PACKET_SIZE so
+ * that one socket read can return many packets, which onReceivedData frames in
+ * one pass and passes to the elementListener without copying.
+ */
+#define NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE 65536
+
 /**
  * Initialize an ndn_ElementReader struct with the elementListener and a buffer for saving partial data.
  * @param self pointer to the ndn_ElementReader struct
@@ -265,6 +265,20 @@ ndn_Tlv0_2WireFormat_decodeSignatureInfoAndValue
    size_t signatureInfoLength, const uint8_t *signatureValue,
    size_t signatureValueLength);
 
+/**
+ * Encode the lpPacket as an NDN-TLV LpPacket.
+ * @param lpPacket A pointer to the ndn_LpPacket struct to encode.
+ * @param output A pointer to a ndn_DynamicUInt8Array struct which receives the
+ * encoded output.  If the output->realloc function pointer is null, its array
+ * must be large enough to receive the entire encoding.
+ * @param encodingLength Set encodingLength to the length of the encoded output.
+ * @return 0 for success, else an error code.
+ */
+ndn_Error
+ndn_Tlv0_2WireFormat_encodeLpPacket
+  (const struct ndn_LpPacket *lpPacket, struct ndn_DynamicUInt8Array *output,
+   size_t *encodingLength);
+
 /**
  * Decode input as an NDN-TLV LpPacket and set the fields in the lpPacket struct.
  * @param lpPacket A pointer to the ndn_LpPacket struct whose fields are updated.
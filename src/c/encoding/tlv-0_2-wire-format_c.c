@@ -205,6 +205,20 @@ ndn_Tlv0_2WireFormat_decodeSignatureInfoAndValue
     (&decoder, ndn_Tlv_SignatureValue, &signature->signature);
 }
 
+ndn_Error
+ndn_Tlv0_2WireFormat_encodeLpPacket
+  (const struct ndn_LpPacket *lpPacket, struct ndn_DynamicUInt8Array *output,
+   size_t *encodingLength)
+{
+  ndn_Error error;
+  struct ndn_TlvEncoder encoder;
+  ndn_TlvEncoder_initialize(&encoder, output);
+  error = ndn_encodeTlvLpPacket(lpPacket, &encoder);
+  *encodingLength = encoder.offset;
+
+  return error;
+}
+
 ndn_Error
 ndn_Tlv0_2WireFormat_decodeLpPacket
   (struct ndn_LpPacket *lpPacket, const uint8_t *input, size_t inputLength)
@@ -23,6 +23,121 @@
 #include "../../lp/congestion-mark.h"
 #include "tlv-lp-packet.h"
 
+/**
+ * This private function is called by ndn_TlvEncoder_writeNestedTlv to write the
+ * TLVs in the body of the Nack header field.
+ * @param context This is the ndn_NetworkNack struct pointer which was passed to
+ * writeTlv.
+ * @param encoder the ndn_TlvEncoder which is calling this.
+ * @return 0 for success, else an error code.
+ */
+static ndn_Error
+encodeNackValue(const void *context, struct ndn_TlvEncoder *encoder)
+{
+  struct ndn_NetworkNack *networkNack = (struct ndn_NetworkNack *)context;
+
+  if (networkNack->reason == ndn_NetworkNackReason_NONE)
+    // Omit the NackReason.
+    return NDN_ERROR_success;
+  else if (networkNack->reason == ndn_NetworkNackReason_OTHER_CODE)
+    return ndn_TlvEncoder_writeNonNegativeIntegerTlv
+      (encoder, ndn_Tlv_LpPacket_NackReason,
+       (uint64_t)networkNack->otherReasonCode);
+  else
+    // The enum numeric values are the same as this wire format, so use as is.
+    return ndn_TlvEncoder_writeNonNegativeIntegerTlv
+      (encoder, ndn_Tlv_LpPacket_NackReason, (uint64_t)networkNack->reason);
+}
+
+/**
+ * This private function is called by ndn_TlvEncoder_writeNestedTlv to write the
+ * TLVs in the body of the LpPacket value.
+ * @param context This is the ndn_LpPacket struct pointer which was passed to
+ * writeTlv.
+ * @param encoder the ndn_TlvEncoder which is calling this.
+ * @return 0 for success, else an error code.
+ */
+static ndn_Error
+encodeLpPacketValue(const void *context, struct ndn_TlvEncoder *encoder)
+{
+  struct ndn_LpPacket *lpPacket = (struct ndn_LpPacket *)context;
+  ndn_Error error;
+  size_t i;
+
+  if (lpPacket->hasSequence) {
+    // The Sequence is a fixed-width 8-byte unsigned integer.
+    uint8_t sequenceBytes[8];
+    int j;
+    for (j = 0; j < 8; ++j)
+      sequenceBytes[j] = (uint8_t)(lpPacket->sequence >> (8 * (7 - j)));
+
+    if ((error = ndn_TlvEncoder_writeTypeAndLength
+         (encoder, ndn_Tlv_LpPacket_Sequence, sizeof(sequenceBytes))))
+      return error;
+    if ((error = ndn_TlvEncoder_writeArray
+         (encoder, sequenceBytes, sizeof(sequenceBytes))))
+      return error;
+  }
+  // Omit FragIndex and FragCount if they have the default values.
+  if (lpPacket->fragIndex != 0) {
+    if ((error = ndn_TlvEncoder_writeNonNegativeIntegerTlv
+         (encoder, ndn_Tlv_LpPacket_FragIndex, lpPacket->fragIndex)))
+      return error;
+  }
+  if (lpPacket->fragCount != 1) {
+    if ((error = ndn_TlvEncoder_writeNonNegativeIntegerTlv
+         (encoder, ndn_Tlv_LpPacket_FragCount, lpPacket->fragCount)))
+      return error;
+  }
+
+  // The header fields must be in order of their TLV type, so make a pass for
+  // each type.
+  for (i = 0; i < lpPacket->nHeaderFields; ++i) {
+    struct ndn_LpPacketHeaderField *field = &lpPacket->headerFields[i];
+    if (field->type == ndn_LpPacketHeaderFieldType_NETWORK_NACK) {
+      if ((error = ndn_TlvEncoder_writeNestedTlv
+           (encoder, ndn_Tlv_LpPacket_Nack, encodeNackValue,
+            &field->networkNack, 0)))
+        return error;
+    }
+  }
+  for (i = 0; i < lpPacket->nHeaderFields; ++i) {
+    struct ndn_LpPacketHeaderField *field = &lpPacket->headerFields[i];
+    if (field->type == ndn_LpPacketHeaderFieldType_INCOMING_FACE_ID) {
+      if ((error = ndn_TlvEncoder_writeNonNegativeIntegerTlv
+           (encoder, ndn_Tlv_LpPacket_IncomingFaceId,
+            field->incomingFaceId.faceId)))
+        return error;
+    }
+  }
+  for (i = 0; i < lpPacket->nHeaderFields; ++i) {
+    struct ndn_LpPacketHeaderField *field = &lpPacket->headerFields[i];
+    if (field->type == ndn_LpPacketHeaderFieldType_CONGESTION_MARK) {
+      if ((error = ndn_TlvEncoder_writeNonNegativeIntegerTlv
+           (encoder, ndn_Tlv_LpPacket_CongestionMark,
+            field->congestionMark.congestionMark)))
+        return error;
+    }
+  }
+
+  // The fragment is supposed to be the last field.
+  if (lpPacket->fragmentWireEncoding.value) {
+    if ((error = ndn_TlvEncoder_writeBlobTlv
+         (encoder, ndn_Tlv_LpPacket_Fragment, &lpPacket->fragmentWireEncoding)))
+      return error;
+  }
+
+  return NDN_ERROR_success;
+}
+
+ndn_Error
+ndn_encodeTlvLpPacket
+  (const struct ndn_LpPacket *lpPacket, struct ndn_TlvEncoder *encoder)
+{
+  return ndn_TlvEncoder_writeNestedTlv
+    (encoder, ndn_Tlv_LpPacket_LpPacket, encodeLpPacketValue, lpPacket, 0);
+}
+
 ndn_Error
 ndn_decodeTlvLpPacket
   (struct ndn_LpPacket *lpPacket, struct ndn_TlvDecoder *decoder)
@@ -63,6 +178,22 @@ ndn_decodeTlvLpPacket
       // The fragment is supposed to be the last field.
       break;
     }
+    else if (fieldType == ndn_Tlv_LpPacket_Sequence) {
+      lpPacket->hasSequence = 1;
+      if ((error = ndn_TlvDecoder_readNonNegativeInteger
+           (decoder, fieldLength, &lpPacket->sequence)))
+        return error;
+    }
+    else if (fieldType == ndn_Tlv_LpPacket_FragIndex) {
+      if ((error = ndn_TlvDecoder_readNonNegativeInteger
+           (decoder, fieldLength, &lpPacket->fragIndex)))
+        return error;
+    }
+    else if (fieldType == ndn_Tlv_LpPacket_FragCount) {
+      if ((error = ndn_TlvDecoder_readNonNegativeInteger
+           (decoder, fieldLength, &lpPacket->fragCount)))
+        return error;
+    }
     else if (fieldType == ndn_Tlv_LpPacket_Nack) {
       struct ndn_NetworkNack *networkNack;
       int code;
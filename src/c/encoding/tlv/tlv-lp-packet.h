@@ -29,6 +29,18 @@
 extern "C" {
 #endif
 
+/**
+ * Encode lpPacket as an NDN-TLV LpPacket, including the fragmentation fields,
+ * the header fields and the fragment.
+ * @param lpPacket A pointer to the LpPacket struct to encode.
+ * @param encoder A pointer to the ndn_TlvEncoder struct which receives the
+ * encoding.
+ * @return 0 for success, else an error code.
+ */
+ndn_Error
+ndn_encodeTlvLpPacket
+  (const struct ndn_LpPacket *lpPacket, struct ndn_TlvEncoder *encoder);
+
 /**
  * Expect the next element to be a TLV LpPacket and decode into the ndn_LpPacket
  * struct.
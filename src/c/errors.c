@@ -142,6 +142,14 @@ ndn_getErrorString(int error)
     return      "An Interest may not have a selected delegation when encoding a forwarding hint";
   case NDN_ERROR_An_Interest_may_not_have_a_link_object_when_encoding_a_forwarding_hint:
     return      "An Interest may not have a link object when encoding a forwarding hint";
+  case NDN_ERROR_SocketTransport_error_in_setsockopt:
+    return      "SocketTransport error in setsockopt";
+  case NDN_ERROR_FaceLite_the_pending_interest_table_is_full:
+    return      "FaceLite: The pending interest table is full";
+  case NDN_ERROR_FaceLite_the_interest_filter_table_is_full:
+    return      "FaceLite: The interest filter table is full";
+  case NDN_ERROR_FaceLite_the_delayed_call_table_is_full:
+    return      "FaceLite: The delayed call table is full";
   default:
     return "unrecognized ndn_Error code";
   }
@@ -109,6 +109,16 @@ ndn_Error
 ndn_Exclude_setFromExclude
   (struct ndn_Exclude *self, const struct ndn_Exclude *other);
 
+/**
+ * Check if the component matches any of the exclude criteria.
+ * @param self A pointer to the ndn_Exclude struct.
+ * @param component A pointer to the name component to check.
+ * @return 1 if the component matches any of the exclude criteria, otherwise 0.
+ */
+int
+ndn_Exclude_matches
+  (const struct ndn_Exclude *self, const struct ndn_NameComponent *component);
+
 /**
  * Initialize an ndn_Interest struct with the pre-allocated nameComponents and excludeEntries,
  * and defaults for all the values.
@@ -199,6 +209,17 @@ ndn_Interest_setFromInterest
   return NDN_ERROR_success;
 }
 
+/**
+ * Check if the interest's name matches the given name (using ndn_Name_match)
+ * and the given name also conforms to the interest selectors.
+ * @param self A pointer to the ndn_Interest struct.
+ * @param name A pointer to the name to check.
+ * @return 1 if the name and interest selectors match, otherwise 0.
+ */
+int
+ndn_Interest_matchesName
+  (const struct ndn_Interest *self, const struct ndn_Name *name);
+
 #ifdef __cplusplus
 }
 #endif
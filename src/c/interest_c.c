@@ -67,3 +67,86 @@ ndn_Exclude_setFromExclude
 
   return NDN_ERROR_success;
 }
+
+int
+ndn_Exclude_matches
+  (const struct ndn_Exclude *self, const struct ndn_NameComponent *component)
+{
+  size_t i;
+  for (i = 0; i < self->nEntries; ++i) {
+    if (self->entries[i].type == ndn_Exclude_ANY) {
+      const struct ndn_ExcludeEntry *lowerBound = 0;
+      const struct ndn_ExcludeEntry *upperBound = 0;
+      size_t iUpperBound;
+      if (i > 0)
+        lowerBound = self->entries + (i - 1);
+
+      // Find the upper bound, possibly skipping over multiple ANY in a row.
+      for (iUpperBound = i + 1; iUpperBound < self->nEntries; ++iUpperBound) {
+        if (self->entries[iUpperBound].type == ndn_Exclude_COMPONENT) {
+          upperBound = self->entries + iUpperBound;
+          break;
+        }
+      }
+
+      // If lowerBound != 0, we already checked component equals lowerBound on
+      // the last pass. If upperBound != 0, we will check component equals
+      // upperBound on the next pass.
+      if (upperBound) {
+        if (lowerBound) {
+          if (ndn_NameComponent_compare(component, &lowerBound->component) > 0 &&
+              ndn_NameComponent_compare(component, &upperBound->component) < 0)
+            return 1;
+        }
+        else {
+          if (ndn_NameComponent_compare(component, &upperBound->component) < 0)
+            return 1;
+        }
+
+        // Make i equal iUpperBound on the next pass.
+        i = iUpperBound - 1;
+      }
+      else {
+        if (lowerBound) {
+          if (ndn_NameComponent_compare(component, &lowerBound->component) > 0)
+            return 1;
+        }
+        else
+          // The exclude has only ANY.
+          return 1;
+      }
+    }
+    else {
+      if (ndn_NameComponent_equals(component, &self->entries[i].component))
+        return 1;
+    }
+  }
+
+  return 0;
+}
+
+int
+ndn_Interest_matchesName
+  (const struct ndn_Interest *self, const struct ndn_Name *name)
+{
+  if (!ndn_Name_match(&self->name, name))
+    return 0;
+
+  if (self->minSuffixComponents >= 0 &&
+      // Add 1 for the implicit digest.
+      !(name->nComponents + 1 - self->name.nComponents >=
+        (size_t)self->minSuffixComponents))
+    return 0;
+  if (self->maxSuffixComponents >= 0 &&
+      // Add 1 for the implicit digest.
+      !(name->nComponents + 1 - self->name.nComponents <=
+        (size_t)self->maxSuffixComponents))
+    return 0;
+  if (self->exclude.nEntries > 0 &&
+      name->nComponents > self->name.nComponents &&
+      ndn_Exclude_matches
+        (&self->exclude, name->components + self->name.nComponents))
+    return 0;
+
+  return 1;
+}
@@ -45,17 +45,26 @@ ndn_LpPacket_initialize
   self->headerFields = headerFields;
   self->maxHeaderFields = maxHeaderFields;
   self->nHeaderFields = 0;
+  self->hasSequence = 0;
+  self->sequence = 0;
+  self->fragIndex = 0;
+  self->fragCount = 1;
   ndn_Blob_initialize(&self->fragmentWireEncoding, 0, 0);
 }
 
 /**
- * Clear all header fields and set the fragment to an isNull Blob.
+ * Clear all header fields, clear the fragmentation fields and set the fragment
+ * to an isNull Blob.
  * @param self A pointer to the ndn_LpPacket struct.
  */
 static __inline void
 ndn_LpPacket_clear(struct ndn_LpPacket *self)
 { 
   self->nHeaderFields = 0;
+  self->hasSequence = 0;
+  self->sequence = 0;
+  self->fragIndex = 0;
+  self->fragCount = 1;
   ndn_Blob_initialize(&self->fragmentWireEncoding, 0, 0);
 }
 
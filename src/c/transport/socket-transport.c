@@ -18,6 +18,11 @@
  * A copy of the GNU Lesser General Public License is in the file COPYING.
  */
 
+// recvmmsg is a GNU extension, so define this before the system headers.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 // Only compile if we have Unix socket support.
 #include <ndn-cpp/ndn-cpp-config.h>
 #if NDN_CPP_HAVE_UNISTD_H
@@ -180,29 +185,169 @@ ndn_Error
 ndn_SocketTransport_processEvents
   (struct ndn_SocketTransport *self, uint8_t *buffer, size_t bufferLength)
 {
-  // Loop until there is no more data in the receive buffer.
+  if (self->socketDescriptor < 0)
+    // The socket is not open.  Just silently return.
+    return NDN_ERROR_success;
+
+  // Loop until there is no more data in the receive buffer. Use a non-blocking
+  // recv instead of calling poll before each recv, so that each read is one
+  // system call.
   while(1) {
-    int receiveIsReady;
     ndn_Error error;
-    size_t nBytes;
-    if ((error = ndn_SocketTransport_receiveIsReady
-         (self, &receiveIsReady)))
-      return error;
-    if (!receiveIsReady)
+    ssize_t nBytes = recv
+      (self->socketDescriptor, buffer, bufferLength, MSG_DONTWAIT);
+    if (nBytes < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        // No more data is ready.
+        return NDN_ERROR_success;
+      if (errno == EINTR)
+        continue;
+      return NDN_ERROR_SocketTransport_error_in_recv;
+    }
+    if (nBytes == 0)
       return NDN_ERROR_success;
 
-    if ((error = ndn_SocketTransport_receive
-         (self, buffer, bufferLength, &nBytes)))
+    if ((error = ndn_ElementReader_onReceivedData
+         (&self->elementReader, buffer, nBytes)))
       return error;
-    if (nBytes == 0)
+    if (self->socketDescriptor < 0)
+      // The elementListener closed the socket.
       return NDN_ERROR_success;
+  }
+}
+
+/**
+ * Receive one datagram at a time into buffer with a non-blocking recvmsg and
+ * pass each to the ElementReader, until there is no more data. Unlike recv,
+ * recvmsg reports when a datagram didn't fit, so a datagram larger than
+ * bufferLength is dropped instead of passing its truncated bytes on.
+ */
+static ndn_Error
+processDatagramsOneAtATime
+  (struct ndn_SocketTransport *self, uint8_t *buffer, size_t bufferLength)
+{
+  struct msghdr message;
+  struct iovec iov;
+
+  // Loop until there is no more data in the receive buffer.
+  while (1) {
+    ndn_Error error;
+    ssize_t nBytes;
+
+    ndn_memset((uint8_t *)&message, 0, sizeof(message));
+    iov.iov_base = buffer;
+    iov.iov_len = bufferLength;
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+
+    nBytes = recvmsg(self->socketDescriptor, &message, MSG_DONTWAIT);
+    if (nBytes < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        // No more data is ready.
+        return NDN_ERROR_success;
+      if (errno == EINTR)
+        continue;
+      return NDN_ERROR_SocketTransport_error_in_recv;
+    }
+    if (nBytes == 0 || (message.msg_flags & MSG_TRUNC))
+      // Skip an empty datagram or drop one which is larger than the buffer.
+      continue;
 
     if ((error = ndn_ElementReader_onReceivedData
          (&self->elementReader, buffer, nBytes)))
       return error;
+    if (self->socketDescriptor < 0)
+      // The elementListener closed the socket.
+      return NDN_ERROR_success;
   }
 }
 
+ndn_Error
+ndn_SocketTransport_processDatagramEvents
+  (struct ndn_SocketTransport *self, uint8_t *buffer, size_t bufferLength)
+{
+#if NDN_CPP_HAVE_RECVMMSG
+  size_t nSlots;
+  size_t i;
+  struct mmsghdr messages[NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH];
+  struct iovec iovecs[NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH];
+#endif
+
+  if (self->socketDescriptor < 0)
+    // The socket is not open.  Just silently return.
+    return NDN_ERROR_success;
+
+#if NDN_CPP_HAVE_RECVMMSG
+  // Divide the buffer into slots which each receive one datagram.
+  nSlots = bufferLength / MAX_NDN_PACKET_SIZE;
+  if (nSlots > NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH)
+    nSlots = NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH;
+  if (nSlots <= 1)
+    // There is only room for one datagram, so receive one at a time.
+    return processDatagramsOneAtATime(self, buffer, bufferLength);
+
+  ndn_memset((uint8_t *)messages, 0, nSlots * sizeof(messages[0]));
+  for (i = 0; i < nSlots; ++i) {
+    iovecs[i].iov_base = buffer + i * MAX_NDN_PACKET_SIZE;
+    iovecs[i].iov_len = MAX_NDN_PACKET_SIZE;
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  // Loop until there is no more data in the receive buffer.
+  while (1) {
+    ndn_Error error;
+    int nMessages = recvmmsg
+      (self->socketDescriptor, messages, nSlots, MSG_DONTWAIT, 0);
+    if (nMessages < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        // No more data is ready.
+        return NDN_ERROR_success;
+      if (errno == EINTR)
+        continue;
+      return NDN_ERROR_SocketTransport_error_in_recv;
+    }
+
+    for (i = 0; i < (size_t)nMessages; ++i) {
+      if (messages[i].msg_hdr.msg_flags & MSG_TRUNC)
+        // The datagram is larger than a packet. Drop it, the same as
+        // processDatagramsOneAtATime.
+        continue;
+
+      if ((error = ndn_ElementReader_onReceivedData
+           (&self->elementReader, (uint8_t *)iovecs[i].iov_base,
+            messages[i].msg_len)))
+        return error;
+      if (self->socketDescriptor < 0)
+        // The elementListener closed the socket.
+        return NDN_ERROR_success;
+    }
+
+    if ((size_t)nMessages < nSlots)
+      // We emptied the receive buffer.
+      return NDN_ERROR_success;
+  }
+#else
+  // Without recvmmsg, slots don't help, so receive one at a time.
+  return processDatagramsOneAtATime(self, buffer, bufferLength);
+#endif
+}
+
+ndn_Error
+ndn_SocketTransport_setReceiveBufferSize
+  (struct ndn_SocketTransport *self, int receiveBufferSize)
+{
+  if (self->socketDescriptor < 0)
+    return NDN_ERROR_SocketTransport_socket_is_not_open;
+
+  if (setsockopt
+      (self->socketDescriptor, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize,
+       sizeof(receiveBufferSize)) != 0)
+    return NDN_ERROR_SocketTransport_error_in_setsockopt;
+
+  return NDN_ERROR_success;
+}
+
 ndn_Error ndn_SocketTransport_close(struct ndn_SocketTransport *self)
 {
   if (self->socketDescriptor < 0)
@@ -30,6 +30,12 @@
 extern "C" {
 #endif
 
+/**
+ * The maximum number of datagrams which
+ * ndn_SocketTransport_processDatagramEvents receives with one system call.
+ */
+#define NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH 32
+
 typedef enum {
   SOCKET_TCP,
   SOCKET_UDP,
@@ -111,15 +117,54 @@ ndn_Error ndn_SocketTransport_receive
  * only for temporary use and is not the way that this function supplies data.
  * It supplies the data by calling the onReceivedElement callback.
  * @param bufferLength The size of buffer. The buffer should be as large as
- * resources permit up to MAX_NDN_PACKET_SIZE, but smaller sizes will work
- * however may be less efficient due to multiple calls to socket receive and
- * more processing by the ElementReader.
+ * resources permit, perhaps NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE so that one
+ * socket receive can return many packets. Smaller sizes will work however may
+ * be less efficient due to multiple calls to socket receive and more
+ * processing by the ElementReader.
  * @return 0 for success, else an error code.
  */
 ndn_Error
 ndn_SocketTransport_processEvents
   (struct ndn_SocketTransport *self, uint8_t *buffer, size_t bufferLength);
 
+/**
+ * Process any datagrams to receive, the same as
+ * ndn_SocketTransport_processEvents except that buffer is divided into slots of
+ * MAX_NDN_PACKET_SIZE bytes and, if the platform has recvmmsg, one system call
+ * receives a datagram into each slot. The datagrams are then passed to the
+ * ElementReader in order. A datagram which is larger than its slot (or larger
+ * than buffer when receiving one at a time) is dropped instead of passing its
+ * truncated bytes to the ElementReader. This is non-blocking and will return
+ * immediately if there is no data to receive.
+ * @param self A pointer to the ndn_SocketTransport struct.
+ * @param buffer A pointer to a buffer for receiving data. Note that this is
+ * only for temporary use and is not the way that this function supplies data.
+ * It supplies the data by calling the onReceivedElement callback.
+ * @param bufferLength The size of buffer. The number of slots is
+ * bufferLength / MAX_NDN_PACKET_SIZE, up to
+ * NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH. If there are less than two slots
+ * or the platform doesn't have recvmmsg, this receives one datagram at a time
+ * into the whole buffer.
+ * @return 0 for success, else an error code.
+ */
+ndn_Error
+ndn_SocketTransport_processDatagramEvents
+  (struct ndn_SocketTransport *self, uint8_t *buffer, size_t bufferLength);
+
+/**
+ * Set the socket's SO_RCVBUF option, which is the size of the kernel's
+ * receive buffer. A larger buffer lets the socket hold more datagrams that
+ * arrive between calls to processEvents before the kernel drops them. The
+ * socket must be connected.
+ * @param self A pointer to the ndn_SocketTransport struct.
+ * @param receiveBufferSize The requested size in bytes. The kernel may adjust
+ * it, for example to the limit in net.core.rmem_max on Linux.
+ * @return 0 for success, else an error code.
+ */
+ndn_Error
+ndn_SocketTransport_setReceiveBufferSize
+  (struct ndn_SocketTransport *self, int receiveBufferSize);
+
 /**
  * Close the socket.
  * @param self A pointer to the ndn_SocketTransport struct.
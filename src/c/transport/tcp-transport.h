@@ -100,9 +100,10 @@ static __inline ndn_Error ndn_TcpTransport_send
  * only for temporary use and is not the way that this function supplies data.
  * It supplies the data by calling the onReceivedElement callback.
  * @param bufferLength The size of buffer. The buffer should be as large as
- * resources permit up to MAX_NDN_PACKET_SIZE, but smaller sizes will work
- * however may be less efficient due to multiple calls to socket receive and
- * more processing by the ElementReader.
+ * resources permit, perhaps NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE so that one
+ * socket receive can return many packets. Smaller sizes will work however may
+ * be less efficient due to multiple calls to socket receive and more
+ * processing by the ElementReader.
  * @return 0 for success, else an error code.
  */
 static __inline ndn_Error
@@ -27,6 +27,13 @@
 extern "C" {
 #endif
 
+/**
+ * The size of a receive buffer for ndn_UdpTransport_processEvents which holds
+ * NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH datagrams of MAX_NDN_PACKET_SIZE.
+ */
+#define NDN_UDP_TRANSPORT_RECEIVE_BUFFER_SIZE \
+  (NDN_SOCKET_TRANSPORT_MAX_DATAGRAM_BATCH * MAX_NDN_PACKET_SIZE)
+
 /**
  * Initialize the ndn_UdpTransport struct with default values for no connection
  * yet and to use the given buffer for the ElementReader. Note that
@@ -92,17 +99,35 @@ static __inline ndn_Error ndn_UdpTransport_send
  * @param buffer A pointer to a buffer for receiving data. Note that this is
  * only for temporary use and is not the way that this function supplies data.
  * It supplies the data by calling the onReceivedElement callback.
- * @param bufferLength The size of buffer. The buffer should be as large as
- * resources permit up to MAX_NDN_PACKET_SIZE, but smaller sizes will work
- * however may be less efficient due to multiple calls to socket receive and
- * more processing by the ElementReader.
+ * @param bufferLength The size of buffer. If bufferLength holds more than one
+ * MAX_NDN_PACKET_SIZE, then this receives a batch of datagrams with one system
+ * call where supported (see ndn_SocketTransport_processDatagramEvents). The
+ * buffer should be as large as resources permit up to
+ * NDN_UDP_TRANSPORT_RECEIVE_BUFFER_SIZE. Smaller sizes will work however may
+ * be less efficient due to more calls to socket receive.
  * @return 0 for success, else an error code.
  */
 static __inline ndn_Error
 ndn_UdpTransport_processEvents
   (struct ndn_UdpTransport *self, uint8_t *buffer, size_t bufferLength)
 {
-  return ndn_SocketTransport_processEvents(&self->base, buffer, bufferLength);
+  return ndn_SocketTransport_processDatagramEvents
+    (&self->base, buffer, bufferLength);
+}
+
+/**
+ * Set the size of the kernel's receive buffer for the socket (SO_RCVBUF). This
+ * must be called after ndn_UdpTransport_connect.
+ * @param self A pointer to the ndn_UdpTransport struct.
+ * @param receiveBufferSize The requested size in bytes.
+ * @return 0 for success, else an error code.
+ */
+static __inline ndn_Error
+ndn_UdpTransport_setReceiveBufferSize
+  (struct ndn_UdpTransport *self, int receiveBufferSize)
+{
+  return ndn_SocketTransport_setReceiveBufferSize
+    (&self->base, receiveBufferSize);
 }
 
 /**
@@ -54,6 +54,29 @@ ndn_getNowMilliseconds()
 #endif
 }
 
+ndn_MillisecondsSince1970
+ndn_getMonotonicMilliseconds()
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency = { 0 };
+  LARGE_INTEGER counter;
+
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec t;
+  if (clock_gettime(CLOCK_MONOTONIC, &t) == 0)
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+  else
+    // The monotonic clock is not supported at run time.
+    return ndn_getNowMilliseconds();
+#else
+  return ndn_getNowMilliseconds();
+#endif
+}
+
 ndn_Error
 ndn_toIsoString
   (ndn_MillisecondsSince1970 milliseconds, int includeFraction, char *isoString)
@@ -28,6 +28,17 @@
 extern "C" {
 #endif
 
+/**
+ * Get the time in milliseconds from a monotonic clock which is not affected by
+ * changes to the system time, for measuring intervals. If the platform has no
+ * monotonic clock, this falls back to ndn_getNowMilliseconds().
+ * @return The time in milliseconds since an unspecified starting point,
+ * including fractions of a millisecond. Only the difference between two
+ * values is meaningful.
+ */
+ndn_MillisecondsSince1970
+ndn_getMonotonicMilliseconds();
+
 /**
  * Convert the time from milliseconds to an ISO time string, for example 
  * "20131018T184138.623355", or "20131018T184139" if includeFraction is 0.
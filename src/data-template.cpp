@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <ndn-cpp/encoding/tlv-0_2-wire-format.hpp>
+#include "c/util/ndn_memory.h"
+#include "c/encoding/tlv/tlv-name.h"
+#include "c/encoding/tlv/tlv-decoder.h"
+#include "c/encoding/tlv/tlv-encoder.h"
+#include <ndn-cpp/data-template.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+/**
+ * Get the length of the TLV encoding of the name component.
+ */
+static size_t
+getComponentEncodingLength(const NameLite::Component& componentLite)
+{
+  struct ndn_TlvEncoder encoder;
+  ndn_TlvEncoder_initialize(&encoder, 0);
+  encoder.enableOutput = 0;
+  ndn_Error error;
+  if ((error = ndn_encodeTlvNameComponent
+       ((const struct ndn_NameComponent*)&componentLite, &encoder)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  return encoder.offset;
+}
+
+/**
+ * Get the length of the TLV with the given type and value length.
+ */
+static size_t
+getTlvLength(unsigned int type, size_t valueLength)
+{
+  return ndn_TlvEncoder_sizeOfVarNumber(type) +
+    ndn_TlvEncoder_sizeOfVarNumber(valueLength) + valueLength;
+}
+
+DataTemplate::DataTemplate
+  (const Data& data, KeyChain& keyChain, const SigningInfo& params,
+   WireFormat& wireFormat)
+: prefix_(data.getName()), keyChain_(&keyChain),
+  digestAlgorithm_(params.getDigestAlgorithm())
+{
+  if (!dynamic_cast<Tlv0_2WireFormat*>(&wireFormat))
+    throw runtime_error("DataTemplate: The wire format must be NDN-TLV 0.2");
+
+  // Resolve the signing key and make the SignatureInfo once, instead of
+  // looking up the PIB for every segment. Encode a copy with empty content to
+  // get the encoded SignatureInfo. We don't need the signature value.
+  ptr_lib::shared_ptr<Signature> signatureInfo =
+    keyChain.prepareSignatureInfo(params, keyName_);
+  Data dataCopy(data);
+  dataCopy.getMetaInfo().setFinalBlockId(Name::Component());
+  dataCopy.setContent(Blob());
+  dataCopy.setSignature(*signatureInfo);
+  SignedBlob encoding = dataCopy.wireEncode(wireFormat);
+
+  ndn_Error error;
+  struct ndn_TlvDecoder decoder;
+  ndn_TlvDecoder_initialize(&decoder, encoding.buf(), encoding.size());
+  size_t dataEndOffset, nameEndOffset, metaInfoEndOffset;
+  if ((error = ndn_TlvDecoder_readNestedTlvsStart
+       (&decoder, ndn_Tlv_Data, &dataEndOffset)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  if ((error = ndn_TlvDecoder_readNestedTlvsStart
+       (&decoder, ndn_Tlv_Name, &nameEndOffset)))
+    throw runtime_error(ndn_getErrorString(error));
+  prefixComponents_ = Blob
+    (encoding.buf() + decoder.offset, nameEndOffset - decoder.offset);
+  ndn_TlvDecoder_seek(&decoder, nameEndOffset);
+
+  if ((error = ndn_TlvDecoder_readNestedTlvsStart
+       (&decoder, ndn_Tlv_MetaInfo, &metaInfoEndOffset)))
+    throw runtime_error(ndn_getErrorString(error));
+  metaInfoFields_ = Blob
+    (encoding.buf() + decoder.offset, metaInfoEndOffset - decoder.offset);
+  ndn_TlvDecoder_seek(&decoder, metaInfoEndOffset);
+
+  struct ndn_Blob content;
+  if ((error = ndn_TlvDecoder_readBlobTlv(&decoder, ndn_Tlv_Content, &content)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  // The SignatureInfo is the rest of the signed portion.
+  signatureInfo_ = Blob
+    (encoding.buf() + decoder.offset,
+     encoding.getSignedPortionEndOffset() - decoder.offset);
+}
+
+size_t
+DataTemplate::wireEncode
+  (const Name::Component& finalComponent, const Name::Component* finalBlockId,
+   const BlobLite* contentSlices, size_t nContentSlices, vector<uint8_t>& output)
+{
+  NameLite::Component componentLite;
+  finalComponent.get(componentLite);
+  size_t componentEncodingLength = getComponentEncodingLength(componentLite);
+
+  NameLite::Component finalBlockIdLite;
+  size_t finalBlockIdEncodingLength = 0;
+  // As with the Data encoder, omit an empty FinalBlockId.
+  bool hasFinalBlockId = (finalBlockId && finalBlockId->getValue().size() > 0);
+  if (hasFinalBlockId) {
+    finalBlockId->get(finalBlockIdLite);
+    finalBlockIdEncodingLength = getComponentEncodingLength(finalBlockIdLite);
+  }
+
+  size_t contentLength = 0;
+  for (size_t i = 0; i < nContentSlices; ++i)
+    contentLength += contentSlices[i].size();
+
+  size_t nameValueLength = prefixComponents_.size() + componentEncodingLength;
+  size_t metaInfoValueLength = metaInfoFields_.size();
+  if (hasFinalBlockId)
+    metaInfoValueLength += getTlvLength
+      (ndn_Tlv_FinalBlockId, finalBlockIdEncodingLength);
+  size_t signedPortionLength =
+    getTlvLength(ndn_Tlv_Name, nameValueLength) +
+    getTlvLength(ndn_Tlv_MetaInfo, metaInfoValueLength) +
+    getTlvLength(ndn_Tlv_Content, contentLength) + signatureInfo_.size();
+
+  // Leave room in front for the Data type and the largest length, which we
+  // write after we know the signature length.
+  const size_t headroom = ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_Data) + 9;
+  output.resize(headroom + signedPortionLength);
+
+  struct ndn_DynamicUInt8Array outputArray;
+  ndn_DynamicUInt8Array_initialize(&outputArray, &output[0], output.size(), 0);
+  struct ndn_TlvEncoder encoder;
+  ndn_TlvEncoder_initialize(&encoder, &outputArray);
+  ndn_TlvEncoder_seek(&encoder, headroom);
+
+  ndn_Error error;
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_Name, nameValueLength)))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_TlvEncoder_writeArray
+       (&encoder, prefixComponents_.buf(), prefixComponents_.size())))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_encodeTlvNameComponent
+       ((const struct ndn_NameComponent*)&componentLite, &encoder)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_MetaInfo, metaInfoValueLength)))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_TlvEncoder_writeArray
+       (&encoder, metaInfoFields_.buf(), metaInfoFields_.size())))
+    throw runtime_error(ndn_getErrorString(error));
+  if (hasFinalBlockId) {
+    if ((error = ndn_TlvEncoder_writeTypeAndLength
+         (&encoder, ndn_Tlv_FinalBlockId, finalBlockIdEncodingLength)))
+      throw runtime_error(ndn_getErrorString(error));
+    if ((error = ndn_encodeTlvNameComponent
+         ((const struct ndn_NameComponent*)&finalBlockIdLite, &encoder)))
+      throw runtime_error(ndn_getErrorString(error));
+  }
+
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_Content, contentLength)))
+    throw runtime_error(ndn_getErrorString(error));
+  for (size_t i = 0; i < nContentSlices; ++i) {
+    if ((error = ndn_TlvEncoder_writeArray
+         (&encoder, contentSlices[i].buf(), contentSlices[i].size())))
+      throw runtime_error(ndn_getErrorString(error));
+  }
+
+  if ((error = ndn_TlvEncoder_writeArray
+       (&encoder, signatureInfo_.buf(), signatureInfo_.size())))
+    throw runtime_error(ndn_getErrorString(error));
+
+  // This computes a DigestSha256 directly if keyName_ is the digest identity.
+  Blob signatureBits = keyChain_->sign
+    (&output[headroom], signedPortionLength, keyName_, digestAlgorithm_);
+  if (signatureBits.isNull())
+    throw runtime_error
+      ("DataTemplate: Cannot sign with key " + keyName_.toUri());
+
+  // Append the SignatureValue. resize may move the array.
+  size_t dataValueLength = signedPortionLength +
+    getTlvLength(ndn_Tlv_SignatureValue, signatureBits.size());
+  output.resize(headroom + dataValueLength);
+  ndn_DynamicUInt8Array_initialize(&outputArray, &output[0], output.size(), 0);
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_SignatureValue, signatureBits.size())))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_TlvEncoder_writeArray
+       (&encoder, signatureBits.buf(), signatureBits.size())))
+    throw runtime_error(ndn_getErrorString(error));
+
+  // Write the Data type and length just before the value.
+  size_t encodingOffset = headroom -
+    (ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_Data) +
+     ndn_TlvEncoder_sizeOfVarNumber(dataValueLength));
+  ndn_TlvEncoder_seek(&encoder, encodingOffset);
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_Data, dataValueLength)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  return encodingOffset;
+}
+
+}
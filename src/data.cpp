@@ -26,7 +26,10 @@
 #include <ndn-cpp/sha256-with-rsa-signature.hpp>
 #include <ndn-cpp/hmac-with-sha256-signature.hpp>
 #include <ndn-cpp/generic-signature.hpp>
+#include <ndn-cpp/encoding/tlv-wire-format.hpp>
 #include "c/data.h"
+#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
+#include "encoding/lite-array.hpp"
 #include "lp/incoming-face-id.hpp"
 #include "lp/congestion-mark.hpp"
 #include "ndn-cpp/lite/util/crypto-lite.hpp"
@@ -58,7 +61,9 @@ Data::Data(const Data& data)
   metaInfo_(data.metaInfo_),
   content_(data.content_),
   defaultFullName_(new Name(*data.defaultFullName_)),
-  changeCount_(0)
+  changeCount_(0),
+  // If data is lazily decoded, then this copy is also lazily decoded.
+  lazyWireEncoding_(data.lazyWireEncoding_)
 {
   if (data.signature_.get()) {
     signature_.set(data.signature_.get()->clone());
@@ -74,6 +79,13 @@ Data::~Data()
 
 Data& Data::operator=(const Data& data)
 {
+  if (&data == this)
+    // Don't clear a pending lazy encoding that we need to copy.
+    return *this;
+
+  // We replace all the fields, so don't decode a pending lazy encoding.
+  lazyWireEncoding_ = Blob();
+
   if (data.signature_.get())
     signature_.set(data.signature_.get()->clone());
   else
@@ -82,6 +94,8 @@ Data& Data::operator=(const Data& data)
   setName(data.name_.get());
   setMetaInfo(data.metaInfo_.get());
   setContent(data.content_);
+  // If data is lazily decoded, then this is also lazily decoded.
+  lazyWireEncoding_ = data.lazyWireEncoding_;
   setDefaultWireEncoding
     (data.defaultWireEncoding_, data.defaultWireEncodingFormat_);
 
@@ -136,6 +150,7 @@ Data::getFullName(WireFormat& wireFormat) const
 void
 Data::get(DataLite& dataLite) const
 {
+  ensureDecoded();
   signature_.get()->get(dataLite.getSignature());
   name_.get().get(dataLite.getName());
   metaInfo_.get().get(dataLite.getMetaInfo());
@@ -145,6 +160,9 @@ Data::get(DataLite& dataLite) const
 void
 Data::set(const DataLite& dataLite)
 {
+  // We replace all the fields, so don't decode a pending lazy encoding.
+  lazyWireEncoding_ = Blob();
+
   if (dataLite.getSignature().getType() == ndn_SignatureType_Sha256WithRsaSignature)
     signature_.set(ptr_lib::shared_ptr<Signature>(new Sha256WithRsaSignature()));
   else if (dataLite.getSignature().getType() == ndn_SignatureType_Sha256WithEcdsaSignature)
@@ -169,6 +187,7 @@ Data::set(const DataLite& dataLite)
 Data&
 Data::setName(const Name& name)
 {
+  ensureDecoded();
   name_.set(name);
   ++changeCount_;
   return *this;
@@ -209,4 +228,60 @@ Data::wireDecode(const Blob& input, WireFormat& wireFormat)
     setDefaultWireEncoding(SignedBlob(), 0);
 }
 
+void
+Data::wireDecodeLazy(const Blob& input)
+{
+  // Decode with the same Lite decoder as wireDecode(input, TlvWireFormat) so
+  // that a malformed packet is rejected here the same as by a full decode, and
+  // to find the signed portion. Only make the Name object now.
+  NameComponentArray nameComponents;
+  NameComponentArray keyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    DataLite dataLite
+      (nameComponents.get(), nameComponents.size(),
+       keyNameComponents.get(), keyNameComponents.size());
+
+    ndn_Error error;
+    size_t signedPortionBeginOffset, signedPortionEndOffset;
+    if ((error = Tlv0_2WireFormatLite::decodeData
+         (dataLite, input.buf(), input.size(), &signedPortionBeginOffset,
+          &signedPortionEndOffset))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(input.size()));
+        keyNameComponents.resize(getMaxArraySize(input.size()));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
+
+    // Clear lazyWireEncoding_ in case this was already lazily decoded.
+    lazyWireEncoding_ = Blob();
+    name_.get().set(dataLite.getName());
+    lazyWireEncoding_ = input;
+
+    if (TlvWireFormat::get() == WireFormat::getDefaultWireFormat())
+      // This is the default wire encoding.
+      // Take a pointer to the input Blob without copying.
+      setDefaultWireEncoding
+        (SignedBlob(input, signedPortionBeginOffset, signedPortionEndOffset),
+         WireFormat::getDefaultWireFormat());
+    else
+      setDefaultWireEncoding(SignedBlob(), 0);
+    return;
+  }
+}
+
+void
+Data::decodeLazyFields()
+{
+  // Clear lazyWireEncoding_ first so that the setters called while decoding
+  // don't call this again.
+  Blob input = lazyWireEncoding_;
+  lazyWireEncoding_ = Blob();
+
+  // Use Data::wireDecode since a subclass may decode differently.
+  Data::wireDecode(input, *TlvWireFormat::get());
+}
+
 }
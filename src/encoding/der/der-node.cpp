@@ -25,6 +25,7 @@
 #include "../../c/util/time.h"
 #include "der-exception.hpp"
 #include "der-node.hpp"
+#include "der-reader.hpp"
 
 using namespace std;
 
@@ -331,27 +332,8 @@ DerNode::DerInteger::toIntegerVal() const
 Blob
 DerNode::DerOid::toVal()
 {
-  size_t offset = 0;
-  vector<int> components;
-
-  while (offset < payloadPosition_) {
-    size_t skip;
-    int nextVal = decode128(offset, skip);
-    offset += skip;
-    components.push_back(nextVal);
-  }
-
-  // For some odd reason, the first digits are represented in one byte.
-  int firstByte = components[0];
-  int firstDigit = firstByte / 40;
-  int secondDigit = firstByte % 40;
-
-  ostringstream result;
-  result << firstDigit << "." << secondDigit;
-  for (size_t i = 1; i < components.size(); ++i)
-    result << "." << components[i];
-
-  string resultString = result.str();
+  string resultString = DerReader::toOidString
+    (BlobLite(&payload_[0], payloadPosition_));
   return Blob((const uint8_t*)&resultString[0], resultString.size());
 }
 
@@ -410,31 +392,11 @@ DerNode::DerOid::encode128(int value)
   return outBytes;
 }
 
-int
-DerNode::DerOid::decode128(size_t offset, size_t& skip)
-{
-  int flagMask = 0x80;
-  int result = 0;
-  size_t oldOffset = offset;
-
-  while ((payload_[offset] & flagMask) != 0) {
-    result = 128 * result + ((int)payload_[offset] & 0xff) - 128;
-    offset += 1;
-  }
-
-  result = result * 128 + ((int)payload_[offset] & 0xff);
-
-  skip = offset - oldOffset + 1;
-  return result;
-}
-
 MillisecondsSince1970
 DerNode::DerGeneralizedTime::toMillisecondsSince1970()
 {
-  string payloadString((const char*)&payload_[0], payloadPosition_);
-  // The payload time has Z at the end. Convert to ISO time with 'T' in the middle.
-  return fromIsoString
-    (payloadString.substr(0, 8) + 'T' + payloadString.substr(8, 6));
+  return DerReader::toMillisecondsSince1970
+    (BlobLite(&payload_[0], payloadPosition_));
 }
 
 string
@@ -463,15 +463,6 @@ private:
    */
   static std::vector<uint8_t>
   encode128(int value);
-
-  /**
-   * Convert an encoded component of the encoded OID to the original integer.
-   * @param offset The offset into this node's payload.
-   * @param skip Set skip to the number of payload bytes to skip.
-   * @return The original integer.
-   */
-  int
-  decode128(size_t offset, size_t& skip);
 };
 
 class DerNode::DerSequence : public DerStructure {
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <string.h>
+#include <climits>
+#include <stdexcept>
+#include "../../c/util/time.h"
+#include "der-exception.hpp"
+#include "der-reader.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+DerNodeType
+DerReader::peekType() const
+{
+  if (atEnd())
+    throw DerDecodingException("DerReader: The input length is too small");
+
+  return (DerNodeType)input_[offset_];
+}
+
+BlobLite
+DerReader::read(DerNodeType expectedType)
+{
+  DerNodeType type;
+  BlobLite payload = readAny(type);
+  if (type != expectedType)
+    throw DerDecodingException("DerReader: Did not get the expected DER type");
+
+  return payload;
+}
+
+BlobLite
+DerReader::readAny(DerNodeType& type)
+{
+  size_t payloadOffset, payloadLength;
+  readHeader(type, payloadOffset, payloadLength);
+
+  offset_ = payloadOffset + payloadLength;
+  return BlobLite(input_ + payloadOffset, payloadLength);
+}
+
+BlobLite
+DerReader::readEncoding()
+{
+  DerNodeType type;
+  size_t payloadOffset, payloadLength;
+  readHeader(type, payloadOffset, payloadLength);
+
+  size_t startOffset = offset_;
+  offset_ = payloadOffset + payloadLength;
+  return BlobLite(input_ + startOffset, offset_ - startOffset);
+}
+
+void
+DerReader::readHeader
+  (DerNodeType& type, size_t& payloadOffset, size_t& payloadLength) const
+{
+  size_t idx = offset_;
+
+  if (inputLength_ < idx + 2)
+    throw DerDecodingException("DerReader: The input length is too small");
+  type = (DerNodeType)input_[idx++];
+  uint8_t sizeLen = input_[idx++];
+
+  if ((sizeLen & (1 << 7)) == 0)
+    payloadLength = sizeLen;
+  else {
+    size_t lenCount = sizeLen & ((1 << 7) - 1);
+    if (lenCount > sizeof(size_t))
+      throw DerDecodingException("DerReader: The element length is too large");
+    if (inputLength_ < idx + lenCount)
+      throw DerDecodingException("DerReader: The input length is too small");
+
+    payloadLength = 0;
+    for (; lenCount > 0; --lenCount)
+      payloadLength = (payloadLength << 8) | input_[idx++];
+  }
+
+  if (payloadLength > inputLength_ - idx)
+    throw DerDecodingException
+      ("DerReader: The element length is past the end of the input");
+  payloadOffset = idx;
+}
+
+template<class Visitor> bool
+DerReader::visitOid(const BlobLite& oidPayload, Visitor& visitor)
+{
+  const uint8_t* p = oidPayload.buf();
+  const uint8_t* end = p + oidPayload.size();
+  if (p == end)
+    throw DerDecodingException("DerReader: The OID payload is empty");
+
+  bool isFirst = true;
+  while (p < end) {
+    int value = 0;
+    while (true) {
+      if (p >= end)
+        throw DerDecodingException("DerReader: The OID payload is truncated");
+      if (value > (INT_MAX >> 7))
+        throw DerDecodingException("DerReader: The OID component is too large");
+      uint8_t b = *(p++);
+      value = (value << 7) | (b & 0x7f);
+      if ((b & 0x80) == 0)
+        break;
+    }
+
+    if (isFirst) {
+      // For some odd reason, the first digits are represented in one value.
+      isFirst = false;
+      if (!visitor(value / 40) || !visitor(value % 40))
+        return false;
+    }
+    else {
+      if (!visitor(value))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+namespace {
+
+class OidStringVisitor {
+public:
+  OidStringVisitor(string& result)
+  : result_(result)
+  {
+  }
+
+  bool
+  operator()(int component)
+  {
+    char digits[12];
+    char* p = digits + sizeof(digits);
+    do {
+      *(--p) = '0' + component % 10;
+      component /= 10;
+    } while (component > 0);
+
+    if (!result_.empty())
+      result_ += '.';
+    result_.append(p, digits + sizeof(digits) - p);
+    return true;
+  }
+
+private:
+  string& result_;
+};
+
+class OidStringCompareVisitor {
+public:
+  OidStringCompareVisitor(const char* oidString)
+  : p_(oidString)
+  {
+  }
+
+  bool
+  operator()(int component)
+  {
+    if (*p_ == '.')
+      ++p_;
+    if (*p_ < '0' || *p_ > '9')
+      return false;
+
+    int value = 0;
+    for (; *p_ >= '0' && *p_ <= '9'; ++p_)
+      value = 10 * value + (*p_ - '0');
+    return value == component;
+  }
+
+  bool
+  isAtEnd() const { return *p_ == 0; }
+
+private:
+  const char* p_;
+};
+
+class OidIntegerListCompareVisitor {
+public:
+  OidIntegerListCompareVisitor(const int* integerList, size_t integerListLength)
+  : integerList_(integerList), integerListLength_(integerListLength), i_(0)
+  {
+  }
+
+  bool
+  operator()(int component)
+  {
+    if (i_ >= integerListLength_)
+      return false;
+    return integerList_[i_++] == component;
+  }
+
+  bool
+  isAtEnd() const { return i_ == integerListLength_; }
+
+private:
+  const int* integerList_;
+  size_t integerListLength_;
+  size_t i_;
+};
+
+}
+
+string
+DerReader::toOidString(const BlobLite& oidPayload)
+{
+  string result;
+  OidStringVisitor visitor(result);
+  visitOid(oidPayload, visitor);
+  return result;
+}
+
+bool
+DerReader::oidEquals(const BlobLite& oidPayload, const char* oidString)
+{
+  OidStringCompareVisitor visitor(oidString);
+  return visitOid(oidPayload, visitor) && visitor.isAtEnd();
+}
+
+bool
+DerReader::oidEquals
+  (const BlobLite& oidPayload, const int* integerList, size_t integerListLength)
+{
+  OidIntegerListCompareVisitor visitor(integerList, integerListLength);
+  return visitOid(oidPayload, visitor) && visitor.isAtEnd();
+}
+
+MillisecondsSince1970
+DerReader::toMillisecondsSince1970(const BlobLite& timePayload)
+{
+  // The payload time is like "20131018184138Z". Convert to ISO time with 'T'
+  // in the middle.
+  if (timePayload.size() < 14)
+    throw DerDecodingException("DerReader: The GeneralizedTime is too short");
+  char isoString[16];
+  memcpy(isoString, timePayload.buf(), 8);
+  isoString[8] = 'T';
+  memcpy(isoString + 9, timePayload.buf() + 8, 6);
+  isoString[15] = 0;
+
+  MillisecondsSince1970 milliseconds;
+  ndn_Error error;
+  if ((error = ndn_fromIsoString(isoString, &milliseconds)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  return milliseconds;
+}
+
+}
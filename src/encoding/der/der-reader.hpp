@@ -0,0 +1,209 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_DER_READER_HPP
+#define NDN_DER_READER_HPP
+
+#include <string>
+#include <ndn-cpp/util/blob.hpp>
+#include <ndn-cpp/lite/util/blob-lite.hpp>
+#include "der-node-type.hpp"
+
+namespace ndn {
+
+/**
+ * A DerReader reads DER elements in order from an input buffer without making
+ * a tree of DerNode objects. Each read checks the type and length in the
+ * element header and returns a BlobLite which points into the input buffer,
+ * so the input must remain valid while the results are used. To read the
+ * children of a sequence, use readSequence to get a DerReader for its payload.
+ * This is used to decode certificates and keys where DerNode::parse would
+ * allocate a node for every element only to read a few of them.
+ */
+class DerReader {
+public:
+  /**
+   * Create a DerReader to read from the input buffer.
+   * @param input The input buffer. This does not copy the buffer.
+   * @param inputLength The number of bytes in the input buffer.
+   */
+  DerReader(const uint8_t* input, size_t inputLength)
+  : input_(input), inputLength_(inputLength), offset_(0)
+  {
+  }
+
+  /**
+   * Create a DerReader to read from the input buffer.
+   * @param input The input buffer. This does not copy the buffer.
+   */
+  DerReader(const BlobLite& input)
+  : input_(input.buf()), inputLength_(input.size()), offset_(0)
+  {
+  }
+
+  /**
+   * Create a DerReader to read from the input Blob.
+   * @param input The input Blob. This does not copy the buffer.
+   */
+  DerReader(const Blob& input)
+  : input_(input.buf()), inputLength_(input.size()), offset_(0)
+  {
+  }
+
+  /**
+   * Check if all the elements have been read.
+   * @return True if there are no more bytes in the input.
+   */
+  bool
+  atEnd() const { return offset_ >= inputLength_; }
+
+  /**
+   * Get the type of the next element without reading it.
+   * @return The type of the next element.
+   * @throws DerDecodingException if there are no more elements.
+   */
+  DerNodeType
+  peekType() const;
+
+  /**
+   * Read the next element, check its type and return its payload.
+   * @param expectedType The expected type of the element.
+   * @return The payload, pointing into the input buffer.
+   * @throws DerDecodingException if the element header can't be decoded, the
+   * payload goes past the end of the input, or the type is not expectedType.
+   */
+  BlobLite
+  read(DerNodeType expectedType);
+
+  /**
+   * Read the next element of any type and return its payload.
+   * @param type Set type to the type of the element.
+   * @return The payload, pointing into the input buffer.
+   * @throws DerDecodingException if the element header can't be decoded or the
+   * payload goes past the end of the input.
+   */
+  BlobLite
+  readAny(DerNodeType& type);
+
+  /**
+   * Read the next element of any type and return its entire encoding,
+   * including the header.
+   * @return The encoding, pointing into the input buffer.
+   * @throws DerDecodingException if the element header can't be decoded or the
+   * payload goes past the end of the input.
+   */
+  BlobLite
+  readEncoding();
+
+  /**
+   * Read the next element which must be a sequence and return a DerReader to
+   * read its children.
+   * @return A DerReader for the payload of the sequence.
+   * @throws DerDecodingException if the next element is not a sequence.
+   */
+  DerReader
+  readSequence() { return DerReader(read(DerNodeType_Sequence)); }
+
+  /**
+   * Skip the next element of any type.
+   * @throws DerDecodingException if the element header can't be decoded or the
+   * payload goes past the end of the input.
+   */
+  void
+  skip() { readEncoding(); }
+
+  /**
+   * Convert the payload of an OBJECT IDENTIFIER to the dotted string, such as
+   * "1.2.840.10045.2.1". This is the same as DerNode::DerOid::toVal().
+   * @param oidPayload The OID payload returned by read.
+   * @return The OID string.
+   * @throws DerDecodingException if the payload can't be decoded.
+   */
+  static std::string
+  toOidString(const BlobLite& oidPayload);
+
+  /**
+   * Check if the payload of an OBJECT IDENTIFIER is the OID given as a dotted
+   * string, without allocating memory.
+   * @param oidPayload The OID payload returned by read.
+   * @param oidString The OID string, such as "1.2.840.10045.2.1".
+   * @return True if the OIDs are equal.
+   * @throws DerDecodingException if the payload can't be decoded.
+   */
+  static bool
+  oidEquals(const BlobLite& oidPayload, const char* oidString);
+
+  /**
+   * Check if the payload of an OBJECT IDENTIFIER is the OID given as a list of
+   * integers, without allocating memory.
+   * @param oidPayload The OID payload returned by read.
+   * @param integerList The OID integers, such as {1, 2, 840, 10045, 2, 1}.
+   * @param integerListLength The number of integers in integerList.
+   * @return True if the OIDs are equal.
+   * @throws DerDecodingException if the payload can't be decoded.
+   */
+  static bool
+  oidEquals
+    (const BlobLite& oidPayload, const int* integerList,
+     size_t integerListLength);
+
+  /**
+   * Convert the payload of a GeneralizedTime to milliseconds since 1970. This
+   * is the same as DerNode::DerGeneralizedTime::toMillisecondsSince1970().
+   * @param timePayload The GeneralizedTime payload returned by read.
+   * @return The time in milliseconds since 1970.
+   * @throws DerDecodingException if the payload is too short.
+   */
+  static MillisecondsSince1970
+  toMillisecondsSince1970(const BlobLite& timePayload);
+
+private:
+  /**
+   * Decode the header of the element at offset_.
+   * @param type Set type to the element type.
+   * @param payloadOffset Set payloadOffset to the offset of the payload.
+   * @param payloadLength Set payloadLength to the payload length.
+   * @throws DerDecodingException if the header can't be decoded or the payload
+   * goes past the end of the input.
+   */
+  void
+  readHeader
+    (DerNodeType& type, size_t& payloadOffset, size_t& payloadLength) const;
+
+  /**
+   * Decode the OID components from the payload, calling the visitor for each.
+   * The first two components are split from the first encoded value.
+   * @param oidPayload The OID payload.
+   * @param visitor An object with bool operator()(int component) which
+   * returns false to stop.
+   * @return False if the visitor stopped, otherwise true.
+   */
+  template<class Visitor> static bool
+  visitOid(const BlobLite& oidPayload, Visitor& visitor);
+
+  const uint8_t* input_;
+  size_t inputLength_;
+  size_t offset_;
+};
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_LITE_ARRAY_HPP
+#define NDN_LITE_ARRAY_HPP
+
+#include <vector>
+#include <ndn-cpp/common.hpp>
+#include <ndn-cpp/c/errors.h>
+#include <ndn-cpp/c/interest-types.h>
+
+namespace ndn {
+
+/**
+ * A LiteArray is an internal class which holds the array of structs, such as
+ * ndn_NameComponent, which a Lite object such as NameLite uses for encoding
+ * or decoding. If the needed number of elements is at most N, this uses the
+ * fixed array in the object (usually on the stack) so that the common case
+ * does not use the heap. Otherwise it allocates an array of the needed size,
+ * so that there is no fixed limit on the number of name components.
+ */
+template<class T, size_t N>
+class LiteArray {
+public:
+  /**
+   * Create a LiteArray with at least the given number of elements.
+   * @param size (optional) The number of elements needed. If omitted, use N.
+   */
+  LiteArray(size_t size = N)
+  {
+    resize(size);
+  }
+
+  /**
+   * Make sure the array has at least the given number of elements. This
+   * invalidates a pointer previously returned by get().
+   * @param size The number of elements needed.
+   */
+  void
+  resize(size_t size)
+  {
+    if (size <= N) {
+      array_ = fixedArray_;
+      size_ = N;
+    }
+    else {
+      heapArray_.resize(size);
+      array_ = &heapArray_[0];
+      size_ = size;
+    }
+  }
+
+  /**
+   * Get the array to give to the Lite object constructor.
+   * @return A pointer to the first element.
+   */
+  T*
+  get() { return array_; }
+
+  /**
+   * Get the number of elements in the array, which is at least N.
+   * @return The number of elements.
+   */
+  size_t
+  size() const { return size_; }
+
+private:
+  // Don't allow copying since array_ may point to fixedArray_.
+  LiteArray(const LiteArray& other);
+  LiteArray& operator=(const LiteArray& other);
+
+  T fixedArray_[N];
+  std::vector<T> heapArray_;
+  T* array_;
+  size_t size_;
+};
+
+// A NameComponentArray or ExcludeEntryArray uses the fixed array for up to 48
+// elements, which is enough for most packets, and otherwise the heap.
+typedef LiteArray<struct ndn_NameComponent, 48> NameComponentArray;
+typedef LiteArray<struct ndn_ExcludeEntry, 48> ExcludeEntryArray;
+
+/**
+ * Check if the decoding error is because a Lite name component array or
+ * exclude entry array is full.
+ * @param error The error from decoding.
+ * @return True if the array is full.
+ */
+inline bool
+isArrayFull(ndn_Error error)
+{
+  return error ==
+    NDN_ERROR_attempt_to_add_a_component_past_the_maximum_number_of_components_allowed_in_the_name ||
+    error ==
+    NDN_ERROR_cannot_add_an_entry_past_the_maximum_number_of_entries_allowed_in_the_exclude;
+}
+
+/**
+ * Get an array size which is enough for any name or exclude in the TLV input,
+ * since each element has at least a type byte and a length byte.
+ * @param inputLength The length of the TLV input.
+ * @return The array size.
+ */
+inline size_t
+getMaxArraySize(size_t inputLength) { return inputLength / 2; }
+
+}
+
+#endif
@@ -0,0 +1,198 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+// Only compile if ndn-cpp-config.h defines NDN_CPP_HAVE_PROTOBUF = 1.
+#include <ndn-cpp/ndn-cpp-config.h>
+#if NDN_CPP_HAVE_PROTOBUF
+
+#include <map>
+#include <google/protobuf/message.h>
+#include <stdexcept>
+#include "tlv-encoder.hpp"
+#include "tlv-decoder.hpp"
+#include <ndn-cpp/encoding/protobuf-tlv-codec.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+ProtobufTlvCodec::Encoder::Encoder(size_t length)
+: encoder_(new TlvEncoder(length > 0 ? length : 1)), length_(length)
+{
+}
+
+void
+ProtobufTlvCodec::Encoder::writeTypeAndLength(unsigned int type, size_t length)
+{
+  encoder_->writeTypeAndLength(type, length);
+}
+
+void
+ProtobufTlvCodec::Encoder::writeNonNegativeIntegerTlv
+  (unsigned int type, uint64_t value)
+{
+  encoder_->writeNonNegativeIntegerTlv(type, value);
+}
+
+void
+ProtobufTlvCodec::Encoder::writeBlobTlv
+  (unsigned int type, const std::string& value)
+{
+  encoder_->writeRawStringTlv(type, value);
+}
+
+Blob
+ProtobufTlvCodec::Encoder::finish()
+{
+  if (encoder_->offset != length_)
+    throw runtime_error
+      ("ProtobufTlvCodec::Encoder: The encoding length is not the computed length");
+
+  return encoder_->finish();
+}
+
+size_t
+ProtobufTlvCodec::Encoder::sizeOfTypeAndLength(unsigned int type, size_t length)
+{
+  return ndn_TlvEncoder_sizeOfVarNumber((uint64_t)type) +
+         ndn_TlvEncoder_sizeOfVarNumber((uint64_t)length);
+}
+
+size_t
+ProtobufTlvCodec::Encoder::sizeOfNonNegativeIntegerTlv
+  (unsigned int type, uint64_t value)
+{
+  size_t valueLength = ndn_TlvEncoder_sizeOfNonNegativeInteger(value);
+  return sizeOfTypeAndLength(type, valueLength) + valueLength;
+}
+
+size_t
+ProtobufTlvCodec::Encoder::sizeOfBlobTlv(unsigned int type, size_t valueLength)
+{
+  return sizeOfTypeAndLength(type, valueLength) + valueLength;
+}
+
+ProtobufTlvCodec::Decoder::Decoder(const uint8_t *input, size_t inputLength)
+: decoder_(new TlvDecoder(input, inputLength))
+{
+}
+
+size_t
+ProtobufTlvCodec::Decoder::readNestedTlvsStart(unsigned int expectedType)
+{
+  return decoder_->readNestedTlvsStart(expectedType);
+}
+
+void
+ProtobufTlvCodec::Decoder::finishNestedTlvs(size_t endOffset)
+{
+  decoder_->finishNestedTlvs(endOffset);
+}
+
+bool
+ProtobufTlvCodec::Decoder::peekType(unsigned int expectedType, size_t endOffset)
+{
+  return decoder_->peekType(expectedType, endOffset);
+}
+
+uint64_t
+ProtobufTlvCodec::Decoder::readNonNegativeIntegerTlv(unsigned int expectedType)
+{
+  return decoder_->readNonNegativeIntegerTlv(expectedType);
+}
+
+struct ndn_Blob
+ProtobufTlvCodec::Decoder::readBlobTlv(unsigned int expectedType)
+{
+  return decoder_->readBlobTlv(expectedType);
+}
+
+bool
+ProtobufTlvCodec::Decoder::readBooleanTlv
+  (unsigned int expectedType, size_t endOffset)
+{
+  return decoder_->readBooleanTlv(expectedType, endOffset);
+}
+
+/**
+ * Compare type_info with before() since the type_info objects for a class in
+ * different shared libraries may not have the same address.
+ */
+struct TypeInfoLess {
+  bool
+  operator()(const type_info* x, const type_info* y) const
+  {
+    return x->before(*y) != 0;
+  }
+};
+
+typedef map<const type_info*,
+            pair<ProtobufTlvCodec::EncodeFunction,
+                 ProtobufTlvCodec::DecodeFunction>,
+            TypeInfoLess> CodecMap;
+
+/**
+ * Get the codec registry. This is a function-local static so that it is
+ * constructed before the generated code calls registerCodec from the static
+ * initializers in other files.
+ */
+static CodecMap&
+getCodecs()
+{
+  static CodecMap codecs;
+  return codecs;
+}
+
+bool
+ProtobufTlvCodec::registerCodec
+  (const type_info& messageType, EncodeFunction encode, DecodeFunction decode)
+{
+  getCodecs()[&messageType] = make_pair(encode, decode);
+  return true;
+}
+
+bool
+ProtobufTlvCodec::findCodec
+  (const google::protobuf::Message& message, EncodeFunction& encode,
+   DecodeFunction& decode)
+{
+  CodecMap& codecs = getCodecs();
+  if (codecs.empty()) {
+    encode = 0;
+    decode = 0;
+    return false;
+  }
+
+  CodecMap::const_iterator found = codecs.find(&typeid(message));
+  if (found == codecs.end()) {
+    encode = 0;
+    decode = 0;
+    return false;
+  }
+
+  encode = found->second.first;
+  decode = found->second.second;
+  return true;
+}
+
+}
+
+#endif // NDN_CPP_HAVE_PROTOBUF
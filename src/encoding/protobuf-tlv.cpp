@@ -28,6 +28,7 @@
 #include <stdexcept>
 #include "tlv-encoder.hpp"
 #include "tlv-decoder.hpp"
+#include <ndn-cpp/encoding/protobuf-tlv-codec.hpp>
 #include <ndn-cpp/encoding/protobuf-tlv.hpp>
 
 using namespace std;
@@ -114,6 +115,19 @@ encodeMessageValue(const void *context, TlvEncoder &encoder)
 
 Blob
 ProtobufTlv::encode(const Message& message)
+{
+  ProtobufTlvCodec::EncodeFunction generatedEncode;
+  ProtobufTlvCodec::DecodeFunction generatedDecode;
+  if (ProtobufTlvCodec::findCodec(message, generatedEncode, generatedDecode))
+    // Use the code generated by protoc-gen-ndntlv, which also calls
+    // CheckInitialized.
+    return generatedEncode(message);
+
+  return encodeWithReflection(message);
+}
+
+Blob
+ProtobufTlv::encodeWithReflection(const Message& message)
 {
   message.CheckInitialized();
   TlvEncoder encoder(256);
@@ -205,6 +219,20 @@ decodeMessageValue
 
 void
 ProtobufTlv::decode(Message& message, const uint8_t *input, size_t inputLength)
+{
+  ProtobufTlvCodec::EncodeFunction generatedEncode;
+  ProtobufTlvCodec::DecodeFunction generatedDecode;
+  if (ProtobufTlvCodec::findCodec(message, generatedEncode, generatedDecode)) {
+    generatedDecode(message, input, inputLength);
+    return;
+  }
+
+  decodeWithReflection(message, input, inputLength);
+}
+
+void
+ProtobufTlv::decodeWithReflection
+  (Message& message, const uint8_t *input, size_t inputLength)
 {
   TlvDecoder decoder(input, inputLength);
   decodeMessageValue(message, decoder, inputLength);
@@ -33,18 +33,30 @@
 #include <ndn-cpp/encrypt/encrypted-content.hpp>
 #include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
 #include "tlv-encoder.hpp"
+#include "lite-array.hpp"
 #include <ndn-cpp/encoding/tlv-0_2-wire-format.hpp>
 
 using namespace std;
 
 namespace ndn {
 
+/**
+ * Get the number of components in the key name of the signature's KeyLocator.
+ * @param signature The Signature.
+ * @return The number of components, or 0 if there is no key name.
+ */
+static size_t
+getKeyNameSize(const Signature* signature)
+{
+  return KeyLocator::canGetFromSignature(signature) ?
+    KeyLocator::getFromSignature(signature).getKeyName().size() : 0;
+}
+
 Blob
 Tlv0_2WireFormat::encodeName(const Name& name)
 {
-  struct ndn_NameComponent nameComponents[100];
-  NameLite nameLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]));
+  NameComponentArray nameComponents(name.size());
+  NameLite nameLite(nameComponents.get(), nameComponents.size());
   name.get(nameLite);
 
   DynamicUInt8Vector output(256);
@@ -62,17 +74,25 @@ void
 Tlv0_2WireFormat::decodeName
   (Name& name, const uint8_t *input, size_t inputLength)
 {
-  struct ndn_NameComponent nameComponents[100];
-  NameLite nameLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]));
+  NameComponentArray nameComponents;
+  // If the fixed array is full, retry once with an array for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    NameLite nameLite(nameComponents.get(), nameComponents.size());
 
-  ndn_Error error;
-  size_t dummyBeginOffset, dummyEndOffset;
-  if ((error = Tlv0_2WireFormatLite::decodeName
-       (nameLite, input, inputLength, &dummyBeginOffset, &dummyEndOffset)))
-    throw runtime_error(ndn_getErrorString(error));
+    ndn_Error error;
+    size_t dummyBeginOffset, dummyEndOffset;
+    if ((error = Tlv0_2WireFormatLite::decodeName
+         (nameLite, input, inputLength, &dummyBeginOffset, &dummyEndOffset))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
 
-  name.set(nameLite);
+    name.set(nameLite);
+    return;
+  }
 }
 
 Blob
@@ -80,13 +100,14 @@ Tlv0_2WireFormat::encodeInterest
   (const Interest& interest, size_t *signedPortionBeginOffset,
    size_t *signedPortionEndOffset)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_ExcludeEntry excludeEntries[100];
-  struct ndn_NameComponent keyNameComponents[100];
+  NameComponentArray nameComponents(interest.getName().size());
+  ExcludeEntryArray excludeEntries(interest.getExclude().size());
+  NameComponentArray keyNameComponents
+    (interest.getKeyLocator().getKeyName().size());
   InterestLite interestLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]),
-     excludeEntries, sizeof(excludeEntries) / sizeof(excludeEntries[0]),
-     keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+    (nameComponents.get(), nameComponents.size(),
+     excludeEntries.get(), excludeEntries.size(),
+     keyNameComponents.get(), keyNameComponents.size());
   interest.get(interestLite, *this);
 
   DynamicUInt8Vector output(256);
@@ -105,39 +126,50 @@ Tlv0_2WireFormat::decodeInterest
   (Interest& interest, const uint8_t *input, size_t inputLength,
    size_t *signedPortionBeginOffset, size_t *signedPortionEndOffset)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_ExcludeEntry excludeEntries[100];
-  struct ndn_NameComponent keyNameComponents[100];
-  InterestLite interestLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]),
-     excludeEntries, sizeof(excludeEntries) / sizeof(excludeEntries[0]),
-     keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
-
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeInterest
-       (interestLite, input, inputLength, signedPortionBeginOffset,
-        signedPortionEndOffset)))
-    throw runtime_error(ndn_getErrorString(error));
+  NameComponentArray nameComponents;
+  ExcludeEntryArray excludeEntries;
+  NameComponentArray keyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    InterestLite interestLite
+      (nameComponents.get(), nameComponents.size(),
+       excludeEntries.get(), excludeEntries.size(),
+       keyNameComponents.get(), keyNameComponents.size());
 
-  if (interestLite.getForwardingHintWireEncoding().buf()) {
-    // Throw any decoding exceptions now before calling set.
-    DelegationSet delegationSet;
-    decodeDelegationSet
-      (delegationSet, interestLite.getForwardingHintWireEncoding().buf(),
-       interestLite.getForwardingHintWireEncoding().size());
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeInterest
+         (interestLite, input, inputLength, signedPortionBeginOffset,
+          signedPortionEndOffset))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(inputLength));
+        excludeEntries.resize(getMaxArraySize(inputLength));
+        keyNameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
+
+    if (interestLite.getForwardingHintWireEncoding().buf()) {
+      // Throw any decoding exceptions now before calling set.
+      DelegationSet delegationSet;
+      decodeDelegationSet
+        (delegationSet, interestLite.getForwardingHintWireEncoding().buf(),
+         interestLite.getForwardingHintWireEncoding().size());
+    }
+
+    interest.set(interestLite, *this);
+    return;
   }
-
-  interest.set(interestLite, *this);
 }
 
 Blob
 Tlv0_2WireFormat::encodeData(const Data& data, size_t *signedPortionBeginOffset, size_t *signedPortionEndOffset)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent keyNameComponents[100];
+  NameComponentArray nameComponents(data.getName().size());
+  NameComponentArray keyNameComponents(getKeyNameSize(data.getSignature()));
   DataLite dataLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]),
-     keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+    (nameComponents.get(), nameComponents.size(),
+     keyNameComponents.get(), keyNameComponents.size());
   data.get(dataLite);
 
   DynamicUInt8Vector output(1500);
@@ -155,31 +187,41 @@ void
 Tlv0_2WireFormat::decodeData
   (Data& data, const uint8_t *input, size_t inputLength, size_t *signedPortionBeginOffset, size_t *signedPortionEndOffset)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent keyNameComponents[100];
-  DataLite dataLite
-    (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]),
-     keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+  NameComponentArray nameComponents;
+  NameComponentArray keyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    DataLite dataLite
+      (nameComponents.get(), nameComponents.size(),
+       keyNameComponents.get(), keyNameComponents.size());
 
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeData
-       (dataLite, input, inputLength, signedPortionBeginOffset,
-        signedPortionEndOffset)))
-    throw runtime_error(ndn_getErrorString(error));
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeData
+         (dataLite, input, inputLength, signedPortionBeginOffset,
+          signedPortionEndOffset))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(inputLength));
+        keyNameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
 
-  data.set(dataLite);
+    data.set(dataLite);
+    return;
+  }
 }
 
 Blob
 Tlv0_2WireFormat::encodeControlParameters
   (const ControlParameters& controlParameters)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent strategyNameComponents[100];
+  NameComponentArray nameComponents(controlParameters.getName().size());
+  NameComponentArray strategyNameComponents
+    (controlParameters.getStrategy().size());
   ControlParametersLite controlParametersLite
-    (nameComponents,
-     sizeof(nameComponents) / sizeof(nameComponents[0]), strategyNameComponents,
-     sizeof(strategyNameComponents) / sizeof(strategyNameComponents[0]));
+    (nameComponents.get(), nameComponents.size(),
+     strategyNameComponents.get(), strategyNameComponents.size());
   controlParameters.get(controlParametersLite);
 
   DynamicUInt8Vector output(256);
@@ -198,30 +240,40 @@ Tlv0_2WireFormat::decodeControlParameters
   (ControlParameters& controlParameters, const uint8_t *input,
    size_t inputLength)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent strategyNameComponents[100];
-  ControlParametersLite controlParametersLite
-    (nameComponents,
-     sizeof(nameComponents) / sizeof(nameComponents[0]), strategyNameComponents,
-     sizeof(strategyNameComponents) / sizeof(strategyNameComponents[0]));
+  NameComponentArray nameComponents;
+  NameComponentArray strategyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    ControlParametersLite controlParametersLite
+      (nameComponents.get(), nameComponents.size(),
+       strategyNameComponents.get(), strategyNameComponents.size());
 
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeControlParameters
-       (controlParametersLite, input, inputLength)))
-    throw runtime_error(ndn_getErrorString(error));
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeControlParameters
+         (controlParametersLite, input, inputLength))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(inputLength));
+        strategyNameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
 
-  controlParameters.set(controlParametersLite);
+    controlParameters.set(controlParametersLite);
+    return;
+  }
 }
 
 Blob
 Tlv0_2WireFormat::encodeControlResponse(const ControlResponse& controlResponse)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent strategyNameComponents[100];
+  const ControlParameters* body = controlResponse.getBodyAsControlParameters();
+  NameComponentArray nameComponents(body ? body->getName().size() : 0);
+  NameComponentArray strategyNameComponents
+    (body ? body->getStrategy().size() : 0);
   ControlResponseLite controlResponseLite
-    (nameComponents,
-     sizeof(nameComponents) / sizeof(nameComponents[0]), strategyNameComponents,
-     sizeof(strategyNameComponents) / sizeof(strategyNameComponents[0]));
+    (nameComponents.get(), nameComponents.size(),
+     strategyNameComponents.get(), strategyNameComponents.size());
   controlResponse.get(controlResponseLite);
 
   DynamicUInt8Vector output(256);
@@ -240,27 +292,36 @@ Tlv0_2WireFormat::decodeControlResponse
   (ControlResponse& controlResponse, const uint8_t *input,
    size_t inputLength)
 {
-  struct ndn_NameComponent nameComponents[100];
-  struct ndn_NameComponent strategyNameComponents[100];
-  ControlResponseLite controlResponseLite
-    (nameComponents,
-     sizeof(nameComponents) / sizeof(nameComponents[0]), strategyNameComponents,
-     sizeof(strategyNameComponents) / sizeof(strategyNameComponents[0]));
+  NameComponentArray nameComponents;
+  NameComponentArray strategyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    ControlResponseLite controlResponseLite
+      (nameComponents.get(), nameComponents.size(),
+       strategyNameComponents.get(), strategyNameComponents.size());
 
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeControlResponse
-       (controlResponseLite, input, inputLength)))
-    throw runtime_error(ndn_getErrorString(error));
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeControlResponse
+         (controlResponseLite, input, inputLength))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(inputLength));
+        strategyNameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
 
-  controlResponse.set(controlResponseLite);
+    controlResponse.set(controlResponseLite);
+    return;
+  }
 }
 
 Blob
 Tlv0_2WireFormat::encodeSignatureInfo(const Signature& signature)
 {
-  struct ndn_NameComponent keyNameComponents[100];
+  NameComponentArray keyNameComponents(getKeyNameSize(&signature));
   SignatureLite signatureLite
-    (keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+    (keyNameComponents.get(), keyNameComponents.size());
   signature.get(signatureLite);
 
   DynamicUInt8Vector output(256);
@@ -276,9 +337,9 @@ Tlv0_2WireFormat::encodeSignatureInfo(const Signature& signature)
 Blob
 Tlv0_2WireFormat::encodeSignatureValue(const Signature& signature)
 {
-  struct ndn_NameComponent keyNameComponents[100];
+  NameComponentArray keyNameComponents(getKeyNameSize(&signature));
   SignatureLite signatureLite
-    (keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+    (keyNameComponents.get(), keyNameComponents.size());
   signature.get(signatureLite);
 
   DynamicUInt8Vector output(300);
@@ -296,33 +357,41 @@ Tlv0_2WireFormat::decodeSignatureInfoAndValue
   (const uint8_t *signatureInfo, size_t signatureInfoLength,
    const uint8_t *signatureValue, size_t signatureValueLength)
 {
-  struct ndn_NameComponent keyNameComponents[100];
-  SignatureLite signatureLite
-    (keyNameComponents, sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+  NameComponentArray keyNameComponents;
+  // If the fixed array is full, retry once with an array for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    SignatureLite signatureLite
+      (keyNameComponents.get(), keyNameComponents.size());
 
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeSignatureInfoAndValue
-       (signatureLite, signatureInfo, signatureInfoLength, signatureValue,
-        signatureValueLength)))
-    throw runtime_error(ndn_getErrorString(error));
-
-  ptr_lib::shared_ptr<Signature> result;
-  if (signatureLite.getType() == ndn_SignatureType_Sha256WithRsaSignature)
-    result.reset(new Sha256WithRsaSignature());
-  else if (signatureLite.getType() == ndn_SignatureType_Sha256WithEcdsaSignature)
-    result.reset(new Sha256WithEcdsaSignature());
-  else if (signatureLite.getType() == ndn_SignatureType_HmacWithSha256Signature)
-    result.reset(new HmacWithSha256Signature());
-  else if (signatureLite.getType() == ndn_SignatureType_DigestSha256Signature)
-    result.reset(new DigestSha256Signature());
-  else if (signatureLite.getType() == ndn_SignatureType_Generic)
-    result.reset(new GenericSignature());
-  else
-    // We don't expect this to happen.
-    throw runtime_error("signatureStruct.type has an unrecognized value");
-
-  result->set(signatureLite);
-  return result;
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeSignatureInfoAndValue
+         (signatureLite, signatureInfo, signatureInfoLength, signatureValue,
+          signatureValueLength))) {
+      if (!isRetry && isArrayFull(error)) {
+        keyNameComponents.resize(getMaxArraySize(signatureInfoLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
+
+    ptr_lib::shared_ptr<Signature> result;
+    if (signatureLite.getType() == ndn_SignatureType_Sha256WithRsaSignature)
+      result.reset(new Sha256WithRsaSignature());
+    else if (signatureLite.getType() == ndn_SignatureType_Sha256WithEcdsaSignature)
+      result.reset(new Sha256WithEcdsaSignature());
+    else if (signatureLite.getType() == ndn_SignatureType_HmacWithSha256Signature)
+      result.reset(new HmacWithSha256Signature());
+    else if (signatureLite.getType() == ndn_SignatureType_DigestSha256Signature)
+      result.reset(new DigestSha256Signature());
+    else if (signatureLite.getType() == ndn_SignatureType_Generic)
+      result.reset(new GenericSignature());
+    else
+      // We don't expect this to happen.
+      throw runtime_error("signatureStruct.type has an unrecognized value");
+
+    result->set(signatureLite);
+    return result;
+  }
 }
 
 Blob
@@ -330,12 +399,13 @@ Tlv0_2WireFormat::encodeDelegationSet(const DelegationSet& delegationSet)
 {
   DynamicUInt8Vector output(256);
   size_t encodingLength = 0;
+  NameComponentArray nameComponents;
 
   // Encode a series of Delegation.
   for (size_t i = 0; i < delegationSet.size(); ++i) {
-    struct ndn_NameComponent nameComponents[100];
+    nameComponents.resize(delegationSet.get(i).getName().size());
     DelegationSetLite::Delegation delegationLite
-      (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]));
+      (nameComponents.get(), nameComponents.size());
     delegationSet.get(i).get(delegationLite);
 
     size_t delegationEncodingLength;
@@ -356,19 +426,27 @@ Tlv0_2WireFormat::decodeDelegationSet
   (DelegationSet& delegationSet, const uint8_t *input, size_t inputLength)
 {
   delegationSet.clear();
+  NameComponentArray nameComponents;
 
   // Decode a series of Delegation
   size_t offset = 0;
+  bool isRetry = false;
   while (offset < inputLength) {
-    struct ndn_NameComponent nameComponents[100];
     DelegationSetLite::Delegation delegationLite
-      (nameComponents, sizeof(nameComponents) / sizeof(nameComponents[0]));
+      (nameComponents.get(), nameComponents.size());
 
     size_t encodingLength;
     ndn_Error error;
     if ((error = Tlv0_2WireFormatLite::decodeDelegationSet_Delegation
-         (delegationLite, input + offset, inputLength - offset, &encodingLength)))
+         (delegationLite, input + offset, inputLength - offset, &encodingLength))) {
+      if (!isRetry && isArrayFull(error)) {
+        // Retry once with an array for the input length.
+        nameComponents.resize(getMaxArraySize(inputLength));
+        isRetry = true;
+        continue;
+      }
       throw runtime_error(ndn_getErrorString(error));
+    }
 
     offset += encodingLength;
     delegationSet.addUnsorted
@@ -380,10 +458,10 @@ Blob
 Tlv0_2WireFormat::encodeEncryptedContent
   (const EncryptedContent& encryptedContent)
 {
-  struct ndn_NameComponent keyNameComponents[100];
+  NameComponentArray keyNameComponents
+    (encryptedContent.getKeyLocator().getKeyName().size());
   EncryptedContentLite encryptedContentLite
-    (keyNameComponents,
-     sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+    (keyNameComponents.get(), keyNameComponents.size());
   encryptedContent.get(encryptedContentLite);
 
   DynamicUInt8Vector output(256);
@@ -402,17 +480,25 @@ Tlv0_2WireFormat::decodeEncryptedContent
   (EncryptedContent& encryptedContent, const uint8_t *input,
    size_t inputLength)
 {
-  struct ndn_NameComponent keyNameComponents[100];
-  EncryptedContentLite encryptedContentLite
-    (keyNameComponents,
-     sizeof(keyNameComponents) / sizeof(keyNameComponents[0]));
+  NameComponentArray keyNameComponents;
+  // If the fixed array is full, retry once with an array for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    EncryptedContentLite encryptedContentLite
+      (keyNameComponents.get(), keyNameComponents.size());
 
-  ndn_Error error;
-  if ((error = Tlv0_2WireFormatLite::decodeEncryptedContent
-       (encryptedContentLite, input, inputLength)))
-    throw runtime_error(ndn_getErrorString(error));
+    ndn_Error error;
+    if ((error = Tlv0_2WireFormatLite::decodeEncryptedContent
+         (encryptedContentLite, input, inputLength))) {
+      if (!isRetry && isArrayFull(error)) {
+        keyNameComponents.resize(getMaxArraySize(inputLength));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
 
-  encryptedContent.set(encryptedContentLite);
+    encryptedContent.set(encryptedContentLite);
+    return;
+  }
 }
 
 Tlv0_2WireFormat* Tlv0_2WireFormat::instance_ = 0;
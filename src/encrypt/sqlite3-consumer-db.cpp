@@ -30,6 +30,7 @@
 #include <sstream>
 #include <fstream>
 #include <ndn-cpp/encrypt/sqlite3-consumer-db.hpp>
+#include "../util/sqlite3-statement.hpp"
 
 using namespace std;
 
@@ -72,15 +73,38 @@ Sqlite3ConsumerDb::Sqlite3ConsumerDb(const string& databaseFilePath)
     sqlite3_free(errorMessage);
     throw ConsumerDb::Error("Consumer DB cannot be initialized");
   }
+
+  statementCache_.reset(new Sqlite3StatementCache
+    (database_, &Sqlite3StatementCache::throwError<ConsumerDb::Error>));
+}
+
+Sqlite3ConsumerDb::~Sqlite3ConsumerDb()
+{
+  // Finalize the cached statements so that the database can be closed.
+  statementCache_.reset();
+  sqlite3_close(database_);
+}
+
+void
+Sqlite3ConsumerDb::beginTransaction() { statementCache_->beginTransaction(); }
+
+void
+Sqlite3ConsumerDb::commitTransaction() { statementCache_->commitTransaction(); }
+
+void
+Sqlite3ConsumerDb::rollbackTransaction() { statementCache_->rollbackTransaction(); }
+
+void
+Sqlite3ConsumerDb::enableWriteAheadLogging(const string& synchronous)
+{
+  statementCache_->enableWriteAheadLogging(synchronous);
 }
 
 Blob
 Sqlite3ConsumerDb::getKey(const Name& keyName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT key_buf FROM decryptionkeys WHERE key_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT key_buf FROM decryptionkeys WHERE key_name=?");
   sqlite3_bind_blob(statement, 1, keyName.wireEncode(), SQLITE_TRANSIENT);
 
   int res = sqlite3_step(statement);
@@ -91,22 +115,19 @@ Sqlite3ConsumerDb::getKey(const Name& keyName)
       (static_cast<const uint8_t*>(sqlite3_column_blob(statement, 0)),
        sqlite3_column_bytes(statement, 0));
 
-  sqlite3_finalize(statement);
   return key;
 }
 
 void
 Sqlite3ConsumerDb::addKey(const Name& keyName, const Blob& keyBlob)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "INSERT INTO decryptionkeys(key_name, key_buf) values (?, ?)",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_,
+     "INSERT INTO decryptionkeys(key_name, key_buf) values (?, ?)");
   sqlite3_bind_blob(statement, 1, keyName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_bind_blob(statement, 2, keyBlob, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw ConsumerDb::Error
       ("Sqlite3ConsumerDb::addKey: Cannot add the key to the database");
@@ -115,12 +136,10 @@ Sqlite3ConsumerDb::addKey(const Name& keyName, const Blob& keyBlob)
 void
 Sqlite3ConsumerDb::deleteKey(const Name& keyName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM decryptionkeys WHERE key_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM decryptionkeys WHERE key_name=?");
   sqlite3_bind_blob(statement, 1, keyName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 }
 
 }
@@ -30,6 +30,7 @@
 #include <sstream>
 #include <fstream>
 #include <ndn-cpp/encrypt/sqlite3-group-manager-db.hpp>
+#include "../util/sqlite3-statement.hpp"
 
 using namespace std;
 
@@ -106,19 +107,42 @@ Sqlite3GroupManagerDb::Sqlite3GroupManagerDb(const string& databaseFilePath)
     sqlite3_free(errorMessage);
     throw GroupManagerDb::Error("GroupManager DB cannot be initialized");
   }
+
+  statementCache_.reset(new Sqlite3StatementCache
+    (database_, &Sqlite3StatementCache::throwError<GroupManagerDb::Error>));
+}
+
+Sqlite3GroupManagerDb::~Sqlite3GroupManagerDb()
+{
+  // Finalize the cached statements so that the database can be closed.
+  statementCache_.reset();
+  sqlite3_close(database_);
+}
+
+void
+Sqlite3GroupManagerDb::beginTransaction() { statementCache_->beginTransaction(); }
+
+void
+Sqlite3GroupManagerDb::commitTransaction() { statementCache_->commitTransaction(); }
+
+void
+Sqlite3GroupManagerDb::rollbackTransaction() { statementCache_->rollbackTransaction(); }
+
+void
+Sqlite3GroupManagerDb::enableWriteAheadLogging(const string& synchronous)
+{
+  statementCache_->enableWriteAheadLogging(synchronous);
 }
 
 bool
 Sqlite3GroupManagerDb::hasSchedule(const string& name)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT schedule_id FROM schedules WHERE schedule_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_,
+     "SELECT schedule_id FROM schedules WHERE schedule_name=?");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
 
   bool result = (sqlite3_step(statement) == SQLITE_ROW);
-  sqlite3_finalize(statement);
   return result;
 }
 
@@ -127,25 +151,20 @@ Sqlite3GroupManagerDb::listAllScheduleNames(vector<string>& nameList)
 {
   nameList.clear();
   
-  sqlite3_stmt* statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT schedule_name FROM schedules", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT schedule_name FROM schedules");
 
   while (sqlite3_step(statement) == SQLITE_ROW)
     nameList.push_back
       (string(reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)),
               sqlite3_column_bytes(statement, 0)));
-
-  sqlite3_finalize(statement);
 }
 
 ptr_lib::shared_ptr<Schedule>
 Sqlite3GroupManagerDb::getSchedule(const string& name)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT schedule FROM schedules where schedule_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT schedule FROM schedules where schedule_name=?");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
@@ -157,18 +176,14 @@ Sqlite3GroupManagerDb::getSchedule(const string& name)
         (Blob((const uint8_t*)sqlite3_column_blob(statement, 0),
               sqlite3_column_bytes(statement, 0)));
     } catch (...) {
-      sqlite3_finalize(statement);
       throw GroupManagerDb::Error
         ("Sqlite3GroupManagerDb::getSchedule: The schedule cannot be decoded");
     }
 
-    sqlite3_finalize(statement);
     return result;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw GroupManagerDb::Error("Cannot get the result from the database");
-  }
 }
 
 void
@@ -177,12 +192,10 @@ Sqlite3GroupManagerDb::getScheduleMembers
 {
   memberMap.clear();
 
-  sqlite3_stmt* statement;
-  sqlite3_prepare_v2
-    (database_,
-     "SELECT key_name, pubkey\
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT key_name, pubkey\
       FROM members JOIN schedules ON members.schedule_id=schedules.schedule_id\
-      WHERE schedule_name=?", -1, &statement, 0);
+      WHERE schedule_name=?");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
 
   while (sqlite3_step(statement) == SQLITE_ROW) {
@@ -192,7 +205,6 @@ Sqlite3GroupManagerDb::getScheduleMembers
         (Blob((const uint8_t*)sqlite3_column_blob(statement, 0),
               sqlite3_column_bytes(statement, 0)));
     } catch (...) {
-      sqlite3_finalize(statement);
       throw GroupManagerDb::Error
         ("Sqlite3GroupManagerDb.getScheduleMembers: Error decoding name");
     }
@@ -201,7 +213,6 @@ Sqlite3GroupManagerDb::getScheduleMembers
                               sqlite3_column_bytes(statement, 1));
   }
 
-  sqlite3_finalize(statement);
 }
 
 void
@@ -210,15 +221,13 @@ Sqlite3GroupManagerDb::addSchedule(const string& name, const Schedule& schedule)
   if (name.size() == 0)
     throw GroupManagerDb::Error("addSchedule: The schedule name cannot be empty");
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "INSERT INTO schedules (schedule_name, schedule) values (?, ?)",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_,
+     "INSERT INTO schedules (schedule_name, schedule) values (?, ?)");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
   sqlite3_bind_blob(statement, 2, schedule.wireEncode(), SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Cannot add the schedule to the database");
 }
@@ -226,12 +235,10 @@ Sqlite3GroupManagerDb::addSchedule(const string& name, const Schedule& schedule)
 void
 Sqlite3GroupManagerDb::deleteSchedule(const string& name)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM schedules WHERE schedule_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM schedules WHERE schedule_name=?");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 }
 
 void
@@ -242,15 +249,13 @@ Sqlite3GroupManagerDb::renameSchedule
     throw GroupManagerDb::Error
       ("renameSchedule: The schedule newName cannot be empty");
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "UPDATE schedules SET schedule_name=? WHERE schedule_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_,
+     "UPDATE schedules SET schedule_name=? WHERE schedule_name=?");
   sqlite3_bind_text(statement, 1, newName, SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, oldName, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Cannot rename the schedule in the database");
 }
@@ -264,15 +269,12 @@ Sqlite3GroupManagerDb::updateSchedule
     return;
   }
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "UPDATE schedules SET schedule=? WHERE schedule_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "UPDATE schedules SET schedule=? WHERE schedule_name=?");
   sqlite3_bind_blob(statement, 1, schedule.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, name, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Cannot update the schedule in the database");
 }
@@ -280,14 +282,11 @@ Sqlite3GroupManagerDb::updateSchedule
 bool
 Sqlite3GroupManagerDb::hasMember(const Name& identity)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT member_id FROM members WHERE member_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT member_id FROM members WHERE member_name=?");
   sqlite3_bind_blob(statement, 1, identity.wireEncode(), SQLITE_TRANSIENT);
 
   bool result = (sqlite3_step(statement) == SQLITE_ROW);
-  sqlite3_finalize(statement);
   return result;
 }
 
@@ -296,9 +295,8 @@ Sqlite3GroupManagerDb::listAllMembers(vector<Name>& nameList)
 {
   nameList.clear();
 
-  sqlite3_stmt* statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT member_name FROM members", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT member_name FROM members");
 
   while (sqlite3_step(statement) == SQLITE_ROW) {
     Name name;
@@ -307,7 +305,6 @@ Sqlite3GroupManagerDb::listAllMembers(vector<Name>& nameList)
         (Blob((const uint8_t*)sqlite3_column_blob(statement, 0),
               sqlite3_column_bytes(statement, 0)));
     } catch (...) {
-      sqlite3_finalize(statement);
       throw GroupManagerDb::Error
         ("Sqlite3GroupManagerDb.listAllMembers: Error decoding name");
     }
@@ -315,19 +312,15 @@ Sqlite3GroupManagerDb::listAllMembers(vector<Name>& nameList)
     nameList.push_back(name);
   }
 
-  sqlite3_finalize(statement);
 }
 
 string
 Sqlite3GroupManagerDb::getMemberSchedule(const Name& identity)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_,
-     "SELECT schedule_name\
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT schedule_name\
       FROM schedules JOIN members ON schedules.schedule_id = members.schedule_id\
-      WHERE member_name=?",
-     -1, &statement, 0);
+      WHERE member_name=?");
   sqlite3_bind_blob(statement, 1, identity.wireEncode(), SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
@@ -336,13 +329,10 @@ Sqlite3GroupManagerDb::getMemberSchedule(const Name& identity)
     string result(reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)),
                   sqlite3_column_bytes(statement, 0));
 
-    sqlite3_finalize(statement);
     return result;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw GroupManagerDb::Error("Cannot get the result from the database");
-  }
 }
 
 void
@@ -356,19 +346,16 @@ Sqlite3GroupManagerDb::addMember
   // Needs to be changed in the future.
   Name memberName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_,
+  Sqlite3Statement statement
+    (*statementCache_,
      "INSERT INTO members(schedule_id, member_name, key_name, pubkey)\
-      values (?, ?, ?, ?)",
-     -1, &statement, 0);
+      values (?, ?, ?, ?)");
   sqlite3_bind_int(statement, 1, scheduleId);
   sqlite3_bind_blob(statement, 2, memberName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_bind_blob(statement, 3, keyName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_bind_blob(statement, 4, key, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Cannot add the member to the database");
 }
@@ -382,15 +369,12 @@ Sqlite3GroupManagerDb::updateMemberSchedule
     throw GroupManagerDb::Error
       ("Sqlite3GroupManagerDb.updateMemberSchedule: The schedule does not exist");
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "UPDATE members SET schedule_id=? WHERE member_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "UPDATE members SET schedule_id=? WHERE member_name=?");
   sqlite3_bind_int(statement, 1, scheduleId);
   sqlite3_bind_blob(statement, 2, identity.wireEncode(), SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Sqlite3GroupManagerDb.updateMemberSchedule: SQLite error");
 }
@@ -398,24 +382,20 @@ Sqlite3GroupManagerDb::updateMemberSchedule
 void
 Sqlite3GroupManagerDb::deleteMember(const Name& identity)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM members WHERE member_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM members WHERE member_name=?");
   sqlite3_bind_blob(statement, 1, identity.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 }
 
 bool
 Sqlite3GroupManagerDb::hasEKey(const Name& eKeyName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT ekey_id FROM ekeys where ekey_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT ekey_id FROM ekeys where ekey_name=?");
   sqlite3_bind_blob(statement, 1, eKeyName.wireEncode(), SQLITE_TRANSIENT);
 
   bool result = (sqlite3_step(statement) == SQLITE_ROW);
-  sqlite3_finalize(statement);
   return result;
 }
 
@@ -423,15 +403,12 @@ void
 Sqlite3GroupManagerDb::addEKey
   (const Name& eKeyName, const Blob& publicKey, const Blob& privateKey)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "INSERT INTO ekeys(ekey_name, pub_key) values (?, ?)",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "INSERT INTO ekeys(ekey_name, pub_key) values (?, ?)");
   sqlite3_bind_blob(statement, 1, eKeyName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_bind_blob(statement, 2, publicKey, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw GroupManagerDb::Error("Cannot add the EKey to database");
 
@@ -442,9 +419,8 @@ void
 Sqlite3GroupManagerDb::getEKey
   (const Name& eKeyName, Blob& publicKey, Blob& privateKey)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT pub_key FROM ekeys where ekey_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT pub_key FROM ekeys where ekey_name=?");
   sqlite3_bind_blob(statement, 1, eKeyName.wireEncode(), SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
@@ -452,12 +428,9 @@ Sqlite3GroupManagerDb::getEKey
   if (status == SQLITE_ROW) {
     publicKey = Blob((const uint8_t*)sqlite3_column_blob(statement, 0),
       sqlite3_column_bytes(statement, 0));
-    sqlite3_finalize(statement);
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw GroupManagerDb::Error("Cannot get the result from the database");
-  }
 
   privateKey = privateKeyBase_[eKeyName];
 }
@@ -465,10 +438,8 @@ Sqlite3GroupManagerDb::getEKey
 void
 Sqlite3GroupManagerDb::cleanEKeys()
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "DELETE FROM ekeys", -1, &statement, 0);
+  Sqlite3Statement statement(*statementCache_, "DELETE FROM ekeys");
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 
   privateKeyBase_.clear();
 }
@@ -476,12 +447,10 @@ Sqlite3GroupManagerDb::cleanEKeys()
 void
 Sqlite3GroupManagerDb::deleteEKey(const Name& eKeyName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM ekeys WHERE ekey_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM ekeys WHERE ekey_name=?");
   sqlite3_bind_blob(statement, 1, eKeyName.wireEncode(), SQLITE_TRANSIENT);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 
   map<Name, Blob>::iterator it = privateKeyBase_.find(eKeyName);
   privateKeyBase_.erase(it);
@@ -490,10 +459,9 @@ Sqlite3GroupManagerDb::deleteEKey(const Name& eKeyName)
 int
 Sqlite3GroupManagerDb::getScheduleId(const std::string& name)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT schedule_id FROM schedules WHERE schedule_name=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_,
+     "SELECT schedule_id FROM schedules WHERE schedule_name=?");
   sqlite3_bind_text(statement, 1, name, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
@@ -502,7 +470,6 @@ Sqlite3GroupManagerDb::getScheduleId(const std::string& name)
   if (status == SQLITE_ROW)
     result = sqlite3_column_int(statement, 0);
 
-  sqlite3_finalize(statement);
   return result;
 }
 
@@ -30,6 +30,7 @@
 #include <sstream>
 #include <fstream>
 #include <ndn-cpp/encrypt/sqlite3-producer-db.hpp>
+#include "../util/sqlite3-statement.hpp"
 
 using namespace std;
 
@@ -72,6 +73,31 @@ Sqlite3ProducerDb::Sqlite3ProducerDb(const string& databaseFilePath)
     sqlite3_free(errorMessage);
     throw ProducerDb::Error("Producer DB cannot be initialized");
   }
+
+  statementCache_.reset(new Sqlite3StatementCache
+    (database_, &Sqlite3StatementCache::throwError<ProducerDb::Error>));
+}
+
+Sqlite3ProducerDb::~Sqlite3ProducerDb()
+{
+  // Finalize the cached statements so that the database can be closed.
+  statementCache_.reset();
+  sqlite3_close(database_);
+}
+
+void
+Sqlite3ProducerDb::beginTransaction() { statementCache_->beginTransaction(); }
+
+void
+Sqlite3ProducerDb::commitTransaction() { statementCache_->commitTransaction(); }
+
+void
+Sqlite3ProducerDb::rollbackTransaction() { statementCache_->rollbackTransaction(); }
+
+void
+Sqlite3ProducerDb::enableWriteAheadLogging(const string& synchronous)
+{
+  statementCache_->enableWriteAheadLogging(synchronous);
 }
 
 bool
@@ -79,14 +105,11 @@ Sqlite3ProducerDb::hasContentKey(MillisecondsSince1970 timeSlot)
 {
   int fixedTimeSlot = getFixedTimeSlot(timeSlot);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT key FROM contentkeys where timeslot=?",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT key FROM contentkeys where timeslot=?");
   sqlite3_bind_int(statement, 1, fixedTimeSlot);
 
   bool result = (sqlite3_step(statement) == SQLITE_ROW);
-  sqlite3_finalize(statement);
   return result;
 }
 
@@ -95,9 +118,8 @@ Sqlite3ProducerDb::getContentKey(MillisecondsSince1970 timeSlot)
 {
   int fixedTimeSlot = getFixedTimeSlot(timeSlot);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT key FROM contentkeys where timeslot=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT key FROM contentkeys where timeslot=?");
   sqlite3_bind_int(statement, 1, fixedTimeSlot);
 
   int res = sqlite3_step(statement);
@@ -106,7 +128,6 @@ Sqlite3ProducerDb::getContentKey(MillisecondsSince1970 timeSlot)
     Blob result = Blob
       (static_cast<const uint8_t*>(sqlite3_column_blob(statement, 0)),
        sqlite3_column_bytes(statement, 0));
-    sqlite3_finalize(statement);
     return result;
   }
   else
@@ -119,15 +140,12 @@ Sqlite3ProducerDb::addContentKey(MillisecondsSince1970 timeSlot, const Blob& key
 {
   int fixedTimeSlot = getFixedTimeSlot(timeSlot);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "INSERT INTO contentkeys (timeslot, key) values (?, ?)",
-     -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "INSERT INTO contentkeys (timeslot, key) values (?, ?)");
   sqlite3_bind_int(statement, 1, fixedTimeSlot);
   sqlite3_bind_blob(statement, 2, key, SQLITE_TRANSIENT);
 
   int status = sqlite3_step(statement);
-  sqlite3_finalize(statement);
   if (status != SQLITE_DONE)
     throw ProducerDb::Error("Cannot add the key to the database");
 }
@@ -136,12 +154,10 @@ void
 Sqlite3ProducerDb::deleteContentKey(MillisecondsSince1970 timeSlot)
 {
   int fixedTimeSlot = getFixedTimeSlot(timeSlot);
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM contentkeys WHERE timeslot=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM contentkeys WHERE timeslot=?");
   sqlite3_bind_int(statement, 1, fixedTimeSlot);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 }
 
 }
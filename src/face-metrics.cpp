@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <ndn-cpp/face-metrics.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+const uint64_t FaceMetrics::rttBucketUpperBoundsMicroseconds_[] = {
+  1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000,
+  1000000, 2000000, 5000000, 10000000
+};
+
+FaceMetrics::FaceMetrics()
+: outInterests_(0), outData_(0), outBytes_(0), inInterests_(0), inData_(0),
+  inUnsolicitedData_(0), inNacks_(0), inBytes_(0), timeouts_(0),
+  decodeErrors_(0), pendingInterestCount_(0), rttCount_(0),
+  rttSumMicroseconds_(0), rttMaxMicroseconds_(0)
+{
+  for (size_t i = 0; i < N_RTT_BUCKETS; ++i)
+    rttBuckets_[i] = 0;
+}
+
+Milliseconds
+FaceMetrics::getRttMean() const
+{
+  if (rttCount_ == 0)
+    return 0;
+
+  return (double)rttSumMicroseconds_ / rttCount_ / 1000.0;
+}
+
+Milliseconds
+FaceMetrics::getRttBucketUpperBound(size_t i)
+{
+  if (i >= N_RTT_BUCKETS - 1)
+    return -1;
+
+  return rttBucketUpperBoundsMicroseconds_[i] / 1000.0;
+}
+
+size_t
+FaceMetrics::getRttBucketIndex(uint64_t rttMicroseconds)
+{
+  // There are only a few buckets, so a linear search is fine.
+  for (size_t i = 0; i < N_RTT_BUCKETS - 1; ++i) {
+    if (rttMicroseconds <= rttBucketUpperBoundsMicroseconds_[i])
+      return i;
+  }
+
+  return N_RTT_BUCKETS - 1;
+}
+
+Milliseconds
+FaceMetrics::getRttPercentile(double percentile) const
+{
+  if (rttCount_ == 0)
+    return 0;
+
+  // The number of round trip times at or below the percentile, rounded up.
+  double target = percentile / 100.0 * rttCount_;
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < N_RTT_BUCKETS - 1; ++i) {
+    cumulative += rttBuckets_[i];
+    if (cumulative > 0 && cumulative >= target)
+      return getRttBucketUpperBound(i);
+  }
+
+  return getRttMax();
+}
+
+string
+FaceMetrics::toString() const
+{
+  ostringstream result;
+
+  result << "out_interests " << outInterests_ << "\n";
+  result << "out_data " << outData_ << "\n";
+  result << "out_bytes " << outBytes_ << "\n";
+  result << "in_interests " << inInterests_ << "\n";
+  result << "in_data " << inData_ << "\n";
+  result << "in_unsolicited_data " << inUnsolicitedData_ << "\n";
+  result << "in_nacks " << inNacks_ << "\n";
+  result << "in_bytes " << inBytes_ << "\n";
+  result << "timeouts " << timeouts_ << "\n";
+  result << "decode_errors " << decodeErrors_ << "\n";
+  result << "pending_interests " << pendingInterestCount_ << "\n";
+  result << "rtt_count " << rttCount_ << "\n";
+  result << "rtt_mean_ms " << getRttMean() << "\n";
+  result << "rtt_p50_ms " << getRttPercentile(50) << "\n";
+  result << "rtt_p90_ms " << getRttPercentile(90) << "\n";
+  result << "rtt_p99_ms " << getRttPercentile(99) << "\n";
+  result << "rtt_max_ms " << getRttMax() << "\n";
+  for (size_t i = 0; i < N_RTT_BUCKETS; ++i) {
+    result << "rtt_bucket_le_";
+    if (i < N_RTT_BUCKETS - 1)
+      result << getRttBucketUpperBound(i);
+    else
+      result << "inf";
+    result << "_ms " << rttBuckets_[i] << "\n";
+  }
+
+  return result.str();
+}
+
+}
@@ -127,6 +127,21 @@ Face::expressInterest
   return pendingInterestId;
 }
 
+uint64_t
+Face::expressInterest
+  (const InterestTemplate& interestTemplate,
+   const Name::Component& finalComponent, const OnData& onData,
+   const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack)
+{
+  uint64_t pendingInterestId = node_->getNextEntryId();
+
+  node_->expressInterestFromTemplate
+    (pendingInterestId, interestTemplate, finalComponent, onData, onTimeout,
+     onNetworkNack, this);
+
+  return pendingInterestId;
+}
+
 void
 Face::removePendingInterest(uint64_t pendingInterestId)
 {
@@ -237,6 +252,68 @@ Face::shutdown()
   node_->shutdown();
 }
 
+void
+Face::setMetricsEnabled(bool enabled)
+{
+  node_->setMetricsEnabled(enabled);
+}
+
+bool
+Face::getMetricsEnabled()
+{
+  return node_->getMetricsEnabled();
+}
+
+FaceMetrics
+Face::getMetrics()
+{
+  FaceMetrics metrics;
+  node_->getMetrics(metrics);
+  return metrics;
+}
+
+void
+Face::resetMetrics()
+{
+  node_->resetMetrics();
+}
+
+void
+Face::setLazyDecoding(bool enabled)
+{
+  node_->setLazyDecoding(enabled);
+}
+
+bool
+Face::getLazyDecoding()
+{
+  return node_->getLazyDecoding();
+}
+
+void
+Face::setInterestAggregation(bool enabled)
+{
+  node_->setInterestAggregation(enabled);
+}
+
+bool
+Face::getInterestAggregation()
+{
+  return node_->getInterestAggregation();
+}
+
+void
+Face::setDataCacheCapacity(size_t capacity)
+{
+  node_->setDataCacheCapacity(capacity);
+}
+
+size_t
+Face::getDataCacheCapacity()
+{
+  return node_->getDataCacheCapacity();
+}
+
 void
 Face::callLater(Milliseconds delayMilliseconds, const Callback& callback)
 {
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../c/util/time.h"
+#include "data-cache.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+void
+DataCache::setCapacity(size_t capacity)
+{
+  capacity_ = capacity;
+  evict();
+}
+
+void
+DataCache::insert(const Data& data)
+{
+  if (capacity_ == 0)
+    return;
+
+  Milliseconds freshnessPeriod = data.getMetaInfo().getFreshnessPeriod();
+  MillisecondsSince1970 staleTime = freshnessPeriod >= 0 ?
+    ndn_getNowMilliseconds() + freshnessPeriod : -1;
+  ptr_lib::shared_ptr<const Data> dataCopy(new Data(data));
+
+  map<Name, EntryList::iterator>::iterator found = index_.find(data.getName());
+  if (found != index_.end()) {
+    // Replace the Data and move it to the back as the most recently used.
+    *found->second = Entry(dataCopy, staleTime);
+    entries_.splice(entries_.end(), entries_, found->second);
+    return;
+  }
+
+  entries_.push_back(Entry(dataCopy, staleTime));
+  index_[data.getName()] = --entries_.end();
+  evict();
+}
+
+ptr_lib::shared_ptr<Data>
+DataCache::find(const Interest& interest)
+{
+  if (index_.empty())
+    return ptr_lib::shared_ptr<Data>();
+
+  MillisecondsSince1970 now = 0;
+  if (interest.getMustBeFresh())
+    now = ndn_getNowMilliseconds();
+
+  // The index is sorted, so the Data names with the Interest name as a prefix
+  // are together, from leftmost to rightmost.
+  map<Name, EntryList::iterator>::iterator found = index_.end();
+  for (map<Name, EntryList::iterator>::iterator i =
+         index_.lower_bound(interest.getName());
+       i != index_.end() && interest.getName().isPrefixOf(i->first); ++i) {
+    const Entry& entry = *i->second;
+    if (interest.getMustBeFresh() &&
+        (entry.staleTime_ < 0 || entry.staleTime_ <= now))
+      continue;
+    if (!interest.matchesData(*entry.data_))
+      continue;
+
+    found = i;
+    if (interest.getChildSelector() != 1)
+      // Use the leftmost.
+      break;
+  }
+
+  if (found == index_.end())
+    return ptr_lib::shared_ptr<Data>();
+
+  // Move the entry to the back as the most recently used.
+  entries_.splice(entries_.end(), entries_, found->second);
+  return ptr_lib::make_shared<Data>(*found->second->data_);
+}
+
+void
+DataCache::evict()
+{
+  while (index_.size() > capacity_) {
+    index_.erase(entries_.front().data_->getName());
+    entries_.pop_front();
+  }
+}
+
+}
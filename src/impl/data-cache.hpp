@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_DATA_CACHE_HPP
+#define NDN_DATA_CACHE_HPP
+
+#include <list>
+#include <map>
+#include <ndn-cpp/interest.hpp>
+#include <ndn-cpp/data.hpp>
+
+namespace ndn {
+
+/**
+ * A DataCache is an internal class to hold a bounded number of the Data
+ * packets which the Face received for its pending Interests, so that a later
+ * expressInterest which matches a cached Data does not need to be sent. When
+ * the cache is full, the least recently used Data is removed.
+ */
+class DataCache {
+public:
+  /**
+   * Create an empty DataCache with a capacity of 0, which disables it.
+   */
+  DataCache()
+  : capacity_(0)
+  {
+  }
+
+  /**
+   * Set the maximum number of Data packets in the cache. If the cache has more
+   * packets, remove the least recently used.
+   * @param capacity The maximum number of Data packets. If 0, the cache is
+   * disabled and cleared.
+   */
+  void
+  setCapacity(size_t capacity);
+
+  /**
+   * Get the capacity given to setCapacity.
+   * @return The maximum number of Data packets.
+   */
+  size_t
+  getCapacity() const { return capacity_; }
+
+  /**
+   * Get the number of Data packets in the cache.
+   * @return The number of Data packets.
+   */
+  size_t
+  size() const { return index_.size(); }
+
+  /**
+   * Insert a copy of the Data packet, replacing a Data with the same name. If
+   * the capacity is 0, do nothing.
+   * @param data The Data packet to copy.
+   */
+  void
+  insert(const Data& data);
+
+  /**
+   * Find a Data packet which matches the interest. If the interest has
+   * MustBeFresh, only return a Data whose FreshnessPeriod has not expired since
+   * it was inserted. If more than one Data matches, use the ChildSelector to
+   * return the leftmost (the default) or rightmost.
+   * @param interest The Interest to match.
+   * @return A new copy of the Data which the caller can modify, or null if not
+   * found.
+   */
+  ptr_lib::shared_ptr<Data>
+  find(const Interest& interest);
+
+  /**
+   * Remove all Data packets from the cache.
+   */
+  void
+  clear()
+  {
+    index_.clear();
+    entries_.clear();
+  }
+
+private:
+  /**
+   * DataCache::Entry holds a Data packet and the time when it becomes stale.
+   */
+  class Entry {
+  public:
+    Entry(const ptr_lib::shared_ptr<const Data>& data,
+          MillisecondsSince1970 staleTime)
+    : data_(data), staleTime_(staleTime)
+    {
+    }
+
+    ptr_lib::shared_ptr<const Data> data_;
+    // The time when the FreshnessPeriod expires, or -1 if the Data has no
+    // FreshnessPeriod.
+    MillisecondsSince1970 staleTime_;
+  };
+
+  typedef std::list<Entry> EntryList;
+
+  /**
+   * Remove the least recently used entries until the size is at most
+   * capacity_.
+   */
+  void
+  evict();
+
+  size_t capacity_;
+  // The list is in order of use, with the most recently used at the back.
+  EntryList entries_;
+  // The key is the Data name.
+  std::map<Name, EntryList::iterator> index_;
+};
+
+}
+
+#endif
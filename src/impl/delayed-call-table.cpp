@@ -27,11 +27,17 @@ using namespace std;
 
 namespace ndn {
 
+DelayedCallTable::DelayedCallTable()
+: entryPool_(ptr_lib::make_shared<SlabPool>())
+{
+}
+
 void
 DelayedCallTable::callLater
   (Milliseconds delayMilliseconds, const Face::Callback& callback)
 {
-  ptr_lib::shared_ptr<Entry> entry(new Entry(delayMilliseconds, callback));
+  ptr_lib::shared_ptr<Entry> entry = ptr_lib::allocate_shared<Entry>
+    (SlabAllocator<Entry>(entryPool_), delayMilliseconds, callback);
   // Insert into table_, sorted on getCallTime().
   table_.insert
     (lower_bound(table_.begin(), table_.end(), entry, entryCompare_), entry);
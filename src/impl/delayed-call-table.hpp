@@ -24,11 +24,18 @@
 
 #include <deque>
 #include <ndn-cpp/face.hpp>
+#include "slab-pool.hpp"
 
 namespace ndn {
 
 class DelayedCallTable {
 public:
+  /**
+   * Create an empty DelayedCallTable. Entries are allocated from a SlabPool
+   * owned by this table.
+   */
+  DelayedCallTable();
+
   /**
    * Call callback() after the given delay. This adds to the delayed call
    * table which is used by callTimedOut().
@@ -93,6 +100,7 @@ private:
   // Use a deque so we can efficiently remove from the front.
   std::deque<ptr_lib::shared_ptr<Entry> > table_;
   Entry::Compare entryCompare_;
+  ptr_lib::shared_ptr<SlabPool> entryPool_;
 };
 
 }
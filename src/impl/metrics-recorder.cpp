@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../c/encoding/tlv/tlv.h"
+#include "metrics-recorder.hpp"
+
+namespace ndn {
+
+MetricsRecorder::MetricsRecorder()
+: isEnabled_(false)
+{
+  store(pendingInterestCount_, 0);
+  reset();
+}
+
+void
+MetricsRecorder::setIsEnabled(bool isEnabled)
+{
+#ifdef NDN_CPP_HAVE_BOOST_ASIO
+  isEnabled_.store(isEnabled, boost::memory_order_relaxed);
+#else
+  isEnabled_ = isEnabled;
+#endif
+}
+
+void
+MetricsRecorder::recordOutPacket(const uint8_t* encoding, size_t encodingLength)
+{
+  add(outBytes_, encodingLength);
+  if (encodingLength == 0)
+    return;
+
+  // Interest and Data have a one-byte TLV type, so just check the first byte.
+  if (encoding[0] == ndn_Tlv_Interest)
+    add(outInterests_, 1);
+  else if (encoding[0] == ndn_Tlv_Data)
+    add(outData_, 1);
+}
+
+void
+MetricsRecorder::recordRtt(Milliseconds rtt)
+{
+  uint64_t rttMicroseconds = rtt > 0 ? (uint64_t)(rtt * 1000.0) : 0;
+
+  add(rttCount_, 1);
+  add(rttSumMicroseconds_, rttMicroseconds);
+  add(rttBuckets_[FaceMetrics::getRttBucketIndex(rttMicroseconds)], 1);
+  // Only the thread which processes the Node records, so we don't need a
+  // compare-and-swap loop for the maximum.
+  if (rttMicroseconds > load(rttMaxMicroseconds_))
+    store(rttMaxMicroseconds_, rttMicroseconds);
+}
+
+void
+MetricsRecorder::get(FaceMetrics& metrics) const
+{
+  metrics.outInterests_ = load(outInterests_);
+  metrics.outData_ = load(outData_);
+  metrics.outBytes_ = load(outBytes_);
+  metrics.inInterests_ = load(inInterests_);
+  metrics.inData_ = load(inData_);
+  metrics.inUnsolicitedData_ = load(inUnsolicitedData_);
+  metrics.inNacks_ = load(inNacks_);
+  metrics.inBytes_ = load(inBytes_);
+  metrics.timeouts_ = load(timeouts_);
+  metrics.decodeErrors_ = load(decodeErrors_);
+  metrics.pendingInterestCount_ = load(pendingInterestCount_);
+  metrics.rttCount_ = load(rttCount_);
+  metrics.rttSumMicroseconds_ = load(rttSumMicroseconds_);
+  metrics.rttMaxMicroseconds_ = load(rttMaxMicroseconds_);
+  for (size_t i = 0; i < FaceMetrics::N_RTT_BUCKETS; ++i)
+    metrics.rttBuckets_[i] = load(rttBuckets_[i]);
+}
+
+void
+MetricsRecorder::reset()
+{
+  store(outInterests_, 0);
+  store(outData_, 0);
+  store(outBytes_, 0);
+  store(inInterests_, 0);
+  store(inData_, 0);
+  store(inUnsolicitedData_, 0);
+  store(inNacks_, 0);
+  store(inBytes_, 0);
+  store(timeouts_, 0);
+  store(decodeErrors_, 0);
+  store(rttCount_, 0);
+  store(rttSumMicroseconds_, 0);
+  store(rttMaxMicroseconds_, 0);
+  for (size_t i = 0; i < FaceMetrics::N_RTT_BUCKETS; ++i)
+    store(rttBuckets_[i], 0);
+}
+
+}
@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_METRICS_RECORDER_HPP
+#define NDN_METRICS_RECORDER_HPP
+
+#include <ndn-cpp/ndn-cpp-config.h>
+#ifdef NDN_CPP_HAVE_BOOST_ASIO
+#include <boost/atomic.hpp>
+#endif
+#include <ndn-cpp/face-metrics.hpp>
+
+namespace ndn {
+
+/**
+ * A MetricsRecorder holds the counters and round trip time histogram for a
+ * Node, and copies them to a FaceMetrics snapshot. The record methods are
+ * called by the thread which processes the Node while getMetrics can be called
+ * by any thread, so with Boost asio (where ThreadsafeFace may read the metrics
+ * from another thread) the counters are lock-free atomics updated with relaxed
+ * memory order. The record methods don't check getIsEnabled(), so that the
+ * caller only checks it once for each event.
+ */
+class MetricsRecorder {
+public:
+  /**
+   * Create a MetricsRecorder which is disabled, with all counters zero.
+   */
+  MetricsRecorder();
+
+  /**
+   * Enable or disable recording. This does not reset the counters.
+   * @param isEnabled True to enable recording.
+   */
+  void
+  setIsEnabled(bool isEnabled);
+
+  /**
+   * Check if recording is enabled.
+   * @return True if recording is enabled.
+   */
+  bool
+  getIsEnabled() const
+  {
+#ifdef NDN_CPP_HAVE_BOOST_ASIO
+    return isEnabled_.load(boost::memory_order_relaxed);
+#else
+    return isEnabled_;
+#endif
+  }
+
+  /**
+   * Count the packet given to the Transport to send, using the TLV type of the
+   * encoding to count it as an Interest or Data packet.
+   * @param encoding The encoded packet.
+   * @param encodingLength The length of the encoding.
+   */
+  void
+  recordOutPacket(const uint8_t* encoding, size_t encodingLength);
+
+  /**
+   * Count the bytes of an element received from the Transport.
+   * @param elementLength The length of the element.
+   */
+  void
+  recordInElement(size_t elementLength) { add(inBytes_, elementLength); }
+
+  void
+  recordInInterest() { add(inInterests_, 1); }
+
+  /**
+   * Count a received Data packet.
+   * @param isUnsolicited True if the Data packet did not match a pending
+   * Interest.
+   */
+  void
+  recordInData(bool isUnsolicited)
+  {
+    add(inData_, 1);
+    if (isUnsolicited)
+      add(inUnsolicitedData_, 1);
+  }
+
+  void
+  recordInNack() { add(inNacks_, 1); }
+
+  void
+  recordTimeout() { add(timeouts_, 1); }
+
+  void
+  recordDecodeError() { add(decodeErrors_, 1); }
+
+  /**
+   * Save the current size of the pending interest table.
+   * @param pendingInterestCount The number of pending Interests.
+   */
+  void
+  setPendingInterestCount(size_t pendingInterestCount)
+  {
+    store(pendingInterestCount_, pendingInterestCount);
+  }
+
+  /**
+   * Add the round trip time to the histogram.
+   * @param rtt The round trip time in milliseconds. If negative (because the
+   * system clock was set back), use 0.
+   */
+  void
+  recordRtt(Milliseconds rtt);
+
+  /**
+   * Copy the current values to the metrics snapshot.
+   * @param metrics The FaceMetrics to receive the values.
+   */
+  void
+  get(FaceMetrics& metrics) const;
+
+  /**
+   * Set all the counters to zero, except the pending Interest count.
+   */
+  void
+  reset();
+
+private:
+#ifdef NDN_CPP_HAVE_BOOST_ASIO
+  typedef boost::atomic_uint64_t Counter;
+
+  static void
+  add(Counter& counter, uint64_t value)
+  {
+    counter.fetch_add(value, boost::memory_order_relaxed);
+  }
+
+  static void
+  store(Counter& counter, uint64_t value)
+  {
+    counter.store(value, boost::memory_order_relaxed);
+  }
+
+  static uint64_t
+  load(const Counter& counter)
+  {
+    return counter.load(boost::memory_order_relaxed);
+  }
+
+  boost::atomic_bool isEnabled_;
+#else
+  // Not using Boost asio, so there is only one thread.
+  typedef uint64_t Counter;
+
+  static void
+  add(Counter& counter, uint64_t value) { counter += value; }
+
+  static void
+  store(Counter& counter, uint64_t value) { counter = value; }
+
+  static uint64_t
+  load(const Counter& counter) { return counter; }
+
+  bool isEnabled_;
+#endif
+
+  Counter outInterests_;
+  Counter outData_;
+  Counter outBytes_;
+  Counter inInterests_;
+  Counter inData_;
+  Counter inUnsolicitedData_;
+  Counter inNacks_;
+  Counter inBytes_;
+  Counter timeouts_;
+  Counter decodeErrors_;
+  Counter pendingInterestCount_;
+  Counter rttCount_;
+  Counter rttSumMicroseconds_;
+  Counter rttMaxMicroseconds_;
+  Counter rttBuckets_[FaceMetrics::N_RTT_BUCKETS];
+};
+
+}
+
+#endif
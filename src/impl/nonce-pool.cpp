@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <ndn-cpp/lite/util/crypto-lite.hpp>
+#include "../c/util/ndn_memory.h"
+#include "nonce-pool.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+NoncePool::NoncePool(size_t maxPooledNonces)
+: randomBufferOffset_(RANDOM_BUFFER_LENGTH), nextIndex_(0),
+  maxPooledNonces_(maxPooledNonces)
+{
+}
+
+Blob
+NoncePool::getNextNonce()
+{
+  // Interests are usually satisfied in the order they are sent, so the next
+  // buffer in round-robin order is usually free.
+  for (size_t i = 0; i < MAX_SEARCH && i < nonces_.size(); ++i) {
+    ptr_lib::shared_ptr<vector<uint8_t> >& nonce = nonces_[nextIndex_];
+    nextIndex_ = (nextIndex_ + 1) % nonces_.size();
+    // If only the pool holds the buffer, no Blob can see it change.
+    if (nonce.use_count() == 1) {
+      fillRandom(&(*nonce)[0]);
+      return Blob(nonce, false);
+    }
+  }
+
+  ptr_lib::shared_ptr<vector<uint8_t> > nonce
+    (new vector<uint8_t>(NONCE_LENGTH));
+  fillRandom(&(*nonce)[0]);
+  if (nonces_.size() < maxPooledNonces_)
+    nonces_.push_back(nonce);
+  return Blob(nonce, false);
+}
+
+void
+NoncePool::fillRandom(uint8_t* nonce)
+{
+  if (randomBufferOffset_ + NONCE_LENGTH > RANDOM_BUFFER_LENGTH) {
+    // Refill the whole buffer with one call to the random number generator.
+    ndn_Error error;
+    if ((error = CryptoLite::generateRandomBytes
+         (randomBuffer_, RANDOM_BUFFER_LENGTH)))
+      throw runtime_error(ndn_getErrorString(error));
+    randomBufferOffset_ = 0;
+  }
+
+  ndn_memcpy(nonce, randomBuffer_ + randomBufferOffset_, NONCE_LENGTH);
+  randomBufferOffset_ += NONCE_LENGTH;
+}
+
+}
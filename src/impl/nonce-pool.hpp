@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_NONCE_POOL_HPP
+#define NDN_NONCE_POOL_HPP
+
+#include <vector>
+#include <ndn-cpp/util/blob.hpp>
+
+namespace ndn {
+
+/**
+ * A NoncePool is an internal class which hands out random Interest nonces
+ * without allocating for each one. It fills a buffer from the random number
+ * generator with one call, and writes each nonce in place into a pooled
+ * buffer which is no longer referenced by any Blob (for example because the
+ * Interest which had the nonce was removed from the PIT). This is not thread
+ * safe, but a Blob from getNextNonce can be released on any thread.
+ */
+class NoncePool {
+public:
+  /**
+   * Create a NoncePool.
+   * @param maxPooledNonces (optional) The maximum number of nonce buffers to
+   * keep for reuse. This should be about the number of Interests which are
+   * pending at the same time. If omitted, use 256.
+   */
+  NoncePool(size_t maxPooledNonces = 256);
+
+  /**
+   * Get a new random nonce of length getNonceLength(). The returned Blob
+   * shares a pooled buffer which is rewritten only after every copy of the
+   * Blob is released.
+   * @return The Blob with the nonce.
+   */
+  Blob
+  getNextNonce();
+
+  /**
+   * Get the number of nonce buffers which are kept for reuse.
+   * @return The number of pooled buffers.
+   */
+  size_t
+  getPooledNonceCount() const { return nonces_.size(); }
+
+  /**
+   * Get the length of the nonces.
+   * @return The nonce length in bytes.
+   */
+  static size_t
+  getNonceLength() { return NONCE_LENGTH; }
+
+private:
+  /**
+   * Copy the next NONCE_LENGTH bytes from randomBuffer_, refilling it with one
+   * call to the random number generator when it is used up.
+   * @param nonce The buffer to receive NONCE_LENGTH bytes.
+   */
+  void
+  fillRandom(uint8_t* nonce);
+
+  static const size_t NONCE_LENGTH = 4;
+  static const size_t RANDOM_BUFFER_LENGTH = 1024;
+  // The number of pooled buffers to check for a free one before allocating.
+  static const size_t MAX_SEARCH = 8;
+
+  uint8_t randomBuffer_[RANDOM_BUFFER_LENGTH];
+  size_t randomBufferOffset_;
+  std::vector<ptr_lib::shared_ptr<std::vector<uint8_t> > > nonces_;
+  size_t nextIndex_;
+  size_t maxPooledNonces_;
+};
+
+}
+
+#endif
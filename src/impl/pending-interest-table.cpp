@@ -29,6 +29,61 @@ using namespace std;
 
 namespace ndn {
 
+static bool
+entryIdLess
+  (const ptr_lib::shared_ptr<PendingInterestTable::Entry>& entry,
+   uint64_t pendingInterestId)
+{
+  return entry->getPendingInterestId() < pendingInterestId;
+}
+
+/**
+ * Check if the interests have the same name and selectors, ignoring the nonce
+ * and lifetime.
+ */
+static bool
+isEquivalentInterest(const Interest& interest1, const Interest& interest2)
+{
+  if (!interest1.getName().equals(interest2.getName()) ||
+      interest1.getMinSuffixComponents() != interest2.getMinSuffixComponents() ||
+      interest1.getMaxSuffixComponents() != interest2.getMaxSuffixComponents() ||
+      interest1.getChildSelector() != interest2.getChildSelector() ||
+      interest1.getMustBeFresh() != interest2.getMustBeFresh() ||
+      !interest1.getKeyLocator().equals(interest2.getKeyLocator()))
+    return false;
+
+  const Exclude& exclude1 = interest1.getExclude();
+  const Exclude& exclude2 = interest2.getExclude();
+  if (exclude1.size() != exclude2.size())
+    return false;
+  for (size_t i = 0; i < exclude1.size(); ++i) {
+    if (exclude1.get(i).getType() != exclude2.get(i).getType() ||
+        (exclude1.get(i).getType() == ndn_Exclude_COMPONENT &&
+         !exclude1.get(i).getComponent().equals
+           (exclude2.get(i).getComponent())))
+      return false;
+  }
+
+  const DelegationSet& forwardingHint1 = interest1.getForwardingHint();
+  const DelegationSet& forwardingHint2 = interest2.getForwardingHint();
+  if (forwardingHint1.size() != forwardingHint2.size())
+    return false;
+  for (size_t i = 0; i < forwardingHint1.size(); ++i) {
+    if (forwardingHint1.get(i).getPreference() !=
+          forwardingHint2.get(i).getPreference() ||
+        !forwardingHint1.get(i).getName().equals
+          (forwardingHint2.get(i).getName()))
+      return false;
+  }
+
+  return true;
+}
+
+PendingInterestTable::PendingInterestTable()
+: entryPool_(ptr_lib::make_shared<SlabPool>())
+{
+}
+
 void
 PendingInterestTable::Entry::callTimeout()
 {
@@ -48,7 +103,8 @@ ptr_lib::shared_ptr<PendingInterestTable::Entry>
 PendingInterestTable::add
   (uint64_t pendingInterestId,
    const ptr_lib::shared_ptr<const Interest>& interestCopy, const OnData& onData,
-   const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack)
+   const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
+   bool isAggregated)
 {
   vector<uint64_t>::iterator removeRequestIterator =
     ::find(removeRequests_.begin(), removeRequests_.end(), pendingInterestId);
@@ -59,9 +115,24 @@ PendingInterestTable::add
     return ptr_lib::shared_ptr<Entry>();
   }
 
-  ptr_lib::shared_ptr<Entry> entry(new Entry
-    (pendingInterestId, interestCopy, onData, onTimeout, onNetworkNack));
-  table_.push_back(entry);
+  // allocate_shared puts the Entry and its reference count in one pooled block.
+  ptr_lib::shared_ptr<Entry> entry = ptr_lib::allocate_shared<Entry>
+    (SlabAllocator<Entry>(entryPool_), pendingInterestId, interestCopy, onData,
+     onTimeout, onNetworkNack);
+  // Keep table_ sorted by pendingInterestId so that extractEntry can do a
+  // binary search. IDs are usually added in increasing order, so check the end.
+  if (table_.empty() ||
+      table_.back()->getPendingInterestId() < pendingInterestId)
+    table_.push_back(entry);
+  else
+    table_.insert
+      (lower_bound(table_.begin(), table_.end(), pendingInterestId,
+                   entryIdLess), entry);
+
+  if (isAggregated) {
+    entriesByName_[interestCopy->getName()].push_back(entry);
+    entry->isNameIndexed_ = true;
+  }
   return entry;
 }
 
@@ -76,8 +147,7 @@ PendingInterestTable::extractEntriesForExpressedInterest
       entries.push_back(pendingInterest);
       // We let the callback from callLater call _processInterestTimeout, but
       // for efficiency, mark this as removed so that it returns right away.
-      pendingInterest->setIsRemoved();
-      table_.erase(table_.begin() + i);
+      erase(table_.begin() + i);
     }
   }
 }
@@ -100,32 +170,102 @@ PendingInterestTable::extractEntriesForNackInterest
       entries.push_back(pendingInterest);
       // We let the callback from callLater call _processInterestTimeout, but
       // for efficiency, mark this as removed so that it returns right away.
-      pendingInterest->setIsRemoved();
-      table_.erase(table_.begin() + i);
+      erase(table_.begin() + i);
     }
   }
 }
 
+ptr_lib::shared_ptr<PendingInterestTable::Entry>
+PendingInterestTable::findSentEquivalentEntry(const Interest& interest)
+{
+  EntriesByName::iterator found = entriesByName_.find(interest.getName());
+  if (found == entriesByName_.end())
+    return ptr_lib::shared_ptr<Entry>();
+
+  vector<ptr_lib::shared_ptr<Entry> >& entries = found->second;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (entries[i]->getIsSent() &&
+        isEquivalentInterest(*entries[i]->getInterest(), interest))
+      return entries[i];
+  }
+
+  return ptr_lib::shared_ptr<Entry>();
+}
+
+ptr_lib::shared_ptr<PendingInterestTable::Entry>
+PendingInterestTable::findUnsentEquivalentEntry
+  (const Interest& interest, MillisecondsSince1970 now)
+{
+  EntriesByName::iterator found = entriesByName_.find(interest.getName());
+  if (found == entriesByName_.end())
+    return ptr_lib::shared_ptr<Entry>();
+
+  vector<ptr_lib::shared_ptr<Entry> >& entries = found->second;
+  ptr_lib::shared_ptr<Entry> result;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    Entry& entry = *entries[i];
+    if (entry.getIsSent() ||
+        !isEquivalentInterest(*entry.getInterest(), interest))
+      continue;
+
+    if (entry.getTimeoutTime() < 0)
+      // The entry doesn't time out, so it is the latest.
+      return entries[i];
+    // Skip an entry which is also timing out now.
+    if (entry.getTimeoutTime() > now &&
+        (!result || entry.getTimeoutTime() > result->getTimeoutTime()))
+      result = entries[i];
+  }
+
+  return result;
+}
+
 void
+PendingInterestTable::extractUnsentEquivalentEntries
+  (const Interest& interest, vector<ptr_lib::shared_ptr<Entry> > &entries)
+{
+  EntriesByName::iterator found = entriesByName_.find(interest.getName());
+  if (found == entriesByName_.end())
+    return;
+
+  // Copy the matching entries first since erase modifies entriesByName_.
+  vector<ptr_lib::shared_ptr<Entry> > matchingEntries;
+  for (size_t i = 0; i < found->second.size(); ++i) {
+    ptr_lib::shared_ptr<Entry>& pendingInterest = found->second[i];
+    if (!pendingInterest->getIsSent() && pendingInterest->getOnNetworkNack() &&
+        isEquivalentInterest(*pendingInterest->getInterest(), interest))
+      matchingEntries.push_back(pendingInterest);
+  }
+
+  for (size_t i = 0; i < matchingEntries.size(); ++i) {
+    vector<ptr_lib::shared_ptr<Entry> >::iterator entry = lower_bound
+      (table_.begin(), table_.end(),
+       matchingEntries[i]->getPendingInterestId(), entryIdLess);
+    if (entry != table_.end() && *entry == matchingEntries[i]) {
+      entries.push_back(matchingEntries[i]);
+      erase(entry);
+    }
+  }
+}
+
+ptr_lib::shared_ptr<PendingInterestTable::Entry>
 PendingInterestTable::removePendingInterest(uint64_t pendingInterestId)
 {
-  int count = 0;
+  ptr_lib::shared_ptr<Entry> removedEntry;
   // Go backwards through the list so we can erase entries.
   // Remove all entries even though pendingInterestId should be unique.
   for (int i = (int)table_.size() - 1; i >= 0; --i) {
     if (table_[i]->getPendingInterestId() == pendingInterestId) {
-      ++count;
+      removedEntry = table_[i];
       // For efficiency, mark this as removed so that processInterestTimeout
       // doesn't look for it.
-      table_[i]->setIsRemoved();
-      table_.erase(table_.begin() + i);
+      erase(table_.begin() + i);
     }
   }
 
-  if (count == 0)
+  if (!removedEntry) {
     _LOG_DEBUG("removePendingInterest: Didn't find pendingInterestId " << pendingInterestId);
 
-  if (count == 0) {
     // The pendingInterestId was not found. Perhaps this has been called before
     //   the callback in expressInterest can add to the PIT. Add this
     //   removal request which will be checked before adding to the PIT.
@@ -134,28 +274,54 @@ PendingInterestTable::removePendingInterest(uint64_t pendingInterestId)
       // Not already requested, so add the request.
       removeRequests_.push_back(pendingInterestId);
   }
+
+  return removedEntry;
 }
 
-bool
-PendingInterestTable::removeEntry
-  (const ptr_lib::shared_ptr<Entry>& pendingInterest)
+ptr_lib::shared_ptr<PendingInterestTable::Entry>
+PendingInterestTable::extractEntry(uint64_t pendingInterestId)
 {
-  if (pendingInterest->getIsRemoved())
-    // extractEntriesForExpressedInterest or removePendingInterest has
-    // removed pendingInterest from the table, so we don't need to look for it.
-    // Do nothing.
-    return false;
+  vector<ptr_lib::shared_ptr<Entry> >::iterator found = lower_bound
+    (table_.begin(), table_.end(), pendingInterestId, entryIdLess);
+  if (found == table_.end() ||
+      (*found)->getPendingInterestId() != pendingInterestId)
+    return ptr_lib::shared_ptr<Entry>();
 
-  // Search by pointer equality.
-  for (size_t i = 0; i < table_.size(); ++i) {
-    if (table_[i].get() == pendingInterest.get()) {
-      table_[i]->setIsRemoved();
-      table_.erase(table_.begin() + i);
-      return true;
-    }
+  ptr_lib::shared_ptr<Entry> entry = *found;
+  erase(found);
+  return entry;
+}
+
+void
+PendingInterestTable::removeFromNameIndex
+  (const ptr_lib::shared_ptr<Entry>& entry)
+{
+  if (!entry->isNameIndexed_)
+    return;
+
+  EntriesByName::iterator found =
+    entriesByName_.find(entry->getInterest()->getName());
+  if (found != entriesByName_.end()) {
+    vector<ptr_lib::shared_ptr<Entry> >& entries = found->second;
+    vector<ptr_lib::shared_ptr<Entry> >::iterator position =
+      ::find(entries.begin(), entries.end(), entry);
+    if (position != entries.end())
+      entries.erase(position);
+    if (entries.empty())
+      entriesByName_.erase(found);
   }
 
-  return false;
+  entry->isNameIndexed_ = false;
+}
+
+void
+PendingInterestTable::erase(vector<ptr_lib::shared_ptr<Entry> >::iterator i)
+{
+  // Copy the shared_ptr since erasing from table_ releases the element.
+  ptr_lib::shared_ptr<Entry> entry = *i;
+  entry->setIsRemoved();
+  removeFromNameIndex(entry);
+  table_.erase(i);
 }
 
 }
@@ -22,7 +22,9 @@
 #ifndef NDN_PENDING_INTEREST_TABLE_HPP
 #define NDN_PENDING_INTEREST_TABLE_HPP
 
+#include <map>
 #include <ndn-cpp/face.hpp>
+#include "slab-pool.hpp"
 
 namespace ndn {
 
@@ -32,6 +34,13 @@ namespace ndn {
  */
 class PendingInterestTable {
 public:
+  /**
+   * Create an empty PendingInterestTable. Entries are allocated from a
+   * SlabPool owned by this table so that adding and removing entries at a
+   * steady rate does not allocate from the heap.
+   */
+  PendingInterestTable();
+
   /**
    * Entry holds the callbacks and other fields for an entry in the pending
    * interest table.
@@ -47,7 +56,9 @@ public:
        const ptr_lib::shared_ptr<const Interest>& interest, const OnData& onData,
        const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack)
     : pendingInterestId_(pendingInterestId), interest_(interest), onData_(onData),
-      onTimeout_(onTimeout), onNetworkNack_(onNetworkNack), isRemoved_(false)
+      onTimeout_(onTimeout), onNetworkNack_(onNetworkNack), isRemoved_(false),
+      sendTime_(0), isSent_(false), timeoutTime_(-1), wireFormat_(0),
+      isNameIndexed_(false)
     {
     }
 
@@ -93,6 +104,63 @@ public:
     bool
     getIsRemoved() { return isRemoved_; }
 
+    /**
+     * Set the time when the interest was sent, used to measure the round trip
+     * time. This is only set when metrics are enabled.
+     * @param sendTime The time in milliseconds from
+     * ndn_getMonotonicMilliseconds().
+     */
+    void
+    setSendTime(MillisecondsSince1970 sendTime) { sendTime_ = sendTime; }
+
+    /**
+     * Get the time given to setSendTime.
+     * @return The time in milliseconds from ndn_getMonotonicMilliseconds(), or
+     * 0 if setSendTime was not called.
+     */
+    MillisecondsSince1970
+    getSendTime() { return sendTime_; }
+
+    /**
+     * Set the flag which is returned by getIsSent(), meaning that the Interest
+     * of this entry was sent to the transport. (When Interest aggregation is
+     * enabled, an entry which is equivalent to a sent entry is not sent.)
+     */
+    void
+    setIsSent() { isSent_ = true; }
+
+    bool
+    getIsSent() { return isSent_; }
+
+    /**
+     * Set the time when this entry times out, and the wire format to use if
+     * this entry's Interest needs to be sent later.
+     * @param timeoutTime The time in milliseconds since 1/1/1970, or -1 if this
+     * entry doesn't time out.
+     * @param wireFormat The wire format for encoding the Interest.
+     */
+    void
+    setTimeout(MillisecondsSince1970 timeoutTime, WireFormat* wireFormat)
+    {
+      timeoutTime_ = timeoutTime;
+      wireFormat_ = wireFormat;
+    }
+
+    /**
+     * Get the time given to setTimeout.
+     * @return The time in milliseconds since 1/1/1970, or -1 if this entry
+     * doesn't time out.
+     */
+    MillisecondsSince1970
+    getTimeoutTime() { return timeoutTime_; }
+
+    /**
+     * Get the wire format given to setTimeout.
+     * @return The wire format, or 0 if setTimeout was not called.
+     */
+    WireFormat*
+    getWireFormat() { return wireFormat_; }
+
     /**
      * Call onTimeout_ (if defined).  This ignores exceptions from the call to
      * onTimeout_.
@@ -107,6 +175,14 @@ public:
     const OnTimeout onTimeout_;
     const OnNetworkNack onNetworkNack_;
     bool isRemoved_;
+    MillisecondsSince1970 sendTime_;
+    bool isSent_;
+    MillisecondsSince1970 timeoutTime_;
+    WireFormat* wireFormat_;
+    // Only PendingInterestTable uses this, to know if the entry is in
+    // entriesByName_.
+    bool isNameIndexed_;
+    friend class PendingInterestTable;
   };
 
   /**
@@ -122,6 +198,10 @@ public:
    * an empty OnTimeout(), this does not use it.
    * @param onNetworkNack Call onNetworkNack.onNetworkNack when a network Nack
    * packet is received.
+   * @param isAggregated (optional) If true, also add the entry to the index by
+   * Interest name which is used by findSentEquivalentEntry,
+   * findUnsentEquivalentEntry and extractUnsentEquivalentEntries. If omitted,
+   * don't index the entry.
    * @return The new PendingInterestTable::Entry, or null if
    * removePendingInterest was already called with the pendingInterestId.
    */
@@ -129,7 +209,7 @@ public:
   add(uint64_t pendingInterestId,
       const ptr_lib::shared_ptr<const Interest>& interestCopy,
       const OnData& onData, const OnTimeout& onTimeout,
-      const OnNetworkNack& onNetworkNack);
+      const OnNetworkNack& onNetworkNack, bool isAggregated = false);
 
   /**
    * Find all entries from the pending interest table where data conforms to
@@ -160,6 +240,43 @@ public:
   extractEntriesForNackInterest
     (const Interest& interest, std::vector<ptr_lib::shared_ptr<Entry> > &entries);
 
+  /**
+   * Find an entry whose Interest was sent and is equivalent to the given
+   * interest, for Interest aggregation. Interests are equivalent if they have
+   * the same name and selectors, ignoring the nonce and lifetime. This only
+   * searches the entries which were added with isAggregated true.
+   * @param interest The Interest to search for.
+   * @return The sent entry, or null if not found.
+   */
+  ptr_lib::shared_ptr<Entry>
+  findSentEquivalentEntry(const Interest& interest);
+
+  /**
+   * Find the entry whose Interest was not sent, is equivalent to the given
+   * interest and has the latest timeout time after now. An entry which
+   * doesn't time out is the latest. This is used to send an aggregated
+   * Interest when the sent one times out or is removed.
+   * @param interest The Interest to search for.
+   * @param now The current time in milliseconds since 1/1/1970.
+   * @return The entry, or null if not found.
+   */
+  ptr_lib::shared_ptr<Entry>
+  findUnsentEquivalentEntry(const Interest& interest, MillisecondsSince1970 now);
+
+  /**
+   * Find all entries whose Interest was not sent, is equivalent to the given
+   * interest and whose OnNetworkNack callback is not an empty OnNetworkNack(),
+   * remove the entries from the table, set each entry's isRemoved flag, and add
+   * to the entries list. This is used to pass a network Nack for a sent
+   * Interest to the entries which were aggregated with it.
+   * @param interest The Interest from the Nack packet.
+   * @param entries Add matching PendingInterestTable::Entry from the pending
+   * interest table.
+   */
+  void
+  extractUnsentEquivalentEntries
+    (const Interest& interest, std::vector<ptr_lib::shared_ptr<Entry> > &entries);
+
   /**
    * Remove the pending interest entry with the pendingInterestId from the
    * pending interest table and set its isRemoved flag. This does not affect
@@ -167,22 +284,57 @@ public:
    * the same interest name. If there is no entry with the pendingInterestId, do
    * nothing.
    * @param pendingInterestId The ID returned from expressInterest.
+   * @return The removed entry, or null if there is no entry with the
+   * pendingInterestId.
    */
-  void
+  ptr_lib::shared_ptr<Entry>
   removePendingInterest(uint64_t pendingInterestId);
 
   /**
-   * Remove the specific pendingInterest entry from the table and set its
-   * isRemoved flag. However, if the pendingInterest isRemoved flag is already
-   * true or the entry is not in the pending interest table then do nothing.
-   * @return
+   * Find the entry with the pendingInterestId, remove it from the table and
+   * set its isRemoved flag. This is used when the interest times out. The
+   * table is kept sorted by pendingInterestId, so this is a binary search.
+   * Unlike removePendingInterest, if the entry is not found this does not add
+   * a removal request.
+   * @param pendingInterestId The pendingInterestId of the entry.
+   * @return The removed entry, or null if there is no entry with the
+   * pendingInterestId (for example if it was already satisfied by a Data
+   * packet).
    */
-  bool
-  removeEntry(const ptr_lib::shared_ptr<Entry>& pendingInterest);
+  ptr_lib::shared_ptr<Entry>
+  extractEntry(uint64_t pendingInterestId);
+
+  /**
+   * Get the number of entries in the pending interest table.
+   * @return The number of entries.
+   */
+  size_t
+  size() const { return table_.size(); }
 
 private:
+  typedef std::map<Name, std::vector<ptr_lib::shared_ptr<Entry> > >
+    EntriesByName;
+
+  /**
+   * If the entry was added with isAggregated true, remove it from
+   * entriesByName_.
+   */
+  void
+  removeFromNameIndex(const ptr_lib::shared_ptr<Entry>& entry);
+
+  /**
+   * Remove the entry from table_ and entriesByName_ and set its isRemoved flag.
+   * @param i The position of the entry in table_.
+   */
+  void
+  erase(std::vector<ptr_lib::shared_ptr<Entry> >::iterator i);
+
   std::vector<ptr_lib::shared_ptr<Entry> > table_;
+  // The entries added with isAggregated true, by Interest name, so that finding
+  // an equivalent Interest doesn't search the whole table.
+  EntriesByName entriesByName_;
   std::vector<uint64_t> removeRequests_;
+  ptr_lib::shared_ptr<SlabPool> entryPool_;
 };
 
 }
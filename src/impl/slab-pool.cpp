@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <new>
+#include "slab-pool.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+SlabPool::SlabPool(size_t blocksPerSlab)
+: blocksPerSlab_(blocksPerSlab > 0 ? blocksPerSlab : 1)
+{
+  for (size_t i = 0; i < N_SIZE_CLASSES; ++i)
+    freeLists_[i] = 0;
+}
+
+SlabPool::~SlabPool()
+{
+  for (size_t i = 0; i < slabs_.size(); ++i)
+    ::operator delete(slabs_[i]);
+}
+
+void*
+SlabPool::allocate(size_t size)
+{
+  if (size == 0)
+    size = 1;
+  if (size > getMaxBlockSize())
+    return ::operator new(size);
+
+  size_t sizeClass = (size - 1) / BLOCK_ALIGNMENT;
+  if (!freeLists_[sizeClass]) {
+    // Carve a new slab into blocks and put them on the free list. Reserve
+    // first so that the push_back can't throw after we allocate the slab.
+    size_t blockSize = (sizeClass + 1) * BLOCK_ALIGNMENT;
+    slabs_.reserve(slabs_.size() + 1);
+    uint8_t* slab = (uint8_t*)::operator new(blockSize * blocksPerSlab_);
+    slabs_.push_back(slab);
+
+    for (size_t i = 0; i < blocksPerSlab_; ++i) {
+      FreeBlock* block = (FreeBlock*)(slab + i * blockSize);
+      block->next_ = freeLists_[sizeClass];
+      freeLists_[sizeClass] = block;
+    }
+  }
+
+  FreeBlock* block = freeLists_[sizeClass];
+  freeLists_[sizeClass] = block->next_;
+  return block;
+}
+
+void
+SlabPool::deallocate(void* block, size_t size)
+{
+  if (!block)
+    return;
+  if (size == 0)
+    size = 1;
+  if (size > getMaxBlockSize()) {
+    ::operator delete(block);
+    return;
+  }
+
+  size_t sizeClass = (size - 1) / BLOCK_ALIGNMENT;
+  FreeBlock* freeBlock = (FreeBlock*)block;
+  freeBlock->next_ = freeLists_[sizeClass];
+  freeLists_[sizeClass] = freeBlock;
+}
+
+}
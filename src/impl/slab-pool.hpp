@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_SLAB_POOL_HPP
+#define NDN_SLAB_POOL_HPP
+
+#include <vector>
+#include <ndn-cpp/common.hpp>
+
+namespace ndn {
+
+/**
+ * A SlabPool is an internal class which hands out small fixed-size blocks
+ * carved from larger slabs. Freed blocks go on a per-size free list and are
+ * reused by the next allocation of the same size, so that a table which
+ * repeatedly adds and removes entries does not touch the heap once it reaches a
+ * steady state. Slabs are only freed when the SlabPool is destroyed. This is
+ * not thread safe. Use SlabAllocator to allocate with a SlabPool, for example
+ * in ptr_lib::allocate_shared.
+ */
+class SlabPool {
+public:
+  /**
+   * Create a SlabPool with no slabs allocated yet.
+   * @param blocksPerSlab (optional) The number of blocks to allocate in each
+   * new slab. If omitted, use 64.
+   */
+  SlabPool(size_t blocksPerSlab = 64);
+
+  ~SlabPool();
+
+  /**
+   * Get a block of at least the given size from the free list for the size,
+   * allocating a new slab if the free list is empty. If size is larger than
+   * getMaxBlockSize(), this allocates with the global operator new.
+   * @param size The number of bytes needed.
+   * @return A pointer to the block, aligned for any type.
+   */
+  void*
+  allocate(size_t size);
+
+  /**
+   * Return the block to the free list for its size.
+   * @param block The block returned by allocate(size).
+   * @param size The size which was given to allocate.
+   */
+  void
+  deallocate(void* block, size_t size);
+
+  /**
+   * Get the maximum block size which is pooled.
+   * @return The maximum block size in bytes.
+   */
+  static size_t
+  getMaxBlockSize() { return N_SIZE_CLASSES * BLOCK_ALIGNMENT; }
+
+  /**
+   * Get the number of slabs which have been allocated.
+   * @return The number of slabs.
+   */
+  size_t
+  getSlabCount() const { return slabs_.size(); }
+
+private:
+  // Don't allow copying since we own the slabs.
+  SlabPool(const SlabPool& other);
+  SlabPool& operator=(const SlabPool& other);
+
+  struct FreeBlock {
+    FreeBlock* next_;
+  };
+
+  static const size_t BLOCK_ALIGNMENT = 16;
+  static const size_t N_SIZE_CLASSES = 32;
+
+  size_t blocksPerSlab_;
+  FreeBlock* freeLists_[N_SIZE_CLASSES];
+  std::vector<void*> slabs_;
+};
+
+/**
+ * A SlabAllocator is a standard allocator which allocates from a shared
+ * SlabPool. The allocator (and every copy made by a container or by
+ * allocate_shared) holds a shared_ptr to the pool, so the pool lives as long as
+ * any block allocated from it.
+ */
+template<class T>
+class SlabAllocator {
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template<class U>
+  struct rebind { typedef SlabAllocator<U> other; };
+
+  /**
+   * Create a SlabAllocator which allocates from the given pool.
+   * @param pool The SlabPool, which must not be null.
+   */
+  explicit SlabAllocator(const ptr_lib::shared_ptr<SlabPool>& pool)
+  : pool_(pool)
+  {
+  }
+
+  template<class U>
+  SlabAllocator(const SlabAllocator<U>& other)
+  : pool_(other.getPool())
+  {
+  }
+
+  pointer
+  allocate(size_type n, const void* hint = 0)
+  {
+    return static_cast<pointer>(pool_->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(pointer p, size_type n)
+  {
+    pool_->deallocate(p, n * sizeof(T));
+  }
+
+  void
+  construct(pointer p, const T& value) { new((void*)p) T(value); }
+
+  void
+  destroy(pointer p) { p->~T(); }
+
+  pointer
+  address(reference value) const { return &value; }
+
+  const_pointer
+  address(const_reference value) const { return &value; }
+
+  size_type
+  max_size() const { return size_type(-1) / sizeof(T); }
+
+  const ptr_lib::shared_ptr<SlabPool>&
+  getPool() const { return pool_; }
+
+  template<class U>
+  bool
+  operator==(const SlabAllocator<U>& other) const
+  {
+    return pool_ == other.getPool();
+  }
+
+  template<class U>
+  bool
+  operator!=(const SlabAllocator<U>& other) const
+  {
+    return pool_ != other.getPool();
+  }
+
+private:
+  ptr_lib::shared_ptr<SlabPool> pool_;
+};
+
+}
+
+#endif
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <ndn-cpp/encoding/tlv-0_2-wire-format.hpp>
+#include <ndn-cpp/lite/util/crypto-lite.hpp>
+#include "c/util/ndn_memory.h"
+#include "c/encoding/tlv/tlv-name.h"
+#include "c/encoding/tlv/tlv-decoder.h"
+#include "c/encoding/tlv/tlv-encoder.h"
+#include <ndn-cpp/interest-template.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+InterestTemplate::InterestTemplate
+  (const Interest& interest, WireFormat& wireFormat)
+: wireFormat_(&wireFormat)
+{
+  if (!dynamic_cast<Tlv0_2WireFormat*>(&wireFormat))
+    throw runtime_error
+      ("InterestTemplate: The wire format must be NDN-TLV 0.2");
+
+  ptr_lib::shared_ptr<Interest> interestCopy(new Interest(interest));
+  // Encode with a placeholder nonce which we find below.
+  vector<uint8_t> placeholderNonce(NONCE_LENGTH, 0);
+  interestCopy->setNonce(Blob(placeholderNonce));
+  Blob encoding = interestCopy->wireEncode(wireFormat);
+  interest_ = interestCopy;
+
+  ndn_Error error;
+  struct ndn_TlvDecoder decoder;
+  ndn_TlvDecoder_initialize(&decoder, encoding.buf(), encoding.size());
+  size_t interestEndOffset, nameEndOffset;
+  if ((error = ndn_TlvDecoder_readNestedTlvsStart
+       (&decoder, ndn_Tlv_Interest, &interestEndOffset)))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_TlvDecoder_readNestedTlvsStart
+       (&decoder, ndn_Tlv_Name, &nameEndOffset)))
+    throw runtime_error(ndn_getErrorString(error));
+  prefixComponents_ = Blob
+    (encoding.buf() + decoder.offset, nameEndOffset - decoder.offset);
+  ndn_TlvDecoder_seek(&decoder, nameEndOffset);
+
+  // The Nonce follows the optional Selectors.
+  int gotExpectedType;
+  if ((error = ndn_TlvDecoder_peekType
+       (&decoder, ndn_Tlv_Selectors, interestEndOffset, &gotExpectedType)))
+    throw runtime_error(ndn_getErrorString(error));
+  if (gotExpectedType) {
+    size_t selectorsEndOffset;
+    if ((error = ndn_TlvDecoder_readNestedTlvsStart
+         (&decoder, ndn_Tlv_Selectors, &selectorsEndOffset)))
+      throw runtime_error(ndn_getErrorString(error));
+    ndn_TlvDecoder_seek(&decoder, selectorsEndOffset);
+  }
+  struct ndn_Blob nonce;
+  if ((error = ndn_TlvDecoder_readBlobTlv(&decoder, ndn_Tlv_Nonce, &nonce)))
+    throw runtime_error(ndn_getErrorString(error));
+  if (nonce.length != NONCE_LENGTH)
+    throw runtime_error("InterestTemplate: Unexpected nonce length");
+
+  afterName_ = Blob
+    (encoding.buf() + nameEndOffset, interestEndOffset - nameEndOffset);
+  nonceOffset_ = (nonce.value - encoding.buf()) - nameEndOffset;
+}
+
+void
+InterestTemplate::encode
+  (const Name::Component& finalComponent, const uint8_t* nonce,
+   vector<uint8_t>& output, size_t* prefixComponentsOffset) const
+{
+  NameLite::Component componentLite;
+  finalComponent.get(componentLite);
+
+  // Get the length of the final component TLV without writing.
+  ndn_Error error;
+  struct ndn_TlvEncoder encoder;
+  ndn_TlvEncoder_initialize(&encoder, 0);
+  encoder.enableOutput = 0;
+  if ((error = ndn_encodeTlvNameComponent
+       ((struct ndn_NameComponent*)&componentLite, &encoder)))
+    throw runtime_error(ndn_getErrorString(error));
+  size_t componentEncodingLength = encoder.offset;
+
+  size_t nameValueLength = prefixComponents_.size() + componentEncodingLength;
+  size_t nameEncodingLength =
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_Name) +
+    ndn_TlvEncoder_sizeOfVarNumber(nameValueLength) + nameValueLength;
+  size_t interestValueLength = nameEncodingLength + afterName_.size();
+  size_t interestEncodingLength =
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_Interest) +
+    ndn_TlvEncoder_sizeOfVarNumber(interestValueLength) + interestValueLength;
+
+  // resize doesn't allocate if the capacity is already large enough.
+  output.resize(interestEncodingLength);
+  struct ndn_DynamicUInt8Array outputArray;
+  ndn_DynamicUInt8Array_initialize
+    (&outputArray, &output[0], output.size(), 0);
+  ndn_TlvEncoder_initialize(&encoder, &outputArray);
+
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_Interest, interestValueLength)))
+    throw runtime_error(ndn_getErrorString(error));
+  if ((error = ndn_TlvEncoder_writeTypeAndLength
+       (&encoder, ndn_Tlv_Name, nameValueLength)))
+    throw runtime_error(ndn_getErrorString(error));
+  *prefixComponentsOffset = encoder.offset;
+  ndn_memcpy
+    (&output[0] + encoder.offset, prefixComponents_.buf(),
+     prefixComponents_.size());
+  encoder.offset += prefixComponents_.size();
+  if ((error = ndn_encodeTlvNameComponent
+       ((struct ndn_NameComponent*)&componentLite, &encoder)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  uint8_t* afterName = &output[0] + encoder.offset;
+  ndn_memcpy(afterName, afterName_.buf(), afterName_.size());
+  ndn_memcpy(afterName + nonceOffset_, nonce, NONCE_LENGTH);
+}
+
+ptr_lib::shared_ptr<Interest>
+InterestTemplate::makeInterest(const Name::Component& finalComponent) const
+{
+  uint8_t nonce[NONCE_LENGTH];
+  ndn_Error error;
+  if ((error = CryptoLite::generateRandomBytes(nonce, NONCE_LENGTH)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  return makeInterest(finalComponent, Blob(nonce, NONCE_LENGTH));
+}
+
+ptr_lib::shared_ptr<Interest>
+InterestTemplate::makeInterest
+  (const Name::Component& finalComponent, const Blob& nonce) const
+{
+  if (nonce.size() != NONCE_LENGTH)
+    throw runtime_error("InterestTemplate::makeInterest: Invalid nonce length");
+
+  ptr_lib::shared_ptr<vector<uint8_t> > encoding(new vector<uint8_t>());
+  size_t prefixComponentsOffset;
+  encode(finalComponent, nonce.buf(), *encoding, &prefixComponentsOffset);
+
+  // Wrap the encoding instead of copying interest_ and its objects. As with
+  // Interest::wireEncode, the signed portion is from the first name component
+  // to just before the final component.
+  ptr_lib::shared_ptr<Interest> interest(new Interest());
+  interest->setFromTemplate
+    (*interest_, finalComponent, nonce,
+     SignedBlob(Blob(encoding, false), prefixComponentsOffset,
+                prefixComponentsOffset + prefixComponents_.size()),
+     wireFormat_);
+  return interest;
+}
+
+}
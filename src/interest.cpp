@@ -23,6 +23,9 @@
 #include <stdexcept>
 #include <ndn-cpp/common.hpp>
 #include <ndn-cpp/lite/util/crypto-lite.hpp>
+#include <ndn-cpp/encoding/tlv-wire-format.hpp>
+#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
+#include "encoding/lite-array.hpp"
 #include "lp/incoming-face-id.hpp"
 #include <ndn-cpp/data.hpp>
 #include <ndn-cpp/util/logging.hpp>
@@ -36,6 +39,14 @@ namespace ndn {
 
 Interest& Interest::operator=(const Interest& interest)
 {
+  if (&interest == this)
+    // Don't clear a pending lazy encoding that we need to copy.
+    return *this;
+
+  // We replace all the fields, so don't decode a pending lazy encoding.
+  lazyWireEncoding_ = Blob();
+  interest.ensureDecoded();
+
   setName(interest.name_.get());
   setMinSuffixComponents(interest.minSuffixComponents_);
   setMaxSuffixComponents(interest.maxSuffixComponents_);
@@ -71,6 +82,7 @@ Interest::getIncomingFaceId() const
 void
 Interest::get(InterestLite& interestLite, WireFormat& wireFormat) const
 {
+  ensureDecoded();
   name_.get().get(interestLite.getName());
   interestLite.setMinSuffixComponents(minSuffixComponents_);
   interestLite.setMaxSuffixComponents(maxSuffixComponents_);
@@ -99,6 +111,9 @@ Interest::get(InterestLite& interestLite, WireFormat& wireFormat) const
 void
 Interest::set(const InterestLite& interestLite, WireFormat& wireFormat)
 {
+  // We replace all the fields, so don't decode a pending lazy encoding.
+  lazyWireEncoding_ = Blob();
+
   name_.get().set(interestLite.getName());
   setMinSuffixComponents(interestLite.getMinSuffixComponents());
   setMaxSuffixComponents(interestLite.getMaxSuffixComponents());
@@ -188,9 +203,108 @@ Interest::wireDecode
     setDefaultWireEncoding(SignedBlob(), 0);
 }
 
+void
+Interest::wireDecodeLazy(const Blob& input)
+{
+  // Decode with the same Lite decoder as wireDecode(input, TlvWireFormat) so
+  // that a malformed packet is rejected here the same as by a full decode, but
+  // only make the Name object now.
+  NameComponentArray nameComponents;
+  ExcludeEntryArray excludeEntries;
+  NameComponentArray keyNameComponents;
+  // If a fixed array is full, retry once with arrays for the input length.
+  for (bool isRetry = false; ; isRetry = true) {
+    InterestLite interestLite
+      (nameComponents.get(), nameComponents.size(),
+       excludeEntries.get(), excludeEntries.size(),
+       keyNameComponents.get(), keyNameComponents.size());
+
+    ndn_Error error;
+    size_t signedPortionBeginOffset, signedPortionEndOffset;
+    if ((error = Tlv0_2WireFormatLite::decodeInterest
+         (interestLite, input.buf(), input.size(), &signedPortionBeginOffset,
+          &signedPortionEndOffset))) {
+      if (!isRetry && isArrayFull(error)) {
+        nameComponents.resize(getMaxArraySize(input.size()));
+        excludeEntries.resize(getMaxArraySize(input.size()));
+        keyNameComponents.resize(getMaxArraySize(input.size()));
+        continue;
+      }
+      throw runtime_error(ndn_getErrorString(error));
+    }
+
+    if (interestLite.getForwardingHintWireEncoding().buf()) {
+      // Throw any decoding exceptions now, the same as wireDecode.
+      DelegationSet delegationSet;
+      TlvWireFormat::get()->decodeDelegationSet
+        (delegationSet, interestLite.getForwardingHintWireEncoding().buf(),
+         interestLite.getForwardingHintWireEncoding().size());
+    }
+
+    // Clear lazyWireEncoding_ in case this was already lazily decoded.
+    lazyWireEncoding_ = Blob();
+    name_.get().set(interestLite.getName());
+    lazyWireEncoding_ = input;
+
+    if (TlvWireFormat::get() == WireFormat::getDefaultWireFormat())
+      // This is the default wire encoding.
+      // Take a pointer to the input Blob without copying.
+      setDefaultWireEncoding
+        (SignedBlob(input, signedPortionBeginOffset, signedPortionEndOffset),
+         WireFormat::getDefaultWireFormat());
+    else
+      setDefaultWireEncoding(SignedBlob(), 0);
+    return;
+  }
+}
+
+void
+Interest::setFromTemplate
+  (const Interest& templateInterest, const Name::Component& finalComponent,
+   const Blob& nonce, const SignedBlob& encoding, WireFormat* wireFormat)
+{
+  // The Name is always needed, for example for the pending interest table.
+  name_.get() = templateInterest.getName();
+  name_.get().append(finalComponent);
+
+  if (templateInterest.keyLocator_.get().getType() >= 0 ||
+      templateInterest.exclude_.get().size() > 0 ||
+      templateInterest.forwardingHint_.get().size() > 0 ||
+      !templateInterest.linkWireEncoding_.isNull() ||
+      templateInterest.link_.get())
+    // Decode the other fields from the encoding when they are needed.
+    lazyWireEncoding_ = encoding;
+  else {
+    minSuffixComponents_ = templateInterest.minSuffixComponents_;
+    maxSuffixComponents_ = templateInterest.maxSuffixComponents_;
+    childSelector_ = templateInterest.childSelector_;
+    mustBeFresh_ = templateInterest.mustBeFresh_;
+    interestLifetimeMilliseconds_ =
+      templateInterest.interestLifetimeMilliseconds_;
+    nonce_ = nonce;
+    // Set getNonceChangeCount_ so that the next call to getNonce() won't clear
+    // nonce_.
+    getNonceChangeCount_ = getChangeCount();
+  }
+
+  setDefaultWireEncoding(encoding, wireFormat);
+}
+
+void
+Interest::decodeLazyFields()
+{
+  // Clear lazyWireEncoding_ first so that the setters called while decoding
+  // don't call this again.
+  Blob input = lazyWireEncoding_;
+  lazyWireEncoding_ = Blob();
+
+  wireDecode(input, *TlvWireFormat::get());
+}
+
 string
 Interest::toUri() const
 {
+  ensureDecoded();
   ostringstream selectors;
 
   if (minSuffixComponents_ >= 0)
@@ -225,6 +339,7 @@ Interest::toUri() const
 bool
 Interest::matchesName(const Name& name) const
 {
+  ensureDecoded();
   if (!getName().match(name))
     return false;
 
@@ -316,6 +431,7 @@ Interest::matchesData(const Data& data, WireFormat& wireFormat) const
 Link*
 Interest::getLink()
 {
+  ensureDecoded();
   if (link_.get())
     return link_.get();
   else if (!linkWireEncoding_.isNull()) {
@@ -337,6 +453,7 @@ Interest::getLink()
 Blob
 Interest::getLinkWireEncoding(WireFormat& wireFormat) const
 {
+  ensureDecoded();
   if (!linkWireEncoding_.isNull() && linkWireEncodingFormat_ == &wireFormat)
     return linkWireEncoding_;
 
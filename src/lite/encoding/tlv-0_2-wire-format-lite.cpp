@@ -152,6 +152,15 @@ Tlv0_2WireFormatLite::decodeSignatureInfoAndValue
      signatureValueLength);
 }
 
+ndn_Error
+Tlv0_2WireFormatLite::encodeLpPacket
+  (const LpPacketLite& lpPacket, DynamicUInt8ArrayLite& output,
+   size_t* encodingLength)
+{
+  return ndn_Tlv0_2WireFormat_encodeLpPacket
+    (&lpPacket, &output, encodingLength);
+}
+
 ndn_Error
 Tlv0_2WireFormatLite::decodeLpPacket
   (LpPacketLite& lpPacket, const uint8_t* input, size_t inputLength)
@@ -70,6 +70,12 @@ ExcludeLite::appendComponent(const NameLite::Component& component)
   return NDN_ERROR_success;
 }
 
+bool
+ExcludeLite::matches(const NameLite::Component& component) const
+{
+  return ndn_Exclude_matches(this, &component) != 0;
+}
+
 void
 ExcludeLite::clear() { ndn_Exclude_clear(this); }
 
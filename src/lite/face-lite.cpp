@@ -0,0 +1,307 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../c/encoding/tlv/tlv.h"
+#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
+#include <ndn-cpp/lite/lp/lp-packet-lite.hpp>
+#include <ndn-cpp/lite/face-lite.hpp>
+
+namespace ndn {
+
+// The maximum number of name components and exclude entries when decoding a
+// received packet. The arrays are on the stack, not in the FaceLite.
+static const size_t MAX_DECODED_NAME_COMPONENTS = 100;
+static const size_t MAX_DECODED_EXCLUDE_ENTRIES = 100;
+static const size_t MAX_LP_HEADER_FIELDS = 5;
+
+ndn_Error
+FaceLite::expressInterest
+  (const InterestLite& interest, OnDataLite onData, OnTimeoutLite onTimeout,
+   OnNetworkNackLite onNetworkNack, void* context,
+   uint64_t* pendingInterestId)
+{
+  PendingInterest* entry = 0;
+  for (size_t i = 0; i < maxPendingInterests_; ++i) {
+    if (pendingInterestTable_[i].pendingInterestId_ == 0) {
+      entry = pendingInterestTable_ + i;
+      break;
+    }
+  }
+  if (!entry)
+    return NDN_ERROR_FaceLite_the_pending_interest_table_is_full;
+
+  ndn_Error error;
+  size_t encodingLength;
+  size_t dummySignedPortionBeginOffset, dummySignedPortionEndOffset;
+  if ((error = Tlv0_2WireFormatLite::encodeInterest
+       (interest, &dummySignedPortionBeginOffset, &dummySignedPortionEndOffset,
+        encoding_, &encodingLength)))
+    return error;
+  if ((error = send(encoding_.getArray(), encodingLength)))
+    return error;
+
+  Milliseconds lifetime = interest.getInterestLifetimeMilliseconds();
+  if (lifetime < 0.0)
+    // Use a default timeout delay.
+    lifetime = 4000.0;
+
+  entry->pendingInterestId_ = ++lastEntryId_;
+  entry->interest_ = &interest;
+  entry->timeoutTime_ = ndn_getNowMilliseconds() + lifetime;
+  entry->onData_ = onData;
+  entry->onTimeout_ = onTimeout;
+  entry->onNetworkNack_ = onNetworkNack;
+  entry->context_ = context;
+  if (pendingInterestId)
+    *pendingInterestId = entry->pendingInterestId_;
+
+  return NDN_ERROR_success;
+}
+
+void
+FaceLite::removePendingInterest(uint64_t pendingInterestId)
+{
+  for (size_t i = 0; i < maxPendingInterests_; ++i) {
+    if (pendingInterestTable_[i].pendingInterestId_ == pendingInterestId) {
+      pendingInterestTable_[i].pendingInterestId_ = 0;
+      return;
+    }
+  }
+}
+
+ndn_Error
+FaceLite::setInterestFilter
+  (const NameLite& prefix, OnInterestLite onInterest, void* context,
+   uint64_t* interestFilterId)
+{
+  for (size_t i = 0; i < maxInterestFilters_; ++i) {
+    InterestFilter& entry = interestFilterTable_[i];
+    if (entry.interestFilterId_ == 0) {
+      entry.interestFilterId_ = ++lastEntryId_;
+      entry.prefix_ = &prefix;
+      entry.onInterest_ = onInterest;
+      entry.context_ = context;
+      if (interestFilterId)
+        *interestFilterId = entry.interestFilterId_;
+
+      return NDN_ERROR_success;
+    }
+  }
+
+  return NDN_ERROR_FaceLite_the_interest_filter_table_is_full;
+}
+
+void
+FaceLite::unsetInterestFilter(uint64_t interestFilterId)
+{
+  for (size_t i = 0; i < maxInterestFilters_; ++i) {
+    if (interestFilterTable_[i].interestFilterId_ == interestFilterId) {
+      interestFilterTable_[i].interestFilterId_ = 0;
+      return;
+    }
+  }
+}
+
+ndn_Error
+FaceLite::putData(const DataLite& data)
+{
+  ndn_Error error;
+  size_t encodingLength;
+  size_t dummySignedPortionBeginOffset, dummySignedPortionEndOffset;
+  if ((error = Tlv0_2WireFormatLite::encodeData
+       (data, &dummySignedPortionBeginOffset, &dummySignedPortionEndOffset,
+        encoding_, &encodingLength)))
+    return error;
+
+  return send(encoding_.getArray(), encodingLength);
+}
+
+ndn_Error
+FaceLite::callLater
+  (Milliseconds delayMilliseconds, OnDelayedCallLite callback, void* context)
+{
+  for (size_t i = 0; i < maxDelayedCalls_; ++i) {
+    DelayedCall& entry = delayedCallTable_[i];
+    if (entry.delayedCallId_ == 0) {
+      entry.delayedCallId_ = ++lastEntryId_;
+      entry.callTime_ = ndn_getNowMilliseconds() + delayMilliseconds;
+      entry.callback_ = callback;
+      entry.context_ = context;
+
+      return NDN_ERROR_success;
+    }
+  }
+
+  return NDN_ERROR_FaceLite_the_delayed_call_table_is_full;
+}
+
+ndn_Error
+FaceLite::processEvents(uint8_t* buffer, size_t bufferLength)
+{
+  ndn_Error error;
+  if ((error = processEvents_(transport_, buffer, bufferLength)))
+    return error;
+
+  processTimers();
+  return NDN_ERROR_success;
+}
+
+void
+FaceLite::onReceivedElement(const uint8_t *element, size_t elementLength)
+{
+  const NetworkNackLite* networkNack = 0;
+  struct ndn_LpPacketHeaderField headerFields[MAX_LP_HEADER_FIELDS];
+  LpPacketLite lpPacket(headerFields, MAX_LP_HEADER_FIELDS);
+
+  if (elementLength > 0 && element[0] == ndn_Tlv_LpPacket_LpPacket) {
+    // Process the fragment and ignore the other headers.
+    if (Tlv0_2WireFormatLite::decodeLpPacket(lpPacket, element, elementLength))
+      // Ignore a packet we can't decode.
+      return;
+
+    element = lpPacket.getFragmentWireEncoding().buf();
+    elementLength = lpPacket.getFragmentWireEncoding().size();
+    networkNack = NetworkNackLite::getFirstHeader(lpPacket);
+  }
+
+  if (elementLength == 0)
+    return;
+  if (element[0] == ndn_Tlv_Interest)
+    processInterest(element, elementLength, networkNack);
+  else if (element[0] == ndn_Tlv_Data)
+    processData(element, elementLength);
+}
+
+void
+FaceLite::onReceivedElementWrapper
+  (ElementListenerLite *self, const uint8_t *element, size_t elementLength)
+{
+  ((FaceLite*)self)->onReceivedElement(element, elementLength);
+}
+
+void
+FaceLite::processData(const uint8_t *element, size_t elementLength)
+{
+  struct ndn_NameComponent nameComponents[MAX_DECODED_NAME_COMPONENTS];
+  struct ndn_NameComponent keyNameComponents[MAX_DECODED_NAME_COMPONENTS];
+  DataLite data
+    (nameComponents, MAX_DECODED_NAME_COMPONENTS, keyNameComponents,
+     MAX_DECODED_NAME_COMPONENTS);
+  size_t dummySignedPortionBeginOffset, dummySignedPortionEndOffset;
+  if (Tlv0_2WireFormatLite::decodeData
+      (data, element, elementLength, &dummySignedPortionBeginOffset,
+       &dummySignedPortionEndOffset))
+    // Ignore a packet we can't decode.
+    return;
+
+  uint64_t maxEntryId = lastEntryId_;
+  for (size_t i = 0; i < maxPendingInterests_; ++i) {
+    PendingInterest& entry = pendingInterestTable_[i];
+    // An onData callback can remove entries, or add entries which we skip.
+    if (entry.pendingInterestId_ == 0 ||
+        entry.pendingInterestId_ > maxEntryId ||
+        !entry.interest_->matchesName(data.getName()))
+      continue;
+
+    // Remove the entry before the callback so that it can use the slot.
+    entry.pendingInterestId_ = 0;
+    entry.onData_(*this, *entry.interest_, data, entry.context_);
+  }
+}
+
+void
+FaceLite::processInterest
+  (const uint8_t *element, size_t elementLength,
+   const NetworkNackLite* networkNack)
+{
+  struct ndn_NameComponent nameComponents[MAX_DECODED_NAME_COMPONENTS];
+  struct ndn_ExcludeEntry excludeEntries[MAX_DECODED_EXCLUDE_ENTRIES];
+  struct ndn_NameComponent keyNameComponents[MAX_DECODED_NAME_COMPONENTS];
+  InterestLite interest
+    (nameComponents, MAX_DECODED_NAME_COMPONENTS, excludeEntries,
+     MAX_DECODED_EXCLUDE_ENTRIES, keyNameComponents,
+     MAX_DECODED_NAME_COMPONENTS);
+  size_t dummySignedPortionBeginOffset, dummySignedPortionEndOffset;
+  if (Tlv0_2WireFormatLite::decodeInterest
+      (interest, element, elementLength, &dummySignedPortionBeginOffset,
+       &dummySignedPortionEndOffset))
+    // Ignore a packet we can't decode.
+    return;
+
+  uint64_t maxEntryId = lastEntryId_;
+  if (networkNack) {
+    // The encoder may have generated the nonce, so match the Nack by name.
+    for (size_t i = 0; i < maxPendingInterests_; ++i) {
+      PendingInterest& entry = pendingInterestTable_[i];
+      if (entry.pendingInterestId_ == 0 ||
+          entry.pendingInterestId_ > maxEntryId ||
+          !entry.interest_->getName().equals(interest.getName()))
+        continue;
+
+      entry.pendingInterestId_ = 0;
+      if (entry.onNetworkNack_)
+        entry.onNetworkNack_
+          (*this, *entry.interest_, *networkNack, entry.context_);
+    }
+
+    return;
+  }
+
+  for (size_t i = 0; i < maxInterestFilters_; ++i) {
+    InterestFilter& entry = interestFilterTable_[i];
+    if (entry.interestFilterId_ == 0 ||
+        entry.interestFilterId_ > maxEntryId ||
+        !entry.prefix_->match(interest.getName()))
+      continue;
+
+    entry.onInterest_(*this, *entry.prefix_, interest, entry.context_);
+  }
+}
+
+void
+FaceLite::processTimers()
+{
+  ndn_MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  uint64_t maxEntryId = lastEntryId_;
+
+  for (size_t i = 0; i < maxPendingInterests_; ++i) {
+    PendingInterest& entry = pendingInterestTable_[i];
+    if (entry.pendingInterestId_ == 0 ||
+        entry.pendingInterestId_ > maxEntryId || entry.timeoutTime_ > now)
+      continue;
+
+    entry.pendingInterestId_ = 0;
+    if (entry.onTimeout_)
+      entry.onTimeout_(*this, *entry.interest_, entry.context_);
+  }
+
+  for (size_t i = 0; i < maxDelayedCalls_; ++i) {
+    DelayedCall& entry = delayedCallTable_[i];
+    if (entry.delayedCallId_ == 0 || entry.delayedCallId_ > maxEntryId ||
+        entry.callTime_ > now)
+      continue;
+
+    entry.delayedCallId_ = 0;
+    entry.callback_(*this, entry.context_);
+  }
+}
+
+}
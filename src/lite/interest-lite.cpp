@@ -47,6 +47,12 @@ InterestLite::setMustBeFresh(bool mustBeFresh)
   return *this;
 }
 
+bool
+InterestLite::matchesName(const NameLite& name) const
+{
+  return ndn_Interest_matchesName(this, &name) != 0;
+}
+
 ndn_Error
 InterestLite::set(const InterestLite& other)
 {
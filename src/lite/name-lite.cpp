@@ -215,7 +215,7 @@ NameLite::NameLite(ndn_NameComponent* components, size_t maxComponents)
 }
 
 bool
-NameLite::equals(const NameLite& name)
+NameLite::equals(const NameLite& name) const
 {
   return ndn_Name_equals(this, &name) != 0;
 }
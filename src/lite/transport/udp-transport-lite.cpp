@@ -55,6 +55,12 @@ UdpTransportLite::processEvents(uint8_t *buffer, size_t bufferLength)
   return ndn_UdpTransport_processEvents(this, buffer, bufferLength);
 }
 
+ndn_Error
+UdpTransportLite::setReceiveBufferSize(int receiveBufferSize)
+{
+  return ndn_UdpTransport_setReceiveBufferSize(this, receiveBufferSize);
+}
+
 ndn_Error
 UdpTransportLite::close()
 {
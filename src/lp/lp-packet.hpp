@@ -61,6 +61,17 @@ public:
   ptr_lib::shared_ptr<LpPacketHeaderField>&
   getHeaderField(int index) { return headerFields_[index]; }
 
+  /**
+   * Set the fragment wire encoding.
+   * @param fragmentWireEncoding The fragment wire encoding or an isNull Blob if
+   * not specified.
+   */
+  void
+  setFragmentWireEncoding(const Blob& fragmentWireEncoding)
+  {
+    fragmentWireEncoding_ = fragmentWireEncoding;
+  }
+
   /**
    * Remove all header fields and set the fragment to an isNull Blob.
    */
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <ndn-cpp/util/logging.hpp>
+#include "../c/util/time.h"
+#include "lp-reassembler.hpp"
+
+INIT_LOGGER("ndn.LpReassembler");
+
+using namespace std;
+
+namespace ndn {
+
+ptr_lib::shared_ptr<LpPacket>
+LpReassembler::receiveFragment
+  (const LpPacketLite& lpPacketLite, Blob& reassembledPacket)
+{
+  MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  removeExpired(now);
+
+  uint64_t fragIndex = lpPacketLite.getFragIndex();
+  uint64_t fragCount = lpPacketLite.getFragCount();
+  if (!lpPacketLite.getHasSequence() || fragIndex >= fragCount ||
+      // Each fragment has at least one byte, so this bounds the allocation.
+      fragCount > MAX_NDN_PACKET_SIZE) {
+    _LOG_DEBUG("LpReassembler: Dropping a fragment with invalid fragmentation fields");
+    return ptr_lib::shared_ptr<LpPacket>();
+  }
+
+  // The Sequence wraps around after the maximum uint64_t, so the fragment
+  // with FragIndex 0 may have a larger Sequence than this fragment. The
+  // unsigned subtraction wraps the same way.
+  uint64_t firstSequence = lpPacketLite.getSequence() - fragIndex;
+  ptr_lib::shared_ptr<PartialPacket> partialPacket;
+  map<uint64_t, ptr_lib::shared_ptr<PartialPacket> >::iterator found =
+    partialPackets_.find(firstSequence);
+  if (found != partialPackets_.end()) {
+    partialPacket = found->second;
+    if (partialPacket->fragments_.size() != fragCount) {
+      _LOG_DEBUG("LpReassembler: Dropping a fragment with a mismatched FragCount");
+      return ptr_lib::shared_ptr<LpPacket>();
+    }
+  }
+  else {
+    if (partialPackets_.size() >= maxPartialPackets_)
+      removeOldest();
+
+    partialPacket.reset(new PartialPacket
+      ((size_t)fragCount, now + reassemblyTimeoutMilliseconds_));
+    partialPackets_[firstSequence] = partialPacket;
+  }
+
+  Blob& fragment = partialPacket->fragments_[(size_t)fragIndex];
+  if (!fragment.isNull())
+    // Ignore a duplicate fragment.
+    return ptr_lib::shared_ptr<LpPacket>();
+
+  fragment = Blob(lpPacketLite.getFragmentWireEncoding());
+  if (fragment.isNull())
+    // Use an empty non-null Blob to mark the fragment as received.
+    fragment = Blob((const uint8_t*)"", 0);
+  partialPacket->totalSize_ += fragment.size();
+  ++partialPacket->nReceivedFragments_;
+  if (partialPacket->totalSize_ > MAX_NDN_PACKET_SIZE) {
+    _LOG_DEBUG("LpReassembler: Dropping a reassembled packet which exceeds MAX_NDN_PACKET_SIZE");
+    partialPackets_.erase(firstSequence);
+    return ptr_lib::shared_ptr<LpPacket>();
+  }
+
+  if (fragIndex == 0) {
+    // The network-layer header fields are in the first fragment.
+    partialPacket->header_.reset(new LpPacket());
+    partialPacket->header_->set(lpPacketLite);
+    partialPacket->header_->setFragmentWireEncoding(Blob());
+  }
+
+  if (partialPacket->nReceivedFragments_ < partialPacket->fragments_.size())
+    // Still waiting for more fragments.
+    return ptr_lib::shared_ptr<LpPacket>();
+
+  // All fragments have arrived, so concatenate them.
+  ptr_lib::shared_ptr<vector<uint8_t> > buffer(new vector<uint8_t>());
+  buffer->reserve(partialPacket->totalSize_);
+  for (size_t i = 0; i < partialPacket->fragments_.size(); ++i) {
+    const Blob& part = partialPacket->fragments_[i];
+    if (part.size() > 0)
+      buffer->insert(buffer->end(), part.buf(), part.buf() + part.size());
+  }
+  reassembledPacket = Blob(buffer, false);
+
+  ptr_lib::shared_ptr<LpPacket> header = partialPacket->header_;
+  partialPackets_.erase(firstSequence);
+  return header;
+}
+
+void
+LpReassembler::removeExpired(MillisecondsSince1970 now)
+{
+  if (partialPackets_.empty())
+    return;
+
+  map<uint64_t, ptr_lib::shared_ptr<PartialPacket> >::iterator it =
+    partialPackets_.begin();
+  while (it != partialPackets_.end()) {
+    if (it->second->expirationTime_ <= now) {
+      _LOG_DEBUG("LpReassembler: Reassembly timeout for the packet with first Sequence " <<
+                 it->first);
+      partialPackets_.erase(it++);
+    }
+    else
+      ++it;
+  }
+}
+
+void
+LpReassembler::removeOldest()
+{
+  map<uint64_t, ptr_lib::shared_ptr<PartialPacket> >::iterator oldest =
+    partialPackets_.end();
+  for (map<uint64_t, ptr_lib::shared_ptr<PartialPacket> >::iterator it =
+         partialPackets_.begin();
+       it != partialPackets_.end(); ++it) {
+    if (oldest == partialPackets_.end() ||
+        it->second->expirationTime_ < oldest->second->expirationTime_)
+      oldest = it;
+  }
+
+  if (oldest != partialPackets_.end())
+    partialPackets_.erase(oldest);
+}
+
+}
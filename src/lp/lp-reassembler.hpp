@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_LP_REASSEMBLER_HPP
+#define NDN_LP_REASSEMBLER_HPP
+
+#include <map>
+#include <vector>
+#include <ndn-cpp/common.hpp>
+#include "lp-packet.hpp"
+
+namespace ndn {
+
+/**
+ * An LpReassembler collects the fragments of NDNLPv2 packets which were
+ * fragmented by the sender and returns the reassembled network-layer packet
+ * when all fragments have arrived. The fragments of one packet have
+ * consecutive Sequence numbers, so the fragments are grouped by the Sequence of
+ * the first fragment. The number of partial packets is bounded, and a partial
+ * packet is dropped if its remaining fragments do not arrive before the
+ * reassembly timeout. This is an internal class which the application normally
+ * would not use.
+ * http://redmine.named-data.net/projects/nfd/wiki/NDNLPv2
+ */
+class LpReassembler {
+public:
+  /**
+   * Create an LpReassembler with the given limits.
+   * @param maxPartialPackets (optional) The maximum number of partial packets
+   * to keep. If a fragment of a new packet arrives when the table is full,
+   * this drops the partial packet with the earliest expiration time. If
+   * omitted, use 64.
+   * @param reassemblyTimeoutMilliseconds (optional) The time to wait for the
+   * remaining fragments of a packet after receiving its first fragment. If
+   * omitted, use 500 milliseconds.
+   */
+  LpReassembler
+    (size_t maxPartialPackets = 64,
+     Milliseconds reassemblyTimeoutMilliseconds = 500.0)
+  : maxPartialPackets_(maxPartialPackets),
+    reassemblyTimeoutMilliseconds_(reassemblyTimeoutMilliseconds)
+  {
+  }
+
+  /**
+   * Process the received fragment. If this completes a packet, return the
+   * reassembled network-layer packet and remove the partial packet from the
+   * table. This also drops expired partial packets.
+   * @param lpPacketLite The decoded LpPacket of the fragment, which must have
+   * a Sequence and a FragCount greater than 1.
+   * @param reassembledPacket If this returns an LpPacket, set this to the
+   * reassembled network-layer packet wire encoding.
+   * @return The LpPacket with the header fields of the fragment with FragIndex
+   * 0 and an isNull fragment, or null if the packet is not yet complete or the
+   * fragment is invalid.
+   */
+  ptr_lib::shared_ptr<LpPacket>
+  receiveFragment(const LpPacketLite& lpPacketLite, Blob& reassembledPacket);
+
+  /**
+   * Get the number of partial packets which are waiting for fragments.
+   * @return The number of partial packets.
+   */
+  size_t
+  size() const { return partialPackets_.size(); }
+
+  /**
+   * Remove the partial packets whose expiration time is at or before now.
+   * receiveFragment calls this, but the owner should also call this
+   * periodically so that a partial packet is dropped when no more fragments
+   * arrive.
+   * @param now The current time in milliseconds from ndn_getNowMilliseconds.
+   */
+  void
+  removeExpired(MillisecondsSince1970 now);
+
+private:
+  class PartialPacket {
+  public:
+    PartialPacket(size_t fragCount, MillisecondsSince1970 expirationTime)
+    : fragments_(fragCount), nReceivedFragments_(0), totalSize_(0),
+      expirationTime_(expirationTime)
+    {
+    }
+
+    std::vector<Blob> fragments_;
+    size_t nReceivedFragments_;
+    size_t totalSize_;
+    MillisecondsSince1970 expirationTime_;
+    ptr_lib::shared_ptr<LpPacket> header_;
+  };
+
+  /**
+   * Remove the partial packet with the earliest expiration time.
+   */
+  void
+  removeOldest();
+
+  // The key is the Sequence of the fragment with FragIndex 0.
+  std::map<uint64_t, ptr_lib::shared_ptr<PartialPacket> > partialPackets_;
+  size_t maxPartialPackets_;
+  Milliseconds reassemblyTimeoutMilliseconds_;
+};
+
+}
+
+#endif
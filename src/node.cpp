@@ -27,6 +27,7 @@
 #include <ndn-cpp/network-nack.hpp>
 #include "c/util/time.h"
 #include "encoding/tlv-decoder.hpp"
+#include "encoding/lite-array.hpp"
 #include <ndn-cpp/util/logging.hpp>
 #include "lp/lp-packet.hpp"
 #include "node.hpp"
@@ -43,7 +44,8 @@ Node::Node(const ptr_lib::shared_ptr<Transport>& transport, const ptr_lib::share
   timeoutPrefix_(Name("/local/timeout")),
   lastEntryId_(0), connectStatus_(ConnectStatus_UNCONNECTED),
   registeredPrefixTable_(interestFilterTable_),
-  nonceTemplate_((const uint8_t*)"\0\0\0\0", 4)
+  interestEncodingBuffer_(256),
+  isLazyDecoding_(false), isInterestAggregation_(false)
 {
 }
 
@@ -52,11 +54,29 @@ Node::expressInterest
   (uint64_t pendingInterestId,
    const ptr_lib::shared_ptr<const Interest>& interestCopy, const OnData& onData,
    const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
-   WireFormat& wireFormat, Face* face)
+   WireFormat& wireFormat, Face* face, bool useInterestNonce)
 {
-  // Set the nonce in our copy of the Interest so it is saved in the PIT.
-  const_cast<Interest*>(interestCopy.get())->setNonce(nonceTemplate_);
-  const_cast<Interest*>(interestCopy.get())->refreshNonce();
+  if (!useInterestNonce)
+    // Set the nonce in our copy of the Interest so it is saved in the PIT.
+    const_cast<Interest*>(interestCopy.get())->setNonce
+      (noncePool_.getNextNonce());
+
+  if (dataCache_.getCapacity() > 0) {
+    ptr_lib::shared_ptr<Data> data = dataCache_.find(*interestCopy);
+    if (data) {
+      // Add to the PIT without sending so that removePendingInterest still
+      // works, and call onData from the event loop like a received Data.
+      if (!pendingInterestTable_.add
+          (pendingInterestId, interestCopy, onData, onTimeout, onNetworkNack))
+        // removePendingInterest was already called with the pendingInterestId.
+        return;
+      _LOG_TRACE("Satisfying the Interest from the Data cache " <<
+                 interestCopy->getName().toUri());
+      face->callLater
+        (0, bind(&Node::satisfyFromDataCache, this, pendingInterestId, data));
+      return;
+    }
+  }
 
   if (connectStatus_ == ConnectStatus_CONNECT_COMPLETE) {
     // We are connected. Simply send the interest.
@@ -102,6 +122,21 @@ Node::expressInterest
     throw runtime_error("Node: Unrecognized connectStatus_");
 }
 
+void
+Node::expressInterestFromTemplate
+  (uint64_t pendingInterestId, const InterestTemplate& interestTemplate,
+   const Name::Component& finalComponent, const OnData& onData,
+   const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack, Face* face)
+{
+  // makeInterest encodes the new Interest with the nonce, so tell
+  // expressInterest not to replace it.
+  expressInterest
+    (pendingInterestId,
+     interestTemplate.makeInterest(finalComponent, noncePool_.getNextNonce()),
+     onData, onTimeout, onNetworkNack, interestTemplate.getWireFormat(), face,
+     true);
+}
+
 void
 Node::onConnected()
 {
@@ -141,6 +176,8 @@ Node::send(const uint8_t *encoding, size_t encodingLength)
       ("The encoded packet size exceeds the maximum limit getMaxNdnPacketSize()");
 
   transport_->send(encoding, encodingLength);
+  if (metrics_.getIsEnabled())
+    metrics_.recordOutPacket(encoding, encodingLength);
 }
 
 uint64_t
@@ -292,6 +329,10 @@ Node::processEvents()
 {
   transport_->processEvents();
 
+  // Drop the partial packets whose remaining fragments didn't arrive, even if
+  // no new fragment arrives to trigger this in receiveFragment.
+  lpReassembler_.removeExpired(ndn_getNowMilliseconds());
+
   // If Face::callLater is overridden to use a different mechanism, then
   // processEvents is not needed to check for delayed calls.
   delayedCallTable_.callTimedOut();
@@ -299,8 +340,19 @@ Node::processEvents()
 
 void
 Node::onReceivedElement(const uint8_t *element, size_t elementLength)
+{
+  if (metrics_.getIsEnabled())
+    metrics_.recordInElement(elementLength);
+
+  processReceivedElement(element, elementLength);
+}
+
+void
+Node::processReceivedElement(const uint8_t *element, size_t elementLength)
 {
   ptr_lib::shared_ptr<LpPacket> lpPacket;
+  // If the LpPacket is a fragment, this holds the reassembled packet.
+  Blob reassembledPacket;
   if (element[0] == ndn_Tlv_LpPacket_LpPacket) {
     // Decode the LpPacket and replace element with the fragment.
     // Use LpPacketLite to avoid copying the fragment.
@@ -310,16 +362,33 @@ Node::onReceivedElement(const uint8_t *element, size_t elementLength)
 
     ndn_Error error;
     if ((error = Tlv0_2WireFormatLite::decodeLpPacket
-         (lpPacketLite, element, elementLength)))
+         (lpPacketLite, element, elementLength))) {
+      if (metrics_.getIsEnabled())
+        metrics_.recordDecodeError();
       throw runtime_error(ndn_getErrorString(error));
-    element = lpPacketLite.getFragmentWireEncoding().buf();
-    elementLength = lpPacketLite.getFragmentWireEncoding().size();
+    }
 
-    // We have saved the wire encoding, so clear to copy it to lpPacket.
-    lpPacketLite.setFragmentWireEncoding(BlobLite());
+    if (lpPacketLite.getFragCount() > 1) {
+      // This is one fragment of a larger packet.
+      lpPacket = lpReassembler_.receiveFragment
+        (lpPacketLite, reassembledPacket);
+      if (!lpPacket)
+        // Wait for the remaining fragments.
+        return;
+
+      element = reassembledPacket.buf();
+      elementLength = reassembledPacket.size();
+    }
+    else {
+      element = lpPacketLite.getFragmentWireEncoding().buf();
+      elementLength = lpPacketLite.getFragmentWireEncoding().size();
 
-    lpPacket.reset(new LpPacket());
-    lpPacket->set(lpPacketLite);
+      // We have saved the wire encoding, so clear to copy it to lpPacket.
+      lpPacketLite.setFragmentWireEncoding(BlobLite());
+
+      lpPacket.reset(new LpPacket());
+      lpPacket->set(lpPacketLite);
+    }
   }
 
   // First, decode as Interest or Data.
@@ -327,20 +396,36 @@ Node::onReceivedElement(const uint8_t *element, size_t elementLength)
   ptr_lib::shared_ptr<Data> data;
 
   if (element[0] == ndn_Tlv_Interest || element[0] == ndn_Tlv_Data) {
-    TlvDecoder decoder(element, elementLength);
-    if (decoder.peekType(ndn_Tlv_Interest, elementLength)) {
-      interest.reset(new Interest());
-      interest->wireDecode(element, elementLength, *TlvWireFormat::get());
-
-      if (lpPacket)
-        interest->setLpPacket(lpPacket);
-    }
-    else if (decoder.peekType(ndn_Tlv_Data, elementLength)) {
-      data.reset(new Data());
-      data->wireDecode(element, elementLength, *TlvWireFormat::get());
-
-      if (lpPacket)
-        data->setLpPacket(lpPacket);
+    // Only count an exception from decoding as a decode error, not one from
+    // processing the packet below.
+    try {
+      TlvDecoder decoder(element, elementLength);
+      if (decoder.peekType(ndn_Tlv_Interest, elementLength)) {
+        interest.reset(new Interest());
+        if (isLazyDecoding_)
+          // Only decode the Name until the Interest matches a filter.
+          interest->wireDecodeLazy(Blob(element, elementLength));
+        else
+          interest->wireDecode(element, elementLength, *TlvWireFormat::get());
+
+        if (lpPacket)
+          interest->setLpPacket(lpPacket);
+      }
+      else if (decoder.peekType(ndn_Tlv_Data, elementLength)) {
+        data.reset(new Data());
+        if (isLazyDecoding_)
+          // Only decode the Name until the Data matches a pending Interest.
+          data->wireDecodeLazy(Blob(element, elementLength));
+        else
+          data->wireDecode(element, elementLength, *TlvWireFormat::get());
+
+        if (lpPacket)
+          data->setLpPacket(lpPacket);
+      }
+    } catch (...) {
+      if (metrics_.getIsEnabled())
+        metrics_.recordDecodeError();
+      throw;
     }
   }
 
@@ -354,6 +439,14 @@ Node::onReceivedElement(const uint8_t *element, size_t elementLength)
 
       vector<ptr_lib::shared_ptr<PendingInterestTable::Entry> > pitEntries;
       pendingInterestTable_.extractEntriesForNackInterest(*interest, pitEntries);
+      if (isInterestAggregation_)
+        // Also pass the Nack to the entries aggregated with the sent Interest.
+        pendingInterestTable_.extractUnsentEquivalentEntries
+          (*interest, pitEntries);
+      if (metrics_.getIsEnabled()) {
+        metrics_.recordInNack();
+        metrics_.setPendingInterestCount(pendingInterestTable_.size());
+      }
       for (size_t i = 0; i < pitEntries.size(); ++i) {
         try {
           pitEntries[i]->getOnNetworkNack()
@@ -372,9 +465,16 @@ Node::onReceivedElement(const uint8_t *element, size_t elementLength)
 
   // Now process as Interest or Data.
   if (interest) {
+    if (metrics_.getIsEnabled())
+      metrics_.recordInInterest();
+
     // Call all interest filter callbacks which match.
     vector<ptr_lib::shared_ptr<InterestFilterTable::Entry> > matchedFilters;
     interestFilterTable_.getMatchedFilters(*interest, matchedFilters);
+    if (matchedFilters.size() > 0)
+      // Finish a lazy decode so the callbacks can share the const Interest
+      // between threads.
+      finishLazyDecode(*interest);
 
     for (size_t i = 0; i < matchedFilters.size(); ++i) {
       InterestFilterTable::Entry &entry = *matchedFilters[i];
@@ -392,6 +492,23 @@ Node::onReceivedElement(const uint8_t *element, size_t elementLength)
   else if (data) {
     vector<ptr_lib::shared_ptr<PendingInterestTable::Entry> > pitEntries;
     pendingInterestTable_.extractEntriesForExpressedInterest(*data, pitEntries);
+    if (pitEntries.size() > 0)
+      // Finish a lazy decode so the callbacks can share the const Data
+      // between threads.
+      finishLazyDecode(*data);
+    if (pitEntries.size() > 0 && dataCache_.getCapacity() > 0)
+      // Only cache the Data that we asked for.
+      dataCache_.insert(*data);
+    if (metrics_.getIsEnabled()) {
+      metrics_.recordInData(pitEntries.size() == 0);
+      MillisecondsSince1970 now = ndn_getMonotonicMilliseconds();
+      for (size_t i = 0; i < pitEntries.size(); ++i) {
+        // The send time is 0 if metrics were enabled after sending.
+        if (pitEntries[i]->getSendTime() > 0)
+          metrics_.recordRtt(now - pitEntries[i]->getSendTime());
+      }
+      metrics_.setPendingInterestCount(pendingInterestTable_.size());
+    }
     for (size_t i = 0; i < pitEntries.size(); ++i) {
       try {
         pitEntries[i]->getOnData()(pitEntries[i]->getInterest(), data);
@@ -419,11 +536,17 @@ Node::expressInterestHelper
 {
   ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest =
     pendingInterestTable_.add
-      (pendingInterestId, interestCopy, onData, onTimeout, onNetworkNack);
+      (pendingInterestId, interestCopy, onData, onTimeout, onNetworkNack,
+       isInterestAggregation_);
   if (!pendingInterest)
     // removePendingInterest was already called with the pendingInterestId.
     return;
+  if (metrics_.getIsEnabled()) {
+    pendingInterest->setSendTime(ndn_getMonotonicMilliseconds());
+    metrics_.setPendingInterestCount(pendingInterestTable_.size());
+  }
 
+  MillisecondsSince1970 timeoutTime = -1;
   if (onTimeout || interestCopy->getInterestLifetimeMilliseconds() >= 0.0) {
     // Set up the timeout.
     double delayMilliseconds = interestCopy->getInterestLifetimeMilliseconds();
@@ -431,27 +554,150 @@ Node::expressInterestHelper
       // Use a default timeout delay.
       delayMilliseconds = 4000.0;
 
+    timeoutTime = ndn_getNowMilliseconds() + delayMilliseconds;
     face->callLater
-      (delayMilliseconds,
-       bind(&Node::processInterestTimeout, this, pendingInterest));
+      (delayMilliseconds, InterestTimeout(this, pendingInterestId));
+  }
+  if (isInterestAggregation_)
+    // Save the timeout time so that sendAggregatedInterest can choose an
+    // aggregated entry to send when the sent entry is no longer pending.
+    pendingInterest->setTimeout(timeoutTime, wireFormat);
+
+  if (isInterestAggregation_ &&
+      pendingInterestTable_.findSentEquivalentEntry(*interestCopy)) {
+    // An equivalent Interest is already pending, so don't send another. The
+    // Data for it will also match this entry.
+    _LOG_TRACE("Aggregating the Interest " << interestCopy->getName().toUri());
+    return;
   }
 
+  pendingInterest->setIsSent();
+  sendInterest(*interestCopy, *wireFormat);
+}
+
+void
+Node::sendInterest(const Interest& interest, WireFormat& wireFormat)
+{
   // Special case: For timeoutPrefix_ we don't actually send the interest.
-  if (!timeoutPrefix_.match(interestCopy->getName())) {
-    Blob encoding = interestCopy->wireEncode(*wireFormat);
-    if (encoding.size() > getMaxNdnPacketSize())
+  if (timeoutPrefix_.match(interest.getName()))
+    return;
+
+  if (!interest.getDefaultWireEncoding() &&
+      (&wireFormat == TlvWireFormat::get() ||
+       &wireFormat == Tlv0_2WireFormat::get())) {
+    // Encode into our reusable buffer instead of allocating a new Blob. The
+    // Transport copies or writes the bytes before send returns. Nack
+    // processing will call wireEncode if it needs the encoding.
+    size_t encodingLength = encodeInterestToBuffer(interest, wireFormat);
+    if (encodingLength > getMaxNdnPacketSize())
       throw runtime_error
         ("The encoded interest size exceeds the maximum limit getMaxNdnPacketSize()");
-    transport_->send(*encoding);
+    transport_->send(interestEncodingBuffer_.array, encodingLength);
+    if (metrics_.getIsEnabled())
+      metrics_.recordOutPacket(interestEncodingBuffer_.array, encodingLength);
+    return;
   }
+
+  // This returns the default wire encoding if it is already set, for example
+  // by InterestTemplate.
+  Blob encoding = interest.wireEncode(wireFormat);
+  if (encoding.size() > getMaxNdnPacketSize())
+    throw runtime_error
+      ("The encoded interest size exceeds the maximum limit getMaxNdnPacketSize()");
+  transport_->send(*encoding);
+  if (metrics_.getIsEnabled())
+    metrics_.recordOutPacket(encoding.buf(), encoding.size());
 }
 
 void
-Node::processInterestTimeout
-  (ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest)
+Node::processInterestTimeout(uint64_t pendingInterestId)
 {
-  if (pendingInterestTable_.removeEntry(pendingInterest))
+  ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest =
+    pendingInterestTable_.extractEntry(pendingInterestId);
+  if (pendingInterest) {
+    if (metrics_.getIsEnabled()) {
+      metrics_.recordTimeout();
+      metrics_.setPendingInterestCount(pendingInterestTable_.size());
+    }
+    if (isInterestAggregation_ && pendingInterest->getIsSent())
+      sendAggregatedInterest(*pendingInterest->getInterest());
+
     pendingInterest->callTimeout();
+  }
+}
+
+void
+Node::removePendingInterest(uint64_t pendingInterestId)
+{
+  ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest =
+    pendingInterestTable_.removePendingInterest(pendingInterestId);
+  if (metrics_.getIsEnabled())
+    metrics_.setPendingInterestCount(pendingInterestTable_.size());
+
+  if (isInterestAggregation_ && pendingInterest && pendingInterest->getIsSent())
+    // Don't leave the aggregated Interests waiting for the removed one.
+    sendAggregatedInterest(*pendingInterest->getInterest());
+}
+
+void
+Node::sendAggregatedInterest(const Interest& interest)
+{
+  // Send an aggregated Interest which has not timed out yet.
+  ptr_lib::shared_ptr<PendingInterestTable::Entry> aggregated =
+    pendingInterestTable_.findUnsentEquivalentEntry
+      (interest, ndn_getNowMilliseconds());
+  if (aggregated) {
+    aggregated->setIsSent();
+    sendInterest(*aggregated->getInterest(), *aggregated->getWireFormat());
+  }
+}
+
+void
+Node::satisfyFromDataCache
+  (uint64_t pendingInterestId, const ptr_lib::shared_ptr<Data>& data)
+{
+  ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest =
+    pendingInterestTable_.extractEntry(pendingInterestId);
+  if (!pendingInterest)
+    // removePendingInterest was called before the event loop processed this.
+    return;
+
+  if (metrics_.getIsEnabled())
+    metrics_.setPendingInterestCount(pendingInterestTable_.size());
+  try {
+    pendingInterest->getOnData()(pendingInterest->getInterest(), data);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("Node::satisfyFromDataCache: Error in onData: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("Node::satisfyFromDataCache: Error in onData.");
+  }
+}
+
+size_t
+Node::encodeInterestToBuffer(const Interest& interest, WireFormat& wireFormat)
+{
+  // Size the arrays for the Interest so that long names don't fail.
+  LiteArray<struct ndn_NameComponent, 48> nameComponents
+    (interest.getName().size());
+  LiteArray<struct ndn_ExcludeEntry, 48> excludeEntries
+    (interest.getExclude().size());
+  LiteArray<struct ndn_NameComponent, 48> keyNameComponents
+    (interest.getKeyLocator().getKeyName().size());
+  InterestLite interestLite
+    (nameComponents.get(), nameComponents.size(),
+     excludeEntries.get(), excludeEntries.size(),
+     keyNameComponents.get(), keyNameComponents.size());
+  interest.get(interestLite, wireFormat);
+
+  ndn_Error error;
+  size_t signedPortionBeginOffset, signedPortionEndOffset, encodingLength;
+  if ((error = Tlv0_2WireFormatLite::encodeInterest
+       (interestLite, &signedPortionBeginOffset, &signedPortionEndOffset,
+        DynamicUInt8ArrayLite::downCast(interestEncodingBuffer_),
+        &encodingLength)))
+    throw runtime_error(ndn_getErrorString(error));
+
+  return encodingLength;
 }
 
 }
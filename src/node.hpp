@@ -36,8 +36,13 @@
 #include "util/command-interest-generator.hpp"
 #include "impl/delayed-call-table.hpp"
 #include "impl/interest-filter-table.hpp"
+#include "impl/metrics-recorder.hpp"
+#include "impl/nonce-pool.hpp"
 #include "impl/pending-interest-table.hpp"
+#include "impl/data-cache.hpp"
 #include "impl/registered-prefix-table.hpp"
+#include "lp/lp-reassembler.hpp"
+#include "util/dynamic-uint8-vector.hpp"
 #include "encoding/element-listener.hpp"
 
 struct ndn_Interest;
@@ -81,6 +86,10 @@ public:
    * @param wireFormat A WireFormat object used to encode the message.
    * @param face The face which has the callLater method, used for interest
    * timeouts. The callLater method may be overridden in a subclass of Face.
+   * @param useInterestNonce (optional) If true, interestCopy already has a new
+   * nonce (and usually a default wire encoding from
+   * expressInterestFromTemplate), so don't replace the nonce. If omitted, set a
+   * new nonce.
    * @throws runtime_error If the encoded interest size exceeds
    * getMaxNdnPacketSize().
    */
@@ -89,19 +98,42 @@ public:
     (uint64_t pendingInterestId,
      const ptr_lib::shared_ptr<const Interest>& interestCopy,
      const OnData& onData, const OnTimeout& onTimeout, 
-     const OnNetworkNack& onNetworkNack, WireFormat& wireFormat, Face* face);
+     const OnNetworkNack& onNetworkNack, WireFormat& wireFormat, Face* face,
+     bool useInterestNonce = false);
+
+  /**
+   * Make an Interest from the interestTemplate with a nonce from this Node's
+   * nonce pool and express it as in expressInterest.
+   * @param pendingInterestId The getNextEntryId() for the pending interest ID
+   * which Face got so it could return it to the caller.
+   * @param interestTemplate The InterestTemplate, whose getWireFormat() is
+   * used to encode.
+   * @param finalComponent The name component to append to the prefix.
+   * @param onData See expressInterest.
+   * @param onTimeout See expressInterest.
+   * @param onNetworkNack See expressInterest.
+   * @param face The face which has the callLater method, used for interest
+   * timeouts.
+   * @throws runtime_error If the encoded interest size exceeds
+   * getMaxNdnPacketSize().
+   */
+  void
+  expressInterestFromTemplate
+    (uint64_t pendingInterestId, const InterestTemplate& interestTemplate,
+     const Name::Component& finalComponent, const OnData& onData,
+     const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack,
+     Face* face);
 
   /**
    * Remove the pending interest entry with the pendingInterestId from the pending interest table.
    * This does not affect another pending interest with a different pendingInterestId, even if it has the same interest name.
    * If there is no entry with the pendingInterestId, do nothing.
+   * If Interest aggregation is enabled and the removed Interest was sent, this
+   * sends an equivalent aggregated Interest in its place.
    * @param pendingInterestId The ID returned from expressInterest.
    */
   void
-  removePendingInterest(uint64_t pendingInterestId)
-  {
-    pendingInterestTable_.removePendingInterest(pendingInterestId);
-  }
+  removePendingInterest(uint64_t pendingInterestId);
 
   /**
    * Append a timestamp component and a random value component to interest's
@@ -311,6 +343,58 @@ public:
   uint64_t
   getNextEntryId();
 
+  /**
+   * Enable or disable recording metrics. See Face::setMetricsEnabled.
+   * @param enabled True to enable recording.
+   */
+  void
+  setMetricsEnabled(bool enabled) { metrics_.setIsEnabled(enabled); }
+
+  bool
+  getMetricsEnabled() const { return metrics_.getIsEnabled(); }
+
+  /**
+   * Copy the current metrics to the snapshot. This is thread safe.
+   * @param metrics The FaceMetrics to receive the values.
+   */
+  void
+  getMetrics(FaceMetrics& metrics) const { metrics_.get(metrics); }
+
+  void
+  resetMetrics() { metrics_.reset(); }
+
+  /**
+   * Enable or disable lazy decoding of incoming packets. See
+   * Face::setLazyDecoding.
+   * @param enabled True to enable lazy decoding.
+   */
+  void
+  setLazyDecoding(bool enabled) { isLazyDecoding_ = enabled; }
+
+  bool
+  getLazyDecoding() const { return isLazyDecoding_; }
+
+  /**
+   * Enable or disable Interest aggregation. See Face::setInterestAggregation.
+   * @param enabled True to enable Interest aggregation.
+   */
+  void
+  setInterestAggregation(bool enabled) { isInterestAggregation_ = enabled; }
+
+  bool
+  getInterestAggregation() const { return isInterestAggregation_; }
+
+  /**
+   * Set the maximum number of received Data packets to cache. See
+   * Face::setDataCacheCapacity.
+   * @param capacity The maximum number of Data packets, or 0 to disable.
+   */
+  void
+  setDataCacheCapacity(size_t capacity) { dataCache_.setCapacity(capacity); }
+
+  size_t
+  getDataCacheCapacity() const { return dataCache_.getCapacity(); }
+
 private:
   enum ConnectStatus {
     ConnectStatus_UNCONNECTED = 1,
@@ -318,6 +402,27 @@ private:
     ConnectStatus_CONNECT_COMPLETE = 3
   };
 
+  /**
+   * An InterestTimeout is the callback given to callLater for a pending
+   * interest. It holds the pendingInterestId instead of a shared_ptr to the PIT
+   * entry so that it is small and trivially copyable, which lets Face::Callback
+   * store it without a heap allocation.
+   */
+  class InterestTimeout {
+  public:
+    InterestTimeout(Node* node, uint64_t pendingInterestId)
+    : node_(node), pendingInterestId_(pendingInterestId)
+    {
+    }
+
+    void
+    operator()() const { node_->processInterestTimeout(pendingInterestId_); }
+
+  private:
+    Node* node_;
+    uint64_t pendingInterestId_;
+  };
+
   /**
    * A RegisterResponse receives the response Data packet from the register
    * prefix interest sent to the connected NDN hub.  If this gets a bad response
@@ -411,14 +516,80 @@ private:
      const OnData& onData, const OnTimeout& onTimeout, 
      const OnNetworkNack& onNetworkNack, WireFormat* wireFormat, Face* face);
 
+  /**
+   * Do the work of onReceivedElement to decode the element and call the
+   * callbacks for the Interest, Data or network Nack.
+   * @param element The encoded element.
+   * @param elementLength The length of element.
+   */
+  void
+  processReceivedElement(const uint8_t *element, size_t elementLength);
+
+  /**
+   * Call packet.finishLazyDecode() for a packet from wireDecodeLazy. If it
+   * throws an exception, record a decode error and rethrow.
+   * @param packet The Interest or Data.
+   */
+  template<class Packet> void
+  finishLazyDecode(Packet& packet)
+  {
+    try {
+      packet.finishLazyDecode();
+    } catch (...) {
+      if (metrics_.getIsEnabled())
+        metrics_.recordDecodeError();
+      throw;
+    }
+  }
+
   /**
    * This is used in callLater for when the pending interest expires. If the
-   * pendingInterest is still in the pendingInterestTable_, remove it and call
+   * pending interest is still in the pendingInterestTable_, remove it and call
    * its onTimeout callback.
-   * @param pendingInterest The pending interest to check.
+   * @param pendingInterestId The ID of the pending interest to check.
+   */
+  void
+  processInterestTimeout(uint64_t pendingInterestId);
+
+  /**
+   * Encode the interest in TLV 0.2 into interestEncodingBuffer_, which is
+   * reused for each interest. The caller must send the encoding before the
+   * next call.
+   * @param interest The Interest to encode.
+   * @param wireFormat The TLV 0.2 wire format, used to encode the link object.
+   * @return The length of the encoding in interestEncodingBuffer_.
+   */
+  size_t
+  encodeInterestToBuffer(const Interest& interest, WireFormat& wireFormat);
+
+  /**
+   * This is used in callLater when expressInterest finds a matching Data in
+   * dataCache_. If the pending interest is still in the pendingInterestTable_,
+   * remove it and call its onData callback.
+   * @param pendingInterestId The pendingInterestId of the entry.
+   * @param data The Data from dataCache_.
+   */
+  void
+  satisfyFromDataCache
+    (uint64_t pendingInterestId, const ptr_lib::shared_ptr<Data>& data);
+
+  /**
+   * Encode the interest and send it to the transport, unless its name matches
+   * timeoutPrefix_.
+   * @param interest The Interest to send.
+   * @param wireFormat The wire format for encoding the interest.
+   */
+  void
+  sendInterest(const Interest& interest, WireFormat& wireFormat);
+
+  /**
+   * Send the unsent Interest which is equivalent to the given interest and has
+   * the latest timeout, if there is one. This is called when the sent Interest
+   * which the others were aggregated with is no longer pending.
+   * @param interest The Interest which is no longer pending.
    */
   void
-  processInterestTimeout(ptr_lib::shared_ptr<PendingInterestTable::Entry> pendingInterest);
+  sendAggregatedInterest(const Interest& interest);
 
   /**
    * Do the work of registerPrefix to register with NFD.
@@ -455,11 +626,17 @@ private:
   RegisteredPrefixTable registeredPrefixTable_;
   InterestFilterTable interestFilterTable_;
   DelayedCallTable delayedCallTable_;
+  LpReassembler lpReassembler_;
   std::vector<Face::Callback> onConnectedCallbacks_;
   CommandInterestGenerator commandInterestGenerator_;
   Name timeoutPrefix_;
   ConnectStatus connectStatus_;
-  Blob nonceTemplate_;
+  NoncePool noncePool_;
+  DynamicUInt8Vector interestEncodingBuffer_;
+  MetricsRecorder metrics_;
+  DataCache dataCache_;
+  bool isLazyDecoding_;
+  bool isInterestAggregation_;
 #ifdef NDN_CPP_HAVE_BOOST_ASIO
   // ThreadsafeFace accesses lastEntryId_ outside of a thread safe dispatch, so
   // use atomic_uint64_t to be thread safe.
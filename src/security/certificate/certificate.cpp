@@ -24,6 +24,7 @@
 #include <float.h>
 #include <ndn-cpp/sha256-with-rsa-signature.hpp>
 #include "../../encoding/der/der-node.hpp"
+#include "../../encoding/der/der-reader.hpp"
 #include "../../encoding/base64.hpp"
 #include "../../c/util/time.h"
 #include <ndn-cpp/security/certificate/certificate.hpp>
@@ -129,54 +130,51 @@ Certificate::toDer()
 void
 Certificate::decode()
 {
-  ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse(getContent());
-
+  // Read the elements in place instead of making a tree of DerNode objects.
   // We need to ensure that there are:
   //   validity (notBefore, notAfter)
   //   subject list
   //   public key
   //   (optional) extension list
 
-  const std::vector<ptr_lib::shared_ptr<DerNode> >& rootChildren =
-    parsedNode->getChildren();
+  DerReader root = DerReader(getContent()).readSequence();
   // 1st: validity info
-  const std::vector<ptr_lib::shared_ptr<DerNode> >& validityChildren =
-    DerNode::getSequence(rootChildren, 0).getChildren();
-  notBefore_ = dynamic_cast<DerGeneralizedTime&>
-    (*validityChildren[0]).toMillisecondsSince1970();
-  notAfter_ = dynamic_cast<DerGeneralizedTime&>
-    (*validityChildren[1]).toMillisecondsSince1970();
+  DerReader validity = root.readSequence();
+  notBefore_ = DerReader::toMillisecondsSince1970
+    (validity.read(DerNodeType_GeneralizedTime));
+  notAfter_ = DerReader::toMillisecondsSince1970
+    (validity.read(DerNodeType_GeneralizedTime));
 
   // 2nd: subjectList
-  const std::vector<ptr_lib::shared_ptr<DerNode> >& subjectChildren =
-    DerNode::getSequence(rootChildren, 1).getChildren();
-  for (size_t i = 0; i < subjectChildren.size(); ++i) {
-    DerSequence& sd = DerNode::getSequence(subjectChildren, i);
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& descriptionChildren =
-      sd.getChildren();
-    string oidStr = descriptionChildren[0]->toVal().toRawStr();
-    string value = descriptionChildren[1]->toVal().toRawStr();
-
-    addSubjectDescription(CertificateSubjectDescription(oidStr, value));
+  DerReader subjectList = root.readSequence();
+  while (!subjectList.atEnd()) {
+    DerReader description = subjectList.readSequence();
+    string oidStr = DerReader::toOidString
+      (description.read(DerNodeType_ObjectIdentifier));
+    DerNodeType type;
+    BlobLite value = description.readAny(type);
+
+    addSubjectDescription(CertificateSubjectDescription
+      (oidStr, string((const char*)value.buf(), value.size())));
   }
 
   // 3rd: public key
-  Blob publicKeyInfo = rootChildren[2]->encode();
-  ptr_lib::shared_ptr<PublicKey> tempPublicKey(new PublicKey(publicKeyInfo));
-  key_ = *tempPublicKey;
-
-  if (rootChildren.size() > 3) {
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& extensionChildren =
-      DerNode::getSequence(rootChildren, 3).getChildren();
-    for (size_t i = 0; i < extensionChildren.size(); ++i) {
-      DerSequence& extInfo = DerNode::getSequence(extensionChildren, i);
-
-      const std::vector<ptr_lib::shared_ptr<DerNode> >& children =
-        extInfo.getChildren();
-      string oidStr = children[0]->toVal().toRawStr();
-      bool isCritical = children[1]->toVal().buf()[0] != 0;
-      Blob value = children[2]->toVal();
-      addExtension(CertificateExtension(oidStr, isCritical, value));
+  BlobLite publicKeyInfo = root.readEncoding();
+  key_ = PublicKey(Blob(publicKeyInfo.buf(), publicKeyInfo.size()));
+
+  if (!root.atEnd()) {
+    DerReader extensionList = root.readSequence();
+    while (!extensionList.atEnd()) {
+      DerReader extInfo = extensionList.readSequence();
+
+      string oidStr = DerReader::toOidString
+        (extInfo.read(DerNodeType_ObjectIdentifier));
+      DerNodeType type;
+      BlobLite critical = extInfo.readAny(type);
+      bool isCritical = critical.size() > 0 && critical.buf()[0] != 0;
+      BlobLite value = extInfo.readAny(type);
+      addExtension(CertificateExtension
+        (oidStr, isCritical, Blob(value.buf(), value.size())));
     }
   }
 }
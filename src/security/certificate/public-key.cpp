@@ -24,6 +24,7 @@
 #include "../../c/util/crypto.h"
 #include "../../encoding/der/der-node.hpp"
 #include "../../encoding/der/der-exception.hpp"
+#include "../../encoding/der/der-reader.hpp"
 #include <ndn-cpp/lite/util/crypto-lite.hpp>
 #include <ndn-cpp/lite/security/ec-public-key-lite.hpp>
 #include <ndn-cpp/lite/security/rsa-public-key-lite.hpp>
@@ -43,14 +44,12 @@ PublicKey::PublicKey(const Blob& keyDer)
   keyDer_ = keyDer;
 
   // Get the public key OID.
-  string oidString;
+  bool isRsa, isEc;
   try {
-    ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse(keyDer);
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& rootChildren =
-      parsedNode->getChildren();
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& algorithmIdChildren =
-      DerNode::getSequence(rootChildren, 0).getChildren();
-    oidString = algorithmIdChildren[0]->toVal().toRawStr();
+    DerReader algorithmId = DerReader(keyDer).readSequence().readSequence();
+    BlobLite oid = algorithmId.read(DerNodeType_ObjectIdentifier);
+    isRsa = DerReader::oidEquals(oid, RSA_ENCRYPTION_OID);
+    isEc = DerReader::oidEquals(oid, EC_ENCRYPTION_OID);
   }
   catch (DerDecodingException& ex) {
     throw UnrecognizedKeyFormatException
@@ -60,14 +59,14 @@ PublicKey::PublicKey(const Blob& keyDer)
   // Verify that the we can decode.
   // Use a temporary pointer since d2i updates it.
 #if NDN_CPP_HAVE_LIBCRYPTO
-  if (oidString == RSA_ENCRYPTION_OID) {
+  if (isRsa) {
     keyType_ = KEY_TYPE_RSA;
 
     RsaPublicKeyLite publicKey;
     if (publicKey.decode(keyDer) != NDN_ERROR_success)
       throw UnrecognizedKeyFormatException("Error decoding RSA public key DER");
   }
-  else if (oidString == EC_ENCRYPTION_OID) {
+  else if (isEc) {
     keyType_ = KEY_TYPE_EC;
 
     EcPublicKeyLite publicKey;
@@ -37,6 +37,7 @@
 #include <ndn-cpp/key-locator.hpp>
 #include <ndn-cpp/security/certificate/identity-certificate.hpp>
 #include <ndn-cpp/security/identity/basic-identity-storage.hpp>
+#include "../../util/sqlite3-statement.hpp"
 
 INIT_LOGGER("ndn.BasicIdentityStorage");
 
@@ -109,6 +110,22 @@ static int sqlite3_bind_text(sqlite3_stmt* statement, int index, const string& v
   return sqlite3_bind_text(statement, index, value.c_str(), value.size(), destructor);
 }
 
+/**
+ * Check if the table exists in the database.
+ * @param statementCache The Sqlite3StatementCache of the database.
+ * @param tableName The name of the table.
+ * @return True if the table exists.
+ */
+static bool
+doesTableExist(Sqlite3StatementCache& statementCache, const string& tableName)
+{
+  Sqlite3Statement statement
+    (statementCache,
+     "SELECT name FROM sqlite_master WHERE type='table' And name=?");
+  sqlite3_bind_text(statement, 1, tableName, SQLITE_TRANSIENT);
+  return sqlite3_step(statement) == SQLITE_ROW;
+}
+
 BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
 {
   int res;
@@ -126,16 +143,12 @@ BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
   if (res != SQLITE_OK)
     throw SecurityException("identity DB cannot be opened/created");
 
-  // Check if TpmInfo table exists.
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT name FROM sqlite_master WHERE type='table' And name='TpmInfo'", -1, &statement, 0);
-  res = sqlite3_step(statement);
+  statementCache_.reset(new Sqlite3StatementCache
+    (database_, &Sqlite3StatementCache::throwError<SecurityException>));
 
-  bool tpmInfoTableExists = false;
-  if (res == SQLITE_ROW)
-    tpmInfoTableExists = true;
+  // Check if TpmInfo table exists.
+  bool tpmInfoTableExists = doesTableExist(*statementCache_, "TpmInfo");
 
-  sqlite3_finalize(statement);
 
   if (!tpmInfoTableExists) {
     char *errorMessage = 0;
@@ -148,14 +161,8 @@ BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
   }
 
   //Check if ID table exists.
-  sqlite3_prepare_v2(database_, "SELECT name FROM sqlite_master WHERE type='table' And name='Identity'", -1, &statement, 0);
-  res = sqlite3_step(statement);
-
-  bool idTableExists = false;
-  if (res == SQLITE_ROW)
-    idTableExists = true;
+  bool idTableExists = doesTableExist(*statementCache_, "Identity");
 
-  sqlite3_finalize(statement);
 
   if (!idTableExists) {
     char *errorMessage = 0;
@@ -168,14 +175,8 @@ BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
   }
 
   //Check if Key table exists;
-  sqlite3_prepare_v2(database_, "SELECT name FROM sqlite_master WHERE type='table' And name='Key'", -1, &statement, 0);
-  res = sqlite3_step(statement);
-
-  bool keyTableExists = false;
-  if (res == SQLITE_ROW)
-    keyTableExists = true;
+  bool keyTableExists = doesTableExist(*statementCache_, "Key");
 
-  sqlite3_finalize(statement);
 
   if (!keyTableExists) {
     char *errorMessage = 0;
@@ -188,14 +189,8 @@ BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
   }
 
   //Check if Certificate table exists;
-  sqlite3_prepare_v2(database_, "SELECT name FROM sqlite_master WHERE type='table' And name='Certificate'", -1, &statement, 0);
-  res = sqlite3_step(statement);
+  bool idCertificateTableExists = doesTableExist(*statementCache_, "Certificate");
 
-  bool idCertificateTableExists = false;
-  if (res == SQLITE_ROW)
-    idCertificateTableExists = true;
-
-  sqlite3_finalize(statement);
 
   if (!idCertificateTableExists) {
     char *errorMessage = 0;
@@ -210,6 +205,24 @@ BasicIdentityStorage::BasicIdentityStorage(const std::string& databaseFilePath)
 
 BasicIdentityStorage::~BasicIdentityStorage()
 {
+  // Finalize the cached statements so that the database can be closed.
+  statementCache_.reset();
+  sqlite3_close(database_);
+}
+
+void
+BasicIdentityStorage::beginTransaction() { statementCache_->beginTransaction(); }
+
+void
+BasicIdentityStorage::commitTransaction() { statementCache_->commitTransaction(); }
+
+void
+BasicIdentityStorage::rollbackTransaction() { statementCache_->rollbackTransaction(); }
+
+void
+BasicIdentityStorage::enableWriteAheadLogging(const string& synchronous)
+{
+  statementCache_->enableWriteAheadLogging(synchronous);
 }
 
 bool
@@ -217,8 +230,8 @@ BasicIdentityStorage::doesIdentityExist(const Name& identityName)
 {
   bool result = false;
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT count(*) FROM Identity WHERE identity_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT count(*) FROM Identity WHERE identity_name=?");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
   int res = sqlite3_step(statement);
@@ -229,7 +242,6 @@ BasicIdentityStorage::doesIdentityExist(const Name& identityName)
       result = true;
   }
 
-  sqlite3_finalize(statement);
 
   return result;
 }
@@ -240,15 +252,12 @@ BasicIdentityStorage::addIdentity(const Name& identityName)
   if (doesIdentityExist(identityName))
     return;
 
-  sqlite3_stmt *statement;
-
-  sqlite3_prepare_v2(database_, "INSERT INTO Identity (identity_name) values (?)", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "INSERT INTO Identity (identity_name) values (?)");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
 
   int res = sqlite3_step(statement);
-
-  sqlite3_finalize(statement);
 }
 
 bool
@@ -264,8 +273,8 @@ BasicIdentityStorage::doesKeyExist(const Name& keyName)
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT count(*) FROM Key WHERE identity_name=? AND key_identifier=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT count(*) FROM Key WHERE identity_name=? AND key_identifier=?");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
@@ -279,7 +288,6 @@ BasicIdentityStorage::doesKeyExist(const Name& keyName)
       keyIdExists = true;
   }
 
-  sqlite3_finalize(statement);
 
   return keyIdExists;
 }
@@ -298,8 +306,8 @@ BasicIdentityStorage::addKey(const Name& keyName, KeyType keyType, const Blob& p
 
   addIdentity(identityName);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "INSERT INTO Key (identity_name, key_identifier, key_type, public_key) values (?, ?, ?, ?)", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "INSERT INTO Key (identity_name, key_identifier, key_type, public_key) values (?, ?, ?, ?)");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
@@ -307,8 +315,6 @@ BasicIdentityStorage::addKey(const Name& keyName, KeyType keyType, const Blob& p
   sqlite3_bind_blob(statement, 4, publicKeyDer.buf(), publicKeyDer.size(), SQLITE_TRANSIENT);
 
   sqlite3_step(statement);
-
-  sqlite3_finalize(statement);
 }
 
 Blob
@@ -320,8 +326,8 @@ BasicIdentityStorage::getKey(const Name& keyName)
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT public_key FROM Key WHERE identity_name=? AND key_identifier=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT public_key FROM Key WHERE identity_name=? AND key_identifier=?");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
@@ -332,7 +338,6 @@ BasicIdentityStorage::getKey(const Name& keyName)
     Blob result = Blob
       (static_cast<const uint8_t*>(sqlite3_column_blob(statement, 0)),
        sqlite3_column_bytes(statement, 0));
-    sqlite3_finalize(statement);
     return result;
   }
   else
@@ -357,23 +362,21 @@ BasicIdentityStorage::updateKeyStatus(const Name& keyName, bool isActive)
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "UPDATE Key SET active=? WHERE identity_name=? AND key_identifier=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "UPDATE Key SET active=? WHERE identity_name=? AND key_identifier=?");
 
   sqlite3_bind_int(statement, 1, (isActive ? 1 : 0));
   sqlite3_bind_text(statement, 2, identityName.toUri(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 3, keyId, SQLITE_TRANSIENT);
 
   int res = sqlite3_step(statement);
-
-  sqlite3_finalize(statement);
 }
 
 bool
 BasicIdentityStorage::doesCertificateExist(const Name& certificateName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT count(*) FROM Certificate WHERE cert_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT count(*) FROM Certificate WHERE cert_name=?");
 
   sqlite3_bind_text(statement, 1, certificateName.toUri(), SQLITE_TRANSIENT);
 
@@ -386,7 +389,6 @@ BasicIdentityStorage::doesCertificateExist(const Name& certificateName)
       certExists = true;
   }
 
-  sqlite3_finalize(statement);
 
   return certExists;
 }
@@ -407,11 +409,9 @@ BasicIdentityStorage::addCertificate(const IdentityCertificate& certificate)
   Name identity = keyName.getPrefix(-1);
 
   // Insert the certificate
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_,
-                      "INSERT INTO Certificate (cert_name, cert_issuer, identity_name, key_identifier, not_before, not_after, certificate_data)\
-                       values (?, ?, ?, ?, datetime(?, 'unixepoch'), datetime(?, 'unixepoch'), ?)",
-                      -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "INSERT INTO Certificate (cert_name, cert_issuer, identity_name, key_identifier, not_before, not_after, certificate_data)\
+                       values (?, ?, ?, ?, datetime(?, 'unixepoch'), datetime(?, 'unixepoch'), ?)");
 
   sqlite3_bind_text(statement, 1, certificateName.toUri(), SQLITE_TRANSIENT);
 
@@ -429,16 +429,13 @@ BasicIdentityStorage::addCertificate(const IdentityCertificate& certificate)
   sqlite3_bind_blob(statement, 7, certificate.wireEncode().buf(), certificate.wireEncode().size(), SQLITE_TRANSIENT);
 
   int res = sqlite3_step(statement);
-
-  sqlite3_finalize(statement);
 }
 
 ptr_lib::shared_ptr<IdentityCertificate>
 BasicIdentityStorage::getCertificate(const Name &certificateName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_,
-                      "SELECT certificate_data FROM Certificate WHERE cert_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT certificate_data FROM Certificate WHERE cert_name=?");
   sqlite3_bind_text(statement, 1, certificateName.toUri(), SQLITE_TRANSIENT);
 
   int res = sqlite3_step(statement);
@@ -450,27 +447,22 @@ BasicIdentityStorage::getCertificate(const Name &certificateName)
         (Blob((const uint8_t*)sqlite3_column_blob(statement, 0),
               sqlite3_column_bytes(statement, 0)));
     } catch (...) {
-      sqlite3_finalize(statement);
       throw SecurityException
         ("BasicIdentityStorage::getCertificate: The certificate cannot be decoded");
     }
 
-    sqlite3_finalize(statement);
     return certificate;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw SecurityException
       ("BasicIdentityStorage::getCertificate: The certificate does not exist");
-  }
 }
 
 string
 BasicIdentityStorage::getTpmLocator()
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "SELECT tpm_locator FROM TpmInfo", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT tpm_locator FROM TpmInfo");
 
   int res = sqlite3_step(statement);
 
@@ -478,21 +470,18 @@ BasicIdentityStorage::getTpmLocator()
     string tpmLocator
       (reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)),
        sqlite3_column_bytes(statement, 0));
-    sqlite3_finalize(statement);
     return tpmLocator;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw SecurityException
       ("BasicIdentityStorage::getTpmLocator: TPM info does not exist");
-  }
 }
 
 Name
 BasicIdentityStorage::getDefaultIdentity()
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT identity_name FROM Identity WHERE default_identity=1", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT identity_name FROM Identity WHERE default_identity=1");
 
   int res = sqlite3_step(statement);
 
@@ -500,21 +489,18 @@ BasicIdentityStorage::getDefaultIdentity()
 
   if (res == SQLITE_ROW) {
     identity = Name(string(reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)), sqlite3_column_bytes(statement, 0)));
-    sqlite3_finalize(statement);
     return identity;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw SecurityException
       ("BasicIdentityStorage::getDefaultIdentity: The default identity is not defined");
-  }
 }
 
 Name
 BasicIdentityStorage::getDefaultKeyNameForIdentity(const Name& identityName)
 {
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT key_identifier FROM Key WHERE identity_name=? AND default_key=1", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT key_identifier FROM Key WHERE identity_name=? AND default_key=1");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
 
@@ -524,14 +510,11 @@ BasicIdentityStorage::getDefaultKeyNameForIdentity(const Name& identityName)
 
   if (res == SQLITE_ROW) {
     keyName = Name(identityName).append(string(reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)), sqlite3_column_bytes(statement, 0)));
-    sqlite3_finalize(statement);
     return keyName;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw SecurityException
       ("BasicIdentityStorage::getDefaultKeyNameForIdentity: The default key for the identity is not defined");
-  }
 }
 
 Name
@@ -540,8 +523,8 @@ BasicIdentityStorage::getDefaultCertificateNameForKey(const Name& keyName)
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2(database_, "SELECT cert_name FROM Certificate WHERE identity_name=? AND key_identifier=? AND default_cert=1", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "SELECT cert_name FROM Certificate WHERE identity_name=? AND key_identifier=? AND default_cert=1");
 
   sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
   sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
@@ -552,31 +535,20 @@ BasicIdentityStorage::getDefaultCertificateNameForKey(const Name& keyName)
 
   if (res == SQLITE_ROW) {
     certName = Name(string(reinterpret_cast<const char *>(sqlite3_column_text(statement, 0)), sqlite3_column_bytes(statement, 0)));
-    sqlite3_finalize(statement);
     return certName;
   }
-  else {
-    sqlite3_finalize(statement);
+  else
     throw SecurityException
       ("BasicIdentityStorage::getDefaultCertificateNameForKey: The default certificate for the key name is not defined");
-  }
 }
 
 void
 BasicIdentityStorage::getAllIdentities(vector<Name>& nameList, bool isDefault)
 {
-  sqlite3_stmt* statement;
-
-  if (isDefault)
-    sqlite3_prepare_v2
-      (database_,
-       "SELECT identity_name FROM Identity WHERE default_identity=1",
-       -1, &statement, 0);
-  else
-    sqlite3_prepare_v2
-      (database_,
-       "SELECT identity_name FROM Identity WHERE default_identity=0",
-       -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, isDefault
+     ? "SELECT identity_name FROM Identity WHERE default_identity=1"
+     : "SELECT identity_name FROM Identity WHERE default_identity=0");
 
   while (sqlite3_step(statement) == SQLITE_ROW) {
     Name identityName
@@ -584,30 +556,19 @@ BasicIdentityStorage::getAllIdentities(vector<Name>& nameList, bool isDefault)
        sqlite3_column_bytes(statement, 0)));
     nameList.push_back(identityName);
   }
-
-  sqlite3_finalize(statement);
 }
 
 void
 BasicIdentityStorage::getAllKeyNamesOfIdentity
   (const Name& identityName, vector<Name>& nameList, bool isDefault)
 {
-  sqlite3_stmt* statement;
-
-  if (isDefault)
-    sqlite3_prepare_v2
-      (database_,
-       "SELECT key_identifier FROM Key WHERE default_key=1 and identity_name=?",
-       -1, &statement, 0);
-  else
-    sqlite3_prepare_v2
-      (database_,
-       "SELECT key_identifier FROM Key WHERE default_key=0 and identity_name=?",
-       -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, isDefault
+     ? "SELECT key_identifier FROM Key WHERE default_key=1 and identity_name=?"
+     : "SELECT key_identifier FROM Key WHERE default_key=0 and identity_name=?");
 
   string identityUri = identityName.toUri();
-  sqlite3_bind_text
-    (statement, 1, identityUri.c_str(), identityUri.size(), SQLITE_TRANSIENT);
+  sqlite3_bind_text(statement, 1, identityUri, SQLITE_TRANSIENT);
 
   while (sqlite3_step(statement) == SQLITE_ROW) {
     Name keyName(identityName);
@@ -616,8 +577,6 @@ BasicIdentityStorage::getAllKeyNamesOfIdentity
        sqlite3_column_bytes(statement, 0)));
     nameList.push_back(keyName);
   }
-
-  sqlite3_finalize(statement);
 }
 
 void
@@ -627,28 +586,18 @@ BasicIdentityStorage::getAllCertificateNamesOfKey
   if (keyName.size() == 0)
     return;
 
-  sqlite3_stmt* statement;
-
-  if (isDefault)
-    sqlite3_prepare_v2
-      (database_,
-        "SELECT cert_name FROM Certificate \
-         WHERE default_cert=1 and identity_name=? and key_identifier=?",
-       -1, &statement, 0);
-  else
-    sqlite3_prepare_v2
-      (database_,
-       "SELECT cert_name FROM Certificate \
-        WHERE default_cert=0 and identity_name=? and key_identifier=?",
-       -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, isDefault
+     ? "SELECT cert_name FROM Certificate \
+         WHERE default_cert=1 and identity_name=? and key_identifier=?"
+     : "SELECT cert_name FROM Certificate \
+        WHERE default_cert=0 and identity_name=? and key_identifier=?");
 
   string identityUri = keyName.getPrefix(-1).toUri();
-  sqlite3_bind_text
-    (statement, 1, identityUri.c_str(), identityUri.size(), SQLITE_TRANSIENT);
+  sqlite3_bind_text(statement, 1, identityUri, SQLITE_TRANSIENT);
 
   string baseKeyNameUri = keyName.get(-1).toEscapedString();
-  sqlite3_bind_text
-    (statement, 2, baseKeyNameUri.c_str(), baseKeyNameUri.size(), SQLITE_TRANSIENT);
+  sqlite3_bind_text(statement, 2, baseKeyNameUri, SQLITE_TRANSIENT);
 
   while (sqlite3_step(statement) == SQLITE_ROW) {
     Name keyName
@@ -656,31 +605,35 @@ BasicIdentityStorage::getAllCertificateNamesOfKey
        sqlite3_column_bytes(statement, 0)));
     nameList.push_back(keyName);
   }
-
-  sqlite3_finalize(statement);
 }
 
 void
 BasicIdentityStorage::setDefaultIdentity(const Name& identityName)
 {
-  sqlite3_stmt *statement;
+  Sqlite3Transaction transaction(*statementCache_);
 
-  // Reset the previous default identity.
-  sqlite3_prepare_v2(database_, "UPDATE Identity SET default_identity=0 WHERE default_identity=1", -1, &statement, 0);
+  {
+    // Reset the previous default identity.
+    Sqlite3Statement statement
+      (*statementCache_,
+       "UPDATE Identity SET default_identity=0 WHERE default_identity=1");
 
-  while (sqlite3_step(statement) == SQLITE_ROW)
-    {}
-
-  sqlite3_finalize(statement);
+    while (sqlite3_step(statement) == SQLITE_ROW)
+      {}
+  }
 
-  // Set the current default identity.
-  sqlite3_prepare_v2(database_, "UPDATE Identity SET default_identity=1 WHERE identity_name=?", -1, &statement, 0);
+  {
+    // Set the current default identity.
+    Sqlite3Statement statement
+      (*statementCache_,
+       "UPDATE Identity SET default_identity=1 WHERE identity_name=?");
 
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
 
-  sqlite3_step(statement);
+    sqlite3_step(statement);
+  }
 
-  sqlite3_finalize(statement);
+  transaction.commit();
 }
 
 void
@@ -692,27 +645,33 @@ BasicIdentityStorage::setDefaultKeyNameForIdentity(const Name& keyName, const Na
   if (identityNameCheck.size() > 0 && !identityNameCheck.equals(identityName))
     throw SecurityException("Specified identity name does not match the key name");
 
-  sqlite3_stmt *statement;
+  Sqlite3Transaction transaction(*statementCache_);
 
-  // Reset the previous default Key.
-  sqlite3_prepare_v2(database_, "UPDATE Key SET default_key=0 WHERE default_key=1 and identity_name=?", -1, &statement, 0);
+  {
+    // Reset the previous default Key.
+    Sqlite3Statement statement
+      (*statementCache_,
+       "UPDATE Key SET default_key=0 WHERE default_key=1 and identity_name=?");
 
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
 
-  while (sqlite3_step(statement) == SQLITE_ROW)
-    {}
+    while (sqlite3_step(statement) == SQLITE_ROW)
+      {}
+  }
 
-  sqlite3_finalize(statement);
+  {
+    // Set the current default Key.
+    Sqlite3Statement statement
+      (*statementCache_,
+       "UPDATE Key SET default_key=1 WHERE identity_name=? AND key_identifier=?");
 
-  // Set the current default Key.
-  sqlite3_prepare_v2(database_, "UPDATE Key SET default_key=1 WHERE identity_name=? AND key_identifier=?", -1, &statement, 0);
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
 
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
-
-  sqlite3_step(statement);
+    sqlite3_step(statement);
+  }
 
-  sqlite3_finalize(statement);
+  transaction.commit();
 }
 
 void
@@ -721,29 +680,33 @@ BasicIdentityStorage::setDefaultCertificateNameForKey(const Name& keyName, const
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-
-  // Reset the previous default Certificate.
-  sqlite3_prepare_v2(database_, "UPDATE Certificate SET default_cert=0 WHERE default_cert=1 AND identity_name=? AND key_identifier=?", -1, &statement, 0);
+  Sqlite3Transaction transaction(*statementCache_);
 
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
+  {
+    // Reset the previous default Certificate.
+    Sqlite3Statement statement
+      (*statementCache_, "UPDATE Certificate SET default_cert=0 WHERE default_cert=1 AND identity_name=? AND key_identifier=?");
 
-  while (sqlite3_step(statement) == SQLITE_ROW)
-    {}
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
 
-  sqlite3_finalize(statement);
+    while (sqlite3_step(statement) == SQLITE_ROW)
+      {}
+  }
 
-  // Set the current default Certificate.
-  sqlite3_prepare_v2(database_, "UPDATE Certificate SET default_cert=1 WHERE identity_name=? AND key_identifier=? AND cert_name=?", -1, &statement, 0);
+  {
+    // Set the current default Certificate.
+    Sqlite3Statement statement
+      (*statementCache_, "UPDATE Certificate SET default_cert=1 WHERE identity_name=? AND key_identifier=? AND cert_name=?");
 
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 3, certificateName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 3, certificateName.toUri(), SQLITE_TRANSIENT);
 
-  sqlite3_step(statement);
+    sqlite3_step(statement);
+  }
 
-  sqlite3_finalize(statement);
+  transaction.commit();
 }
 
 void
@@ -752,12 +715,10 @@ BasicIdentityStorage::deleteCertificateInfo(const Name& certificateName)
   if (certificateName.size() == 0)
     return;
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM Certificate WHERE cert_name=?", -1, &statement, 0);
+  Sqlite3Statement statement
+    (*statementCache_, "DELETE FROM Certificate WHERE cert_name=?");
   sqlite3_bind_text(statement, 1, certificateName.toUri(), SQLITE_TRANSIENT);
   sqlite3_step(statement);
-  sqlite3_finalize(statement);
 }
 
 void
@@ -769,24 +730,27 @@ BasicIdentityStorage::deletePublicKeyInfo(const Name& keyName)
   string keyId = keyName.get(-1).toEscapedString();
   Name identityName = keyName.getPrefix(-1);
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_,
-     "DELETE FROM Certificate WHERE identity_name=? and key_identifier=?",
-     -1, &statement, 0);
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
-  sqlite3_step(statement);
-  sqlite3_finalize(statement);
+  Sqlite3Transaction transaction(*statementCache_);
 
-  sqlite3_prepare_v2
-    (database_,
-     "DELETE FROM Key WHERE identity_name=? and key_identifier=?",
-     -1, &statement, 0);
-  sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
-  sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
-  sqlite3_step(statement);
-  sqlite3_finalize(statement);
+  {
+    Sqlite3Statement statement
+      (*statementCache_,
+       "DELETE FROM Certificate WHERE identity_name=? and key_identifier=?");
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
+    sqlite3_step(statement);
+  }
+
+  {
+    Sqlite3Statement statement
+      (*statementCache_,
+       "DELETE FROM Key WHERE identity_name=? and key_identifier=?");
+    sqlite3_bind_text(statement, 1, identityName.toUri(), SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement, 2, keyId, SQLITE_TRANSIENT);
+    sqlite3_step(statement);
+  }
+
+  transaction.commit();
 }
 
 void
@@ -794,24 +758,30 @@ BasicIdentityStorage::deleteIdentityInfo(const Name& identityName)
 {
   string identity = identityName.toUri();
 
-  sqlite3_stmt *statement;
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM Certificate WHERE identity_name=?", -1, &statement, 0);
-  sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
-  sqlite3_step(statement);
-  sqlite3_finalize(statement);
+  Sqlite3Transaction transaction(*statementCache_);
 
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM Key WHERE identity_name=?", -1, &statement, 0);
-  sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
-  sqlite3_step(statement);
-  sqlite3_finalize(statement);
+  {
+    Sqlite3Statement statement
+      (*statementCache_, "DELETE FROM Certificate WHERE identity_name=?");
+    sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
+    sqlite3_step(statement);
+  }
 
-  sqlite3_prepare_v2
-    (database_, "DELETE FROM Identity WHERE identity_name=?", -1, &statement, 0);
-  sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
-  sqlite3_step(statement);
-  sqlite3_finalize(statement);
+  {
+    Sqlite3Statement statement
+      (*statementCache_, "DELETE FROM Key WHERE identity_name=?");
+    sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
+    sqlite3_step(statement);
+  }
+
+  {
+    Sqlite3Statement statement
+      (*statementCache_, "DELETE FROM Identity WHERE identity_name=?");
+    sqlite3_bind_text(statement, 1, identity, SQLITE_TRANSIENT);
+    sqlite3_step(statement);
+  }
+
+  transaction.commit();
 }
 
 string
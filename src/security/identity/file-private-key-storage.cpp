@@ -40,6 +40,7 @@ static const char *RSA_ENCRYPTION_OID = "1.2.840.113549.1.1.1";
 static const char *EC_ENCRYPTION_OID = "1.2.840.10045.2.1";
 
 FilePrivateKeyStorage::FilePrivateKeyStorage(const string& keyStoreDirectoryPath)
+: isPrivateKeyCacheEnabled_(false)
 {
   if (keyStoreDirectoryPath != "") {
     keyStorePath_ = keyStoreDirectoryPath;
@@ -101,6 +102,9 @@ FilePrivateKeyStorage::generateKeyPair
     ::chmod(publicKeyFilePath.c_str(),  S_IRUSR | S_IRGRP | S_IROTH);
     ::chmod(privateKeyFilePath.c_str(), S_IRUSR);
 #endif
+
+    if (isPrivateKeyCacheEnabled_)
+      privateKeyCache_[keyUri] = privateKey;
   } catch (TpmPrivateKey::Error& ex) {
     throw SecurityException(ex.what());
   }
@@ -111,6 +115,7 @@ FilePrivateKeyStorage::deleteKeyPair(const Name& keyName)
 {
   string keyUri = keyName.toUri();
 
+  privateKeyCache_.erase(keyUri);
   remove(nameTransform(keyUri, ".pub").c_str());
   remove(nameTransform(keyUri, ".pri").c_str());
 }
@@ -139,12 +144,31 @@ Blob
 FilePrivateKeyStorage::sign
   (const uint8_t *data, size_t dataLength, const Name& keyName,
    DigestAlgorithm digestAlgorithm)
+{
+  try {
+    return getPrivateKey(keyName)->sign(data, dataLength, digestAlgorithm);
+  } catch (TpmPrivateKey::Error& ex) {
+    throw SecurityException(ex.what());
+  }
+}
+
+ptr_lib::shared_ptr<TpmPrivateKey>
+FilePrivateKeyStorage::getPrivateKey(const Name& keyName)
 {
   string keyURI = keyName.toUri();
 
-  if (!doesKeyExist(keyName, KEY_CLASS_PRIVATE))
+  // Check the file even for a cached key in case another process deleted it.
+  // This is much cheaper than reading and decoding the file.
+  if (!doesKeyExist(keyName, KEY_CLASS_PRIVATE)) {
+    privateKeyCache_.erase(keyURI);
     throw SecurityException
       ("FilePrivateKeyStorage::sign: private key doesn't exist");
+  }
+
+  map<string, ptr_lib::shared_ptr<TpmPrivateKey> >::iterator cached =
+    privateKeyCache_.find(keyURI);
+  if (cached != privateKeyCache_.end())
+    return cached->second;
 
   // Read the private key.
   ifstream file(nameTransform(keyURI, ".pri").c_str());
@@ -153,13 +177,20 @@ FilePrivateKeyStorage::sign
   vector<uint8_t> pkcs8Der;
   fromBase64(base64.str(), pkcs8Der);
 
-  TpmPrivateKey privateKey;
-  try {
-    privateKey.loadPkcs8(&pkcs8Der.front(), pkcs8Der.size());
-    return privateKey.sign(data, dataLength, digestAlgorithm);
-  } catch (TpmPrivateKey::Error& ex) {
-    throw SecurityException(ex.what());
-  }
+  ptr_lib::shared_ptr<TpmPrivateKey> privateKey(new TpmPrivateKey());
+  privateKey->loadPkcs8(&pkcs8Der.front(), pkcs8Der.size());
+  if (isPrivateKeyCacheEnabled_)
+    privateKeyCache_[keyURI] = privateKey;
+
+  return privateKey;
+}
+
+void
+FilePrivateKeyStorage::setPrivateKeyCacheEnabled(bool isPrivateKeyCacheEnabled)
+{
+  isPrivateKeyCacheEnabled_ = isPrivateKeyCacheEnabled;
+  if (!isPrivateKeyCacheEnabled_)
+    privateKeyCache_.clear();
 }
 
 Blob
@@ -50,14 +50,15 @@ namespace ndn {
 IdentityManager::IdentityManager
   (const ptr_lib::shared_ptr<IdentityStorage>& identityStorage,
    const ptr_lib::shared_ptr<PrivateKeyStorage>& privateKeyStorage)
-: identityStorage_(identityStorage), privateKeyStorage_(privateKeyStorage)
+: identityStorage_(identityStorage), privateKeyStorage_(privateKeyStorage),
+  isSignatureCacheEnabled_(false)
 {
   // Don't call checkTpm() when using a custom PrivateKeyStorage.
 }
 
 IdentityManager::IdentityManager
   (const ptr_lib::shared_ptr<IdentityStorage>& identityStorage)
-: identityStorage_(identityStorage)
+: identityStorage_(identityStorage), isSignatureCacheEnabled_(false)
 {
   ConfigFile config;
   string canonicalTpmLocator;
@@ -67,6 +68,7 @@ IdentityManager::IdentityManager
 }
 
 IdentityManager::IdentityManager()
+: isSignatureCacheEnabled_(false)
 {
   ConfigFile config;
   identityStorage_ = getDefaultIdentityStorage(config);
@@ -208,6 +210,9 @@ IdentityManager::deleteIdentity(const Name& identityName)
 
   for (size_t i = 0; i < keysToDelete.size(); ++i)
     privateKeyStorage_->deleteKeyPair(keysToDelete[i]);
+
+  // A new key could be created with a deleted key name, so clear all.
+  signatureCache_.clear();
 }
 
 Name
@@ -216,6 +221,7 @@ IdentityManager::generateKeyPair
 {
   Name keyName = identityStorage_->getNewKeyName(identityName, isKsk);
   privateKeyStorage_->generateKeyPair(keyName, params);
+  signatureCache_.clear();
   ptr_lib::shared_ptr<PublicKey> pubKey = privateKeyStorage_->getPublicKey(keyName);
   identityStorage_->addKey(keyName, params.getKeyType(), pubKey->getKeyDer());
 
@@ -599,34 +605,43 @@ ptr_lib::shared_ptr<Signature>
 IdentityManager::makeSignatureByCertificate
   (const Name& certificateName, DigestAlgorithm& digestAlgorithm)
 {
+  // All the supported key types use SHA-256.
+  digestAlgorithm = DIGEST_ALGORITHM_SHA256;
+
+  // Getting the public key to check the key type may read and decode a file,
+  // so save a prototype signature for each certificate name.
+  map<Name, ptr_lib::shared_ptr<Signature> >::iterator cached =
+    signatureCache_.find(certificateName);
+  if (cached != signatureCache_.end())
+    return cached->second->clone();
+
   Name keyName = IdentityCertificate::certificateNameToPublicKeyName
     (certificateName);
   ptr_lib::shared_ptr<PublicKey> publicKey = privateKeyStorage_->getPublicKey
     (keyName);
   KeyType keyType = publicKey->getKeyType();
 
+  ptr_lib::shared_ptr<Signature> signature;
   if (keyType == KEY_TYPE_RSA) {
-    ptr_lib::shared_ptr<Sha256WithRsaSignature> signature
+    ptr_lib::shared_ptr<Sha256WithRsaSignature> rsaSignature
       (new Sha256WithRsaSignature());
-    digestAlgorithm = DIGEST_ALGORITHM_SHA256;
-
-    signature->getKeyLocator().setType(ndn_KeyLocatorType_KEYNAME);
-    signature->getKeyLocator().setKeyName(certificateName.getPrefix(-1));
-
-    return signature;
+    rsaSignature->getKeyLocator().setType(ndn_KeyLocatorType_KEYNAME);
+    rsaSignature->getKeyLocator().setKeyName(certificateName.getPrefix(-1));
+    signature = rsaSignature;
   }
   else if (keyType == KEY_TYPE_EC) {
-    ptr_lib::shared_ptr<Sha256WithEcdsaSignature> signature
+    ptr_lib::shared_ptr<Sha256WithEcdsaSignature> ecSignature
       (new Sha256WithEcdsaSignature());
-    digestAlgorithm = DIGEST_ALGORITHM_SHA256;
-
-    signature->getKeyLocator().setType(ndn_KeyLocatorType_KEYNAME);
-    signature->getKeyLocator().setKeyName(certificateName.getPrefix(-1));
-
-    return signature;
+    ecSignature->getKeyLocator().setType(ndn_KeyLocatorType_KEYNAME);
+    ecSignature->getKeyLocator().setKeyName(certificateName.getPrefix(-1));
+    signature = ecSignature;
   }
   else
     throw SecurityException("Key type is not recognized");
+
+  if (isSignatureCacheEnabled_)
+    signatureCache_[certificateName] = signature->clone();
+  return signature;
 }
 
 }
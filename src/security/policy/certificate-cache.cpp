@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2014-2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ * From PyNDN certificate_cache.py by Adeola Bannis.
+ * Originally from Yingdi Yu <http://irl.cs.ucla.edu/~yingdi/>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <algorithm>
+#include "../../c/util/time.h"
+#include <ndn-cpp/security/policy/certificate-cache.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+void
+CertificateCache::insertCertificate
+  (const IdentityCertificate& certificate, const Name& trustAnchorName)
+{
+  // nowOffsetMilliseconds_ is only used for testing.
+  MillisecondsSince1970 now = ndn_getNowMilliseconds() + nowOffsetMilliseconds_;
+  refresh(now);
+
+  MillisecondsSince1970 removalTime = DBL_MAX;
+  if (trustAnchorName.size() > 0) {
+    if (certificate.getNotAfter() < now)
+      // Already expired.
+      return;
+
+    removalTime = certificate.getNotAfter();
+    if (removalTime < nextRefreshTime_)
+      nextRefreshTime_ = removalTime;
+  }
+
+  ptr_lib::shared_ptr<IdentityCertificate> certificateCopy
+    (new IdentityCertificate(certificate));
+  certificatesByName_[certificate.getName().getPrefix(-1)] = Entry
+    (certificateCopy, trustAnchorName, certificate.getNotBefore(), removalTime);
+}
+
+ptr_lib::shared_ptr<IdentityCertificate>
+CertificateCache::getCertificate(const Name& certificateName) const
+{
+  // nowOffsetMilliseconds_ is only used for testing.
+  MillisecondsSince1970 now = ndn_getNowMilliseconds() + nowOffsetMilliseconds_;
+  map<Name, Entry>::const_iterator entry = findEntry(certificateName, now);
+  if (entry == certificatesByName_.end() ||
+      (entry->second.trustAnchorName_.size() > 0 &&
+       now < entry->second.notBefore_))
+    return ptr_lib::shared_ptr<IdentityCertificate>();
+
+  return entry->second.certificate_;
+}
+
+Name
+CertificateCache::getTrustAnchorName(const Name& certificateName) const
+{
+  map<Name, Entry>::const_iterator entry = findEntry
+    (certificateName, ndn_getNowMilliseconds() + nowOffsetMilliseconds_);
+  if (entry == certificatesByName_.end())
+    return Name();
+
+  return entry->second.trustAnchorName_;
+}
+
+map<Name, CertificateCache::Entry>::const_iterator
+CertificateCache::findEntry
+  (const Name& certificateName, MillisecondsSince1970 now) const
+{
+  map<Name, Entry>::const_iterator entry = certificatesByName_.find
+    (certificateName);
+  if (entry != certificatesByName_.end() && entry->second.removalTime_ <= now)
+    // The entry has expired but is not yet removed by refresh.
+    return certificatesByName_.end();
+
+  return entry;
+}
+
+void
+CertificateCache::refresh(MillisecondsSince1970 now)
+{
+  if (now < nextRefreshTime_)
+    return;
+
+  // We recompute nextRefreshTime_.
+  MillisecondsSince1970 nextRefreshTime = DBL_MAX;
+  for (map<Name, Entry>::iterator i = certificatesByName_.begin();
+       i != certificatesByName_.end();) {
+    if (i->second.removalTime_ <= now)
+      certificatesByName_.erase(i++);
+    else {
+      nextRefreshTime = min(nextRefreshTime, i->second.removalTime_);
+      ++i;
+    }
+  }
+
+  nextRefreshTime_ = nextRefreshTime;
+}
+
+}
@@ -121,6 +121,7 @@ ConfigPolicyManager::reset()
     certificateCacheV2_->clear();
   fixedCertificateCache_.clear();
   keyTimestamps_.clear();
+  keyTimestampIndex_.clear();
   requiresVerification_ = true;
   config_.reset(new BoostInfoParser());
   refreshManager_.reset(new TrustAnchorRefreshManager(isSecurityV1_));
@@ -369,11 +370,7 @@ ConfigPolicyManager::getCertificateInterest
   // If we don't actually have the certificate yet, return a certificateInterest
   //   for it.
   if (isSecurityV1_) {
-    ptr_lib::shared_ptr<IdentityCertificate> foundCert =
-      refreshManager_->getCertificate(signatureName);
-    if (!foundCert)
-      foundCert = certificateCache_->getCertificate(signatureName);
-    if (!foundCert)
+    if (!findCertificate(signatureName))
       return ptr_lib::make_shared<Interest>(signatureName);
   }
   else {
@@ -395,10 +392,8 @@ ConfigPolicyManager::onCertificateDownloadComplete
    const OnVerified& onVerified, 
    const OnDataValidationFailed& onValidationFailed)
 {
-  if (isSecurityV1_) {
-    IdentityCertificate certificate(*data);
-    certificateCache_->insertCertificate(certificate);
-  }
+  if (isSecurityV1_)
+    insertVerifiedCertificate(IdentityCertificate(*data));
   else {
     CertificateV2 certificate(*data);
     certificateCacheV2_->insert(certificate);
@@ -417,10 +412,8 @@ ConfigPolicyManager::onCertificateDownloadCompleteForInterest
    const OnVerifiedInterest& onVerified,
    const OnInterestValidationFailed& onValidationFailed, WireFormat& wireFormat)
 {
-  if (isSecurityV1_) {
-    IdentityCertificate certificate(*data);
-    certificateCache_->insertCertificate(certificate);
-  }
+  if (isSecurityV1_)
+    insertVerifiedCertificate(IdentityCertificate(*data));
   else {
     CertificateV2 certificate(*data);
     certificateCacheV2_->insert(certificate);
@@ -700,6 +693,56 @@ ConfigPolicyManager::lookupCertificate(const string& certID, bool isPath)
   return cert;
 }
 
+ptr_lib::shared_ptr<IdentityCertificate>
+ConfigPolicyManager::findCertificate
+  (const Name& certificateName, Name& trustAnchorName) const
+{
+  ptr_lib::shared_ptr<IdentityCertificate> certificate =
+    refreshManager_->getCertificate(certificateName);
+  if (certificate) {
+    trustAnchorName = certificateName;
+    return certificate;
+  }
+
+  certificate = certificateCache_->getCertificate(certificateName);
+  if (!certificate)
+    return certificate;
+
+  trustAnchorName = certificateCache_->getTrustAnchorName(certificateName);
+  if (trustAnchorName.size() == 0)
+    // This is a fixed trust anchor from the configuration.
+    trustAnchorName = certificateName;
+  else if (!refreshManager_->getCertificate(trustAnchorName) &&
+           !certificateCache_->getCertificate(trustAnchorName)) {
+    // The trust anchor was removed, so the certificate must be fetched and
+    // verified again.
+    trustAnchorName = Name();
+    return ptr_lib::shared_ptr<IdentityCertificate>();
+  }
+
+  return certificate;
+}
+
+void
+ConfigPolicyManager::insertVerifiedCertificate
+  (const IdentityCertificate& certificate)
+{
+  // The certificate was verified with its signer's certificate, so it chains to
+  // the same trust anchor.
+  Name trustAnchorName = certificate.getName().getPrefix(-1);
+  if (KeyLocator::canGetFromSignature(certificate.getSignature())) {
+    const KeyLocator& keyLocator =
+      KeyLocator::getFromSignature(certificate.getSignature());
+    if (keyLocator.getType() == ndn_KeyLocatorType_KEYNAME) {
+      const Name& signerName = keyLocator.getKeyName();
+      if (!findCertificate(signerName, trustAnchorName))
+        trustAnchorName = signerName;
+    }
+  }
+
+  certificateCache_->insertCertificate(certificate, trustAnchorName);
+}
+
 ptr_lib::shared_ptr<CertificateV2>
 ConfigPolicyManager::lookupCertificateV2(const string& certID, bool isPath)
 {
@@ -822,9 +865,9 @@ ConfigPolicyManager::interestTimestampIsFresh
   (const Name& keyName, MillisecondsSince1970 timestamp,
    string& failureReason) const
 {
-  map<string, MillisecondsSince1970>::const_iterator lastTimestamp =
-    keyTimestamps_.find(keyName.toUri());
-  if (lastTimestamp == keyTimestamps_.end()) {
+  map<Name, KeyTimestampList::iterator>::const_iterator lastTimestamp =
+    keyTimestampIndex_.find(keyName);
+  if (lastTimestamp == keyTimestampIndex_.end()) {
     MillisecondsSince1970 now = ndn_getNowMilliseconds();
     MillisecondsSince1970 notBefore = now - keyGraceInterval_;
     MillisecondsSince1970 notAfter = now + keyGraceInterval_;
@@ -841,7 +884,7 @@ ConfigPolicyManager::interestTimestampIsFresh
       return true;
   }
   else {
-    if (timestamp <= lastTimestamp->second) {
+    if (timestamp <= lastTimestamp->second->timestamp_) {
       failureReason =
         "The command interest timestamp is not newer than the previous timestamp";
       return false;
@@ -855,35 +898,28 @@ void
 ConfigPolicyManager::updateTimestampForKey
   (const Name& keyName, MillisecondsSince1970 timestamp)
 {
-  keyTimestamps_[keyName.toUri()] = timestamp;
-
-  if (keyTimestamps_.size() >= maxTrackedKeys_) {
-    MillisecondsSince1970 now = ndn_getNowMilliseconds();
-    MillisecondsSince1970 oldestTimestamp = now;
-    string oldestKey;
-
-    // Get the keys to erase without disturbing the map.
-    vector<string> keysToErase;
-
-    for (map<string, MillisecondsSince1970>::iterator entry = keyTimestamps_.begin();
-         entry != keyTimestamps_.end(); ++entry) {
-      const string& keyUri = entry->first;
-      MillisecondsSince1970 ts = entry->second;
-      if (now - ts > keyTimestampTtl_)
-        keysToErase.push_back(keyUri);
-      else if (ts < oldestTimestamp) {
-        oldestTimestamp = ts;
-        oldestKey = keyUri;
-      }
-    }
-
-    // Now erase.
-    for (size_t i = 0; i < keysToErase.size(); ++i)
-      keyTimestamps_.erase(keysToErase[i]);
+  MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  map<Name, KeyTimestampList::iterator>::iterator entry =
+    keyTimestampIndex_.find(keyName);
+  if (entry != keyTimestampIndex_.end()) {
+    // Update the record and move it to the back as the most recent.
+    entry->second->timestamp_ = timestamp;
+    entry->second->lastUsed_ = now;
+    keyTimestamps_.splice(keyTimestamps_.end(), keyTimestamps_, entry->second);
+  }
+  else {
+    keyTimestamps_.push_back(KeyTimestampRecord(keyName, timestamp, now));
+    keyTimestampIndex_[keyName] = --keyTimestamps_.end();
+  }
 
-    if (keyTimestamps_.size() > maxTrackedKeys_ && oldestKey != "")
-      // have not removed enough
-      keyTimestamps_.erase(oldestKey);
+  // Purge the keys which have not been used within the TTL, then the least
+  // recently used keys if the table is still too large. The list is ordered by
+  // lastUsed_, so only check the front.
+  while (!keyTimestamps_.empty() &&
+         (now - keyTimestamps_.front().lastUsed_ > keyTimestampTtl_ ||
+          keyTimestampIndex_.size() > maxTrackedKeys_)) {
+    keyTimestampIndex_.erase(keyTimestamps_.front().keyName_);
+    keyTimestamps_.pop_front();
   }
 }
 
@@ -911,9 +947,7 @@ ConfigPolicyManager::verify
     Blob publicKeyDer;
     if (isSecurityV1_) {
       ptr_lib::shared_ptr<IdentityCertificate> certificate =
-        refreshManager_->getCertificate(signatureName);
-      if (!certificate)
-        certificate = certificateCache_->getCertificate(signatureName);
+        findCertificate(signatureName);
       if (!certificate) {
         failureReason = "Cannot find a certificate with name " +
           signatureName.toUri();
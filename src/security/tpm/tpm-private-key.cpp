@@ -22,6 +22,7 @@
 
 #include "../../encoding/der/der-node.hpp"
 #include "../../encoding/der/der-exception.hpp"
+#include "../../encoding/der/der-reader.hpp"
 #include "../../c/util/crypto.h"
 #include <ndn-cpp/security/tpm/tpm-private-key.hpp>
 
@@ -43,23 +44,19 @@ TpmPrivateKey::loadPkcs1
   if (keyType == (KeyType)-1) {
     // Try to determine the key type.
     try {
-      ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse
-        (encoding, encodingLength);
-      const std::vector<ptr_lib::shared_ptr<DerNode> >& children =
-        parsedNode->getChildren();
+      DerReader children = DerReader(encoding, encodingLength).readSequence();
 
       // An RsaPrivateKey has integer version 0 and 8 integers.
-      if (children.size() == 9 &&
-          dynamic_cast<DerNode::DerInteger*>(children[0].get()) &&
-          dynamic_cast<DerNode::DerInteger&>(*children[0]).toIntegerVal() == 0 &&
-          dynamic_cast<DerNode::DerInteger*>(children[1].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[2].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[3].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[4].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[5].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[6].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[7].get()) &&
-          dynamic_cast<DerNode::DerInteger*>(children[8].get()))
+      BlobLite version = children.read(DerNodeType_Integer);
+      bool isRsa = (version.size() == 1 && version.buf()[0] == 0);
+      for (int i = 0; isRsa && i < 8; ++i) {
+        if (children.atEnd() || children.peekType() != DerNodeType_Integer)
+          isRsa = false;
+        else
+          children.skip();
+      }
+
+      if (isRsa && children.atEnd())
         keyType = KEY_TYPE_RSA;
       else
         // Assume it is an EC key. Try decoding it below.
@@ -95,26 +92,29 @@ TpmPrivateKey::loadPkcs1
 void
 TpmPrivateKey::loadPkcs8(const uint8_t* encoding, size_t encodingLength)
 {
-  string oidString;
-  ptr_lib::shared_ptr<DerNode> algorithmParameters;
-  Blob privateKeyDer;
+  bool isEc, isRsa;
+  BlobLite algorithmParameters;
+  BlobLite privateKeyDer;
 
   try {
-    // Decode to find the algorithm OID and the inner private key DER.
-    ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse
-      (encoding, encodingLength);
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& pkcs8Children =
-      parsedNode->getChildren();
+    // Read in place to find the algorithm OID and the inner private key DER.
+    DerReader pkcs8Children = DerReader(encoding, encodingLength).readSequence();
+    // Skip the version.
+    pkcs8Children.skip();
 
     // Get the algorithm OID and parameters.
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& algorithmIdChildren =
-      DerNode::getSequence(pkcs8Children, 1).getChildren();
-    oidString =
-      dynamic_cast<DerNode::DerOid&>(*algorithmIdChildren[0]).toVal().toRawStr();
-    algorithmParameters = algorithmIdChildren[1];
+    DerReader algorithmIdChildren = pkcs8Children.readSequence();
+    BlobLite oid = algorithmIdChildren.read(DerNodeType_ObjectIdentifier);
+    isEc = DerReader::oidEquals(oid, EC_ENCRYPTION_OID);
+    isRsa = DerReader::oidEquals(oid, RSA_ENCRYPTION_OID);
+    if (!algorithmIdChildren.atEnd() &&
+        algorithmIdChildren.peekType() == DerNodeType_ObjectIdentifier)
+      // The EC parameters are the curve OID.
+      algorithmParameters = algorithmIdChildren.read
+        (DerNodeType_ObjectIdentifier);
 
     // Get the value of the 3rd child which is the octet string.
-    privateKeyDer = pkcs8Children[2]->toVal();
+    privateKeyDer = pkcs8Children.read(DerNodeType_OctetString);
   } catch (const DerDecodingException&) {
     // Error decoding as PKCS #8. Try PKCS #1 for backwards compatibility.
     try {
@@ -127,14 +127,14 @@ TpmPrivateKey::loadPkcs8(const uint8_t* encoding, size_t encodingLength)
 
   keyType_ = (KeyType)-1;
 #if NDN_CPP_HAVE_LIBCRYPTO
-  if (oidString == EC_ENCRYPTION_OID) {
+  if (isEc) {
     ecPrivateKey_.reset(new EcPrivateKeyLite());
     decodeEcPrivateKey(algorithmParameters, privateKeyDer, *ecPrivateKey_);
 
     // Successfully decoded, so set the keyType_.
     keyType_ = KEY_TYPE_EC;
   }
-  else if (oidString == RSA_ENCRYPTION_OID) {
+  else if (isRsa) {
     rsaPrivateKey_.reset(new RsaPrivateKeyLite());
     ndn_Error error;
     if ((error = rsaPrivateKey_->decode(privateKeyDer)))
@@ -164,15 +164,16 @@ TpmPrivateKey::derivePublicKey() const
       throw Error(string("generate: ") + ndn_getErrorString(error));
     // Convert the openssl style to ndn-cxx which has the simple
     // AlgorithmIdentifier.
-    // Find the bit string which is the second child.
-    ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse
-      (opensslPublicKeyDer);
-    const std::vector<ptr_lib::shared_ptr<DerNode> >& children =
-      parsedNode->getChildren();
+    // Find the bit string which is the second child and only parse it.
+    DerReader children = DerReader
+      (&opensslPublicKeyDer[0], opensslPublicKeyDer.size()).readSequence();
+    children.skip();
+    BlobLite bitString = children.readEncoding();
     OID parametersOid = getEcOid(*ecPrivateKey_);
     return encodeSubjectPublicKeyInfo
       (OID(EC_ENCRYPTION_OID),
-       ptr_lib::make_shared<DerNode::DerOid>(parametersOid), children[1]);
+       ptr_lib::make_shared<DerNode::DerOid>(parametersOid),
+       DerNode::parse(bitString.buf(), bitString.size()));
   }
   else if (keyType_ == KEY_TYPE_RSA) {
     // Get the encoding length and then encode.
@@ -383,30 +384,34 @@ TpmPrivateKey::encodeSubjectPublicKeyInfo
 #if NDN_CPP_HAVE_LIBCRYPTO
 void
 TpmPrivateKey::decodeEcPrivateKey
-  (const ptr_lib::shared_ptr<DerNode>& algorithmParameters,
-   const Blob& privateKeyDer, EcPrivateKeyLite& privateKey)
+  (const BlobLite& algorithmParameters, const BlobLite& privateKeyDer,
+   EcPrivateKeyLite& privateKey)
 {
-  // Find the curveId in EC_KEY_INFO.
   int curveId = -1;
-  string oidString = algorithmParameters->toVal().toRawStr();
-  for (size_t i = 0 ; i < ndn_getEcKeyInfoCount(); ++i) {
-    const struct ndn_EcKeyInfo *info = ndn_getEcKeyInfo(i);
-    OID curveOid(info->oidIntegerList, info->oidIntegerListLength);
-    if (curveOid.toString() == oidString) {
-      curveId = info->curveId;
-      break;
+  BlobLite octetStringValue;
+  try {
+    // Find the curveId in EC_KEY_INFO.
+    for (size_t i = 0 ; i < ndn_getEcKeyInfoCount(); ++i) {
+      const struct ndn_EcKeyInfo *info = ndn_getEcKeyInfo(i);
+      if (DerReader::oidEquals
+          (algorithmParameters, info->oidIntegerList,
+           info->oidIntegerListLength)) {
+        curveId = info->curveId;
+        break;
+      }
     }
+    if (curveId == -1)
+      throw Error("decodeEcPrivateKey: Unrecognized EC algorithm parameters");
+
+    // Get the value in the octet string which is the second child.
+    DerReader children = DerReader(privateKeyDer).readSequence();
+    children.skip();
+    octetStringValue = children.read(DerNodeType_OctetString);
+  } catch (const DerDecodingException& ex) {
+    throw Error
+      (string("decodeEcPrivateKey: Error decoding the private key: ") +
+       ex.what());
   }
-  if (curveId == -1)
-    throw Error("decodeEcPrivateKey: Unrecognized EC algorithm parameters");
-
-  // Get the value in the octet string.
-  ptr_lib::shared_ptr<DerNode> parsedNode = DerNode::parse(privateKeyDer);
-  DerNode::DerOctetString* octetString = dynamic_cast<DerNode::DerOctetString*>
-    (parsedNode->getChildren()[1].get());
-  if (!octetString)
-    throw Error("decodeEcPrivateKey: Can't get the private key octet string");
-  Blob octetStringValue = octetString->toVal();
 
   ndn_Error error;
   if ((error = privateKey.setByCurve(curveId, octetStringValue)))
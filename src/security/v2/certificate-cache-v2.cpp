@@ -39,7 +39,8 @@ CertificateCacheV2::CertificateCacheV2(Milliseconds maxLifetimeMilliseconds)
 }
 
 void
-CertificateCacheV2::insert(const CertificateV2& certificate)
+CertificateCacheV2::insert
+  (const CertificateV2& certificate, const Name& trustAnchorName)
 {
   MillisecondsSince1970 notAfterTime =
     certificate.getValidityPeriod().getNotAfter();
@@ -62,7 +63,7 @@ CertificateCacheV2::insert(const CertificateV2& certificate)
     << removalHours << " hours");
   ptr_lib::shared_ptr<CertificateV2> certificateCopy(new CertificateV2(certificate));
   certificatesByName_[certificateCopy->getName()] = 
-    Entry(certificateCopy, removalTime);
+    Entry(certificateCopy, removalTime, trustAnchorName);
 }
 
 ptr_lib::shared_ptr<CertificateV2>
@@ -106,6 +107,17 @@ CertificateCacheV2::find(const Interest& interest) const
   return ptr_lib::shared_ptr<CertificateV2>();
 }
 
+Name
+CertificateCacheV2::getTrustAnchorName(const Name& certificateName) const
+{
+  map<Name, Entry>::const_iterator entry =
+    certificatesByName_.find(certificateName);
+  if (entry == certificatesByName_.end())
+    return Name();
+
+  return entry->second.trustAnchorName_;
+}
+
 void
 CertificateCacheV2::deleteCertificate(const Name& certificateName)
 {
@@ -28,14 +28,23 @@ namespace ndn {
 
 ptr_lib::shared_ptr<CertificateV2>
 CertificateStorage::findTrustedCertificate
-  (const Interest& interestForCertificate)
+  (const Interest& interestForCertificate, Name& trustAnchorName)
 {
   ptr_lib::shared_ptr<CertificateV2> certificate =
     trustAnchors_.find(interestForCertificate);
-  if (!!certificate)
+  if (!!certificate) {
+    trustAnchorName = certificate->getName();
     return certificate;
+  }
 
   certificate = verifiedCertificateCache_.find(interestForCertificate);
+  if (!certificate)
+    return certificate;
+
+  // A verified certificate stays trusted until it is removed from the cache,
+  // even if its trust anchor is later removed.
+  trustAnchorName = verifiedCertificateCache_.getTrustAnchorName
+    (certificate->getName());
   return certificate;
 }
 
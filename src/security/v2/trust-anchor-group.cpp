@@ -20,9 +20,14 @@
  * A copy of the GNU Lesser General Public License is in the file COPYING.
  */
 
+#include <ndn-cpp/ndn-cpp-config.h>
 #include <dirent.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <unistd.h>
+#if NDN_CPP_HAVE_INOTIFY
+#include <sys/inotify.h>
+#endif
 #include <fstream>
 #include <sstream>
 #include <ndn-cpp/util/logging.hpp>
@@ -98,16 +103,34 @@ DynamicTrustAnchorGroup::DynamicTrustAnchorGroup
   isDirectory_(isDirectory),
   path_(path),
   refreshPeriod_(refreshPeriod),
-  expireTime_(0)
+  expireTime_(0),
+  inotifyFd_(-1)
 {
   if (refreshPeriod <= 0)
     throw runtime_error("Refresh period for the dynamic group must be positive");
 
+  if (isDirectory_)
+    directory_ = path_;
+  else {
+    size_t iSlash = path_.find_last_of('/');
+    if (iSlash == string::npos)
+      directory_ = ".";
+    else if (iSlash == 0)
+      directory_ = "/";
+    else
+      directory_ = path_.substr(0, iSlash);
+  }
+
   _LOG_TRACE("Create a dynamic trust anchor group " << id << " for file/dir " <<
     path << " with refresh time " << refreshPeriod);
   refresh();
 }
 
+DynamicTrustAnchorGroup::~DynamicTrustAnchorGroup()
+{
+  stopWatch();
+}
+
 void
 DynamicTrustAnchorGroup::refresh()
 {
@@ -116,13 +139,32 @@ DynamicTrustAnchorGroup::refresh()
     return;
 
   expireTime_ = now + refreshPeriod_;
-  _LOG_TRACE("Reloading the dynamic trust anchor group");
 
-  // Save a copy of anchorNames_ .
-  set<Name> oldAnchorNames = anchorNames_;
+  if (inotifyFd_ >= 0) {
+    if (processWatchEvents())
+      return;
+
+    // Events were lost or the directory was removed.
+    stopWatch();
+  }
+
+  _LOG_TRACE("Rescanning the dynamic trust anchor group");
+  // Start the watch before the scan so that a change during the scan is not
+  // missed.
+  startWatch();
+  rescan();
+}
+
+void
+DynamicTrustAnchorGroup::rescan()
+{
+  set<string> filePaths;
 
-  if (!isDirectory_)
-    loadCertificate(path_, oldAnchorNames);
+  if (!isDirectory_) {
+    struct stat fileStat;
+    if (::stat(path_.c_str(), &fileStat) != -1 && S_ISREG(fileStat.st_mode))
+      filePaths.insert(path_);
+  }
   else {
     DIR *directory = ::opendir(path_.c_str());
     if (directory != NULL) {
@@ -133,34 +175,174 @@ DynamicTrustAnchorGroup::refresh()
         struct stat fileStat;
         if (::stat(filePath.c_str(), &fileStat) != -1 &&
             S_ISREG(fileStat.st_mode))
-          loadCertificate(filePath, oldAnchorNames);
+          filePaths.insert(filePath);
       }
 
       ::closedir(directory);
     }
   }
 
-  // Remove old certificates.
-  for (set<Name>::iterator name = oldAnchorNames.begin();
-       name != oldAnchorNames.end(); ++name) {
-    anchorNames_.erase(*name);
-    certificates_.remove(*name);
+  // Remove the files which are gone. Save the paths in a list since we can't
+  // erase from files_ while iterating.
+  vector<string> removedFilePaths;
+  for (map<string, FileInfo>::iterator file = files_.begin();
+       file != files_.end(); ++file) {
+    if (filePaths.count(file->first) == 0)
+      removedFilePaths.push_back(file->first);
+  }
+  for (size_t i = 0; i < removedFilePaths.size(); ++i)
+    removeFile(removedFilePaths[i]);
+
+  for (set<string>::iterator filePath = filePaths.begin();
+       filePath != filePaths.end(); ++filePath)
+    updateFile(*filePath, false);
+}
+
+void
+DynamicTrustAnchorGroup::updateFile(const string& filePath, bool force)
+{
+  struct stat fileStat;
+  if (::stat(filePath.c_str(), &fileStat) == -1 || !S_ISREG(fileStat.st_mode)) {
+    removeFile(filePath);
+    return;
+  }
+
+  MillisecondsSince1970 modificationTime = fileStat.st_mtime * 1000.0;
+  uint64_t size = fileStat.st_size;
+  map<string, FileInfo>::iterator file = files_.find(filePath);
+  if (file != files_.end() && !force &&
+      file->second.modificationTime_ == modificationTime &&
+      file->second.size_ == size)
+    // Not changed.
+    return;
+
+  if (file == files_.end())
+    file = files_.insert(make_pair(filePath, FileInfo())).first;
+  file->second.modificationTime_ = modificationTime;
+  file->second.size_ = size;
+
+  _LOG_TRACE("Loading the trust anchor file " << filePath);
+  Name oldCertificateName = file->second.certificateName_;
+  ptr_lib::shared_ptr<CertificateV2> certificate = readCertificate(filePath);
+  if (certificate)
+    file->second.certificateName_ = certificate->getName();
+  else
+    file->second.certificateName_.clear();
+
+  if (oldCertificateName.equals(file->second.certificateName_))
+    // Upon refresh, the existing certificates are not changed.
+    return;
+
+  if (certificate && anchorNames_.count(certificate->getName()) == 0) {
+    anchorNames_.insert(certificate->getName());
+    certificates_.add(*certificate);
+  }
+  if (oldCertificateName.size() > 0)
+    removeAnchorIfUnused(oldCertificateName);
+}
+
+void
+DynamicTrustAnchorGroup::removeFile(const string& filePath)
+{
+  map<string, FileInfo>::iterator file = files_.find(filePath);
+  if (file == files_.end())
+    return;
+
+  Name certificateName = file->second.certificateName_;
+  files_.erase(file);
+  if (certificateName.size() > 0)
+    removeAnchorIfUnused(certificateName);
+}
+
+void
+DynamicTrustAnchorGroup::removeAnchorIfUnused(const Name& certificateName)
+{
+  for (map<string, FileInfo>::iterator file = files_.begin();
+       file != files_.end(); ++file) {
+    if (file->second.certificateName_.equals(certificateName))
+      // Another file has the same certificate.
+      return;
+  }
+
+  anchorNames_.erase(certificateName);
+  certificates_.remove(certificateName);
+}
+
+void
+DynamicTrustAnchorGroup::startWatch()
+{
+#if NDN_CPP_HAVE_INOTIFY
+  inotifyFd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotifyFd_ < 0)
+    return;
+
+  if (::inotify_add_watch
+      (inotifyFd_, directory_.c_str(),
+       IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+       IN_DELETE_SELF | IN_MOVE_SELF) < 0) {
+    // The directory doesn't exist yet, so rescan until it does.
+    stopWatch();
+    return;
   }
+#endif
 }
 
 void
-DynamicTrustAnchorGroup::loadCertificate
-  (const string& file, set<Name>& oldAnchorNames)
-{
-  ptr_lib::shared_ptr<CertificateV2> certificate = readCertificate(file);
-  if (certificate) {
-    if (anchorNames_.count(certificate->getName()) == 0) {
-      anchorNames_.insert(certificate->getName());
-      certificates_.add(*certificate);
+DynamicTrustAnchorGroup::stopWatch()
+{
+  if (inotifyFd_ >= 0) {
+    ::close(inotifyFd_);
+    inotifyFd_ = -1;
+  }
+}
+
+bool
+DynamicTrustAnchorGroup::processWatchEvents()
+{
+#if NDN_CPP_HAVE_INOTIFY
+  // The buffer must be aligned for struct inotify_event.
+  union {
+    struct inotify_event event;
+    char buffer[4096];
+  } events;
+  set<string> changedFilePaths;
+  // For a single anchor file, only watch for events with its file name.
+  string fileName = path_.substr(path_.find_last_of('/') + 1);
+
+  while (true) {
+    ssize_t nBytes = ::read(inotifyFd_, events.buffer, sizeof(events.buffer));
+    if (nBytes <= 0)
+      // There are no more events.
+      break;
+
+    for (ssize_t offset = 0; offset < nBytes; ) {
+      const struct inotify_event* event =
+        (const struct inotify_event*)(events.buffer + offset);
+      offset += sizeof(struct inotify_event) + event->len;
+
+      if (event->mask &
+          (IN_Q_OVERFLOW | IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+        return false;
+      if (event->len == 0)
+        continue;
+
+      if (isDirectory_)
+        changedFilePaths.insert(directory_ + '/' + event->name);
+      else if (fileName == event->name)
+        changedFilePaths.insert(path_);
     }
-    else
-      oldAnchorNames.erase(certificate->getName());
   }
+
+  // A file which is modified in place in the same second with the same size
+  // is only detected by inotify, so force reading it.
+  for (set<string>::iterator filePath = changedFilePaths.begin();
+       filePath != changedFilePaths.end(); ++filePath)
+    updateFile(*filePath, true);
+
+  return true;
+#else
+  return false;
+#endif
 }
 
 }
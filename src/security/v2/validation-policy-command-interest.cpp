@@ -74,9 +74,13 @@ ValidationPolicyCommandInterest::cleanUp()
   MillisecondsSince1970 now = ndn_getNowMilliseconds() + nowOffsetMilliseconds_;
   MillisecondsSince1970 expiring = now - options_.recordLifetime_;
 
-  while ((container_.size() > 0 && container_[0]->lastRefreshed_ <= expiring) ||
-         (options_.maxRecords_ >= 0 && container_.size() > options_.maxRecords_))
-    container_.erase(container_.begin());
+  while ((!container_.empty() &&
+          container_.front().lastRefreshed_ <= expiring) ||
+         (options_.maxRecords_ >= 0 &&
+          recordIndex_.size() > options_.maxRecords_)) {
+    recordIndex_.erase(container_.front().keyName_);
+    container_.pop_front();
+  }
 }
 
 bool
@@ -121,9 +125,9 @@ ValidationPolicyCommandInterest::checkTimestamp
     return false;
   }
 
-  int index = findByKeyName(keyName);
-  if (index >= 0) {
-    if (timestamp <= container_[index]->timestamp_) {
+  RecordList::iterator record = findByKeyName(keyName);
+  if (record != container_.end()) {
+    if (timestamp <= record->timestamp_) {
       state->fail(ValidationError(ValidationError::POLICY_ERROR,
         "Timestamp is reordered for key " + keyName.toUri()));
       return false;
@@ -146,26 +150,28 @@ ValidationPolicyCommandInterest::insertNewRecord
 {
   // nowOffsetMilliseconds_ is only used for testing.
   MillisecondsSince1970 now = ndn_getNowMilliseconds() + nowOffsetMilliseconds_;
-  ptr_lib::shared_ptr<LastTimestampRecord> newRecord
-    (new LastTimestampRecord(keyName, timestamp, now));
-
-  int index = findByKeyName(keyName);
-  if (index >= 0)
-    // Remove the existing record so we can move it to the end.
-    container_.erase(container_.begin() + index);
 
-  container_.push_back(newRecord);
+  RecordList::iterator record = findByKeyName(keyName);
+  if (record != container_.end()) {
+    // Update the existing record and move it to the back.
+    record->timestamp_ = timestamp;
+    record->lastRefreshed_ = now;
+    container_.splice(container_.end(), container_, record);
+  }
+  else {
+    container_.push_back(LastTimestampRecord(keyName, timestamp, now));
+    recordIndex_[keyName] = --container_.end();
+  }
 }
 
-int
+ValidationPolicyCommandInterest::RecordList::iterator
 ValidationPolicyCommandInterest::findByKeyName(const Name& keyName)
 {
-  for (int i = 0; i < container_.size(); ++i) {
-    if (container_[i]->keyName_.equals(keyName))
-      return i;
-  }
+  map<Name, RecordList::iterator>::iterator entry = recordIndex_.find(keyName);
+  if (entry == recordIndex_.end())
+    return container_.end();
 
-  return -1;
+  return entry->second;
 }
 
 }
@@ -116,8 +116,10 @@ Validator::requestCertificate
 
   _LOG_TRACE("Retrieving " << certificateRequest->interest_.getName());
 
+  // This stops at the first trust anchor or already verified certificate.
+  Name trustAnchorName;
   ptr_lib::shared_ptr<CertificateV2> certificate = findTrustedCertificate
-    (certificateRequest->interest_);
+    (certificateRequest->interest_, trustAnchorName);
   if (certificate) {
     _LOG_TRACE("Found trusted certificate " << certificate->getName());
 
@@ -126,7 +128,7 @@ Validator::requestCertificate
       state->verifyOriginalPacket(*certificate);
 
     for (size_t i = 0; i < state->certificateChain_.size(); ++i)
-      cacheVerifiedCertificate(*state->certificateChain_[i]);
+      cacheVerifiedCertificate(*state->certificateChain_[i], trustAnchorName);
 
     return;
   }
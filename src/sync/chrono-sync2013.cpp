@@ -38,6 +38,18 @@ using namespace ndn::func_lib;
 
 namespace ndn {
 
+/**
+ * Make the InterestTemplate for sync interests with the broadcast prefix.
+ */
+static InterestTemplate
+makeSyncInterestTemplate
+  (const Name& applicationBroadcastPrefix, Milliseconds syncLifetime)
+{
+  Interest interest(applicationBroadcastPrefix);
+  interest.setInterestLifetimeMilliseconds(syncLifetime);
+  return InterestTemplate(interest);
+}
+
 ChronoSync2013::Impl::Impl
   (const OnReceivedSyncState& onReceivedSyncState,
    const OnInitialized& onInitialized, const Name& applicationDataPrefix,
@@ -50,7 +62,9 @@ ChronoSync2013::Impl::Impl
   face_(face), keyChain_(keyChain), certificateName_(certificateName),
   syncLifetime_(syncLifetime), initialPreviousSequenceNo_(previousSequenceNumber),
   sequenceNo_(previousSequenceNumber), digestTree_(new DigestTree()),
-  contentCache_(&face), enabled_(true)
+  contentCache_(&face), enabled_(true),
+  syncInterestTemplate_(makeSyncInterestTemplate
+    (applicationBroadcastPrefix, syncLifetime))
 {
 }
 
@@ -161,12 +175,7 @@ ChronoSync2013::Impl::publishNextSequenceNo(const Blob& applicationInfo)
 
   // TODO: Should we have an option to not express an interest if this is the
   //   final publish of the session?
-  Interest interest(applicationBroadcastPrefix_);
-  interest.getName().append(digestTree_->getRoot());
-  interest.setInterestLifetimeMilliseconds(syncLifetime_);
-  face_.expressInterest
-    (interest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
-     bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
+  expressSyncInterest();
 }
 
 void
@@ -274,15 +283,7 @@ ChronoSync2013::Impl::onData
     _LOG_ERROR("ChronoSync2013::Impl::onData: Error in onReceivedSyncState.");
   }
 
-  Name name(applicationBroadcastPrefix_);
-  name.append(digestTree_->getRoot());
-  Interest syncInterest(name);
-  syncInterest.setInterestLifetimeMilliseconds(syncLifetime_);
-  face_.expressInterest
-    (syncInterest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
-     bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
-  _LOG_DEBUG("Syncinterest expressed:");
-  _LOG_DEBUG(name.toUri());
+  expressSyncInterest();
 }
 
 void
@@ -432,16 +433,8 @@ ChronoSync2013::Impl::syncTimeout(const ptr_lib::shared_ptr<const Interest>& int
    _LOG_DEBUG("Sync Interest name: " + interest->getName().toUri());
   string component = interest->getName().get
     (applicationBroadcastPrefix_.size()).toEscapedString();
-  if (component == digestTree_->getRoot()) {
-    Name name(interest->getName());
-    Interest retryInterest(interest->getName());
-    retryInterest.setInterestLifetimeMilliseconds(syncLifetime_);
-    face_.expressInterest
-      (retryInterest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
-       bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
-     _LOG_DEBUG("Syncinterest expressed:");
-     _LOG_DEBUG(name.toUri());
-  }
+  if (component == digestTree_->getRoot())
+    expressSyncInterest();
 }
 
 void
@@ -548,15 +541,7 @@ ChronoSync2013::Impl::initialTimeOut(const ptr_lib::shared_ptr<const Interest>&
     _LOG_ERROR("ChronoSync2013::Impl::initialTimeOut: Error in onInitialized.");
   }
 
-  Name name(applicationBroadcastPrefix_);
-  name.append(digestTree_->getRoot());
-  Interest retryInterest(name);
-  retryInterest.setInterestLifetimeMilliseconds(syncLifetime_);
-  face_.expressInterest
-    (retryInterest, bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
-     bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
-  _LOG_DEBUG("Syncinterest expressed:");
-  _LOG_DEBUG(name.toUri());
+  expressSyncInterest();
 }
 
 void
@@ -580,6 +565,18 @@ ChronoSync2013::DigestLogEntry::DigestLogEntry
 {
 }
 
+void
+ChronoSync2013::Impl::expressSyncInterest()
+{
+  face_.expressInterest
+    (syncInterestTemplate_, Name::Component(digestTree_->getRoot()),
+     bind(&ChronoSync2013::Impl::onData, shared_from_this(), _1, _2),
+     bind(&ChronoSync2013::Impl::syncTimeout, shared_from_this(), _1));
+  _LOG_DEBUG("Syncinterest expressed:");
+  _LOG_DEBUG(Name(applicationBroadcastPrefix_).append
+             (digestTree_->getRoot()).toUri());
+}
+
 void
 ChronoSync2013::Impl::dummyOnData
   (const ptr_lib::shared_ptr<const Interest>& interest,
@@ -89,7 +89,7 @@ ThreadsafeFace::expressInterest
     (boost::bind
      (&Node::expressInterest, node_, pendingInterestId,
       ptr_lib::make_shared<const Interest>(interest), onData, onTimeout,
-      onNetworkNack, boost::ref(wireFormat), this));
+      onNetworkNack, boost::ref(wireFormat), this, false));
 
   return pendingInterestId;
 }
@@ -108,7 +108,27 @@ ThreadsafeFace::expressInterest
     (boost::bind
      (&Node::expressInterest, node_, pendingInterestId,
       getInterestCopy(name, interestTemplate), onData, onTimeout, onNetworkNack,
-      boost::ref(wireFormat), this));
+      boost::ref(wireFormat), this, false));
+
+  return pendingInterestId;
+}
+
+uint64_t
+ThreadsafeFace::expressInterest
+  (const InterestTemplate& interestTemplate,
+   const Name::Component& finalComponent, const OnData& onData,
+   const OnTimeout& onTimeout, const OnNetworkNack& onNetworkNack)
+{
+  // Node.lastEntryId_ uses atomic_uint64_t, so this call is thread safe.
+  uint64_t pendingInterestId = node_->getNextEntryId();
+
+  // Copying the InterestTemplate only copies pointers. Node makes the Interest
+  // with a nonce from its pool in the io_service thread.
+  ioService_.dispatch
+    (boost::bind
+     (&Node::expressInterestFromTemplate, node_, pendingInterestId,
+      interestTemplate, finalComponent, onData, onTimeout, onNetworkNack,
+      this));
 
   return pendingInterestId;
 }
@@ -23,10 +23,13 @@
 #define NDN_ASYNC_SOCKET_TRANSPORT_HPP
 
 #include <stdexcept>
+#include <deque>
+#include <vector>
 #include <boost/bind.hpp>
 #include <boost/asio.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <ndn-cpp/transport/transport.hpp>
+#include <ndn-cpp/transport/send-queue-options.hpp>
 #include "../c/encoding/element-reader.h"
 #include "../encoding/element-listener.hpp"
 #include "../util/dynamic-uint8-vector.hpp"
@@ -74,11 +77,14 @@ public:
   }
 
   /**
-   * Send data to the host. To be thread-safe, this must be called from a
-   * dispatch to the ioService which was given to the constructor, as is done by
-   * ThreadsafeFace.
+   * Queue data to send to the host and start an asynchronous write if one is
+   * not already in progress. This copies the data and does not block. To be
+   * thread-safe, this must be called from a dispatch to the ioService which was
+   * given to the constructor, as is done by ThreadsafeFace.
    * @param data A pointer to the buffer of data to send.
    * @param dataLength The number of bytes in data.
+   * @throws runtime_error if the socket is not connected, or if the send queue
+   * is full and the drop policy is THROW_ERROR.
    */
   void
   send(const uint8_t *data, size_t dataLength)
@@ -86,6 +92,30 @@ public:
     impl_->send(data, dataLength);
   }
 
+  /**
+   * Set the limits, drop policy and watermark callbacks of the send queue.
+   * @param options The SendQueueOptions, which is copied.
+   */
+  void
+  setSendQueueOptions(const SendQueueOptions& options)
+  {
+    impl_->setSendQueueOptions(options);
+  }
+
+  /**
+   * Get the number of bytes which are queued or being written.
+   * @return The number of queued bytes.
+   */
+  size_t
+  getQueuedBytes() { return impl_->getQueuedBytes(); }
+
+  /**
+   * Get the number of packets dropped because the send queue was full.
+   * @return The number of dropped packets.
+   */
+  uint64_t
+  getDroppedPacketCount() { return impl_->getDroppedPacketCount(); }
+
   bool
   getIsConnected()
   {
@@ -111,7 +141,9 @@ private:
   public:
     Impl(boost::asio::io_service& ioService)
     : ioService_(ioService), socket_(new typename AsioProtocol::socket(ioService)),
-      elementBuffer_(new DynamicUInt8Vector(1000)), isConnected_(false)
+      elementBuffer_(new DynamicUInt8Vector(1000)), isConnected_(false),
+      queuedBytes_(0), isWriting_(false), isAboveHighWatermark_(false),
+      droppedPacketCount_(0)
     {
       ndn_ElementReader_initialize(&elementReader_, 0, elementBuffer_.get());
     }
@@ -142,7 +174,7 @@ private:
     }
 
     /**
-     * Implement to send data to the host.
+     * Implement to queue data to send to the host.
      * @param data A pointer to the buffer of data to send.
      * @param dataLength The number of bytes in data.
      */
@@ -153,15 +185,56 @@ private:
         throw std::runtime_error
           ("AsyncSocketTransport.send: The socket is not connected");
 
-      // Assume that this is called from a dispatch so that we are already in the
-      // ioService_ thread. Just do a blocking write.
-      boost::system::error_code errorCode;
-      boost::asio::write
-        (*socket_, boost::asio::buffer(data, dataLength), errorCode);
-      if (errorCode != boost::system::errc::success)
-        throw std::runtime_error("AsyncSocketTransport.send: Error in write");
+      // Assume that this is called from a dispatch so that we are already in
+      // the ioService_ thread. Make room in the queue according to the policy.
+      // Always accept a packet when nothing is queued so that a packet larger
+      // than the maximum can still be sent.
+      if (queuedBytes_ > 0 &&
+          queuedBytes_ + dataLength > options_.getMaxQueuedBytes()) {
+        if (options_.getDropPolicy() == SendQueueOptions::THROW_ERROR)
+          throw std::runtime_error
+            ("AsyncSocketTransport.send: The send queue is full");
+        else if (options_.getDropPolicy() == SendQueueOptions::DROP_OLDEST) {
+          while (!sendQueue_.empty() &&
+                 queuedBytes_ + dataLength > options_.getMaxQueuedBytes()) {
+            queuedBytes_ -= sendQueue_.front()->size();
+            sendQueue_.pop_front();
+            ++droppedPacketCount_;
+          }
+          // Dropping may have drained the queue to the low watermark.
+          checkWatermarks();
+        }
+
+        if (queuedBytes_ > 0 &&
+            queuedBytes_ + dataLength > options_.getMaxQueuedBytes()) {
+          // DROP_NEWEST, or DROP_OLDEST could only drop the packets which are
+          // not already being written.
+          ++droppedPacketCount_;
+          return;
+        }
+      }
+
+      sendQueue_.push_back(boost::shared_ptr<std::vector<uint8_t> >
+        (new std::vector<uint8_t>(data, data + dataLength)));
+      queuedBytes_ += dataLength;
+      checkWatermarks();
+
+      if (!isWriting_)
+        startWrite();
     }
 
+    void
+    setSendQueueOptions(const SendQueueOptions& options)
+    {
+      options_ = options;
+    }
+
+    size_t
+    getQueuedBytes() { return queuedBytes_; }
+
+    uint64_t
+    getDroppedPacketCount() { return droppedPacketCount_; }
+
     bool
     getIsConnected()
     {
@@ -182,9 +255,35 @@ private:
       }
 
       isConnected_ = false;
+      // Discard the packets not yet given to async_write. writeHandler will
+      // release the packets being written when the write is canceled.
+      for (size_t i = 0; i < sendQueue_.size(); ++i)
+        queuedBytes_ -= sendQueue_[i]->size();
+      sendQueue_.clear();
     }
 
   private:
+    /**
+     * Call onHighWatermark if queuedBytes_ reached the high watermark, or
+     * onLowWatermark if it drained to the low watermark after that.
+     */
+    void
+    checkWatermarks()
+    {
+      if (!isAboveHighWatermark_ &&
+          queuedBytes_ >= options_.getHighWatermark()) {
+        isAboveHighWatermark_ = true;
+        if (options_.getOnHighWatermark())
+          options_.getOnHighWatermark()();
+      }
+      else if (isAboveHighWatermark_ &&
+               queuedBytes_ <= options_.getLowWatermark()) {
+        isAboveHighWatermark_ = false;
+        if (options_.getOnLowWatermark())
+          options_.getOnLowWatermark()();
+      }
+    }
+
     /**
      * This is called by async_connect to do the first async_receive.
      */
@@ -236,12 +335,83 @@ private:
                        this->shared_from_this(), _1, _2));
     }
 
+    /**
+     * Move up to MAX_GATHER_PACKETS packets from sendQueue_ to writingPackets_
+     * and write them with one gathering async_write.
+     */
+    void
+    startWrite()
+    {
+      std::vector<boost::asio::const_buffer> buffers;
+      while (!sendQueue_.empty() && writingPackets_.size() < MAX_GATHER_PACKETS) {
+        writingPackets_.push_back(sendQueue_.front());
+        sendQueue_.pop_front();
+        buffers.push_back(boost::asio::buffer(*writingPackets_.back()));
+      }
+      if (buffers.empty())
+        return;
+
+      isWriting_ = true;
+      // writingPackets_ keeps the buffers valid until writeHandler is called.
+      boost::asio::async_write
+        (*socket_, buffers,
+         boost::bind(&AsyncSocketTransport::Impl::writeHandler,
+                     this->shared_from_this(), _1, _2));
+    }
+
+    /**
+     * This is called by async_write to release the written packets, call
+     * onLowWatermark if needed, and start the next write. On a write error,
+     * close the connection and report it with onWriteError instead of throwing
+     * out of the io_service handler.
+     */
+    void
+    writeHandler(const boost::system::error_code& errorCode, size_t nBytesSent)
+    {
+      isWriting_ = false;
+      for (size_t i = 0; i < writingPackets_.size(); ++i)
+        queuedBytes_ -= writingPackets_[i]->size();
+      writingPackets_.clear();
+
+      if (errorCode != boost::system::errc::success &&
+          errorCode != boost::system::errc::operation_canceled) {
+        close();
+        isAboveHighWatermark_ = false;
+        if (options_.getOnWriteError())
+          options_.getOnWriteError()
+            ("AsyncSocketTransport: Error in async_write: " +
+             errorCode.message());
+        return;
+      }
+      // If the write was canceled because the socket was closed, then
+      // isConnected_ is false, unless there was a new connect and send while
+      // the canceled write was pending, in which case we continue below.
+
+      checkWatermarks();
+
+      if (isConnected_ && !isWriting_)
+        startWrite();
+    }
+
+    // The maximum number of queued packets to combine in one async_write.
+    static const size_t MAX_GATHER_PACKETS = 64;
+
     boost::asio::io_service& ioService_;
     boost::shared_ptr<typename AsioProtocol::socket> socket_;
-    uint8_t receiveBuffer_[MAX_NDN_PACKET_SIZE];
+    uint8_t receiveBuffer_[NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE];
     boost::shared_ptr<DynamicUInt8Vector> elementBuffer_;
     ndn_ElementReader elementReader_;
     bool isConnected_;
+    SendQueueOptions options_;
+    // The packets waiting for the next async_write.
+    std::deque<boost::shared_ptr<std::vector<uint8_t> > > sendQueue_;
+    // The packets given to the current async_write.
+    std::vector<boost::shared_ptr<std::vector<uint8_t> > > writingPackets_;
+    // The bytes in sendQueue_ plus writingPackets_.
+    size_t queuedBytes_;
+    bool isWriting_;
+    bool isAboveHighWatermark_;
+    uint64_t droppedPacketCount_;
   };
 
   boost::shared_ptr<Impl> impl_;
@@ -115,6 +115,24 @@ AsyncTcpTransport::send(const uint8_t *data, size_t dataLength)
   socketTransport_->send(data, dataLength);
 }
 
+void
+AsyncTcpTransport::setSendQueueOptions(const SendQueueOptions& options)
+{
+  socketTransport_->setSendQueueOptions(options);
+}
+
+size_t
+AsyncTcpTransport::getQueuedBytes()
+{
+  return socketTransport_->getQueuedBytes();
+}
+
+uint64_t
+AsyncTcpTransport::getDroppedPacketCount()
+{
+  return socketTransport_->getDroppedPacketCount();
+}
+
 bool
 AsyncTcpTransport::getIsConnected()
 {
@@ -75,6 +75,24 @@ AsyncUnixTransport::send(const uint8_t *data, size_t dataLength)
   socketTransport_->send(data, dataLength);
 }
 
+void
+AsyncUnixTransport::setSendQueueOptions(const SendQueueOptions& options)
+{
+  socketTransport_->setSendQueueOptions(options);
+}
+
+size_t
+AsyncUnixTransport::getQueuedBytes()
+{
+  return socketTransport_->getQueuedBytes();
+}
+
+uint64_t
+AsyncUnixTransport::getDroppedPacketCount()
+{
+  return socketTransport_->getDroppedPacketCount();
+}
+
 bool
 AsyncUnixTransport::getIsConnected()
 {
@@ -0,0 +1,355 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <algorithm>
+#include "../c/util/time.h"
+#include "../c/encoding/tlv/tlv.h"
+#include "../encoding/tlv-encoder.hpp"
+#include <ndn-cpp/control-parameters.hpp>
+#include <ndn-cpp/control-response.hpp>
+#include <ndn-cpp/network-nack.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+LoopbackForwarder::LoopbackForwarder()
+: lastFaceId_(0), localhostRibPrefix_("/localhost/nfd/rib"),
+  localhopRibPrefix_("/localhop/nfd/rib"), nextPruneTime_(0)
+{
+}
+
+uint64_t
+LoopbackForwarder::addFace(LoopbackTransport* transport)
+{
+  uint64_t faceId = ++lastFaceId_;
+  faces_[faceId] = transport;
+  return faceId;
+}
+
+void
+LoopbackForwarder::removeFace(uint64_t faceId)
+{
+  if (faces_.erase(faceId) == 0)
+    return;
+
+  for (map<Name, vector<uint64_t> >::iterator entry = fib_.begin();
+       entry != fib_.end(); ) {
+    vector<uint64_t>& faceIds = entry->second;
+    faceIds.erase
+      (std::remove(faceIds.begin(), faceIds.end(), faceId), faceIds.end());
+    if (faceIds.empty())
+      // Post-increment so that erase doesn't invalidate the iterator.
+      fib_.erase(entry++);
+    else
+      ++entry;
+  }
+
+  for (map<Name, vector<PitEntry> >::iterator entry = pit_.begin();
+       entry != pit_.end(); ) {
+    vector<PitEntry>& pitEntries = entry->second;
+    // Go backwards through the list so we can erase entries.
+    for (int i = (int)pitEntries.size() - 1; i >= 0; --i) {
+      if (pitEntries[i].faceId_ == faceId)
+        pitEntries.erase(pitEntries.begin() + i);
+    }
+
+    if (pitEntries.empty())
+      pit_.erase(entry++);
+    else
+      ++entry;
+  }
+}
+
+void
+LoopbackForwarder::onReceivedPacket(uint64_t faceId, const Blob& packet)
+{
+  if (packet.size() == 0)
+    return;
+
+  // The first byte of a TLV packet is the type since both types are < 253.
+  if (packet.buf()[0] == ndn_Tlv_Interest)
+    processInterest(faceId, packet);
+  else if (packet.buf()[0] == ndn_Tlv_Data)
+    processData(faceId, packet);
+  // Ignore other packets such as an LpPacket from the application.
+}
+
+size_t
+LoopbackForwarder::getPitSize() const
+{
+  size_t result = 0;
+  for (map<Name, vector<PitEntry> >::const_iterator entry = pit_.begin();
+       entry != pit_.end(); ++entry)
+    result += entry->second.size();
+
+  return result;
+}
+
+void
+LoopbackForwarder::addRoute(const Name& prefix, uint64_t faceId)
+{
+  vector<uint64_t>& faceIds = fib_[prefix];
+  if (std::find(faceIds.begin(), faceIds.end(), faceId) == faceIds.end())
+    faceIds.push_back(faceId);
+}
+
+void
+LoopbackForwarder::removeRoute(const Name& prefix, uint64_t faceId)
+{
+  map<Name, vector<uint64_t> >::iterator entry = fib_.find(prefix);
+  if (entry == fib_.end())
+    return;
+
+  vector<uint64_t>& faceIds = entry->second;
+  faceIds.erase
+    (std::remove(faceIds.begin(), faceIds.end(), faceId), faceIds.end());
+  if (faceIds.empty())
+    fib_.erase(entry);
+}
+
+void
+LoopbackForwarder::processInterest(uint64_t faceId, const Blob& packet)
+{
+  ptr_lib::shared_ptr<Interest> interest(new Interest());
+  try {
+    interest->wireDecode(packet);
+  } catch (const std::exception& ex) {
+    // Drop a packet which can't be decoded, as a forwarder would.
+    return;
+  }
+
+  const Name& name = interest->getName();
+  if (name.size() > localhostRibPrefix_.size() + 1 &&
+      (localhostRibPrefix_.isPrefixOf(name) ||
+       localhopRibPrefix_.isPrefixOf(name))) {
+    const Name::Component& verb = name[localhostRibPrefix_.size()];
+    if (verb.equals(Name::Component("register"))) {
+      processRibCommand(faceId, *interest, true);
+      return;
+    }
+    else if (verb.equals(Name::Component("unregister"))) {
+      processRibCommand(faceId, *interest, false);
+      return;
+    }
+  }
+
+  MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  pruneExpiredEntries(now);
+
+  // Check for a duplicate Interest.
+  vector<PitEntry>& pitEntries = pit_[name];
+  for (size_t i = 0; i < pitEntries.size(); ++i) {
+    if (pitEntries[i].expirationTime_ > now &&
+        pitEntries[i].interest_->getNonce().equals(interest->getNonce()))
+      // A looped or retransmitted Interest with the same nonce.
+      return;
+  }
+
+  // Find the FIB entry with the longest matching prefix.
+  const vector<uint64_t>* nextHops = 0;
+  for (int prefixLength = (int)name.size(); prefixLength >= 0; --prefixLength) {
+    map<Name, vector<uint64_t> >::const_iterator entry =
+      fib_.find(name.getPrefix(prefixLength));
+    if (entry != fib_.end()) {
+      nextHops = &entry->second;
+      break;
+    }
+  }
+
+  vector<uint64_t> outFaceIds;
+  if (nextHops) {
+    for (size_t i = 0; i < nextHops->size(); ++i) {
+      if ((*nextHops)[i] != faceId)
+        outFaceIds.push_back((*nextHops)[i]);
+    }
+  }
+
+  if (outFaceIds.empty()) {
+    if (pitEntries.empty())
+      pit_.erase(name);
+    sendNack(faceId, packet, ndn_NetworkNackReason_NO_ROUTE);
+    return;
+  }
+
+  Milliseconds lifetime = interest->getInterestLifetimeMilliseconds();
+  if (lifetime < 0)
+    lifetime = 4000.0;
+  pitEntries.push_back(PitEntry(interest, faceId, now + lifetime));
+
+  for (size_t i = 0; i < outFaceIds.size(); ++i)
+    sendToFace(outFaceIds[i], packet);
+}
+
+void
+LoopbackForwarder::processData(uint64_t faceId, const Blob& packet)
+{
+  Data data;
+  try {
+    data.wireDecode(packet);
+  } catch (const std::exception& ex) {
+    return;
+  }
+
+  MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  const Name& dataName = data.getName();
+  vector<uint64_t> outFaceIds;
+
+  // Check the entries whose Interest name is a proper prefix of the Data name.
+  for (size_t prefixLength = 0; prefixLength < dataName.size();
+       ++prefixLength) {
+    map<Name, vector<PitEntry> >::iterator entry =
+      pit_.find(dataName.getPrefix(prefixLength));
+    if (entry != pit_.end()) {
+      extractMatchingEntries(entry->second, data, now, outFaceIds);
+      if (entry->second.empty())
+        pit_.erase(entry);
+    }
+  }
+
+  // In canonical order, the Interest names which equal the Data name or add
+  // the implicit digest component immediately follow the Data name.
+  for (map<Name, vector<PitEntry> >::iterator entry = pit_.lower_bound(dataName);
+       entry != pit_.end() && entry->first.size() <= dataName.size() + 1 &&
+       dataName.isPrefixOf(entry->first); ) {
+    extractMatchingEntries(entry->second, data, now, outFaceIds);
+    if (entry->second.empty())
+      pit_.erase(entry++);
+    else
+      ++entry;
+  }
+
+  // Unsolicited Data is dropped.
+  for (size_t i = 0; i < outFaceIds.size(); ++i)
+    sendToFace(outFaceIds[i], packet);
+}
+
+void
+LoopbackForwarder::extractMatchingEntries
+  (vector<PitEntry>& pitEntries, const Data& data, MillisecondsSince1970 now,
+   vector<uint64_t>& outFaceIds)
+{
+  // Go backwards through the list so we can erase entries.
+  for (int i = (int)pitEntries.size() - 1; i >= 0; --i) {
+    if (pitEntries[i].expirationTime_ <= now) {
+      pitEntries.erase(pitEntries.begin() + i);
+      continue;
+    }
+
+    if (pitEntries[i].interest_->matchesData(data)) {
+      if (std::find(outFaceIds.begin(), outFaceIds.end(),
+                    pitEntries[i].faceId_) == outFaceIds.end())
+        outFaceIds.push_back(pitEntries[i].faceId_);
+      pitEntries.erase(pitEntries.begin() + i);
+    }
+  }
+}
+
+void
+LoopbackForwarder::pruneExpiredEntries(MillisecondsSince1970 now)
+{
+  if (now < nextPruneTime_)
+    return;
+  // Check at most once a second since this visits every entry.
+  nextPruneTime_ = now + 1000.0;
+
+  for (map<Name, vector<PitEntry> >::iterator entry = pit_.begin();
+       entry != pit_.end(); ) {
+    vector<PitEntry>& pitEntries = entry->second;
+    // Go backwards through the list so we can erase entries.
+    for (int i = (int)pitEntries.size() - 1; i >= 0; --i) {
+      if (pitEntries[i].expirationTime_ <= now)
+        pitEntries.erase(pitEntries.begin() + i);
+    }
+
+    if (pitEntries.empty())
+      pit_.erase(entry++);
+    else
+      ++entry;
+  }
+}
+
+void
+LoopbackForwarder::processRibCommand
+  (uint64_t faceId, const Interest& interest, bool isRegister)
+{
+  ControlParameters controlParameters;
+  ControlResponse response;
+  try {
+    controlParameters.wireDecode
+      (interest.getName()[localhostRibPrefix_.size() + 1].getValue());
+
+    if (isRegister)
+      addRoute(controlParameters.getName(), faceId);
+    else
+      removeRoute(controlParameters.getName(), faceId);
+
+    response.setStatusCode(200);
+    response.setStatusText("OK");
+    response.setBodyAsControlParameters(&controlParameters);
+  } catch (const std::exception& ex) {
+    response.setStatusCode(400);
+    response.setStatusText("Malformed command");
+  }
+
+  Data data(interest.getName());
+  data.setContent(response.wireEncode());
+  sendToFace(faceId, data.wireEncode());
+}
+
+void
+LoopbackForwarder::sendNack
+  (uint64_t faceId, const Blob& interestPacket, int reason)
+{
+  // Encode the LpPacket with the Nack header field and the Interest fragment.
+  struct ndn_Blob fragment;
+  interestPacket.get(fragment);
+
+  TlvEncoder encoder(interestPacket.size() + 16);
+  size_t reasonLength = ndn_TlvEncoder_sizeOfNonNegativeInteger(reason);
+  size_t nackReasonLength =
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_NackReason) +
+    ndn_TlvEncoder_sizeOfVarNumber(reasonLength) + reasonLength;
+  size_t nackLength = ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_Nack) +
+    ndn_TlvEncoder_sizeOfVarNumber(nackReasonLength) + nackReasonLength;
+  size_t fragmentLength = ndn_TlvEncoder_sizeOfBlobTlv
+    (ndn_Tlv_LpPacket_Fragment, &fragment);
+
+  encoder.writeTypeAndLength
+    (ndn_Tlv_LpPacket_LpPacket, nackLength + fragmentLength);
+  encoder.writeTypeAndLength(ndn_Tlv_LpPacket_Nack, nackReasonLength);
+  encoder.writeNonNegativeIntegerTlv(ndn_Tlv_LpPacket_NackReason, reason);
+  encoder.writeBlobTlv(ndn_Tlv_LpPacket_Fragment, &fragment);
+
+  sendToFace(faceId, encoder.finish());
+}
+
+void
+LoopbackForwarder::sendToFace(uint64_t faceId, const Blob& packet)
+{
+  map<uint64_t, LoopbackTransport*>::iterator face = faces_.find(faceId);
+  if (face != faces_.end())
+    face->second->queuePacket(packet);
+}
+
+}
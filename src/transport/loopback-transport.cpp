@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../encoding/element-listener.hpp"
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
+
+using namespace std;
+
+namespace ndn {
+
+LoopbackTransport::ConnectionInfo::~ConnectionInfo()
+{
+}
+
+LoopbackTransport::LoopbackTransport()
+: elementListener_(0), faceId_(0)
+{
+}
+
+bool
+LoopbackTransport::isLocal(const Transport::ConnectionInfo& connectionInfo)
+{
+  return true;
+}
+
+bool
+LoopbackTransport::isAsync() { return false; }
+
+void
+LoopbackTransport::connect
+  (const Transport::ConnectionInfo& connectionInfo,
+   ElementListener& elementListener, const OnConnected& onConnected)
+{
+  const LoopbackTransport::ConnectionInfo& loopbackConnectionInfo =
+    dynamic_cast<const LoopbackTransport::ConnectionInfo&>(connectionInfo);
+
+  // Remove any previous face.
+  close();
+
+  forwarder_ = loopbackConnectionInfo.getForwarder();
+  elementListener_ = &elementListener;
+  faceId_ = forwarder_->addFace(this);
+
+  if (onConnected)
+    onConnected();
+}
+
+void
+LoopbackTransport::send(const uint8_t *data, size_t dataLength)
+{
+  if (!forwarder_)
+    throw runtime_error
+      ("Cannot send because the loopback transport is not connected");
+
+  forwarder_->onReceivedPacket(faceId_, Blob(data, dataLength));
+}
+
+void
+LoopbackTransport::processEvents()
+{
+  // Only deliver the packets which are already queued, since the listener can
+  // send packets which cause the forwarder to queue more.
+  size_t nPackets = queue_.size();
+  for (size_t i = 0; i < nPackets && !queue_.empty(); ++i) {
+    Blob packet = queue_.front();
+    queue_.pop_front();
+    if (elementListener_)
+      elementListener_->onReceivedElement(packet.buf(), packet.size());
+  }
+}
+
+bool
+LoopbackTransport::getIsConnected()
+{
+  return !!forwarder_;
+}
+
+void
+LoopbackTransport::close()
+{
+  if (forwarder_) {
+    forwarder_->removeFace(faceId_);
+    forwarder_.reset();
+  }
+
+  elementListener_ = 0;
+  faceId_ = 0;
+  queue_.clear();
+}
+
+LoopbackTransport::~LoopbackTransport()
+{
+  close();
+}
+
+}
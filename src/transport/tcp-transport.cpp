@@ -41,7 +41,8 @@ TcpTransport::ConnectionInfo::~ConnectionInfo()
 
 TcpTransport::TcpTransport()
   : isConnected_(false), transport_(new struct ndn_TcpTransport),
-    elementBuffer_(new DynamicUInt8Vector(1000)), connectionInfo_("", 0)
+    elementBuffer_(new DynamicUInt8Vector(1000)),
+    receiveBuffer_(NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE), connectionInfo_("", 0)
 {
   ndn_TcpTransport_initialize(transport_.get(), elementBuffer_.get());
 }
@@ -101,10 +102,9 @@ TcpTransport::send(const uint8_t *data, size_t dataLength)
 void
 TcpTransport::processEvents()
 {
-  uint8_t buffer[MAX_NDN_PACKET_SIZE];
   ndn_Error error;
   if ((error = ndn_TcpTransport_processEvents
-       (transport_.get(), buffer, sizeof(buffer))))
+       (transport_.get(), &receiveBuffer_[0], receiveBuffer_.size())))
     throw runtime_error(ndn_getErrorString(error));
 }
 
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #include "../c/transport/udp-transport.h"
 #include "../c/encoding/element-reader.h"
+#include "../c/encoding/tlv-0_2-wire-format.h"
+#include "../c/encoding/tlv/tlv-encoder.h"
+#include "../c/lp/lp-packet.h"
+#include "../c/util/crypto.h"
 #include "../encoding/element-listener.hpp"
 #include "../util/dynamic-uint8-vector.hpp"
 #include <ndn-cpp/transport/udp-transport.hpp>
@@ -39,11 +43,38 @@ UdpTransport::ConnectionInfo::~ConnectionInfo()
 {
 }
 
+/**
+ * Get the maximum encoding size of an LpPacket for a fragment with
+ * fragmentSize bytes. This is the LpPacket type and length, the fixed-width
+ * Sequence, the FragIndex and FragCount at their maximum size, and the
+ * Fragment TLV.
+ */
+static size_t
+getMaxLpPacketSize(size_t fragmentSize)
+{
+  size_t valueSize =
+    // The Sequence has an 8-byte value.
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_Sequence) + 1 + 8 +
+    // A NonNegativeInteger value has at most 8 bytes.
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_FragIndex) + 1 + 8 +
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_FragCount) + 1 + 8 +
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_Fragment) +
+    ndn_TlvEncoder_sizeOfVarNumber(fragmentSize) + fragmentSize;
+
+  return ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_LpPacket) +
+    ndn_TlvEncoder_sizeOfVarNumber(valueSize) + valueSize;
+}
+
 UdpTransport::UdpTransport()
   : isConnected_(false), transport_(new struct ndn_UdpTransport),
-    elementBuffer_(new DynamicUInt8Vector(1000))
+    elementBuffer_(new DynamicUInt8Vector(1000)), mtu_(0), nextSequence_(0),
+    receiveBufferSize_(0), receiveBuffer_(NDN_UDP_TRANSPORT_RECEIVE_BUFFER_SIZE)
 {
   ndn_UdpTransport_initialize(transport_.get(), elementBuffer_.get());
+
+  // Start the Sequence at a random value so that a restarted sender doesn't
+  // reuse the Sequence numbers of fragments still in the receiver's table.
+  ndn_generateRandomBytes((uint8_t*)&nextSequence_, sizeof(nextSequence_));
 }
 
 bool
@@ -68,6 +99,11 @@ UdpTransport::connect
        (transport_.get(), (char *)udpConnectionInfo.getHost().c_str(),
         udpConnectionInfo.getPort(), &elementListener)))
     throw runtime_error(ndn_getErrorString(error));
+  if (receiveBufferSize_ > 0) {
+    if ((error = ndn_UdpTransport_setReceiveBufferSize
+         (transport_.get(), receiveBufferSize_)))
+      throw runtime_error(ndn_getErrorString(error));
+  }
 
   isConnected_ = true;
   if (onConnected)
@@ -77,18 +113,98 @@ UdpTransport::connect
 void
 UdpTransport::send(const uint8_t *data, size_t dataLength)
 {
+  if (mtu_ > 0 && dataLength > mtu_) {
+    sendFragments(data, dataLength);
+    return;
+  }
+
   ndn_Error error;
   if ((error = ndn_UdpTransport_send(transport_.get(), data, dataLength)))
     throw runtime_error(ndn_getErrorString(error));
 }
 
+void
+UdpTransport::setMtu(size_t mtu)
+{
+  if (mtu != 0 && getMaxFragmentSize(mtu) == 0)
+    throw runtime_error
+      ("UdpTransport::setMtu: The MTU is too small for an NDNLPv2 fragment");
+
+  mtu_ = mtu;
+}
+
+void
+UdpTransport::setReceiveBufferSize(int receiveBufferSize)
+{
+  receiveBufferSize_ = receiveBufferSize;
+
+  if (isConnected_ && receiveBufferSize_ > 0) {
+    ndn_Error error;
+    if ((error = ndn_UdpTransport_setReceiveBufferSize
+         (transport_.get(), receiveBufferSize_)))
+      throw runtime_error(ndn_getErrorString(error));
+  }
+}
+
+size_t
+UdpTransport::getMaxFragmentSize(size_t mtu)
+{
+  size_t overhead = getMaxLpPacketSize(0);
+  if (mtu <= overhead)
+    return 0;
+
+  // The overhead grows with the size of the TLV length fields, so reduce the
+  // fragment size until the LpPacket fits.
+  size_t fragmentSize = mtu - overhead;
+  while (fragmentSize > 0 && getMaxLpPacketSize(fragmentSize) > mtu)
+    --fragmentSize;
+
+  return fragmentSize;
+}
+
+void
+UdpTransport::sendFragments(const uint8_t *data, size_t dataLength)
+{
+  if (!fragmentBuffer_)
+    fragmentBuffer_.reset(new DynamicUInt8Vector(mtu_));
+
+  size_t maxFragmentSize = getMaxFragmentSize(mtu_);
+  size_t fragCount = (dataLength + maxFragmentSize - 1) / maxFragmentSize;
+
+  struct ndn_LpPacket lpPacket;
+  ndn_LpPacket_initialize(&lpPacket, 0, 0);
+  lpPacket.hasSequence = 1;
+  lpPacket.fragCount = fragCount;
+
+  for (size_t fragIndex = 0; fragIndex < fragCount; ++fragIndex) {
+    size_t offset = fragIndex * maxFragmentSize;
+    size_t fragmentSize = dataLength - offset;
+    if (fragmentSize > maxFragmentSize)
+      fragmentSize = maxFragmentSize;
+
+    // The fragments of one packet have consecutive Sequence numbers.
+    lpPacket.sequence = nextSequence_++;
+    lpPacket.fragIndex = fragIndex;
+    ndn_Blob_initialize
+      (&lpPacket.fragmentWireEncoding, data + offset, fragmentSize);
+
+    ndn_Error error;
+    size_t encodingLength;
+    if ((error = ndn_Tlv0_2WireFormat_encodeLpPacket
+         (&lpPacket, fragmentBuffer_.get(), &encodingLength)))
+      throw runtime_error(ndn_getErrorString(error));
+    if ((error = ndn_UdpTransport_send
+         (transport_.get(), fragmentBuffer_->array, encodingLength)))
+      throw runtime_error(ndn_getErrorString(error));
+  }
+}
+
 void
 UdpTransport::processEvents()
 {
-  uint8_t buffer[MAX_NDN_PACKET_SIZE];
   ndn_Error error;
   if ((error = ndn_UdpTransport_processEvents
-       (transport_.get(), buffer, sizeof(buffer))))
+       (transport_.get(), &receiveBuffer_[0], receiveBuffer_.size())))
     throw runtime_error(ndn_getErrorString(error));
 }
 
@@ -41,7 +41,8 @@ UnixTransport::ConnectionInfo::~ConnectionInfo()
 
 UnixTransport::UnixTransport()
   : isConnected_(false), transport_(new struct ndn_UnixTransport),
-    elementBuffer_(new DynamicUInt8Vector(1000))
+    elementBuffer_(new DynamicUInt8Vector(1000)),
+    receiveBuffer_(NDN_ELEMENT_READER_RECEIVE_BUFFER_SIZE)
 {
   ndn_UnixTransport_initialize(transport_.get(), elementBuffer_.get());
 }
@@ -85,10 +86,9 @@ UnixTransport::send(const uint8_t *data, size_t dataLength)
 void
 UnixTransport::processEvents()
 {
-  uint8_t buffer[MAX_NDN_PACKET_SIZE];
   ndn_Error error;
   if ((error = ndn_UnixTransport_processEvents
-       (transport_.get(), buffer, sizeof(buffer))))
+       (transport_.get(), &receiveBuffer_[0], receiveBuffer_.size())))
     throw runtime_error(ndn_getErrorString(error));
 }
 
@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../c/util/time.h"
+#include <ndn-cpp/util/logging.hpp>
+#include <ndn-cpp/util/interest-retransmitter.hpp>
+
+INIT_LOGGER("ndn.InterestRetransmitter");
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+/**
+ * An InterestRetransmitter::Request holds the state of one expressInterest
+ * call. The Face callbacks hold a shared_ptr to it so that it remains
+ * allocated, and it holds a shared_ptr to its RttEstimator so that the
+ * InterestRetransmitter itself does not need to outlive the Interests.
+ */
+class InterestRetransmitter::Request
+  : public ptr_lib::enable_shared_from_this<InterestRetransmitter::Request> {
+public:
+  Request
+    (Face& face, const Interest& interest,
+     const ptr_lib::shared_ptr<RttEstimator>& rttEstimator, int maxRetries,
+     const OnData& onData, const OnTimeout& onTimeout,
+     const OnNetworkNack& onNetworkNack)
+  : face_(face), interest_(new Interest(interest)), rttEstimator_(rttEstimator),
+    maxRetries_(maxRetries), retryCount_(0), sendTime_(0), sendRto_(0),
+    callerOnData_(onData), callerOnTimeout_(onTimeout),
+    callerOnNetworkNack_(onNetworkNack)
+  {
+  }
+
+  void
+  send();
+
+private:
+  void
+  onData
+    (const ptr_lib::shared_ptr<const Interest>& interest,
+     const ptr_lib::shared_ptr<Data>& data);
+
+  void
+  onTimeout(const ptr_lib::shared_ptr<const Interest>& interest);
+
+  void
+  onNetworkNack
+    (const ptr_lib::shared_ptr<const Interest>& interest,
+     const ptr_lib::shared_ptr<NetworkNack>& networkNack);
+
+  /**
+   * Back off the RTO for a loss event. If the RTO has already grown since this
+   * Interest was sent, another Interest of the same loss event backed it off,
+   * so don't back it off again.
+   */
+  void
+  backoff();
+
+  /**
+   * If there are retries left, increment retryCount_ and return true.
+   */
+  bool
+  canRetry();
+
+  void
+  callOnTimeout();
+
+  Face& face_;
+  ptr_lib::shared_ptr<const Interest> interest_;
+  ptr_lib::shared_ptr<RttEstimator> rttEstimator_;
+  int maxRetries_;
+  int retryCount_;
+  MillisecondsSince1970 sendTime_;
+  // The RTO used as the lifetime of the last transmission.
+  Milliseconds sendRto_;
+  OnData callerOnData_;
+  OnTimeout callerOnTimeout_;
+  OnNetworkNack callerOnNetworkNack_;
+};
+
+void
+InterestRetransmitter::expressInterest
+  (const Interest& interest, const OnData& onData, const OnTimeout& onTimeout,
+   const OnNetworkNack& onNetworkNack)
+{
+  ptr_lib::shared_ptr<Request> request(new Request
+    (face_, interest, getRttEstimator(interest.getName().getPrefix(-1)),
+     maxRetries_, onData, onTimeout, onNetworkNack));
+  request->send();
+}
+
+ptr_lib::shared_ptr<RttEstimator>
+InterestRetransmitter::getRttEstimator(const Name& prefix)
+{
+  map<Name, RttEstimatorList::iterator>::iterator found =
+    rttEstimators_.find(prefix);
+  if (found != rttEstimators_.end()) {
+    // Move the prefix to the front as the most recently used.
+    rttEstimatorLru_.splice
+      (rttEstimatorLru_.begin(), rttEstimatorLru_, found->second);
+    return found->second->second;
+  }
+
+  ptr_lib::shared_ptr<RttEstimator> rttEstimator
+    (new RttEstimator(initialRto_, minRto_, maxRto_));
+  rttEstimatorLru_.push_front(make_pair(prefix, rttEstimator));
+  rttEstimators_[prefix] = rttEstimatorLru_.begin();
+  if (rttEstimatorLru_.size() > maxPrefixCount_) {
+    // A Request still holds a shared_ptr to the RttEstimator it uses.
+    rttEstimators_.erase(rttEstimatorLru_.back().first);
+    rttEstimatorLru_.pop_back();
+  }
+
+  return rttEstimator;
+}
+
+void
+InterestRetransmitter::Request::send()
+{
+  Interest interest(*interest_);
+  sendRto_ = rttEstimator_->getRto();
+  interest.setInterestLifetimeMilliseconds(sendRto_);
+  // Each transmission gets a new nonce.
+  interest.refreshNonce();
+
+  sendTime_ = ndn_getMonotonicMilliseconds();
+  face_.expressInterest
+    (interest, bind(&Request::onData, shared_from_this(), _1, _2),
+     bind(&Request::onTimeout, shared_from_this(), _1),
+     bind(&Request::onNetworkNack, shared_from_this(), _1, _2));
+}
+
+void
+InterestRetransmitter::Request::onData
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<Data>& data)
+{
+  // Karn's algorithm: Don't measure the RTT of a retransmitted Interest since
+  // the Data may answer an earlier transmission.
+  if (retryCount_ == 0)
+    rttEstimator_->addMeasurement(ndn_getMonotonicMilliseconds() - sendTime_);
+
+  try {
+    callerOnData_(interest_, data);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("InterestRetransmitter::onData: Error in onData: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("InterestRetransmitter::onData: Error in onData.");
+  }
+}
+
+void
+InterestRetransmitter::Request::onTimeout
+  (const ptr_lib::shared_ptr<const Interest>& interest)
+{
+  backoff();
+  if (canRetry()) {
+    _LOG_DEBUG("Retransmitting " << interest_->getName().toUri() <<
+               " with RTO " << rttEstimator_->getRto());
+    send();
+  }
+  else
+    callOnTimeout();
+}
+
+void
+InterestRetransmitter::Request::onNetworkNack
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<NetworkNack>& networkNack)
+{
+  ndn_NetworkNackReason reason = networkNack->getReason();
+  if (reason == ndn_NetworkNackReason_DUPLICATE && canRetry()) {
+    // The new nonce from send() resolves the duplicate.
+    send();
+    return;
+  }
+  if (reason == ndn_NetworkNackReason_CONGESTION && canRetry()) {
+    backoff();
+    face_.callLater
+      (rttEstimator_->getRto(), bind(&Request::send, shared_from_this()));
+    return;
+  }
+
+  if (callerOnNetworkNack_) {
+    try {
+      callerOnNetworkNack_(interest_, networkNack);
+    } catch (const std::exception& ex) {
+      _LOG_ERROR("InterestRetransmitter::onNetworkNack: Error in onNetworkNack: " <<
+                 ex.what());
+    } catch (...) {
+      _LOG_ERROR("InterestRetransmitter::onNetworkNack: Error in onNetworkNack.");
+    }
+  }
+  else
+    callOnTimeout();
+}
+
+void
+InterestRetransmitter::Request::backoff()
+{
+  if (rttEstimator_->getRto() <= sendRto_)
+    rttEstimator_->backoff();
+}
+
+bool
+InterestRetransmitter::Request::canRetry()
+{
+  if (retryCount_ >= maxRetries_)
+    return false;
+
+  ++retryCount_;
+  return true;
+}
+
+void
+InterestRetransmitter::Request::callOnTimeout()
+{
+  if (!callerOnTimeout_)
+    return;
+
+  try {
+    callerOnTimeout_(interest_);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("InterestRetransmitter::onTimeout: Error in onTimeout: " <<
+               ex.what());
+  } catch (...) {
+    _LOG_ERROR("InterestRetransmitter::onTimeout: Error in onTimeout.");
+  }
+}
+
+}
@@ -81,15 +81,21 @@ void
 SegmentFetcher::fetchNextSegment
   (const Interest& originalInterest, const Name& dataName, uint64_t segment)
 {
-  // Start with the original Interest to preserve any special selectors.
-  Interest interest(originalInterest);
-  // Changing a field clears the nonce so that the library will generate a new one.
-  interest.setChildSelector(0);
-  interest.setMustBeFresh(false);
-  interest.setName(dataName.getPrefix(-1).appendSegment(segment));
+  if (!segmentInterestTemplate_ ||
+      segmentInterestTemplate_->getPrefix().size() + 1 != dataName.size() ||
+      !segmentInterestTemplate_->getPrefix().isPrefixOf(dataName)) {
+    // Start with the original Interest to preserve any special selectors.
+    Interest interest(originalInterest);
+    interest.setChildSelector(0);
+    interest.setMustBeFresh(false);
+    interest.setName(dataName.getPrefix(-1));
+    // The template pre-encodes the prefix and selectors, so that each segment
+    // Interest only needs to encode the segment number and nonce.
+    segmentInterestTemplate_.reset(new InterestTemplate(interest));
+  }
 
   face_.expressInterest
-    (interest,
+    (*segmentInterestTemplate_, Name::Component::fromSegment(segment),
      bind(&SegmentFetcher::onSegmentReceived, shared_from_this(), _1, _2),
      bind(&SegmentFetcher::onTimeout, shared_from_this(), _1));
 }
@@ -31,7 +31,104 @@ using namespace std;
 
 namespace ndn {
 
+Sqlite3StatementCache::~Sqlite3StatementCache()
+{
+  // Finalize all statements, including any which were not released.
+  sqlite3_stmt* statement;
+  while ((statement = sqlite3_next_stmt(database_, 0)) != 0)
+    sqlite3_finalize(statement);
+}
+
+sqlite3_stmt*
+Sqlite3StatementCache::prepare(const string& sql)
+{
+  map<string, vector<sqlite3_stmt*> >::iterator idle = idleStatements_.find(sql);
+  if (idle != idleStatements_.end() && idle->second.size() > 0) {
+    sqlite3_stmt* statement = idle->second.back();
+    idle->second.pop_back();
+    return statement;
+  }
+
+  sqlite3_stmt* statement;
+  int result = sqlite3_prepare_v2(database_, sql.c_str(), -1, &statement, 0);
+  if (result != SQLITE_OK)
+    throwError_("Error preparing SQL statement: " + sql);
+
+  return statement;
+}
+
+void
+Sqlite3StatementCache::release(sqlite3_stmt* statement)
+{
+  sqlite3_reset(statement);
+  sqlite3_clear_bindings(statement);
+  // sqlite3_sql returns the SQL given to sqlite3_prepare_v2.
+  idleStatements_[sqlite3_sql(statement)].push_back(statement);
+}
+
+void
+Sqlite3StatementCache::beginTransaction()
+{
+  // A nested transaction is a savepoint. SQLite allows the same savepoint name
+  // to be nested, and uses the most recent one.
+  const char* sql = (transactionDepth_ == 0 ? "BEGIN" : "SAVEPOINT nested");
+  if (sqlite3_exec(database_, sql, NULL, NULL, NULL) != SQLITE_OK)
+    throwError_("Error beginning the SQL transaction");
+
+  ++transactionDepth_;
+}
+
+void
+Sqlite3StatementCache::commitTransaction()
+{
+  if (transactionDepth_ == 0)
+    throwError_("commitTransaction: There is no SQL transaction");
+
+  const char* sql = (transactionDepth_ == 1 ? "COMMIT" : "RELEASE nested");
+  if (sqlite3_exec(database_, sql, NULL, NULL, NULL) != SQLITE_OK)
+    // Keep the depth so that the caller can roll back.
+    throwError_("Error committing the SQL transaction");
+
+  --transactionDepth_;
+}
+
+void
+Sqlite3StatementCache::rollbackTransaction()
+{
+  if (transactionDepth_ == 0)
+    return;
+
+  if (transactionDepth_ == 1)
+    sqlite3_exec(database_, "ROLLBACK", NULL, NULL, NULL);
+  else
+    // ROLLBACK TO leaves the savepoint on the stack, so also release it.
+    sqlite3_exec
+      (database_, "ROLLBACK TO nested; RELEASE nested", NULL, NULL, NULL);
+  --transactionDepth_;
+}
+
+void
+Sqlite3StatementCache::enableWriteAheadLogging(const string& synchronous)
+{
+  if (!(synchronous == "OFF" || synchronous == "NORMAL" ||
+        synchronous == "FULL"))
+    throwError_("enableWriteAheadLogging: Unrecognized synchronous mode " +
+                synchronous);
+  // SQLite can't change the journal mode inside a transaction.
+  if (transactionDepth_ > 0)
+    throwError_("enableWriteAheadLogging: Cannot change the journal mode in a transaction");
+
+  if (sqlite3_exec
+      (database_, "PRAGMA journal_mode=WAL", NULL, NULL, NULL) != SQLITE_OK)
+    throwError_("Error setting the SQL journal mode");
+  if (sqlite3_exec
+      (database_, ("PRAGMA synchronous=" + synchronous).c_str(), NULL, NULL,
+       NULL) != SQLITE_OK)
+    throwError_("Error setting the SQL synchronous mode");
+}
+
 Sqlite3Statement::Sqlite3Statement(sqlite3* database, const string& statement)
+: cache_(0)
 {
   int result = sqlite3_prepare_v2(database, statement.c_str(), -1, &statement_, 0);
   if (result != SQLITE_OK)
@@ -40,7 +137,10 @@ Sqlite3Statement::Sqlite3Statement(sqlite3* database, const string& statement)
 
 Sqlite3Statement::~Sqlite3Statement()
 {
-  sqlite3_finalize(statement_);
+  if (cache_)
+    cache_->release(statement_);
+  else
+    sqlite3_finalize(statement_);
 }
 
 }
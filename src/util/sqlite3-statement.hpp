@@ -28,11 +28,186 @@
 #ifdef NDN_CPP_HAVE_SQLITE3
 
 #include <string>
+#include <map>
+#include <vector>
+#include <stdexcept>
 #include <sqlite3.h>
 #include <ndn-cpp/util/blob.hpp>
 
 namespace ndn {
 
+/**
+ * Sqlite3StatementCache holds the prepared statements for one SQLite3 database
+ * connection so that each SQL statement is compiled once and reused, instead of
+ * calling sqlite3_prepare_v2 and sqlite3_finalize for every query. It also
+ * provides nestable transactions to batch many changes into one commit.
+ * The owner of the database connection must destroy the Sqlite3StatementCache
+ * before calling sqlite3_close.
+ */
+class Sqlite3StatementCache
+{
+public:
+  /**
+   * A ThrowError function throws an exception with the message. The owner of
+   * the database connection uses this to set the exception type which is
+   * thrown by the cache, for example throwError<SecurityException>.
+   */
+  typedef void (*ThrowError)(const std::string& message);
+
+  /**
+   * Create an Sqlite3StatementCache for the database connection.
+   * @param database The handle to the open SQLite3 database.
+   * @param throwError (optional) The function to throw an error from prepare,
+   * beginTransaction or commitTransaction. If omitted, throw std::domain_error.
+   */
+  Sqlite3StatementCache
+    (sqlite3* database,
+     ThrowError throwError = &Sqlite3StatementCache::throwError<std::domain_error>)
+  : database_(database), throwError_(throwError), transactionDepth_(0)
+  {
+  }
+
+  /**
+   * Finalize all the statements of the database connection, including
+   * statements which were not released.
+   */
+  ~Sqlite3StatementCache();
+
+  /**
+   * Get an idle prepared statement for the SQL, or prepare a new one if there
+   * is no idle statement (for example if the same SQL is used in a nested
+   * query). When finished with the statement, call release(statement).
+   * @param sql The SQL statement.
+   * @return The prepared statement.
+   * @throws The exception from the ThrowError given to the constructor if the
+   * SQL statement is bad.
+   */
+  sqlite3_stmt*
+  prepare(const std::string& sql);
+
+  /**
+   * Reset the statement and clear its bindings, and save it to be returned by
+   * a later call to prepare with the same SQL.
+   * @param statement The statement from prepare.
+   */
+  void
+  release(sqlite3_stmt* statement);
+
+  /**
+   * Begin a transaction. If a transaction is already begun, begin a nested
+   * transaction as an SQLite savepoint so that only the outermost transaction
+   * is committed to the database.
+   * @throws The exception from the ThrowError given to the constructor if the
+   * transaction can't be begun.
+   */
+  void
+  beginTransaction();
+
+  /**
+   * Commit the transaction if this is the outermost commitTransaction which
+   * matches beginTransaction. Otherwise, release the savepoint of the nested
+   * transaction so that its changes are committed with the outer transaction.
+   * @throws The exception from the ThrowError given to the constructor if
+   * there is no transaction or if the commit fails.
+   */
+  void
+  commitTransaction();
+
+  /**
+   * Roll back the changes since the matching beginTransaction. For a nested
+   * transaction, this only rolls back to its savepoint, so the outer
+   * transaction can still be committed. If there is no transaction, do nothing.
+   */
+  void
+  rollbackTransaction();
+
+  /**
+   * Throw an exception of type Error with the message. This is a ThrowError
+   * function for the constructor.
+   * @param message The error message.
+   */
+  template<class Error> static void
+  throwError(const std::string& message) { throw Error(message); }
+
+  /**
+   * Set the database to use write-ahead logging, so that each commit appends to
+   * the log instead of rewriting the database file, and set the synchronous
+   * mode. SQLite keeps the log in files named like the database file with
+   * "-wal" and "-shm" appended. This has no effect for an in-memory database.
+   * @param synchronous The SQLite synchronous mode "OFF", "NORMAL" or "FULL".
+   * (With write-ahead logging, NORMAL only syncs at checkpoints and does not
+   * risk corrupting the database, but a power failure may roll back the last
+   * commits.)
+   * @throws The exception from the ThrowError given to the constructor if
+   * synchronous is not recognized, if a transaction is begun, or if setting the
+   * journal mode fails.
+   */
+  void
+  enableWriteAheadLogging(const std::string& synchronous);
+
+  sqlite3*
+  getDatabase() { return database_; }
+
+private:
+  // Disable the copy constructor and assignment operator.
+  Sqlite3StatementCache(const Sqlite3StatementCache& other);
+  Sqlite3StatementCache& operator=(const Sqlite3StatementCache& other);
+
+  sqlite3* database_;
+  ThrowError throwError_;
+  // The key is the SQL. The value is the list of idle prepared statements.
+  std::map<std::string, std::vector<sqlite3_stmt*> > idleStatements_;
+  int transactionDepth_;
+};
+
+/**
+ * Sqlite3Transaction begins a transaction in the constructor and rolls it back
+ * in the destructor unless commit() was called, so that an exception between
+ * the two doesn't leave the transaction open. It throws the exception type of
+ * the Sqlite3StatementCache. Transactions can be nested.
+ */
+class Sqlite3Transaction
+{
+public:
+  /**
+   * Begin a transaction with cache.beginTransaction().
+   * @param cache The Sqlite3StatementCache of the database.
+   */
+  Sqlite3Transaction(Sqlite3StatementCache& cache)
+  : cache_(cache), isFinished_(false)
+  {
+    cache_.beginTransaction();
+  }
+
+  /**
+   * Roll back the transaction if commit() was not called.
+   */
+  ~Sqlite3Transaction()
+  {
+    if (!isFinished_)
+      cache_.rollbackTransaction();
+  }
+
+  /**
+   * Commit the transaction with cache.commitTransaction(). If the commit
+   * fails, the destructor still rolls back.
+   */
+  void
+  commit()
+  {
+    cache_.commitTransaction();
+    isFinished_ = true;
+  }
+
+private:
+  // Disable the copy constructor and assignment operator.
+  Sqlite3Transaction(const Sqlite3Transaction& other);
+  Sqlite3Transaction& operator=(const Sqlite3Transaction& other);
+
+  Sqlite3StatementCache& cache_;
+  bool isFinished_;
+};
+
 /*
  * Sqlite3Statement is a utility class to wrap an SQLite3 prepared statement,
  * provide access methods, and finalize the statement in the destructor.
@@ -49,7 +224,21 @@ public:
   Sqlite3Statement(sqlite3* database, const std::string& statement);
 
   /**
-   * Finalize the statement.
+   * Create an Sqlite3Statement which gets the prepared statement from the cache
+   * and releases it back to the cache in the destructor.
+   * @param cache The Sqlite3StatementCache of the database.
+   * @param statement The SQL statement.
+   * @throws The exception from the ThrowError of the cache if the SQL
+   * statement is bad.
+   */
+  Sqlite3Statement(Sqlite3StatementCache& cache, const std::string& statement)
+  : statement_(cache.prepare(statement)), cache_(&cache)
+  {
+  }
+
+  /**
+   * Finalize the statement, or release it to the cache given to the
+   * constructor.
    */
   ~Sqlite3Statement();
 
@@ -180,12 +369,19 @@ public:
   int
   step() { return sqlite3_step(statement_); }
 
+  /**
+   * Get the prepared statement so that it can be passed to the SQLite3
+   * functions.
+   */
+  operator sqlite3_stmt*() { return statement_; }
+
 private:
   // Disable the copy constructor and assignment operator.
   Sqlite3Statement(const Sqlite3Statement& other);
   Sqlite3Statement& operator=(const Sqlite3Statement& other);
 
   sqlite3_stmt* statement_;
+  Sqlite3StatementCache* cache_;
 };
 
 }
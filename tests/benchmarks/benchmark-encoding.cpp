@@ -0,0 +1,232 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <ndn-cpp/ndn-cpp-config.h>
+#include <ndn-cpp/interest.hpp>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/encoding/tlv-wire-format.hpp>
+#include "../../src/c/encoding/element-reader.h"
+#include "../../src/encoding/element-listener.hpp"
+#include "../../src/util/dynamic-uint8-vector.hpp"
+#if NDN_CPP_HAVE_PROTOBUF
+#include <ndn-cpp/encoding/protobuf-tlv.hpp>
+#include "../../examples/fib-entry.pb.h"
+#endif
+#include "benchmark-harness.hpp"
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+class NameBenchmark {
+public:
+  NameBenchmark()
+  : uri_("/ndn/edu/ucla/remap/demo/ndn-js-test/hello.txt/%FDU%8D%9DM/%00%01"),
+    name_(uri_),
+    otherName_("/ndn/edu/ucla/remap/demo/ndn-js-test/hello.txt/%FDU%8D%9DM/%00%02"),
+    compareResult_(0)
+  {
+  }
+
+  void
+  parse() { parsedName_ = Name(uri_); }
+
+  void
+  toUri() { toUriResult_ = name_.toUri(); }
+
+  void
+  compare() { compareResult_ += name_.compare(otherName_); }
+
+private:
+  string uri_;
+  Name name_;
+  Name otherName_;
+  Name parsedName_;
+  string toUriResult_;
+  int compareResult_;
+};
+
+class InterestBenchmark {
+public:
+  InterestBenchmark()
+  : matchCount_(0)
+  {
+    interest_.setName(Name("/ndn/edu/ucla/remap/demo/ndn-js-test/hello.txt"));
+    interest_.setMustBeFresh(false);
+    interest_.setInterestLifetimeMilliseconds(4000);
+    interest_.getExclude().appendComponent(Name::Component("excluded"));
+    const uint8_t nonce[] = { 1, 2, 3, 4 };
+    interest_.setNonce(Blob(nonce, sizeof(nonce)));
+    encoding_ = interest_.wireEncode();
+
+    data_.setName(Name(interest_.getName()).appendVersion(1).appendSegment(0));
+  }
+
+  void
+  encode()
+  {
+    // Call the wire format directly to bypass the cached default encoding.
+    size_t signedPortionBeginOffset, signedPortionEndOffset;
+    encodeResult_ = TlvWireFormat::get()->encodeInterest
+      (interest_, &signedPortionBeginOffset, &signedPortionEndOffset);
+  }
+
+  void
+  decode() { decodedInterest_.wireDecode(encoding_); }
+
+  void
+  matchesData()
+  {
+    if (interest_.matchesData(data_))
+      ++matchCount_;
+  }
+
+private:
+  Interest interest_;
+  Blob encoding_;
+  Blob encodeResult_;
+  Interest decodedInterest_;
+  Data data_;
+  int matchCount_;
+};
+
+#if NDN_CPP_HAVE_PROTOBUF
+class ProtobufTlvBenchmark {
+public:
+  ProtobufTlvBenchmark()
+  {
+    message_.mutable_fib_entry()->mutable_name()->add_component("ndn");
+    message_.mutable_fib_entry()->mutable_name()->add_component("ucla");
+    for (int i = 0; i < 4; ++i) {
+      ndn_message::FibEntryMessage_NextHopRecord& nextHopRecord =
+        *message_.mutable_fib_entry()->add_next_hop_records();
+      nextHopRecord.set_face_id(16 + i);
+      nextHopRecord.set_cost(i);
+    }
+    encoding_ = ProtobufTlv::encode(message_);
+  }
+
+  void
+  encode() { encodeResult_ = ProtobufTlv::encode(message_); }
+
+  void
+  decode()
+  {
+    ndn_message::FibEntryMessage message;
+    ProtobufTlv::decode(message, encoding_);
+  }
+
+private:
+  ndn_message::FibEntryMessage message_;
+  Blob encoding_;
+  Blob encodeResult_;
+};
+#endif
+
+/**
+ * The ElementReaderBenchmark frames a buffer of concatenated Data packets,
+ * either in one call or in chunks as from a stream socket.
+ */
+class ElementReaderBenchmark : public ElementListener {
+public:
+  ElementReaderBenchmark(int nPackets, size_t chunkSize)
+  : nPackets_(nPackets), chunkSize_(chunkSize), elementBuffer_(1000),
+    nElements_(0)
+  {
+    ndn_ElementReader_initialize(&elementReader_, this, &elementBuffer_);
+
+    for (int i = 0; i < nPackets; ++i) {
+      Data data(Name("/ndn/edu/ucla/remap/benchmark").appendSegment(i));
+      string content(100, 'x');
+      data.setContent((const uint8_t*)&content[0], content.size());
+      Blob encoding = data.wireEncode();
+      buffer_.insert
+        (buffer_.end(), encoding.buf(), encoding.buf() + encoding.size());
+    }
+  }
+
+  virtual void
+  onReceivedElement(const uint8_t *element, size_t elementLength)
+  {
+    ++nElements_;
+  }
+
+  void
+  frame()
+  {
+    nElements_ = 0;
+    for (size_t offset = 0; offset < buffer_.size(); offset += chunkSize_) {
+      ndn_Error error;
+      if ((error = ndn_ElementReader_onReceivedData
+           (&elementReader_, &buffer_[offset],
+            min(chunkSize_, buffer_.size() - offset))))
+        throw runtime_error(ndn_getErrorString(error));
+    }
+
+    if (nElements_ != nPackets_)
+      throw runtime_error("ElementReaderBenchmark: Wrong number of elements");
+  }
+
+private:
+  int nPackets_;
+  size_t chunkSize_;
+  vector<uint8_t> buffer_;
+  DynamicUInt8Vector elementBuffer_;
+  struct ndn_ElementReader elementReader_;
+  int nElements_;
+};
+
+void
+runEncodingBenchmarks(BenchmarkHarness& harness)
+{
+  NameBenchmark name;
+  harness.run("name/parse", bind(&NameBenchmark::parse, &name));
+  harness.run("name/to-uri", bind(&NameBenchmark::toUri, &name));
+  harness.run("name/compare", bind(&NameBenchmark::compare, &name));
+
+  InterestBenchmark interest;
+  harness.run("interest/encode", bind(&InterestBenchmark::encode, &interest));
+  harness.run("interest/decode", bind(&InterestBenchmark::decode, &interest));
+  harness.run
+    ("interest/matches-data", bind(&InterestBenchmark::matchesData, &interest));
+
+#if NDN_CPP_HAVE_PROTOBUF
+  ProtobufTlvBenchmark protobufTlv;
+  harness.run
+    ("protobuf-tlv/encode", bind(&ProtobufTlvBenchmark::encode, &protobufTlv));
+  harness.run
+    ("protobuf-tlv/decode", bind(&ProtobufTlvBenchmark::decode, &protobufTlv));
+#endif
+
+  // Frame 64 packets with the whole buffer at once, then in small chunks.
+  ElementReaderBenchmark wholeBuffer(64, 65536);
+  harness.run
+    ("element-reader/64-packets-whole",
+     bind(&ElementReaderBenchmark::frame, &wholeBuffer));
+  ElementReaderBenchmark chunked(64, 100);
+  harness.run
+    ("element-reader/64-packets-100-byte-chunks",
+     bind(&ElementReaderBenchmark::frame, &chunked));
+}
+
+}
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include <ndn-cpp/face.hpp>
+#include <ndn-cpp/security/key-chain.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
+#include <ndn-cpp/util/memory-content-cache.hpp>
+#include "../../src/c/util/time.h"
+#include "../../src/impl/delayed-call-table.hpp"
+#include "../../src/impl/interest-filter-table.hpp"
+#include "../../src/impl/pending-interest-table.hpp"
+#include "benchmark-harness.hpp"
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+static Name
+makeName(const string& prefix, int i)
+{
+  ostringstream uri;
+  uri << prefix << "/" << i;
+  return Name(uri.str());
+}
+
+/**
+ * The PendingInterestTableBenchmark fills the table with unrelated entries,
+ * then adds and extracts one entry as Node does for expressInterest and an
+ * incoming Data packet.
+ */
+class PendingInterestTableBenchmark {
+public:
+  PendingInterestTableBenchmark(int nEntries)
+  : lastEntryId_(0),
+    interest_(new Interest(Name("/benchmark/pit/target"))),
+    data_(Name("/benchmark/pit/target"))
+  {
+    for (int i = 0; i < nEntries; ++i)
+      table_.add
+        (++lastEntryId_, ptr_lib::make_shared<Interest>
+           (makeName("/benchmark/pit/other", i)),
+         OnData(), OnTimeout(), OnNetworkNack());
+  }
+
+  void
+  addAndExtract()
+  {
+    table_.add(++lastEntryId_, interest_, OnData(), OnTimeout(), OnNetworkNack());
+
+    vector<ptr_lib::shared_ptr<PendingInterestTable::Entry> > entries;
+    table_.extractEntriesForExpressedInterest(data_, entries);
+    if (entries.size() != 1)
+      throw runtime_error
+        ("PendingInterestTableBenchmark: Wrong number of entries");
+  }
+
+private:
+  PendingInterestTable table_;
+  uint64_t lastEntryId_;
+  ptr_lib::shared_ptr<const Interest> interest_;
+  Data data_;
+};
+
+/**
+ * The InterestFilterTableBenchmark fills the table with filters for different
+ * prefixes and finds the filter for an incoming Interest.
+ */
+class InterestFilterTableBenchmark {
+public:
+  InterestFilterTableBenchmark(int nEntries)
+  : interest_(Name(makeName("/benchmark/filter", nEntries / 2)).append("data"))
+  {
+    for (int i = 0; i < nEntries; ++i)
+      table_.setInterestFilter
+        (i + 1, ptr_lib::make_shared<InterestFilter>
+           (makeName("/benchmark/filter", i)),
+         OnInterestCallback(), 0);
+  }
+
+  void
+  getMatchedFilters()
+  {
+    vector<ptr_lib::shared_ptr<InterestFilterTable::Entry> > matchedFilters;
+    table_.getMatchedFilters(interest_, matchedFilters);
+    if (matchedFilters.size() != 1)
+      throw runtime_error
+        ("InterestFilterTableBenchmark: Wrong number of filters");
+  }
+
+private:
+  InterestFilterTable table_;
+  Interest interest_;
+};
+
+/**
+ * The DelayedCallTableBenchmark fills the table with calls far in the future,
+ * then adds and calls one immediate call.
+ */
+class DelayedCallTableBenchmark {
+public:
+  DelayedCallTableBenchmark(int nEntries)
+  : nCalls_(0)
+  {
+    for (int i = 0; i < nEntries; ++i)
+      table_.callLater
+        (1e9 + i, bind(&DelayedCallTableBenchmark::onCall, this));
+  }
+
+  void
+  callLaterAndCallTimedOut()
+  {
+    int nCalls = nCalls_;
+    table_.callLater(0, bind(&DelayedCallTableBenchmark::onCall, this));
+    table_.callTimedOut();
+    if (nCalls_ != nCalls + 1)
+      throw runtime_error("DelayedCallTableBenchmark: The call was not made");
+  }
+
+private:
+  void
+  onCall() { ++nCalls_; }
+
+  DelayedCallTable table_;
+  int nCalls_;
+};
+
+/**
+ * The MemoryContentCacheBenchmark fills a MemoryContentCache on a Face which
+ * uses a LoopbackTransport, then gives Interests to the transport as if
+ * received from the forwarder. Each iteration includes decoding the Interest,
+ * the Face dispatch, the cache lookup and putData of the found Data, which the
+ * forwarder drops.
+ */
+class MemoryContentCacheBenchmark {
+public:
+  MemoryContentCacheBenchmark(int nEntries, KeyChain& keyChain)
+  : transport_(new LoopbackTransport()),
+    face_(transport_, ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>
+      (ptr_lib::make_shared<LoopbackForwarder>())),
+    memoryContentCache_(&face_, 1e9), nextInterest_(0), isRegistered_(false)
+  {
+    face_.setCommandSigningInfo(keyChain, keyChain.getDefaultCertificateName());
+
+    Name prefix("/benchmark/memory-content-cache");
+    memoryContentCache_.registerPrefix
+      (prefix, bind(&MemoryContentCacheBenchmark::onRegisterFailed, this, _1),
+       bind(&MemoryContentCacheBenchmark::onRegisterSuccess, this, _1, _2));
+    MillisecondsSince1970 timeout = ndn_getNowMilliseconds() + 5000;
+    while (!isRegistered_) {
+      if (ndn_getNowMilliseconds() > timeout)
+        throw runtime_error
+          ("MemoryContentCacheBenchmark: Timeout registering the prefix");
+      face_.processEvents();
+    }
+
+    for (int i = 0; i < nEntries; ++i) {
+      Data data(makeName(prefix.toUri(), i));
+      data.getMetaInfo().setFreshnessPeriod(3600 * 1000.0);
+      string content(100, 'x');
+      data.setContent((const uint8_t*)&content[0], content.size());
+      memoryContentCache_.add(data);
+    }
+
+    // Spread the Interests over the cache.
+    for (int i = 0; i < 64; ++i)
+      interestEncodings_.push_back
+        (Interest(makeName(prefix.toUri(), (i * nEntries) / 64)).wireEncode());
+  }
+
+  void
+  lookup()
+  {
+    transport_->queuePacket(interestEncodings_[nextInterest_]);
+    nextInterest_ = (nextInterest_ + 1) % interestEncodings_.size();
+    face_.processEvents();
+  }
+
+private:
+  void
+  onRegisterFailed(const ptr_lib::shared_ptr<const Name>& prefix)
+  {
+    throw runtime_error
+      ("MemoryContentCacheBenchmark: Register failed for " + prefix->toUri());
+  }
+
+  void
+  onRegisterSuccess
+    (const ptr_lib::shared_ptr<const Name>& prefix, uint64_t registeredPrefixId)
+  {
+    isRegistered_ = true;
+  }
+
+  ptr_lib::shared_ptr<LoopbackTransport> transport_;
+  Face face_;
+  MemoryContentCache memoryContentCache_;
+  vector<Blob> interestEncodings_;
+  size_t nextInterest_;
+  bool isRegistered_;
+};
+
+void
+runFaceBenchmarks(BenchmarkHarness& harness)
+{
+  const int tableSizes[] = { 100, 10000 };
+  for (size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); ++i) {
+    ostringstream suffix;
+    suffix << "/" << tableSizes[i] << "-entries";
+
+    if (harness.isEnabled("pit/add-extract" + suffix.str())) {
+      PendingInterestTableBenchmark pit(tableSizes[i]);
+      harness.run
+        ("pit/add-extract" + suffix.str(),
+         bind(&PendingInterestTableBenchmark::addAndExtract, &pit));
+    }
+    if (harness.isEnabled("interest-filter-table/match" + suffix.str())) {
+      InterestFilterTableBenchmark filterTable(tableSizes[i]);
+      harness.run
+        ("interest-filter-table/match" + suffix.str(),
+         bind(&InterestFilterTableBenchmark::getMatchedFilters, &filterTable));
+    }
+    if (harness.isEnabled("delayed-call-table/call" + suffix.str())) {
+      DelayedCallTableBenchmark delayedCallTable(tableSizes[i]);
+      harness.run
+        ("delayed-call-table/call" + suffix.str(),
+         bind(&DelayedCallTableBenchmark::callLaterAndCallTimedOut,
+              &delayedCallTable));
+    }
+  }
+
+  // Only make the KeyChain for registerPrefix if needed.
+  ptr_lib::shared_ptr<KeyChain> keyChain;
+  for (size_t i = 0; i < sizeof(tableSizes) / sizeof(tableSizes[0]); ++i) {
+    ostringstream name;
+    name << "memory-content-cache/lookup/" << tableSizes[i] << "-entries";
+    if (!harness.isEnabled(name.str()))
+      continue;
+
+    if (!keyChain) {
+      keyChain.reset(new KeyChain("pib-memory:", "tpm-memory:"));
+      keyChain->createIdentityV2(Name("/benchmark/identity"));
+    }
+    MemoryContentCacheBenchmark memoryContentCache(tableSizes[i], *keyChain);
+    harness.run
+      (name.str(),
+       bind(&MemoryContentCacheBenchmark::lookup, &memoryContentCache));
+  }
+}
+
+}
@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <time.h>
+#include <ndn-cpp/ndn-cpp-config.h>
+#include "../../src/c/util/time.h"
+#include "benchmark-harness.hpp"
+
+using namespace std;
+
+namespace ndn {
+
+/**
+ * Return the value as a quoted JSON string.
+ */
+static string
+toJsonString(const string& value)
+{
+  ostringstream result;
+  result << '"';
+  for (size_t i = 0; i < value.size(); ++i) {
+    char c = value[i];
+    if (c == '"' || c == '\\')
+      result << '\\' << c;
+    else if (c == '\n')
+      result << "\\n";
+    else if ((unsigned char)c < 0x20)
+      result << "\\u" << hex << setw(4) << setfill('0') << (int)c << dec;
+    else
+      result << c;
+  }
+  result << '"';
+
+  return result.str();
+}
+
+BenchmarkHarness::BenchmarkHarness(int argc, char** argv)
+: nRepetitions_(15), nWarmupRepetitions_(3), minRepetitionSeconds_(0.01)
+{
+  for (int i = 1; i < argc; ++i) {
+    string option = argv[i];
+    if (i + 1 >= argc)
+      throw runtime_error("Missing value for option " + option);
+    string value = argv[++i];
+
+    if (option == "--filter")
+      filter_ = value;
+    else if (option == "--json")
+      jsonFilePath_ = value;
+    else if (option == "--repetitions")
+      nRepetitions_ = max(1, atoi(value.c_str()));
+    else if (option == "--warmup")
+      nWarmupRepetitions_ = max(0, atoi(value.c_str()));
+    else if (option == "--min-time")
+      minRepetitionSeconds_ = max(0.0, atof(value.c_str()));
+    else
+      throw runtime_error("Unrecognized option " + option);
+  }
+}
+
+bool
+BenchmarkHarness::isEnabled(const string& name) const
+{
+  return filter_.empty() || name.find(filter_) != string::npos;
+}
+
+void
+BenchmarkHarness::run(const string& name, const Operation& operation)
+{
+  if (!isEnabled(name))
+    return;
+
+  Result result(name);
+  try {
+    // Find the number of iterations for the minimum repetition time. This
+    // also warms up the operation.
+    int nIterations = 1;
+    while (timeIterations(operation, nIterations) < minRepetitionSeconds_ &&
+           nIterations < (1 << 30))
+      nIterations *= 2;
+
+    for (int i = 0; i < nWarmupRepetitions_; ++i)
+      timeIterations(operation, nIterations);
+
+    vector<double> nanoseconds;
+    for (int i = 0; i < nRepetitions_; ++i)
+      nanoseconds.push_back
+        (timeIterations(operation, nIterations) * 1e9 / nIterations);
+
+    double sum = 0;
+    for (size_t i = 0; i < nanoseconds.size(); ++i)
+      sum += nanoseconds[i];
+    double mean = sum / nanoseconds.size();
+    double sumOfSquares = 0;
+    for (size_t i = 0; i < nanoseconds.size(); ++i)
+      sumOfSquares += (nanoseconds[i] - mean) * (nanoseconds[i] - mean);
+
+    sort(nanoseconds.begin(), nanoseconds.end());
+    result.nIterations_ = nIterations;
+    result.mean_ = mean;
+    result.standardDeviation_ = sqrt(sumOfSquares / nanoseconds.size());
+    result.min_ = nanoseconds.front();
+    result.p50_ = getPercentile(nanoseconds, 50);
+    result.p90_ = getPercentile(nanoseconds, 90);
+    result.max_ = nanoseconds.back();
+
+    cout << left << setw(44) << name << right << fixed << setprecision(1)
+         << " p50 " << setw(12) << result.p50_ << " ns"
+         << "  p90 " << setw(12) << result.p90_ << " ns"
+         << "  " << setw(12) << (1e9 / result.p50_) << " Hz" << endl;
+  } catch (const std::exception& ex) {
+    result.error_ = ex.what();
+    cout << left << setw(44) << name << " ERROR: " << result.error_ << endl;
+  }
+
+  results_.push_back(result);
+}
+
+int
+BenchmarkHarness::finish()
+{
+  int exitCode = 0;
+  for (size_t i = 0; i < results_.size(); ++i) {
+    if (!results_[i].error_.empty())
+      exitCode = 1;
+  }
+
+  if (!jsonFilePath_.empty()) {
+    ofstream output(jsonFilePath_.c_str());
+    writeJson(output);
+    output.close();
+    if (output.fail()) {
+      cout << "Error writing " << jsonFilePath_ << endl;
+      exitCode = 1;
+    }
+    else
+      cout << "Wrote " << jsonFilePath_ << endl;
+  }
+
+  return exitCode;
+}
+
+double
+BenchmarkHarness::timeIterations(const Operation& operation, int nIterations)
+{
+  // Use the monotonic clock so that a change to the system time doesn't skew
+  // the result.
+  double start = ndn_getMonotonicMilliseconds();
+  for (int i = 0; i < nIterations; ++i)
+    operation();
+  return (ndn_getMonotonicMilliseconds() - start) / 1000.0;
+}
+
+double
+BenchmarkHarness::getPercentile
+  (const vector<double>& sortedValues, double percentile)
+{
+  double rank = percentile / 100.0 * (sortedValues.size() - 1);
+  size_t lower = (size_t)floor(rank);
+  size_t upper = (size_t)ceil(rank);
+  return sortedValues[lower] +
+    (rank - lower) * (sortedValues[upper] - sortedValues[lower]);
+}
+
+void
+BenchmarkHarness::writeJson(ostream& output) const
+{
+  time_t now = time(0);
+  char timestamp[32];
+  strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+  output << fixed << setprecision(1);
+  output << "{" << endl;
+  output << "  \"library\": \"ndn-cpp\"," << endl;
+  output << "  \"version\": " << toJsonString(NDN_CPP_PACKAGE_VERSION) << ","
+         << endl;
+  output << "  \"timestamp\": " << toJsonString(timestamp) << "," << endl;
+  output << "  \"repetitions\": " << nRepetitions_ << "," << endl;
+  output << "  \"warmupRepetitions\": " << nWarmupRepetitions_ << "," << endl;
+  output << "  \"unit\": \"ns\"," << endl;
+  output << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results_.size(); ++i) {
+    const Result& result = results_[i];
+    output << (i == 0 ? "" : ",") << endl;
+    output << "    {\"name\": " << toJsonString(result.name_);
+    if (!result.error_.empty())
+      output << ", \"error\": " << toJsonString(result.error_);
+    else
+      output << ", \"iterations\": " << result.nIterations_
+             << ", \"mean\": " << result.mean_
+             << ", \"stddev\": " << result.standardDeviation_
+             << ", \"min\": " << result.min_
+             << ", \"p50\": " << result.p50_
+             << ", \"p90\": " << result.p90_
+             << ", \"max\": " << result.max_;
+    output << "}";
+  }
+  output << endl << "  ]" << endl << "}" << endl;
+}
+
+}
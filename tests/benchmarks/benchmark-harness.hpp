@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_BENCHMARK_HARNESS_HPP
+#define NDN_BENCHMARK_HARNESS_HPP
+
+#include <string>
+#include <vector>
+#include <ndn-cpp/common.hpp>
+
+namespace ndn {
+
+/**
+ * A BenchmarkHarness times operations for the benchmark suite. For each
+ * benchmark, it first doubles the number of iterations per repetition until
+ * one repetition takes at least the minimum time, then runs the warmup
+ * repetitions which are not recorded, then runs the measured repetitions. It
+ * reports the mean, standard deviation, minimum, maximum, median and 90th
+ * percentile of the per-iteration time of each measured repetition, and can
+ * write all results as JSON so that runs from different releases can be
+ * compared. Since each repetition is one sample, a higher percentile would
+ * need many more repetitions to be meaningful.
+ */
+class BenchmarkHarness {
+public:
+  /**
+   * An Operation is called once for each iteration.
+   */
+  typedef func_lib::function<void()> Operation;
+
+  /**
+   * Create a BenchmarkHarness and parse the command-line options:
+   *   --filter SUBSTRING  Only run benchmarks whose name has SUBSTRING.
+   *   --json FILE         Write the results as JSON to FILE.
+   *   --repetitions N     The number of measured repetitions (default 15).
+   *   --warmup N          The number of warmup repetitions (default 3).
+   *   --min-time SECONDS  The minimum duration of one repetition (default 0.01).
+   * @param argc The argc from main.
+   * @param argv The argv from main.
+   * @throws std::runtime_error for an unrecognized option.
+   */
+  BenchmarkHarness(int argc, char** argv);
+
+  /**
+   * Check if the benchmark with the name should run, according to --filter.
+   * A benchmark with expensive setup can check this before the setup.
+   * @param name The benchmark name.
+   * @return True if the benchmark should run.
+   */
+  bool
+  isEnabled(const std::string& name) const;
+
+  /**
+   * Run the benchmark and print its results. If the operation throws an
+   * exception, print it and record it as an error for finish().
+   * @param name The benchmark name, such as "name/parse". This should be
+   * unique and stable across releases since it is used to compare results.
+   * @param operation The operation to time.
+   */
+  void
+  run(const std::string& name, const Operation& operation);
+
+  /**
+   * Write the JSON file if requested.
+   * @return The exit code for main, which is 1 if a benchmark had an error or
+   * the JSON file could not be written, otherwise 0.
+   */
+  int
+  finish();
+
+private:
+  class Result {
+  public:
+    Result(const std::string& name)
+    : name_(name), nIterations_(0), mean_(0), standardDeviation_(0), min_(0),
+      p50_(0), p90_(0), max_(0)
+    {
+    }
+
+    std::string name_;
+    std::string error_;
+    int nIterations_;
+    // The following are nanoseconds per iteration.
+    double mean_;
+    double standardDeviation_;
+    double min_;
+    double p50_;
+    double p90_;
+    double max_;
+  };
+
+  /**
+   * Call the operation nIterations times.
+   * @return The duration in seconds from the monotonic clock.
+   */
+  static double
+  timeIterations(const Operation& operation, int nIterations);
+
+  /**
+   * Get the percentile of the sorted values, interpolating between the
+   * closest ranks.
+   */
+  static double
+  getPercentile(const std::vector<double>& sortedValues, double percentile);
+
+  void
+  writeJson(std::ostream& output) const;
+
+  std::string filter_;
+  std::string jsonFilePath_;
+  int nRepetitions_;
+  int nWarmupRepetitions_;
+  double minRepetitionSeconds_;
+  std::vector<Result> results_;
+};
+
+/**
+ * Run the benchmarks for Name, Interest, ProtobufTlv and ElementReader.
+ */
+void
+runEncodingBenchmarks(BenchmarkHarness& harness);
+
+/**
+ * Run the benchmarks for the Face tables and MemoryContentCache.
+ */
+void
+runFaceBenchmarks(BenchmarkHarness& harness);
+
+/**
+ * Run the benchmarks for KeyChain signing and Validator verification.
+ */
+void
+runSecurityBenchmarks(BenchmarkHarness& harness);
+
+/**
+ * Run the benchmarks for DigestTree.
+ */
+void
+runSyncBenchmarks(BenchmarkHarness& harness);
+
+}
+
+#endif
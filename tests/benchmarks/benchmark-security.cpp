@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <ndn-cpp/security/key-chain.hpp>
+#include <ndn-cpp/security/v2/validation-policy-from-pib.hpp>
+#include <ndn-cpp/security/v2/validator.hpp>
+#include "benchmark-harness.hpp"
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+/**
+ * The SignVerifyBenchmark signs a Data packet with a key in an in-memory
+ * KeyChain and verifies it with a Validator which trusts the PIB.
+ */
+class SignVerifyBenchmark {
+public:
+  SignVerifyBenchmark
+    (KeyChain& keyChain, const Name& identityName, const KeyParams& keyParams)
+  : keyChain_(keyChain),
+    validator_(ptr_lib::make_shared<ValidationPolicyFromPib>(keyChain.getPib())),
+    nVerified_(0)
+  {
+    signingInfo_ = SigningInfo
+      (keyChain.createIdentityV2(identityName, keyParams));
+
+    data_.setName(Name("/benchmark/sign/data"));
+    string content(100, 'x');
+    data_.setContent((const uint8_t*)&content[0], content.size());
+    keyChain_.sign(data_, signingInfo_);
+  }
+
+  void
+  sign() { keyChain_.sign(data_, signingInfo_); }
+
+  void
+  verify()
+  {
+    int nVerified = nVerified_;
+    validator_.validate
+      (data_, bind(&SignVerifyBenchmark::onSuccess, this, _1),
+       bind(&SignVerifyBenchmark::onFailure, this, _1, _2));
+    if (nVerified_ != nVerified + 1)
+      throw runtime_error("SignVerifyBenchmark: Verification failed: " + error_);
+  }
+
+private:
+  void
+  onSuccess(const Data& data) { ++nVerified_; }
+
+  void
+  onFailure(const Data& data, const ValidationError& error)
+  {
+    error_ = error.getInfo();
+  }
+
+  KeyChain& keyChain_;
+  SigningInfo signingInfo_;
+  Validator validator_;
+  Data data_;
+  int nVerified_;
+  string error_;
+};
+
+/**
+ * The HmacBenchmark signs and verifies a Data packet with HmacWithSha256.
+ * The Validator only supports public key signatures, so this uses the static
+ * KeyChain methods.
+ */
+class HmacBenchmark {
+public:
+  HmacBenchmark()
+  {
+    const uint8_t key[] = {
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+    };
+    key_ = Blob(key, sizeof(key));
+
+    data_.setName(Name("/benchmark/sign/data"));
+    string content(100, 'x');
+    data_.setContent((const uint8_t*)&content[0], content.size());
+    KeyChain::signWithHmacWithSha256(data_, key_);
+  }
+
+  void
+  sign() { KeyChain::signWithHmacWithSha256(data_, key_); }
+
+  void
+  verify()
+  {
+    if (!KeyChain::verifyDataWithHmacWithSha256(data_, key_))
+      throw runtime_error("HmacBenchmark: Verification failed");
+  }
+
+private:
+  Blob key_;
+  Data data_;
+};
+
+void
+runSecurityBenchmarks(BenchmarkHarness& harness)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  if (harness.isEnabled("key-chain/sign/rsa") ||
+      harness.isEnabled("validator/verify/rsa")) {
+    SignVerifyBenchmark rsa
+      (keyChain, Name("/benchmark/identity/rsa"), RsaKeyParams());
+    harness.run("key-chain/sign/rsa", bind(&SignVerifyBenchmark::sign, &rsa));
+    harness.run("validator/verify/rsa", bind(&SignVerifyBenchmark::verify, &rsa));
+  }
+
+  if (harness.isEnabled("key-chain/sign/ecdsa") ||
+      harness.isEnabled("validator/verify/ecdsa")) {
+    SignVerifyBenchmark ecdsa
+      (keyChain, Name("/benchmark/identity/ecdsa"), EcKeyParams());
+    harness.run
+      ("key-chain/sign/ecdsa", bind(&SignVerifyBenchmark::sign, &ecdsa));
+    harness.run
+      ("validator/verify/ecdsa", bind(&SignVerifyBenchmark::verify, &ecdsa));
+  }
+
+  HmacBenchmark hmac;
+  harness.run("key-chain/sign/hmac", bind(&HmacBenchmark::sign, &hmac));
+  harness.run("key-chain/verify/hmac", bind(&HmacBenchmark::verify, &hmac));
+}
+
+}
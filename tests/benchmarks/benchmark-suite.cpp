@@ -0,0 +1,50 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+/**
+ * The benchmark suite for "make benchmark". See BenchmarkHarness for the
+ * command-line options. To compare releases, run with --json FILE and compare
+ * the p50 of each benchmark name.
+ */
+
+#include <iostream>
+#include "benchmark-harness.hpp"
+
+using namespace std;
+using namespace ndn;
+
+int
+main(int argc, char** argv)
+{
+  try {
+    BenchmarkHarness harness(argc, argv);
+
+    runEncodingBenchmarks(harness);
+    runFaceBenchmarks(harness);
+    runSecurityBenchmarks(harness);
+    runSyncBenchmarks(harness);
+
+    return harness.finish();
+  } catch (std::exception& e) {
+    cout << "exception: " << e.what() << endl;
+    return 1;
+  }
+}
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include "../../src/sync/digest-tree.hpp"
+#include "benchmark-harness.hpp"
+
+using namespace std;
+using namespace ndn::func_lib;
+
+namespace ndn {
+
+/**
+ * The DigestTreeBenchmark adds the members to a DigestTree, then updates the
+ * sequence number of each member in turn, which recomputes the root digest.
+ */
+class DigestTreeBenchmark {
+public:
+  DigestTreeBenchmark(int nMembers)
+  : nextMember_(0)
+  {
+    for (int i = 0; i < nMembers; ++i) {
+      ostringstream dataPrefix;
+      dataPrefix << "/ndn/edu/ucla/remap/benchmark/member" << i;
+      dataPrefixes_.push_back(dataPrefix.str());
+      sequenceNos_.push_back(0);
+      digestTree_.update(dataPrefix.str(), 1, 0);
+    }
+  }
+
+  void
+  update()
+  {
+    if (!digestTree_.update
+        (dataPrefixes_[nextMember_], 1, ++sequenceNos_[nextMember_]))
+      throw runtime_error("DigestTreeBenchmark: The tree was not updated");
+    nextMember_ = (nextMember_ + 1) % dataPrefixes_.size();
+  }
+
+private:
+  DigestTree digestTree_;
+  vector<string> dataPrefixes_;
+  vector<int> sequenceNos_;
+  size_t nextMember_;
+};
+
+void
+runSyncBenchmarks(BenchmarkHarness& harness)
+{
+  DigestTreeBenchmark smallTree(10);
+  harness.run
+    ("digest-tree/update/10-members",
+     bind(&DigestTreeBenchmark::update, &smallTree));
+  DigestTreeBenchmark largeTree(100);
+  harness.run
+    ("digest-tree/update/100-members",
+     bind(&DigestTreeBenchmark::update, &largeTree));
+}
+
+}
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "../../src/c/encoding/tlv/tlv.h"
+#include "../../src/encoding/tlv-encoder.hpp"
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+void
+CallbackCounter::onData
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<Data>& data)
+{
+  ++onDataCallCount_;
+  interest_ = interest;
+  data_ = data;
+}
+
+void
+CallbackCounter::onTimeout(const ptr_lib::shared_ptr<const Interest>& interest)
+{
+  ++onTimeoutCallCount_;
+  interest_ = interest;
+}
+
+void
+CallbackCounter::onNetworkNack
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<NetworkNack>& networkNack)
+{
+  ++onNetworkNackCallCount_;
+  interest_ = interest;
+  networkNack_ = networkNack;
+}
+
+FaceTestFixture::FaceTestFixture()
+: forwarder_(new LoopbackForwarder()),
+  transport_(new LoopbackTransport()),
+  face_(transport_, ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>
+        (forwarder_)),
+  recorder_(sentPackets_)
+{
+  // Connect the other face now. The Face connects when it first sends.
+  recorderTransport_.connect
+    (LoopbackTransport::ConnectionInfo(forwarder_), recorder_,
+     Transport::OnConnected());
+  forwarder_->addRoute(Name("/"), recorderTransport_.getFaceId());
+}
+
+uint64_t
+FaceTestFixture::expressInterest
+  (const Interest& interest, CallbackCounter& counter)
+{
+  return face_.expressInterest
+    (interest, bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1),
+     bind(&CallbackCounter::onNetworkNack, &counter, _1, _2));
+}
+
+void
+FaceTestFixture::receive(const Blob& encoding)
+{
+  transport_->queuePacket(encoding);
+  transport_->processEvents();
+}
+
+const vector<Blob>&
+FaceTestFixture::getSentPackets()
+{
+  // Move the packets which the forwarder queued to sentPackets_.
+  recorderTransport_.processEvents();
+  return sentPackets_;
+}
+
+void
+FaceTestFixture::PacketRecorder::onReceivedElement
+  (const uint8_t *element, size_t elementLength)
+{
+  packets_.push_back(Blob(element, elementLength));
+}
+
+Blob
+FaceTestFixture::makeNack(const Blob& interestEncoding, int reason)
+{
+  struct ndn_Blob fragment;
+  interestEncoding.get(fragment);
+
+  size_t reasonLength = ndn_TlvEncoder_sizeOfNonNegativeInteger(reason);
+  size_t nackReasonLength =
+    ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_NackReason) +
+    ndn_TlvEncoder_sizeOfVarNumber(reasonLength) + reasonLength;
+  size_t nackLength = ndn_TlvEncoder_sizeOfVarNumber(ndn_Tlv_LpPacket_Nack) +
+    ndn_TlvEncoder_sizeOfVarNumber(nackReasonLength) + nackReasonLength;
+
+  TlvEncoder encoder(interestEncoding.size() + 16);
+  encoder.writeTypeAndLength
+    (ndn_Tlv_LpPacket_LpPacket, nackLength +
+     ndn_TlvEncoder_sizeOfBlobTlv(ndn_Tlv_LpPacket_Fragment, &fragment));
+  encoder.writeTypeAndLength(ndn_Tlv_LpPacket_Nack, nackReasonLength);
+  encoder.writeNonNegativeIntegerTlv(ndn_Tlv_LpPacket_NackReason, reason);
+  encoder.writeBlobTlv(ndn_Tlv_LpPacket_Fragment, &fragment);
+
+  return encoder.finish();
+}
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#ifndef NDN_FACE_TEST_FIXTURE_HPP
+#define NDN_FACE_TEST_FIXTURE_HPP
+
+#include <vector>
+#include <ndn-cpp/face.hpp>
+#include <ndn-cpp/network-nack.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
+#include "../../src/encoding/element-listener.hpp"
+
+/**
+ * A CallbackCounter counts the calls to the expressInterest callbacks and
+ * keeps the arguments of the last call.
+ */
+class CallbackCounter {
+public:
+  CallbackCounter()
+  : onDataCallCount_(0), onTimeoutCallCount_(0), onNetworkNackCallCount_(0)
+  {
+  }
+
+  void
+  onData(const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest,
+         const ndn::ptr_lib::shared_ptr<ndn::Data>& data);
+
+  void
+  onTimeout(const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest);
+
+  void
+  onNetworkNack
+    (const ndn::ptr_lib::shared_ptr<const ndn::Interest>& interest,
+     const ndn::ptr_lib::shared_ptr<ndn::NetworkNack>& networkNack);
+
+  int onDataCallCount_;
+  int onTimeoutCallCount_;
+  int onNetworkNackCallCount_;
+  ndn::ptr_lib::shared_ptr<const ndn::Interest> interest_;
+  ndn::ptr_lib::shared_ptr<ndn::Data> data_;
+  ndn::ptr_lib::shared_ptr<ndn::NetworkNack> networkNack_;
+};
+
+/**
+ * A FaceTestFixture has a Face which uses a LoopbackTransport to a
+ * LoopbackForwarder. A second face of the forwarder has the route for all
+ * names, so that it receives each Interest which the Face sends. No NFD is
+ * needed.
+ */
+class FaceTestFixture {
+public:
+  FaceTestFixture();
+
+  /**
+   * Call face_.expressInterest with the onData, onTimeout and onNetworkNack
+   * callbacks of the counter.
+   * @param interest The Interest to express.
+   * @param counter The CallbackCounter for the callbacks.
+   * @return The pending Interest ID.
+   */
+  uint64_t
+  expressInterest(const ndn::Interest& interest, CallbackCounter& counter);
+
+  /**
+   * Deliver the encoding to face_ as if received from the forwarder. An
+   * exception from processing the packet is thrown from this call.
+   * @param encoding The encoded packet.
+   */
+  void
+  receive(const ndn::Blob& encoding);
+
+  /**
+   * Get the packets which face_ sent and the forwarder forwarded to the other
+   * face, in order.
+   * @return The list of encoded packets.
+   */
+  const std::vector<ndn::Blob>&
+  getSentPackets();
+
+  /**
+   * Make an LpPacket with a Nack header for the encoded Interest.
+   * @param interestEncoding The encoded Interest.
+   * @param reason The Nack reason code.
+   * @return The encoded LpPacket.
+   */
+  static ndn::Blob
+  makeNack(const ndn::Blob& interestEncoding, int reason);
+
+  ndn::ptr_lib::shared_ptr<ndn::LoopbackForwarder> forwarder_;
+  ndn::ptr_lib::shared_ptr<ndn::LoopbackTransport> transport_;
+  ndn::Face face_;
+
+private:
+  /**
+   * A PacketRecorder saves each packet which the other face receives.
+   */
+  class PacketRecorder : public ndn::ElementListener {
+  public:
+    PacketRecorder(std::vector<ndn::Blob>& packets)
+    : packets_(packets)
+    {
+    }
+
+    virtual void
+    onReceivedElement(const uint8_t *element, size_t elementLength);
+
+  private:
+    std::vector<ndn::Blob>& packets_;
+  };
+
+  std::vector<ndn::Blob> sentPackets_;
+  PacketRecorder recorder_;
+  ndn::LoopbackTransport recorderTransport_;
+};
+
+#endif
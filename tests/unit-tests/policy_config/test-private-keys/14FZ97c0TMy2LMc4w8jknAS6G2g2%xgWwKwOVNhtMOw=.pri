@@ -0,0 +1,26 @@
+MIIEvwIBADANBgkqhkiG9w0BAQEFAASCBKkwggSlAgEAAoIBAQC4BucbCn8gxlww
+jS2rUhEAffXLlWHuw6p+s5ysRmcejk93Ee5m0iJD7hV6j3+APcInL7IhP0QY7jEC
+tKTowxwQh8fNSjBgHv14asvXGRlZlLPwMHJHLrMOnTKCbusLBB/Vt8CrWMGy+dXI
+ZwckPm6QWscerXB1C4QQhsu9Mxy9fuYnsS/RMwMP98537ylQeTfF8Q2xYJdc0mwn
+QxMOjhONvv4KKtNMH8kVwlN71xwa/wiNAOFslJaWDGEYJpg/2V8BBlQhSsIbOxxw
+elAOdXcwZjbG21TH3ctLXyhaw0YkcdXBULYfhSRDJlsWbWnIHAK34OcxeHvQlffl
+P823eSTRAgMBAAECggEAVJeLtXDqRjkYWJMU+qsjOJwuF/KnjVcxMMPEkaZdMX0O
+RzgdY/NVH++5vNhorhz1egjhM4o+9czMB6fdJEfHx0t7C0F+ojisoCVLZSla70Q9
+QHwsk88CLQYSmUV+UtaHAblRXhJTG7/fRxsg+8adEUtBO7dTOeJcxzIHRoXPwMTk
+W8afpwooF8eA/l4rVTch955ToYqp6Sym4uTkVJaOgq8mnyD/Norqkonk8KfAKowB
+qU91pZhuTGQp/UDYoBCdsE/Qozq/wMlbBFc7LKs/wH83W54YrgSFJM7AEfYJuU+f
+mJPrZvIyEHh6IxV/YfZhwwt0LD+L7TB0oQCMqZQ7RwKBgQDb7qh0Td8G4Z8rghfs
+AjvWxvzXvVbKQ18RCPUkHELlR3DHqhiELLXTlb/O2czP2onXGloauhGYYuJ2AwzC
+cFQ9JDRmavW5ACSi4OGPgokigBGCbpz0AnfmkGh3fUOwuM5h6QzQPTSGnmYjyhbs
+bQ8NeE5nU4C83EvcsbcuZ9b/9wKBgQDWNNhIcFmSPV2A47jcyNZsJJNMxnMNBn7q
+qZ1ffcTN8RNbwBqd87rdi5AXY6gH74GlF20+BdGt2b8COPv1QNCQoKfbQTIHcs0O
+P838gxT1muDkxmWGV9NttSOphXbz3boOsr0nLYuCdS4NnsuCOakbbN0WQT/v9pW6
+xeb53vDfdwKBgQDLY073l5gcJgTr2HhE8t/hxM3IubmMfXdqKo2Bon0eyc17aEsZ
+2Lsh+8eRBIxK4EA+44jWVKK2+SOSnUlsezL8BAJNgLbTKlW3Jx6Rd9dYR3Vp2N9f
+LPUzDPL/JaG2yYFavInz/dYYdF3i1R4T8NtNyqc/GNLiVRv28YaE7NTAiwKBgQC8
+hqYUm006OGgjGEmLh/ewFkDOQZrgy+bIAaBQexDLcHHpPpouimTcuAiJjVxGH7Wq
+54NuIxD4Qbyq6BxZLkJiCAO0JR0zEQcIk39nzraTs0xcDYEtS/75f4Nzn9OhrnQi
+m41+/cbbeuaddjUG2FjNmnK7M5JiUFRXnfY71MuK4QKBgQDIwskgismN3dM+DwjT
+uJRo9fBqcHyHhbaba4zvgjG8DxBOnFzD6zOB9R+DZt1vakoxmi3qnsaJkXLSaKEN
+PlnBJ73aBr9+GIVQ+3PeB57ofljI5PJkaKKeDWReExKqyc4Q4CxbBzpppwBb0XEt
+SDvtKDiJmV0uBRWebBo+N/vjLg==
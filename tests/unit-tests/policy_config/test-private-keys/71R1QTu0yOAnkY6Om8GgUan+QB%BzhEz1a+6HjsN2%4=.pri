@@ -0,0 +1,26 @@
+MIIEvQIBADANBgkqhkiG9w0BAQEFAASCBKcwggSjAgEAAoIBAQDAqP/VFWmhYcbM
+6f8UbJ+kFIxDalRQ2cNtDQ7Y5Fx/KACRhXDTa92pE1MA/SnMk1NluHY4ZJc4+oiU
+fm7ipZLVis+lz09r0CXxS32jqmGBsZqxY4Gqfn3xgUcP+qK/UjrCzhGjICutcqkJ
+y6qzRb3ugBmuvfylcCBbxZUvWg2/bPAMZ0Y3s7h1nMBslDIxXcS5mJ0aCWKTUcmh
+9fOxxBWa7pEX1e1emKKHCaQ44XLYBwmqxUnKUEU0joW5Gz3eXqT1Q5WEyUNPm4b+
+KdBawq2N7TFj7FUvCvXEJ88otCgwzjLWiU68GloPVGqKWJhcqUJ+SdRJrYjOVd7q
+4dITiZx9AgMBAAECggEAJ+Y4CWSkWiA6QDDLu2qdiykYPVP1f0MCBoEYTJHKmCjs
+KTcF/TsPDldqrr8/W1c9g8j2bspiSRIVnA8tHrIknSXgyBmNfKoAWZ8FN5JvHCFw
+hIEzluAYbB4WXfhNoSrB8ZskqvBcK1EeMeGkifkNEyojZ32AJ7D3epoKQeK4CycD
+36d5DTcxHx9dT/isk1u5Hfm5dgHOQm+digeZKR1cUkL4+aj573EmjLMLRVCGQQq2
+UHkwpDY6S9BlsRrhvFVnrt+hJ+dUZuSFeTGeXpBWzLxYlUFUuBJk7nlZ4U8Ih1fy
+yMFN1S2Tm7mzkMg+Djvyxk633ZRTHh2987o3YLNeEQKBgQDoqEbiowOR64NO34Md
+0T9udYWWo65TH2C2htYDd84rk8OU1aWvluFzDOwtRr88eAnM0gljZAeBJxKdho5H
+wzYKOAclWz0A0eVCV6/u012gn8Jf6tb83Tc4gpbU8Pzcgt8M6LZtxP3p2073xeoe
+L/k/qKzLs9rkgp2NG1+I70rwaQKBgQDT/Wik55cHpcUMWhMPJnF9NiXg8S2IXtjn
+ZCxkluas1qQGkskHSlJSpb2I5TeefXh7h6XIU5NwZBVudGxyZBgSZtzT6V8PuH7u
+ONmwCE0F+A61VsG7USLy5Eo/uEnHRdizSxo7Fi/5PKncKD3fsEHNW1VWSipCi9ox
+n6ws7RRI9QKBgQCVTni/NTIzUNrhoRr55bE5Z/4lIEHdYkOkn390lkwfNyLKvxkn
+SELCnMZsf/x2B+ryINCZkjYmsjaGFTX149coU7ByTs0lW44vNyrWr5pkXGJXP9Rc
+TnMDtvqpCUadFPejxyxb4ZG5pF5XMBIA8XSZX9wUlgWhpBkL10dGD5seEQKBgGjV
+Ax+xaw2cG3K9RHmUgED0Ow0fF249wTPEZPOlcBN+3YRmqEUTqtw2HCGLgNK+p4sn
+DIOhWOMWi0ahClQTTZgkCAY/fQQQL6zsrjIQGM7f2Z4xdgKE4CyPWmxiXRHPZ5da
+h3E6yqSNLE60E8z/o7rC9NOEP5vC/zbVCFb7MrHVAoGALqfmdB9/PPs+AUi68IyN
+EoWQ3xv+dZDAfMKhhDTMN+AUnocZ5b2tRMHakn9N6o1J2Y5SXiTIIzHnVxMpvt99
+07dsgYfYp8+BgDiGxVnVwjGabP+YA2DdOTWy1M6RKjFL07v3R7FAFka4R+pxWkCR
+I074e8/nvEUpVEvDGiLf+8c=
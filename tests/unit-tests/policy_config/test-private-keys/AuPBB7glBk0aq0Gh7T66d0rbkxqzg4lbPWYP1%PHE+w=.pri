@@ -0,0 +1,26 @@
+MIIEvQIBADANBgkqhkiG9w0BAQEFAASCBKcwggSjAgEAAoIBAQCzNDE7KuSaTj6z
+jHiDb3PpIUCsUj6CVjrHn0WdUK4VHKhEmQZ0jiClTMawQ5zUFVUNSuVnM4FyrBfQ
+PUQOMDBqRTiEkwmuH1/jOddpxP/6l7+dDcZaE70DxPQDciK7ImAAtU7Mu6SOdsBV
+UWtJ4YRFopPbRKYtT5SJRAH9/lhWmtx6MDTmIlLfex3cLWdar6CpxnyjY548Gvrt
+l3t7vKRaZWQw8MZvY6J2vAnyw1lKvDt2Vt6P6wl1lWpowaogVBDh3nhv0mOYP3GR
+lu+zM4KIuI3KWCAUjXULkgdsSu0YZJdB4knOdhRCcJOQls/ecVxHHmQ0slePLpxY
+AHiJq+y7AgMBAAECggEADg65EfAicKxUpNcPGRhkGlSecyYcezLyd3haCKYskcFm
+vcLXS8teajkkmO0k30oxGtLWPgs/S1SOpao4rXhARAXcEiJKrxsM9ZEzAbwPbIP8
+5wAOoEBOIn6Publ5Wf6vUz7lyI+rr/VGzyqM5QXIz4GaYaf39TP57e6kzVznZxuq
+/b5V5DAD378mbWWAfbnpd1I9zNB5X+EaVOpIDlblm0/WB36RZmBSs/cEMQJyTm5j
+fixGK4Xmz8VGREsJkCDDzzYqegzj76OVdSCFLY1KYgOoqfwPxO4B6RF8MVHeMCZ3
+brpgCH+KhgvZj1KD9CRscqUdfgM7kTHVvCb0J7or6QKBgQDwcjQzH4kbICimIiuY
+uhPNcWqHkE7gNkNq0aGKEXidyJrFb1OEndkgLAaKujop2gJon6kfM9lsnT6mvifV
+CbFV4f9MMJZ9Ji4+JcoG/z7U6rIql76+J5eApfBJem99TsX5nwHwra+XM5CdJPsM
+MeKg8ttKGMlazfOOTHfrxsTapwKBgQC+y9CabGxMhifIt5ISMFlWkdtULoE84oNZ
+CMJBp6qOzOCDZugOO56sGx5Caz75UYTk/G98WDsgLD2Q2LJWzFL19Xc2/fu20ID8
+zz5g20VmfmcOnMcB+DnI0mp0p7VRT8lcfmK5sDVVMTcf8QHudzUeqxPwRjNNs5EO
+PrBrwzwjzQKBgDm44Oko9+woIzoG1/p5KUnXoWBb92OCA1tAagxQN2mBgA5HtIAQ
+uNAtYYCqRk5HxO5C7gHMm7SkZyb2XW+aPRVGBNjQjUAMC2vl/IMDgZzxnsX02dii
+fo9mxrGND/jAEWzkjD2wJIgi2+OtvgrmauaChrxaCPSgnoiZuOxEMnvfAoGADuQj
+bNoHfdV+p2jEas0BPAN4RdK3XYQkUj+fwbYPVsPgxgCzHeFDWhVnwDFUoerd321g
+WikcvD8XswVmreWWmAHHgzBBhBwz5Qdby/1xJjW5X2eXFK1F/UmG64HnYehDRAfN
+Nsbs8rA7qC+MQgtlxvX9QWSJPohESwNTi6WaPQUCgYEAmclDN/QVUysKorIcOHek
+KmCfjG/ryRsONk4dGBlKWIMDD9BUBJufBhBau+O1yg1loBROrURek0MxgzCoXNBK
+RlXLTalcZmynyF3WL6YmH9ZrvIJxBbYHxK2dWg9ju2oc5WrrLncPNWTbGLpXWFzW
+NciScJFCJ6NphgLynjU8CXk=
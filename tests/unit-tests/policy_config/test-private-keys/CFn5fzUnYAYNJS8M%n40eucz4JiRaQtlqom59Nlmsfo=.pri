@@ -0,0 +1,26 @@
+MIIEvAIBADANBgkqhkiG9w0BAQEFAASCBKYwggSiAgEAAoIBAQCooMNSsG/7ZBWd
+woTGgUPu2skIXMDc8mLJhvpHTWCpAhZnwYT14sjM7eDcGqXVfNlKay+sQdzoEp7D
+MYAkdEhd3QUa22IVC9r6nDaqTYRLYT/9lCR3wr1fXDmAwmovdVYhuGo+ArlQb46b
+OG8wfD0BWope5HI4syI66YCRenpa16CsPY9hFR2qiOv6bqPtAOhcPozqZVCBFh38
+EoC6rHCbVBYqcixRlG7s4IY9W+Jv9r9JqP9G+9IRdqYkB1CVtGOhbcEKzJrLsyM5
+S0SIz6OLwRLl6RBPUp6nuqNz+ZW6CsKPEDB2fMqi4tb0eb8JS1QQCyzEs2aNncUV
+lEzKmqmRAgMBAAECggEAEhw17gcJ989PbQKLnQAcCiaQKahAhFo51tf6wDakt3IE
+cv87JudE1pGDsU/hWJTQh2gMliz6qyf4yhDiaMfeT8phdnlyRr1ftsOZMWAi4a+f
+nj3PTtdo3Dl86YG3wsIQzo1OR7umKGfawnvkoSnuqVsOelOBmupONlKGntkvE9tg
+ufm33Y5+jWPZhnVtcfLZSHo/4mGJQ9IIOcXHD+DwS5X88qSHIa+chgGm15E8poer
+6jEek7brJqod3x1VYw/GkFOU9+cTyNQvHOUdZqYl6GwPoc2323mDMBI+FMnmEdX8
+9EajuFAGUoORTKOKEetVd3g0FcLoxmMpO8DUdYIbcwKBgQDok6EY0NysOu32ktOY
+m4qOMixEXW2ME8g58n2U5gUbJeD+oYVZoDGSEHtdMhpt+TwSGXS7rxpUGYKqlR9Z
+mTW7NcipJWqD2B5ZdwKSdXo1tIPHWpsoFn4SseQHHfRWelR7geuCFbyzm1plO4Bt
+nnh+phL/W9D6KdaaQNLbIR3JGwKBgQC5nGMAi+ETOFexXF5cr31mWuYY4Za5HuUa
+Zs0s8q2ep8JTZbyVp2ldl9jPBE5N5oFEK79Wo8ZBOa9B8laIo6t/zuEBJXMfcpda
+u34PUnj/isBkzxslHm3rQBMp2x9P8/dtJAkhRuGjPV3cMTk7r9d+Sx7NQ2LCLddw
+aaO9MXEOwwKBgCSR+hXN2bUXOw23fqATbRD44K8LRctt3OEHuSltlcX0CdHgEfjK
+0KCYCN3ZoABE3WY3LHzKhshMjphGBHzxM1qxlVDLelkq5XLJ3NSstj+1l7cEDzuZ
+dc94u1NHKYFjkN8uyZpV0qsnNWqPlZ0m+ulnMbuHc2+ynnT41m7wYR+bAoGAcH2G
+RuN/sm1YQGaxzcyR3IHEqFm4RlOiGEErok0lylzz2iVziOOgaRfJT5XVe0LzHwTA
+ftrdIdS7EeW0ajV/kAMqvM4cmneRoWy2dsTODlniRnZ6hiGODqCTvK9Pp949G4lW
+ezOBNrTPeM7gV/s3SBRxA4gOh47O3hM4KEaZtY8CgYBavEpNoylCFJ1ONxsodg0F
+0j5E0nxuR8dcrM0FjGdF2eQIdR33F6g/0Dm+EX4e2+ZYiX/HiNNf0HicOTpaytgt
+z6v3+JpCq7lxMNULxScUagegTgeenkSbVPLMpn4jCz05QeagFwK/VeSMkoO6TNpb
+Rry3Gzdq+JDd/Mz/chhYyw==
@@ -0,0 +1,26 @@
+MIIEvQIBADANBgkqhkiG9w0BAQEFAASCBKcwggSjAgEAAoIBAQCci+MH3UdP42wI
+s0WfboA4W+OIgGmDj5aTH3dNf5qpb16l1n8f2KBpDrFSj+NFIvgNxZrYV1sm72bx
+YwxLut5Wss/35i2ZxIaAC00abK3DP51zDHe6BT1tZB8NNKg/YkGJowX8DY0x3hQ4
+5wwB4SkJ421BaU97zGEG/ys2EXJ1lX6vSApsFRdSNQ9jhtvOPrxldxKTEGDVJ5aa
+Ghs92yozpTM8jS5zCHksjsVSzV+SeOMzV4JyDcN7FeIebhva776La5fj8x4AvRyk
+VxopkhZt9jYK7d2nRt0uaXxDykDAEMQ7+a5JK3++XA9y+6nyI8UjbBUn5d/WeZ4C
+SlpyUZ7jAgMBAAECggEAJQC/ykUYrR6Bk9DkPRo+fpPhxYss5acUHXSLm6r04OXt
+Rl/cLqfiytJpQa23N8lbPs4dmtOTPTHLcHVMG75w/adIlz02PCmC7VM+h2d27zbj
+PaWNy0+fxHKtEE8JEepkuWbqbDi7zjTDLOwYH32cWLUERzjgS8/0g1XfXelj17z+
+fB9F6kouRksx24hKmiHrG4OMTgoihmk0QJwzN/CSYXGeHGLmXsFeku9KyYcoLf50
+6FogtOdL7BhJd7AdEkzb59mdOkjknp8gOixmUNsK0vNyan9jozpFX4a8B7QRsjXj
+5ldmlkca198U7UchOMcrAOWM26mAaOefqmpejesW4QKBgQDZlcg9CH6PjjerKwpH
+njoCzXz5Xvl3UKV42sfjNJ8Qg8+R2/3WSoVJq97qgxau+RUUb6RSQXFUA7FDYYKN
+gVoaGOmUNNm1UQkDwHxoiTitEkmpLGI6XucPxi0bee5YO2c1Kidfc6TZHVwYGZik
+6MRMlbCyB5qS0wlSWpnDxiow8wKBgQC4L1VuAn9vQAYuQIx5cSNCs1DxsoEH8vAI
+y7l5dYgDpCrYKO8l5IeomSF1CExzZuStSVfIkrUtY9suz0VHN2Ta40mPrNET0XhC
+lFrs5mEeKonfjGY4qkHybZrc7CovHIpjuAQI9/h+ntpOsr2OTQGbwJsEcl8Y82AG
+WHLIaP/WUQKBgEiyClyZ4e8EjQTbNGwJKUiWbxLB8Ic0opRmRDJc+mgCIe+RmJVo
+AHBExA2GDqYXAjv5sOTqiHqRYUAp6/xrIzdk62Vg4vv5PxHJ1cb3UcBBQ+sJsSff
+XUOf6qIrcr532lug4da6RHFlpcdHhgBS5ILR4F8au0Ii0BJ7wrPuGVqRAoGAa7HB
+kgGD4djdxE2Z1aiBpY6T1b86ExvJnlsAqDRAw2BKbPoCW3W0nLBtD7E6gn+3Vlt8
+KJsftNqeXlBzgaCyKAqeCJRT6/KfDs8QG1TZlHnrA/tkCd4DkWzlEChGwiU+BfCi
+61uSwPbBTyLUE1CTkC6edYsqb7xeeVdeRjCe5wECgYEAtado9X9Ga3Bn7mrv/8NM
+7jnOSwHcK01N+8rTTnQI0xiqWJBio72C+3c7f+tNTA4ZkLERf9M8L8XZnUxakk7e
+EHIaZpYOVttuAy1vVTfcKHUkoLr4oID1MC+/BEWR9Gtu4q8LsEqvRo62IwvYvw8y
+KYf7ZMf+JqXtVCP6YuJoVxU=
@@ -0,0 +1,26 @@
+MIIEvwIBADANBgkqhkiG9w0BAQEFAASCBKkwggSlAgEAAoIBAQC5O2MoHfqjz0IR
+Z/uaxBhedL/B6x3ZSQ5TCeo4RtHyb2vM7nLwb9nHw38IKgAaGIdlTDSKjAFAUksc
+Qj39dUucC63KDSuj6SZTjwq+yq4qxHS6oVYU8gvYLhkmH8xS/K07xgr2+RHJp1kt
+DARSmUeuOGoKtPMJfWA8BVn82YWC+5OV3xrnGJfmyGV+4p3A/41UMLQ2fke8BnFn
+5qOpODbuA9du+ZhIK+lU/dJoZVo3O/RAjIMBmJmoP6jUTesxUWC5LVLIejOYULNZ
+UbA8Qpg2vc5dFNUGbPac6GqvNKU+ktlqMMcCijeBmiVOUBPrCu8N1VDIa4mdyp0p
+CqKLKJtjAgMBAAECggEAECn9iierkpXohwpS63uHQN7hSPPSg/6bEGYCGW0crxJI
+DvcT8qVgFM2bjUPVBHH1hsJyp1B2X32O7mVdcXvF4FUokkQ59bDH1mzaHDIlprfE
+E/E2SNeibvf+29PUib1hBKFQnaK4iadf4c11pxuXJL3piwulVcOqHTK+WpFE1Fwn
+oY1cgTG4w4NlCjcijTC6+wjAkhZlKOi3K+T7TZav+Ed34CjjtxWnZEP5gR1s4xO9
+nfPdsEYqWWCASunoSWgvv+pRio9w47zFLD51JcU3hn12+MsUdE8VhlNnfCeHKxdW
+GOlFLkYMllqS8ahxEg6rKKHaKo2uJX0OFMC36oP6UQKBgQDwNmL1AnSA0VLZu5PZ
+KsWkgJwA3iLOdqsP5e6Zj/LwnF57cs45b3w8R8JYwfHwzBDTVOCpnJbBuUlJgrjQ
+lEsNWo4RbeXmRd9iNNt0DPEem0CVvBFCJFYwFdVjYb+ozAxBgKBzWmr/NF3LyDhN
+EUtNRoqREQ+kKcC+BmN59DP3+QKBgQDFZ/INKLcpP0LCho5ucrdq363JG2+yD8f4
+9WfwMzvN/06Z/6BueEt5k+hzM0dR8Lafv4NmQfbZQIcEQITNHUtjWHEViUSah8VL
+545M05UZSlWKWtK55i7dj/DLEjwfYS4LKosV2/33mdzmySF1Li7yslemUULjHjf/
+Mb9BgyFdOwKBgQCwR1krcBfLCNICEtOXBPpxlCfnwxxL4235hsUoUCj6ReZYNZH9
+OEE1g3ut4vYHvdmDHMCZ993yYGTV22aBOrIxJIkpZTrXV+NskFmTuoOf8FLfD1qi
+7UOKmhs0iWE7IDLGRvx4apwmmGlUyKP4en6GQQQjHSAbWsClMs8BiiIxEQKBgQCP
+6RxTrYgBoOWpbHCvYiAG4LQPtVmzRL/y5ez09lS181a4+9tYTYgwRLykJxDqUoLA
+aNyBErvDW8BSQDrQUXfhH9uo6J5DzZDuqgtaRLEgc8lyiI2xCnbF/SZ81HlSIwVv
+DH/C2tMFy3x4Hs6uX5HISm2NiRYq/p+yAfE88DzFewKBgQC1YYImfDj1Qk9L+bDS
+beYERV10IxHbn5KxClVDvTx+ZdqnUG55xUSJyQY5vgy3zv15WNLPrp4pquhCkOK/
+8y5ynrkFSh5YQUgP2vSH3pz0p1hZYFwLiXgzTF52U1jI9Qt7KN8rPCrSfQBbXDzH
+fZW/YbYNp2DH+VNEo/sClyoY5g==
@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQDCywnUIOssTsnD
+16AeRr/QjhMTDrAOw6wa/BiOsNgXQm/NZZWyj/U1MjUiJtRk9jqGtpjmMlDwjd4j
+KsbEGo7C4gmLhR45QiY9e1DYnPIXcw5mD0MriBvwlAko0nqdVCUmVzz+NIT9zIuB
+yC+wmpc68AHtkDtnlzwnDzXu8e+ukdiopSqbhpUXfA0NQl1xZC3z/qeizAHb9wcQ
+zKOME8OIiF9yrEILGpAikqLoyu/lii29fv1/E4X09lmHreTNVRsMQMZlqZiqi3Vt
+NmvsA5/pDqmqc4PnjbGOjb8cTRUqPxAa6F0YZvBAZs1vzcArUaFEaBO1J41fIv9i
+MRr4uhz9AgMBAAECggEADQnfrMwOSc81SK9ed6BXNwvHgZNOXBKjasP8ldKHCFmJ
+V8eIs2TY7jhf35sXRPHJXZqL1f7AtbVdTN/QYbCAZVGRf34H1Z/UpPFj6jfpKYIp
+UNINNjT8X8hc65dZHz5SZURaIA7eZwmhvexrKshSPp7xlhf9LfQs0dV+D/IwT7Az
+9ceQGXJqgJOHbTfZz+nOBfQVUdUqYe5yPmavD/NS3nbGj91PUBVon4ql6S9AF0VR
+YpAmZOJhqPdCYwuRQp9uAFhhiyn0akNxhEJZ+TBe7JP1pxun2dXhpuXzySWVpaXZ
+sAcLP1kN0taVEunTHOHSPVDlRx5/lDqxratjJFLJAQKBgQD2H25UC0LcHQ+NQmqn
+jOoEDauu1ecZrlL1Sp9oKtg4wD8xUdAV125QE7R+t+WcIqNJlXLAIqjunxZXQFPy
+iPGthG0c+kEjSMF/OyC+TNJElt+LuuR4hbmd34vKXVqp/RfKG/FckNSS/VNiEOUt
+XtAM9bruFD87jDTz5zjkk4eFAQKBgQDKnERAut1aD2MPR3asusJihUiroJ3Bq9Wi
+Sno8pCknyontJ1SkOGqDUWxci4QDtUffVZRJygZjfmFAE4DaX4rxeb2Fhux5KZlN
+6Ol5L2sB5B0olQN8GaubTgpdBmnQzp1EdORXPZm8jTXEmYUdtPoygbPAIRpZg4wy
+/xKZ4fSr/QKBgQCHE7j5ZzTKmShv3oOqcSv+DYKr8blj3sio1sul393LR7dm2f/Z
+/OIOEMJ+yW66wkfbmqnfySXt0GHygNuRwJbjJEq+HJqjQsrviQPvbTn5atRFW80I
+WFwGySlvZszbfowP4EYXB2WjRmT87UjaHa8Rbcup3nLVu51UPxJ6YH2AAQKBgC8Q
+A06h2T7NKi5nZCqVKwfle87Z/Sr6diI/eItTenfStR0QMLoAnMUqCaipg5204x/+
+afaF5dwAhCh1H04aOVUD+UDl6VHvlruhKXJL0GhdC2Tc0DVoZRMrGn8nOTcWdzNq
+j4uwNGC20FF9c41F94P52r37Mnqucsd5tmFmOgYlAoGBAKDPPiPi5HBjAhKIBX6x
+B5otnfVKaTPSwsH99dflh8FQfj5J7LN5blNTmtgjN1MLWxO0vW960n7hi8sxn1hQ
+xga6Tv4kfNJnqs7/r5sbLimqjje1YkO7aQwYeY6llcwR4bTjDePyXl1tKAbOlH+n
+c1FrhMYdPWsVT+Yj2cIpKQNb
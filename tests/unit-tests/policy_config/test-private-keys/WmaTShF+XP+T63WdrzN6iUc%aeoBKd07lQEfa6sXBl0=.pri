@@ -0,0 +1,26 @@
+MIIEvQIBADANBgkqhkiG9w0BAQEFAASCBKcwggSjAgEAAoIBAQCkgw+qubxexqVC
+NYzICfV2NRibNK9jRIVEb5ItVmZfEUn725bLkvy14MbBFp+Lv0m13LI0g0KQN0NL
+p6kSz0F/KzBZIOjGrWK7N7Ua2FA4dwQPpdDyiHnDsrKWArfF6jyfLDYl/XzXkU9k
+4MlF7MJUTE4Cf8ZVjJEqLG3KeXT5+YYDKaIFBElUTfhWdqhuEWqNdnlpnsUSS+EI
+wnnpTEgI4o4kPwM6H1soaXRwewHgX5UUTRul/oKcFmjj+dejeW1n4WGTuSpyGQln
+aNc0wEbMc2phCW1sXcfGcwWWUwfs9BwAGRYYYL6is3spUhYDEhUtrubLK39T+qlp
+JvN5DYdVAgMBAAECggEAB72OlzzsfvVv8U964NmjxeylzFMHB+UW3ntfwHLZgmfE
+7aJYHsV7JE/1F2uJ/7sKdpGxr9Ss5S4NzvQ5TrmCOSp4zfoarGhxkLdZtdo6Mgya
+3A/0UXO4Q6E3k7qBLOvXxNyBbWRXLf8NYi93wOrCJ6cRyj56quv1fkC/Z2CzbznU
+kAr75UEtm/wLBpik1oJLYZDdd0KXmWd2uxe/OPtnR9XGCknk3+TG3HcBDfRuKDc9
+wkkyLE62LEeZ07fi4pJURxHWPZneYpmNkjyMsbziyfKdnN4PP7TLvrYZ1+nl2IaS
+Rly+E4Mm3XzJdDTARBRsnA+GZ6XVZsXlbFHc9rsg8QKBgQDdTedHUQ7/MxG2NRVl
+31474+I4HROvVQQgK8jUR0dKKXoYGwvrt8bQaIVIVFYyIqfZvDv6ao0ZpTZpXey4
+qNhLiIpU5sLK9vYqwjyM0lbfum+KairjwDvqVOD/tD4Z2BXrYeZRZ9UC1bma+azX
+3q204ihuA0PY+w9k3vbngMJs8QKBgQC+TcjMBQrISVJQLUsHpE8OGjXWbXoOgo8X
+WEoy7aI0EnJ7d/YGFepsDbMM5AtJjCKmdIopuIJCAf9rXHtdBr8WZXayLMGSveH7
+aJCpMol1x133taR9ckNv2zLnpEts1QoDdd6o96XKmCthpmHP1EMABv6jvk2bxGmZ
+9q2pHNJQpQKBgF/ltTXbM0N07tTlFduqOlx7eHjWaMROc9Y5AvKx3HuPk5/EgJrp
+bRa8ZB0epqddCx04C0mNSI13YSexkrXGPMwmY8M8p+Zps+x9dN2U/B5A3Lq/HMzK
+bWwy0bkcctiiIYV5S+O0ucJbuO0mCjcVAHLkmZ5qfckVqesNDzLsQdQRAoGBAKt5
+EzEiafDGgHDWHwEnwEQIwfIQeyaP5bc3SsRQ8xLQfG9cTEZ3gN8UCP3YjYMbzi0G
+XWfyZQxtGGT40/+ikJPxoN4zDcjXZ8RNF+wdKVcC6VzGQwz15GXpsRigJYZO/9LW
+ZmcBnlXKf2xhq0jFDgn8Q33vf6aXeD/O0fPLkIYxAoGACbb7iy9aInCRzPbtR7oe
+EWHouu2umlBLfGTzriUzJN5AtoLiFxHKJUm1fay0aLf705h2X+dLzW/cd5t+rZ4I
+Gv3XTK2drQAWdhuSZIpS/u/knlkh+JOlBqcbcRky/khc5bqGKo3+VhWEUILSfnbI
+ptG6HwBlDgb1gg+yAs2ElY0=
@@ -0,0 +1,26 @@
+MIIEvAIBADANBgkqhkiG9w0BAQEFAASCBKYwggSiAgEAAoIBAQCOunrcnBWfOPoL
+LX4v+M1MVWcqDQc5TGqsRtKecjb2sClha8h7m9LB76lS7cC/d5wO+3sLF1I9pMH4
+MXKTHHcjYvN0eLX1hCswsUEj5Zeov8T9qIzPKoSNffDgZ4JNdM2kYY4C9ahFWiL7
+M9Gl1L9/2rG9suCTuXB1hXFYKQe+pOTjTUDhpNFzTWQHNTbQgYSj+cIdG3d9YTlF
+/fiQH0WQznQNU6J/iyQEvJXcyKyhQt0C7eZOq2tI5MNk7t5mAvwns9YuNg5NMA1y
+q/ihUsLmc5Dz8U6qWVVzaZxk6UsRqnAMWGgDlV2BZaK8pePJHBwNzHgj6SUTy2d+
+hiRT6jdPAgMBAAECgf9MiGxB33BETb1pWEFpGrrMkNBjvA0MT2H7LXM3JgdqQCM2
+GgnybLMiM73dorahC98uWAguGN7pRlgwvfX31R0klqTdz39lbRykc9wdBnQdq3E7
+2PbuH1LGAJO02Ck1X2yIifWcWtfgKbr1VV+hL1wL7QpKrivsrYMUahyLhowU8yxC
+jEsO8UPPL1w3McUqTKf+1IqEERWgP87l4hnqqA6a0sWCt5TsdlWN2yY0j0JA0tpC
+N1UOFVJ5I3ArXcQgFoIV+LSAfzn8b7g7BsFY/rrN/YP8LQ7DevVR8yflB9KVLm0N
+s8pgGd9ozLF0CUKD/eWj4xd/GS7/YDdltNusfYECgYEAxu5q+D/3RFDde/YXVxo1
+s0BvRlIzCjZ27XFjzc2OMRpFzbcimgXfXOyw5z2/w8tWZjNFwvW/DO1QJypt7NYl
+9AKHyRv+AkI1QmO9ZUHRB4TMOQkvGFGplcZGC+4Dpc56MwDqLjGfh8OfHMLB7Lb6
+thmkrUDyEyRs/vxBK0Ahke8CgYEAt6yA9JjuY7jTG7TfLALL+zkY6S0fbH5ozvJW
+hgE9CfkhYOHTckH7JgD5E+O7PnYmwcMnCT3ex8nv/HWykYkD3Gt7nU+5D+OZAsda
+QfnpWBFOllo17Qy/hpNfCButjDbOD4KLgeXUJKQbx0jj/dcr0XKxcoVdjt++0ITJ
+acm5kKECgYAjM5tQNJl/yEN5JRH6QtQP1S4bpn4Lp5mh6Le9ektYGwsRHQANe06M
+NgIT2VRuxDOUwCvvFOdq1S+izppHF5n9tNjsWHy5T5f3GIkyOtRPXUt6KEriJck5
+jK1mfQa+N2xeTCIkbHmLX61vPHNufO6efKksU1rC0mZLNL4fdii6lwKBgQCjTUAq
+OH5bM0ye6aUyYBoz9oPrbS7vK0TMGjJLWnaGk3XVyXJRt9Av7dWGlYc49Ztn0ra2
+RMf6IdS5RXvKYWOJahaxutvzAIxeKBhbaHLK1jhk/TfM1vTCFez8LH+UlnWG3K5k
+g46mNTJtcKUkX1aaFbsm8uRHzy67/hOFdtEBgQKBgQCKA27b6zP2O1uWUTsxiy9G
+TPXfNE4dXBEdhG1hnUM0mLDMxDT20HBEgmI874152vwMFGVwWL5qxtlNSKVoQ4h5
+z4T+9ZocN9AXgep5HEtL+oLghh6ThYxPZC13Am4Zxt/8qkrOcAjc4NH+lZprhWj7
+gPTj0jl3xrZpTHBzYi9wyA==
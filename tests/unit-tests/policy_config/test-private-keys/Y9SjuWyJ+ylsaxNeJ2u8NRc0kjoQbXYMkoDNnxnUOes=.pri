@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQDT4c8IJEnfjaug
+xmuT1N48CZPXEqaafhr34J4RTWzVVvnoDGa0q+xGvcehYIQMMpylGX8x1/p2CZ0e
+ycljXBYy90SakCxmm6xpAN8gjyvjcR5/qjDO6+Vg6oHmQw2wUZYS59gCyYho4a0D
+qTKXu0w+p5DIKwfimIpRTQS1NmzwxDVhITjpMu2CgnuQrB14jRjaFGNqSbzi4rx6
+xhyTAoLQDYMaBbJ+AdC8wFny+GQPurqbERCyxfuqRx8zOyIVCRJYvmcHnbQwe19E
+SaZmI5266htZh5HozU70GFtnAKyrJ7fWCsSLcmBtRJUu6n2XqULRv4GYE6jB7tfv
+cT7Bi3nrAgMBAAECggEABjKbuLQ/CO/+7jP/n5JhccYh8e+Uuf4oUcnbNcxa+56Q
+rs32DyDcR3Fzrm/BTQ4J8PZe9xlHNT6wvt7OKj7eU11SP2cqNVImZ+fjnvMxKHT9
+nGRhCxxxWDVj2VVqyBaK2kC329UDTXYUdn/zf+a1ozuJi6FemK03los3MQnHg/9b
+omd+FJgVX2TyvHbYyi9LYTmYPwj8DLryENu3vrcgEVC94br6DnDbpRT6eIKdUlqI
+ZlPSd1vmZr4sJv5sMyXtBvYTCSFEXRJ1bCmFdEBi9xOlo9XDFNq4T8Oe9vJCFclY
+LNFKEJ0n3dwPG2+mQggkRjcRQsafPoRkJ2Jr4ub5OQKBgQDwyczzdyMxkHaEIwAZ
+OflahSuPBWp0njniMCMQ4AzOVXIRcwJ3qjJyP0uZamqzcrGzRbHyLP3iu/S8GfMu
+Z3ze/M9VP74aaJaliEGzlo/rjPIvMuYBl5DUvvgybMqqR7xUU/ajXCNeiQ5JqOEj
+nrCgvu/5xjCGfBLgXesAdavP9QKBgQDhRIQl6wdTUXyGZZThQJGqOyOopEYZKnxp
+EvqRlXbefF5jkUOgIUacU/mNdILDC+UBV77ledj0p7wqlpmnWWZAU+hkjKyFkhmK
+x0GOauhVLCaRAsnFYn1bS2+nXauFp3fyYF0xWzbn2UWF8uffjp5RXdDNaoqXxXDG
+2wd50BlWXwKBgQCIhJG78+8zOcnILyPuKY1zwg8pPpPV3KPK1yn6dl0sWwuaUw+y
+EwAZAEP3jntClKOllb1HJjUn6RLf1wKma6xDrShMGCDLTkMjRPajQJkGntns4rm/
+a1SFGmUUCdR56MQhN52djy7KeYBtSN+k12MjMD5U6gY3KX92UCleEFlCRQKBgQDP
+etXkPsbufJ0fBCzOEzSXAAVl7HgL8c/Iz4wtzuY/IXmmZ0NMF5n7nnS5TtipYSk5
+xWGz5jhnjp6G81Luii7djOr8wXydQeV4pvHAhMMcv5997H1+6angDmj2VBYI8ihN
++2eacBLwFHQuXX4nsCotcyVALaMdCuNGpLIMBhlwLQKBgAo0hen1cNlDMDMklGB7
+frQ1L0yeqOtYsHBEU+pv2ptq8fUxmbrr6frgnomMGej0QZJKIz5XC+/FoE59hIBY
+un/O04vU2cC8XGk4Qadidn9m3iR6cP0wIcsujn83hUbwcI8mHRx0tJ9vMPjiZV6b
+6ZKucpgroh5G//6CF8ZztjBS
@@ -0,0 +1,26 @@
+MIIEvQIBADANBgkqhkiG9w0BAQEFAASCBKcwggSjAgEAAoIBAQCR6U0EtqNPL3PT
+2I7LHyti63AdmzKr5kfZ0YQHqDTj7VYjALhBw+sy6NtsaU6CN+mqRFdy/jbnHuKu
+mncQoj9rjc5hAh16Q9xxmJDlV92H5Dujg84mUl/Vs2bIQHbu6ME4k0eb1LSUlF8k
+fyuDuu334DzVHfrrdVC0tKVZtbHNzmsAey6s3/VmrUrcvdzTH+CQsFUa68U6hU5h
+oROdUYSlT2QqR8ePQFoMGcxmfMI1DDnDQDPTb4HEeCy8z8Ko9nfsUETJYfiTYAGt
+6u30WSrTh2xlAzfQ/QIDb/MOLasiZvr2C6QvVeTbHJdfHpkoZGhPaOlgvyBZVb5h
+sfUb+R8vAgMBAAECggEABHcMtc+2+KXdmAaA/CNEix7kS+ujZdJCsZ4xOaDCmZT6
+NVEA0nZh3Kl2iX9BeUenvV+hA3JXEMSHsEsmyJoGcc6hmaNcbpDkDo/aI0KIk29/
+CbZvWQndR+dZBli+qvnxa79KCjE8o21U6gOAO+Q9AwBYLDdiJdFtulHq229tdPxH
+vv0EvhDzX481oem79zdvCm6hpIvpGKVGADzW7qJFkNqxWTV6Ie/zfUf+Whmy4Arq
+FpDpwvTxrE4uQRhrC/3AvKbwjr2s2ptY+czV8JfUqLJcqBE/WLX8JBZtUttlfVLH
+pDmlYAmAsxFyhjfD6XUpwhJBI696PTF1jV27h5DHcQKBgQDLPj7HFaB3bRs0QCfl
+MDR0c0mwtau4JqDVnUtUTN2HsHyDkz3NBxNnGDYTp84LjMT3uR3Je2xXH9xMi3oF
+1J135vCXJ/CHTnIRpgjGeo4HA1LKLdBJDrw0FBxUlsXSHXUNhpemjrTZCfK+eMcC
+hz7OEN02rYSBEsJNGlw163wD3wKBgQC3yUllN+70DIQWFd6NHp/SQEp8ay3Xxu/Q
+VSxNtcfDoDkpfXe2kd3AkMW1B/JOh18s6oqI/wPJyhewCKgd6wfp8ylF5I6IyNQ0
+r+S9iUSxgAoU2nln5ypLFd4xe1WtZi3c988u4GfD8Q6VGNqq1ViBxQW0HKbxJAWH
+gwnPG4POsQKBgALOfD1xjgK4Lfz9uc9PaBoHkYfwKkvjtKrefjDO0uxRwpZqjRrs
+sxbkXbLNyWmdawbktoWWv7tARGGGN4wnEHmcZcwgkBC+Q5L80Pg0rwtnv1ftZAfu
+PSkW8gE1B8xL/dbO+f8hz1uD6Kc6sbzWM0bTMsrTgJXrtWUtLQLNmqvPAoGBAKbS
+ryyRePVN5xelAj5WbfwLH5GQOCyFB2mz5mMjfhC0fy6KFQBDp2YEA3IvpGJjvqCm
+xNlVobqpFpdTREbj8GsLrYsjy72djgHFJ3xj/VahQoVrSohl7J37W5TOvxaGiVrq
+FcYXLBlP1kzAIryuq4gfru2ulFqOt/Ypm93CvAIBAoGAQ/Pjq/WqOYXl/SX6RsCx
+xsPq9KgfaxlLHqs0q4KNBgoC9xIBDmPpqLavRv59ma+hOb2lcN8/qGiPvwyjM4NU
+wZt0yx/KqaChbYSLthMzGkc+5pHeVXz1jsP7157pQstpCqhse32Cd9om0zYtShfi
+wKXHaxNIShWgvYelSHp2IaA=
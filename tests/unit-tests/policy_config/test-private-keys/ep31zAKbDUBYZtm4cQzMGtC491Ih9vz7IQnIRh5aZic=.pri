@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQCxRvVy6pCIRNRj
+T7tnCYct2dUZvELf12BbD3UTwrdPwRUa4zfnSPVq1GV/7AlEth1q/HdoN2q50KsW
+HMQpKVg4HK7coYH93ZpqE8gQ36UoERNNKVQEV+hfreid/hRyXD5y1pzUr2PaNvi9
+h8AcC6VqZOPzSJfO0elA46xMlqmxWqz7xNTu2xzKB+SYY8Oh6q2TCDuMXIuq2HWL
+DA+JOe0UHPLYHi9jYRqBIZO/hYY6TjTPd6RMYnWIfurT6J6xhVd/W5CAaPov4e0x
+CFk6U1lsB6mlABvxTdv07IgfOL3gT1UMmBDxoS5c48mEA0MXATtSS+sDSrlVBJna
+6q25lRmPAgMBAAECggEASDCEoAyr2Ynp0R01S6KiJQY5FJdIxj0+1CYJv4fBvRz7
+2qyfZbQcmCmwwXRdW9krRpdTiqFSeSNjoAgLy1U2QvdPL7InLLlSeZLfnBtudk/p
+w7iqKXCgxGGdwcSnD+DHX11MlQFtEH3lMcz3apRFgnteJgIwK3zoVs+/qJqLtJfw
+4lItAsz9VHiLgeN1dvrmomt3TD7iG810OVU/b0NPqMTme7mJaUfmw/X3ARTJdwVm
+y9U3za7nElIY6qyZddffJrWGqHPMiRf1w8hfUXSw3EeN/6iEiJW6MfhwnKb7hZGK
+ZBJ6EA12ovhPijyVhauFGUkk7PNMrPP9ySDkyJTvxQKBgQDwm1aUDFnpzPYqpc6p
+AUnyR3kg8osb7a3bTNo7Lq8/wtvXt0+GRbn2Rllv13FtSlz+OBuIzN1MI/z4EWdm
+ns8Qntk5PW/j0vqTd9HSHo/gNGcP16BC7sjXEdvvi6z1tqkB1Z7I4VYnh3UGm/GW
+Ow2gsJSgi2AlFS04bd372OmADQKBgQC8nmhDuXGnPFe1bORambe+MZ13cxFEM5mF
+ORd58H1JYIoWj5iBO2CH2CUHlZDWgZdhlSYJtu3mWm3XEYNmaQWvBaUTnFUYD9K7
+lXrHCNjY7UMjag7ouebemy6dbeUAB2nYPhZ+gqtH57YxHUcJLgjEbtNNxHA5uPRn
+u12qgE+9CwKBgDFbbFNKhVdU2Fq/ULmSrhypVMvRdX/xLe0CwvHJDeJCkt6ZmBKv
+UwqWO9qZk4cb7h+oWt2hSPRJnac1ysReZ5O9QkpftAhES2rc9YnpAxK3LT0uuo2A
+dmrIGxn0yTJOmjTqIXyL3SSWwQbuDo0G6DDCiHq2nK5+vZwJzbPQN3YxAoGBAJy6
+4BaObJMzQApgPmvOWXDwF1GfStSqL8IUy54mqGSllHjkvyt7ZF3czAA+Vsj3jAuo
+/J+L4qjLsYPJaK9bSz7A6QefmtHQrCH1Nr1Wa6HtnSE7SsI1X1LQDe8A1w2sG1Z1
+WQmsmJi6QJkVI+bL2rsm/+wZ88rzFhtwBIfd8OQ7AoGBANB6kerU/orC3P1F/P3a
+1AA0GuOlHWpcCU7WSah3Kk5txz3iUmvpuuQh1mumEBFBnX8ANNen2mPKxQMT6X+4
+YlWKHZcJUQTemZFInV1mwWsHo7YMwFS2dcGFBaMKTZnmYVycysTUWw1fvjBSvY9e
+YcY6EgkXAay6cPk2lcLsQ8Dm
@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQCXTnx7/Gb6uKMK
+OUI6JIYe8nCi5MtKTaRYgCgJTJruGdhFjGFfzRmUiMhxjnPCAddHzfiNAa/gP+c+
+7LyH3Yea80ETRmUUZPs6TQoeJ7qeHLhJYf+mf+rV/h/cHNzHMep3RGSZ0Ckrv2fW
+aruhfF3vbsUSX/9V20iPjtXaqgj+cAMO1564BPhF1mXs8rKfZTfGR7wakf18m9wY
+3Jwa1kUnzTi1tlZi0kCa6BwrIiCw43uOuEBi1tcU9h7pZSuIUMYpdrzBuwfUCkBJ
+OUHje2JYCNw9YVdq0lzFj5+t2KHsVbOCsCr0YvCS3SRBAAmLkB+qSISOg2WD5Ism
+futCSLgFAgMBAAECggEAAw5hCdEUlGpf0rBK4+lCc0QS3dtwtsDAOdBm3p83Pulz
+Op5mBh0ar+seX1rRAEFww4DHzTNURduMlHMMMNNa7piMvzKsDoAmqewN8QN8674p
+Q8QwuYB6chWWt6e2luhtc7jELm4rsrhEROq1fQLJ0/EBFoitW+LYwZuROsA1+8un
+853ye9v5fp5fe4d5HUXqqPCdUcwEblWqRYup7t8q0wwMkDl9t1uUZoq0s6yc1Ofd
+3CNvAduRFavQfZruDy5Tp7OCxrEnL7Sn+l6Ko9mG6zdzM2G8MT1W5OpRwBa/1hyg
+aXjn1aRTLuPy37ILATgMxMzMVX2tyIXLpaaAP9SxyQKBgQDLk0DRLO9bCU3+0RwW
+KWf8pHn3jZVXsroNskXMina02jnl9TQSYigufhX0CCgtE2ygCBMlfNwPZry8JmjT
+UtdTFqVUKws7tRPNNcO4gWkLjNUJmskL2JJ+VKPYtlNTCY4dI5WL/EE5cbVE6dXD
+jOcfJadO+kKUVTTCBl3WrKqQiQKBgQC+RWk9dPMGkU/ErhkcDPjw5eWBK+NqG6rc
+6Z+Q2bJxE9Me3txM1MGEhxFx48YS2BJKrQZBX/6P8DCOJRkgu5zGXu7np6udWQ75
+eiU6yoStYqb0ROjsq4dyF+uZonpAQ272ObfiZ6N3LCdKHLqmDxZ2kDhdszFwHCeC
+c7GDhrB0nQKBgQCb9MiANzt7c6pj35DzzW7TlrG1m6rgj5SHb56XbzA3psMaT3o/
+5yC/VWq+FA2rUqkyBF2ep4Py7JMEVSyTUHCTP9MSoxMs/7EW0eyKCeIOrip6/DCv
+OZAo5fDL0goNoFFWM2+a2XqiZmEnVTilYemh6/e7wm+FMa2EQtpa3tageQKBgEO4
+tNJ4857czYV1ad6AB4LGcL9e/ZxgqJnkVTTbJxX0NmqAa+y0tQQUhvMAXRmL6kbF
++rn+Dr7wgHe3YJAz9oLsex/cn8prTlchUGrydfK4cC/07up9ysGjHeoa2GRTHAVr
+WbWtqZLbFkjcnNpJ+HbOsiE3jFsYyj82KnJj2B5JAoGBALlX+YKEG8QrXt7kZlS+
+/T6z5KBGeBSGG9oWy9qBabL7lU/ZP6uJn4Iuie9Yii0qJE5J0QPhlOMCmu1qXfx/
+jwBykY4xMq4woEyCFaoCNBCrszPwRGKhMGm6ND7xTQZ/6g1+Ma0EC0GQaVZT+X9r
+X/c3c3fZRnPfdoXsY+H6hG6S
@@ -0,0 +1,26 @@
+MIIEvAIBADANBgkqhkiG9w0BAQEFAASCBKYwggSiAgEAAoIBAQCtMX23dunAPF9x
+SLHJocDdHcMEjcieM6GkvAn6d9LihAZU3StC/HwVBZuvPiE0mgu30ELRYXHpth8+
+ZvqQnvC0n2HuaUTKFdM6cS6aLknw0hgv+BcSbtuGTTCbM5RFQXqUjF58rOjOcPD8
+EHdG+osG5lCMLbqqYz2G+h+YeS3yHeq50AX1jMOgxQ2PiZY7iZRcWWDYBnVUrSiO
+jl6P8br/KXYL06NpOMp7Gvxc4L/gBna7hrAAwRXXRPpVhLO6wJOd4deDQAu31QHw
+TdnQXd25Umy1Vnlns/Ir7ROjoR4vMW58Ndc6iu7O0qpiAR0V5t5Btx7U2ZWlu+E9
+hb2Q6Ja7AgMBAAECggEAAWa0tibhvrt+TzoaP4QEJ2RsHmdxg4DuIQiVpJqje78l
+Q1v7acAQwGgt8pKd+j5nayuX3hoN8J3llmEXsGPB2ELczWdgial945rZglLH5Wfh
+6GMu4dHypz6uR6+wZ0XRsT0EywbofNY3QcWXdlIGPzosfL1/XRLXVrjfaSzzi7tA
+ed9Zm2MaKhzVBMJRm3wnF6ox7Dlyt963lDGS+jOaSnPOGUIcL8G/ie0S+7+WUFG+
+txzFZA1/UrT4g8QpfOem4AkMJ6IOzsXETylWAcFHMDrFWjivXsy1Qf5HLXnEhZym
+WhFC2W4JFnNO9mHXfOpQCOq7m7lkLnSp+DM8+P83CQKBgQDVJM51mn2yUlHAVUCU
+cgSF1SjFl1p/Ym7HBuC9k49i2GNEY6EI9Ai6snBP+S4Xyq9ZESFpvchC3rvCuZ8+
+4iJNjHGG9uBPlQm9scpErZ9GY9IGFcpp1AQkFG6zhPzBLMv59hm7csrv/uFe7S77
+6Dn6ynpfwjS2qubjKg47kKyDnQKBgQDQBE6KsFKbKdzUQg6ugDnQlY6Dym62T+5/
+smhQYQ4+IvME6b1QpoJK2GNH1qYNX7q1C9vI0DLVQ+ySQR03CKTYc2z9co5K8aAx
+bYTYRFIGmXkWZQtzI81rFvuojokzWHHGLFL1mQOSQgMLM5vNLhDFxuOR3ajtE5KO
+hq0/mBCQNwKBgF/koFJ+wCBzMr6SXGys42YG4cIL9zYqZeZ7LK997NuuuPJy1Gd/
+y1GbqDYCyH8BvGQY9exp6uhS5yyTcJbNDFvRXN44wfBsACbtDzBY4Li9ficotJlq
+PrawzqFLqp+KdPavhyIzYiQZivG3ShUhhLxVTjs415h7SUdYi3C3BTZtAoGAfkKO
+9cluanXvbvqldK+p5/xPI5lkt84ugl3kyR0QCxElls7VNTXMEefj4v/bjHSVnDyV
+a/9LS31OA7v4IqZhgGwXNIMq8TxWMoo6PxbA/vZ6s+gjGgEaNy0dFUNm7b56WIIg
+3KfCrizZMhxiLhkO3y0IhkoXtcbShyYh1F7VduMCgYBXS7fXwZu+qt92JG4L/crW
+oughcGsaF8QGE7yjQkjppZKkxqdybp/9/OkD2W8DxiZh+KeSgNpIpGv40kcdq/mv
+Z5WebPZIO/6WOFuTQdNCskeBBG9Ej9Jo8ouldeMFlShg3WetSgYO+YC10zEH6u6x
+4RQ0GW9v/fhlicmZ+sVmfg==
@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQC/VDdrTJYQSM/+
+ACVjyYwCLc7zhTiG34spN6R2YlwXRbvjsMJ/00cE7cQb+8jCzNssOksyVBvebJ7A
+fjDU69t0p2fowUu61jfIybGzyA3gPpBW1VwVcuk2WxWY9ThnhVV9XMg5XMBKsjzP
+gkZJ8ge9wixGAlQ0G2I6rdghqLhJdlv/fpBjpM7V5sreZytDk21J+GS5Hhh98jEP
+VyOwkFPt0ISWe8KtB3DBCzRsEK2mWREj5MzF4rJWHSS45hs662LFr1BQgidNdmCm
+5pUSZV1SvkADdmZmk/hnf4KSIV4+M/jyN+gLARVa7HecQNCVqnEVzrGRj8ZWNzne
+VSXF4MOrAgMBAAECggEAAjTNWT3nHxdIvkXMfekjyTn6x49TGifwFkKIYz6kj8TO
+XcueSMYPpd5KeJN4iMtpnZgc74l4Mz6u2byeVsHE1iDrZMTgEfXB3UDs0n4RBR48
+djE1GT0btJDr/DlGV9gktQ8XARc4b8QR18dl9qcaqdwC2MwLhb/a3buUPYFYSOZW
+M0DpU8xlz6iTSjyXbZo4TzMM+TN7I4ox+rlLsP5RnphtSNh2qJn0voI70Fg7JLcS
+pcQUl5goZVOdspNXoW3klX/DuA5jbvcRL2net63Yz9PLxrCYHTOIar2ClaPCIxrd
+0PcGeKDT3/ol+UwEFpPOsusMlw3xEWi5Lbhr9z87xQKBgQD3AQgawUaMjDxo++35
+utk98C/SBwCGR3recHPUnFhUGACMJT+tymEkiPSQNiiho/HVbIZXEJAe3XGOQlvo
+NycqWJvJlEmHVr8SZR9f3NYLxvtfAO6CFDhEo5nbg1rTdjW+DgzySe9xi4YgpdMa
+yGf4c03WDM+oD6Ygx/HMm6konwKBgQDGTBetMXhEkI8Xx/ptQe9hLJH+pwvcINLV
+uZzD1J/miIsJwglONL0Qph0xuX7BrBl/0l9y5sU+8KPJ0AzUfLEdP/YJqnnMxA3X
+vTIdLddEoh6p5In9pYcY5vHU43zdVOlPjjxaFbFImjCDmhXYAKwCxJOUeln2fE9x
+8+olF0rtdQKBgQDRhaaCS4C0qCB2TX3IYJ720089MYNYZDnthiY7K4QhkVqlhtNF
+cG6Gt0X9LnO46YCyMaSjJgGarO0uZ0ve5ynp2dAMZiUZEJRz3iOHBaTryJZiOEAZ
+R12Tm9NfSUU6KwPbe7+vptfd0SStfPxds7G+JtDXyXY8cUnSdMi/bytGsQKBgQCr
+aeOdp4HbY0sOt6PXBoQzcB/UDfrGkukuL4FAF3ESCz6FdOIuZJB6792UulDEgkyY
+nfY8kRg4zDQJpHsyw4cnTb8Vo/Qd+ewtbjL/3jyT68CuBAz04j3iXOD3sp6hhWEZ
+kE7DYLUbmY4OdQgk7I/E5MDePNW/qL3UN5FT9sqicQKBgDguubIiokpK+icb5un1
+X5c+5gwesoDQZLIYEDAXLzNE/GCg/pWZqiHGkJcDCyGEXU2CB9Dxx9DvqJGkgB+G
+Y2+s7U4zBb2i7GRDqu0z3I58jz+lIe9gI+Eh70/2j2YMFbaN8wa2rKTiR9N+zdx5
+k1KKXv7IIhyq1jMpF/019Uwb
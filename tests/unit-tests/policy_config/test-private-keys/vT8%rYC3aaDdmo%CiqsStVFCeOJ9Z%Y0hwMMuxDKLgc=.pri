@@ -0,0 +1,26 @@
+MIIEvAIBADANBgkqhkiG9w0BAQEFAASCBKYwggSiAgEAAoIBAQCQ1w/kRaYxKTE9
+5SDY95y7kN814MkQ0iOMRbIJYh5aVNUFFZY/VcXvYv6IPeXvxJObdOUwZ4Q/9dSP
+ndq99MmdIPo1R0yU0BeopRGH8ZHoxXpDWmpgj10d1MsX/ohhV1c18VzkvlJsKcAo
+1oEo3/NmO4b0rl+Vp7J8RmlezJC9/LkpjIRII6WdDbCFntrGef5ettp+JA+t8IB3
+Su1oLc4+Ys+ocj5YA8vnyc4JJbrDFZ61XBLdOtpNQAPX6M9yG/zvFex7CNC7pBE5
+TIyf4ATtUxf1OQgLYwfV3F9ph3c7uBG6dCbRgiKpSZei3DxS4xBkRGkcbo2PLXPN
+M7hRp6adAgMBAAECggEABolGBNGl0dMfj0D/TftCne5IPGiz+ifZhdOBWM4OO5pX
+cJ7MRHhs8cQgY2qTrVHMLXhFfX02aSKBYKfJfsgErywVToE0sgSABNLKKz3aDUyY
+G2EBqvDdTWLUdXU9l1L3Mw582C/EjXAG5XDkrEEK/WKTUQhrdNf4BIay653ErGYh
+Vh0dEM5+zgtwzHRtWhD25My+2fgWxDuwsK9n15Aa5eR7K+Hblo+GxtLmD1S12jfl
+VP5O8R3iOCDjnhJMoZi2x5NP1UBjRDetTnU/KpL5N04b4j6akSX/du4/+7He59i4
+uZWMrkyMgrK+lyThmOaI7ryBfmpHJYoFxc2BTvc/GwKBgQDMPPqo6ycIg/Lft+Kt
+zqAzz6VZvScBh52QM5fTb7YAH+Wjwu8s6I0l7RboF+trWCiQrmv4nP4aNNPsCEvX
+cOYZfrPIZkkOcK0tQ0AoPUiHkXyGiU8cfDb6o5LCX/fqKndEcKyGMKpD6vY4qurH
+dBMY3yCqg+PeWShjAM/MqrSq2wKBgQC1jFHfsrgBasu2twlyY7hL0BAEsgTTQuRz
+rDZHuFT34mI+85NM88KILCcHKUuFDCo/gWhW5HS5sF5D9bTijAWvemqWox7X1kl3
+XEVLV3TtYtJEWlfd/ajna1rjt9Fe9KJZL3EhqJIIcZyeYhFVNVxLX3LA5YNSThyr
+XZz/N5Xh5wKBgCzXcp1ly9MlzUxrPjy08h2OCJrUWd0PHnwLp9kHXOlYF35GDWdJ
+w7vA+1eH8OtHlth1Q0V5ipzMXn8jLyulIRAV7nkgZAfkm1Elw89R7Tu+qJ2NRi5V
+42hSQ6WjlnX2Tuta5bYstyVkUB0PAa86//pk+vIVNRGbd6+M/RLNpA8jAoGARFCh
++nBQ50+diorDxkSZ9AU+EdY/FJQmTRSvdDt71a9dUtzrP9i2CfG7WemDHnSebTkv
+3wqmlb01K5OI1nrkJM0G0Npe388l5AFXnesx96XpA4mPaNxrs3FlSS1BXt7lPHQq
+uQSqtvyxd7PlW8/xg/dNwiJbURxNk3ptemgbQV8CgYAhPjR/4Yd+LWSbvN5Cn09N
+Jmv2o7F49S3x5pxmRuEuKFE1V+5DoOs7BLZhXCRtz2V/Rx8jLSF9Y9/8pig08to8
+kpqEnrR9BbteC+75r3oMXABNEWZiS11/DFWOIwUGgPXKpRUB1rYXK/K1amdey28/
+qFVGHZYgup18sGj0+lZg3w==
@@ -0,0 +1,26 @@
+MIIEvgIBADANBgkqhkiG9w0BAQEFAASCBKgwggSkAgEAAoIBAQCXUbhiwGCpAMlm
+A4C+Vxs2V5dImEv2ilo9417CjC6Sl36OgLnQ7W2Kl/1S5veygHXUVh1WTbDZwerf
+H004rgERuLlZJy38sQQm4AnmXeyL7n3gUpuDtWKeIumWeTaqRF496eKl1ANJVvYA
+J5P1eVI9JkyeJl/iR5EKf6TxZh67xjSsIUwFEl5JQWrho8aKQQ3owwwwibwR0SOV
+LAiv4Ve3eAU8fhdtM9BU/VzFlIaSc3gBPkfttcdqtfwe8lSQUd4nMY1atwCs4fnR
+Xyjcp+oArKxhXn3sJiR6AXfvrkBUNt7wB4uApiqJ+mxnY/873wwJPJ5GW4pVMATW
+nCsoSUARAgMBAAECggEACN3A8AhVoZFqO4/4+y4fag+3zYke6lMw9m9cHgoYsH4v
+7CmeuZ8vy+8b6L+fw9XDEa36ChSDSD8Ug/5RiACqD1/DfHXPO/8jPyPhcJ4QPiK7
+PWmZsx3tqVZiWW7AxTk8TGRn40+I4cM2psuq37c8GlkkJCAbfiazWOohwAM7ycS8
+M1ffINEeAdVOzsXbnLeo1u3/zy5Vs8+4AR3sRPQCZbduCmfzVToeMChRW1JQmdpT
+E/fJtE22pNhR3k9MDnQASKfptO9FUZ/GSdSgqNLRtz+OdpM/cl2ZvhJMVXYteEvg
+Lc4PQEZGwJfzdkvMLjIigAmPTRbkKSIoOED435TAAQKBgQDSjYJU1X/aoZJPcVAV
+DxGZoRwZZ0h+OsVHrBp8VdVg2cmeqNSfNlvLqRoy4Xtdt+cyTFoxtPEytYFQE2Co
+jukut/CIXI6M70V2weNliGO4PqMew4CHtigqDzhNMG0olLFgfWGJYEzb4gGCa7/5
+XUtSE057RCM5tj1Eih+8S9HEyQKBgQC3+yZEeSftDu3/bvMAPirRLIeQ1z7IXRW8
+69+W06DOwDniMBAFM9BS63QhHXQZG/PxjcQ98vCmq6zCANMdON8rZAp2RQazrlam
+r9KHxAjTOFo9NTg6GnSjPS7fkCdMHdTtzW6853JwVNvX92xkIvS/JjFhf6x/jXXc
+Z5tKjsItCQKBgQDOAo1B6f+F8E6SkkETycGjuoIezPKeJ2y9WsQzYVw8vfrK1U/s
+U6hvVY5/uCUXpod8rD4Xon3Y6sSSj9MkOWgoQOsE0OLdPIOP1ddjkZZYQFkkEY9h
+ubYEqQ2iYL59VTdUPHlBi8rH3ZMyg7C7ETBQJvnEHAAHSKsbs7Wna9vcGQKBgQCS
+xq6U2gNcQBjnO2BpxS7riZbtmorf1kNNYPATp+oWh4ymQqnFPLzqKiWPdav1jDNl
+djAlK/eJQFSmwXmrSn/gYgNmr1LVbjR67rIK1f4kZES5qAefcxOyV1FZ0etH8lS5
+ErdRxWOq8kghV6cFjE2tYY7rtausZvKsT4u4Q4Pt4QKBgHtEBg5dJji8phtcmJeM
+QN9r3lI2bt5G+Kv91cy7qDd/rQOjvCiYI0MiPtbktIAJbqh8wC4uoJZyVO0Zaq/V
+DiTsunVMWUgAyV0dtJY8YL7iCWvXIg3+//P8BwrN9JpId2njioSAPK3YUjSXH8ij
+CtoXn0yia9Xwv/3jB/5lWpZc
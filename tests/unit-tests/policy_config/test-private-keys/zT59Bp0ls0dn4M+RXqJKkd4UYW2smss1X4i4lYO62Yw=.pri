@@ -0,0 +1,26 @@
+MIIEvAIBADANBgkqhkiG9w0BAQEFAASCBKYwggSiAgEAAoIBAQCtyvtwrKuRUNfb
+olR6Jo4TNZRcn2b6yoC5dXLRU/TEXlEPJ+8u8qeILhMsBio3EgtEP9xffYynJkfV
+obtK5N7N1i8AQkAc4nBY5pv3d5mVlNkXw2okVyR8B2/r6NVjsk1yjomD3gHDLuAD
+332Qquaa7z85d92mVQMHantjM1Kqf+fuKLfy16WDffsJUO2YaeoicwtEXkp4r7WN
+pXbB3SQjJnx9xXf86dRZEFXAdlW3w3XErxC9h2fZmcmh3YiFsRGD0Jzp4YNInv6g
+pDsxgB6c8soeAhz9YhJtKgpDjacq9mlR0v8ydcDuIK3Fa4V2NQRVx2H9XnUbCtpQ
++/mkjOThAgMBAAECggEAAI2LRD4AY7t2nFfFXggeXphGiw7kxHp9c1mYzmqudit4
+pYwyehtChi/jVroES12O1J5BZLphBq0cAGV904yr2srKJn2Pd6gOxHGjYGOshOnO
+0QEJpujyEETzybPZbfJExc8HR/ieV9Ef3FNLMnkgt7B4KoYjmeJeWpkvoE6q/ijd
+q8OrboEdsN+RoNhAVhWt3upyf8vJVsFTurpkEEjFbhF9G5S4HtRmRTqivCD74lO4
+SW3kAQvR3z1aPGlX8vtQD+rZOGK9qUGSu4qi4FXTC3WK81+R+PoT12vy4heRe081
+wpnmtvD4M0EhK95w1L7uW2WZzwVGIDcKAOn9oM15SwKBgQDZ7CdeH2MIJBGNowwp
+7EvBLONmYeYCs6HkhRIu7+FL1OvVoow52kp9QF+gjad4FdCl9JKYr+0bBd713RLa
+Xicwzu5rN3rkqPz0F70RpxzxDlLLZinZ2Lt05idZHxfmm8AtIRI/UU74V0bV8Esf
+Z/fBvBHR9g1Y59aBclgcqxRmMwKBgQDMKOCStLObi05YBM4OxUTkFbUyZhwHQhZu
+IF69ecigowxkd/uaxoL6PQazCC4BeLBeq6w0mcpJEhKlZsQZMGz4XdFzGPisIhub
+4+wspScpholkHbpethX0tBVZTabGPBlLxR7nXO9bpwWFkhKlrE5SxfZic0NsorvA
+rYjMpxTsmwKBgBIecXOA9pHxtcfp+5PswquwGMQldaNZ3icK7WUbqsbMUEN1/WS+
+Ap2BYbIOtRLl9XAm8p1hWzx4833LwMqJM4b6XZZqiXxDlKyS4LR8CYr9XuLsfqRP
+Qd7JWBIv5KPW5VabPlInZ4J8dzZIgWZ+FXp1MaIcbCWtOQeQQ0U28D5DAoGAPFdQ
+mMvD0hNIYod5B7CSff9UgMLhQdvsmTwEBGh8Pc4zGXbE7KgDikaDNmMShejP6AtB
+aIKT4SjwTeajyvYfHwFLqIMW7HlgQ6EH6uIdQw66iNaogNm8f4jCTpS+2BRnPZfT
+XHqBXEtvPF1CGalltN1BxzNeGDu41mfz6NjxPEUCgYBNr5N0FaCyC7eFbZVJOw+Y
+/6fHee27s0g+9FWnTtc83C7v+kQGsvX/sxoegwUMUQTqudQzN+G+5PNiu+PvJMkU
+5tfYWDH/MFCV0iX6MBlf8YOWANBoB0JPlPcw2R6w5OU6z+BspPzBAvL0/Q0ePot9
+67i06xPSF+quqEF2TOpUng==
@@ -0,0 +1,353 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/ndn-cpp-config.h>
+
+#ifdef NDN_CPP_HAVE_BOOST_ASIO
+
+#include <sstream>
+#include <unistd.h>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/transport/async-unix-transport.hpp>
+#include "../../src/encoding/element-listener.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+class RecordingElementListener : public ElementListener {
+public:
+  virtual void
+  onReceivedElement(const uint8_t *element, size_t elementLength)
+  {
+    elements_.push_back(vector<uint8_t>(element, element + elementLength));
+  }
+
+  vector<vector<uint8_t> > elements_;
+};
+
+static void
+setFlag(bool* flag) { *flag = true; }
+
+static void
+increment(int* count) { ++(*count); }
+
+static void
+saveMessage(const string& message, string* savedMessage)
+{
+  *savedMessage = message;
+}
+
+static void
+onAccept(const boost::system::error_code& errorCode, bool* isAccepted)
+{
+  *isAccepted = !errorCode;
+}
+
+class TestAsyncSocketTransport : public ::testing::Test {
+public:
+  TestAsyncSocketTransport()
+  : acceptor_(ioService_), serverSocket_(ioService_), transport_(ioService_)
+  {
+    ostringstream filePath;
+    filePath << "/tmp/test-async-socket-transport-" << ::getpid() << ".sock";
+    filePath_ = filePath.str();
+    ::unlink(filePath_.c_str());
+  }
+
+  ~TestAsyncSocketTransport()
+  {
+    transport_.close();
+    ::unlink(filePath_.c_str());
+  }
+
+  /**
+   * Listen on the Unix socket and connect the transport to it.
+   */
+  void
+  connect()
+  {
+    boost::asio::local::stream_protocol::endpoint endpoint(filePath_);
+    acceptor_.open(endpoint.protocol());
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+    bool isAccepted = false;
+    acceptor_.async_accept
+      (serverSocket_, bind(&onAccept, _1, &isAccepted));
+
+    bool isConnected = false;
+    transport_.connect
+      (AsyncUnixTransport::ConnectionInfo(filePath_.c_str()), elementListener_,
+       bind(&setFlag, &isConnected));
+    for (int i = 0; i < 1000 && !(isConnected && isAccepted); ++i) {
+      ioService_.poll();
+      ioService_.reset();
+      usleep(1000);
+    }
+    ASSERT_TRUE(isConnected && isAccepted);
+  }
+
+  /**
+   * Read from the server socket until nBytes are received or there is no more
+   * progress.
+   * @return The number of bytes received.
+   */
+  size_t
+  receive(size_t nBytes)
+  {
+    vector<uint8_t> buffer(65536);
+    size_t nReceived = 0;
+    for (int idle = 0; nReceived < nBytes && idle < 1000; ) {
+      ioService_.poll();
+      ioService_.reset();
+      if (serverSocket_.available() > 0)
+        nReceived += serverSocket_.read_some(boost::asio::buffer(buffer));
+      else {
+        ++idle;
+        usleep(1000);
+      }
+    }
+    return nReceived;
+  }
+
+  boost::asio::io_service ioService_;
+  boost::asio::local::stream_protocol::acceptor acceptor_;
+  boost::asio::local::stream_protocol::socket serverSocket_;
+  AsyncUnixTransport transport_;
+  RecordingElementListener elementListener_;
+  string filePath_;
+};
+
+TEST_F(TestAsyncSocketTransport, QueueAndWatermarks)
+{
+  int nHighWatermark = 0;
+  int nLowWatermark = 0;
+  transport_.setSendQueueOptions(SendQueueOptions()
+    .setMaxQueuedBytes(64 * 1024)
+    .setWatermarks(32 * 1024, 8 * 1024)
+    .setDropPolicy(SendQueueOptions::DROP_NEWEST)
+    .setOnHighWatermark(bind(&increment, &nHighWatermark))
+    .setOnLowWatermark(bind(&increment, &nLowWatermark)));
+  connect();
+
+  // The server doesn't read, so after the socket buffer is full the packets
+  // are queued up to the maximum and then dropped. send must not block.
+  const size_t packetSize = 8000;
+  const int nPackets = 1000;
+  vector<uint8_t> packet(packetSize, 0x55);
+  for (int i = 0; i < nPackets; ++i) {
+    transport_.send(&packet[0], packet.size());
+    ioService_.poll();
+    ioService_.reset();
+  }
+
+  ASSERT_TRUE(transport_.getQueuedBytes() <= 64 * 1024);
+  ASSERT_TRUE(transport_.getDroppedPacketCount() > 0);
+  ASSERT_EQ(1, nHighWatermark);
+  ASSERT_EQ(0, nLowWatermark);
+
+  size_t nExpected =
+    (nPackets - transport_.getDroppedPacketCount()) * packetSize;
+  ASSERT_EQ(nExpected, receive(nExpected));
+  ASSERT_EQ(0, transport_.getQueuedBytes());
+  ASSERT_EQ(1, nLowWatermark);
+}
+
+TEST_F(TestAsyncSocketTransport, ThrowWhenFull)
+{
+  transport_.setSendQueueOptions(SendQueueOptions()
+    .setMaxQueuedBytes(16 * 1024)
+    .setDropPolicy(SendQueueOptions::THROW_ERROR));
+  connect();
+
+  vector<uint8_t> packet(8000, 0x55);
+  bool threw = false;
+  for (int i = 0; i < 1000 && !threw; ++i) {
+    try {
+      transport_.send(&packet[0], packet.size());
+    } catch (const runtime_error& ex) {
+      threw = true;
+    }
+    ioService_.poll();
+    ioService_.reset();
+  }
+  ASSERT_TRUE(threw);
+  ASSERT_EQ(0, transport_.getDroppedPacketCount());
+}
+
+TEST_F(TestAsyncSocketTransport, DropOldest)
+{
+  int nHighWatermark = 0;
+  int nLowWatermark = 0;
+  transport_.setSendQueueOptions(SendQueueOptions()
+    .setMaxQueuedBytes(64 * 1024)
+    .setWatermarks(32 * 1024, 16 * 1024)
+    .setDropPolicy(SendQueueOptions::DROP_OLDEST)
+    .setOnHighWatermark(bind(&increment, &nHighWatermark))
+    .setOnLowWatermark(bind(&increment, &nLowWatermark)));
+  connect();
+
+  // The server doesn't read, so the queue fills up and the oldest queued
+  // packets are dropped to make room.
+  const size_t packetSize = 8000;
+  const int nPackets = 1000;
+  vector<uint8_t> packet(packetSize);
+  for (int i = 0; i < nPackets; ++i) {
+    packet[0] = (uint8_t)i;
+    transport_.send(&packet[0], packet.size());
+    ioService_.poll();
+    ioService_.reset();
+  }
+  ASSERT_TRUE(transport_.getQueuedBytes() <= 64 * 1024);
+  ASSERT_TRUE(transport_.getDroppedPacketCount() > 0);
+  ASSERT_EQ(1, nHighWatermark);
+  ASSERT_EQ(0, nLowWatermark);
+
+  // A large packet drops all the queued packets which are not being written,
+  // which drains the queue to the low watermark before it is queued.
+  vector<uint8_t> largePacket(56 * 1024, 0x77);
+  transport_.send(&largePacket[0], largePacket.size());
+  ASSERT_EQ(1, nLowWatermark);
+  ASSERT_EQ(2, nHighWatermark);
+
+  // The newest packet is not dropped, so it is the last one received.
+  vector<uint8_t> buffer(65536);
+  size_t nReceived = 0;
+  uint8_t lastByte = 0;
+  for (int idle = 0; idle < 1000; ) {
+    ioService_.poll();
+    ioService_.reset();
+    if (serverSocket_.available() > 0) {
+      size_t n = serverSocket_.read_some(boost::asio::buffer(buffer));
+      nReceived += n;
+      lastByte = buffer[n - 1];
+      idle = 0;
+    }
+    else {
+      if (transport_.getQueuedBytes() == 0)
+        break;
+      ++idle;
+      usleep(1000);
+    }
+  }
+  ASSERT_EQ(0, transport_.getQueuedBytes());
+  ASSERT_TRUE(nReceived >= largePacket.size());
+  ASSERT_EQ(0x77, lastByte);
+}
+
+TEST_F(TestAsyncSocketTransport, DefaultIsLossless)
+{
+  connect();
+
+  // Queue more than any fixed default maximum while the server doesn't read.
+  const size_t packetSize = 8000;
+  const int nPackets = 1000;
+  vector<uint8_t> packet(packetSize, 0x55);
+  for (int i = 0; i < nPackets; ++i) {
+    transport_.send(&packet[0], packet.size());
+    ioService_.poll();
+    ioService_.reset();
+  }
+  ASSERT_EQ(0, transport_.getDroppedPacketCount());
+
+  size_t nExpected = nPackets * packetSize;
+  ASSERT_EQ(nExpected, receive(nExpected));
+  ASSERT_EQ(0, transport_.getQueuedBytes());
+}
+
+TEST_F(TestAsyncSocketTransport, WriteError)
+{
+  string errorMessage;
+  transport_.setSendQueueOptions(SendQueueOptions()
+    .setOnWriteError(bind(&saveMessage, _1, &errorMessage)));
+  connect();
+  serverSocket_.close();
+
+  // The write error closes the transport instead of throwing from poll.
+  vector<uint8_t> packet(8000, 0x55);
+  for (int i = 0; i < 1000 && transport_.getIsConnected(); ++i) {
+    transport_.send(&packet[0], packet.size());
+    ASSERT_NO_THROW(ioService_.poll());
+    ioService_.reset();
+    usleep(1000);
+  }
+
+  ASSERT_FALSE(transport_.getIsConnected());
+  ASSERT_TRUE(errorMessage.size() > 0);
+  ASSERT_EQ(0, transport_.getQueuedBytes());
+  ASSERT_THROW(transport_.send(&packet[0], packet.size()), runtime_error);
+}
+
+TEST_F(TestAsyncSocketTransport, ReceiveSplitElements)
+{
+  connect();
+
+  // Send a small packet, then a large packet split across several writes
+  // with the next packet's first bytes in the same write as its tail.
+  Data small(Name("/small"));
+  Data large(Name("/large"));
+  vector<uint8_t> content(8000, 0x33);
+  large.setContent(Blob(content));
+  Blob smallEncoding = small.wireEncode();
+  Blob largeEncoding = large.wireEncode();
+
+  vector<uint8_t> stream(smallEncoding.buf(), smallEncoding.buf() + smallEncoding.size());
+  stream.insert(stream.end(), largeEncoding.buf(), largeEncoding.buf() + largeEncoding.size());
+  stream.insert(stream.end(), smallEncoding.buf(), smallEncoding.buf() + smallEncoding.size());
+
+  const size_t chunkSize = 1500;
+  for (size_t offset = 0; offset < stream.size(); offset += chunkSize) {
+    size_t length = min(chunkSize, stream.size() - offset);
+    boost::asio::write
+      (serverSocket_, boost::asio::buffer(&stream[offset], length));
+    for (int i = 0; i < 10; ++i) {
+      ioService_.poll();
+      ioService_.reset();
+      usleep(100);
+    }
+  }
+  for (int i = 0; i < 1000 && elementListener_.elements_.size() < 3; ++i) {
+    ioService_.poll();
+    ioService_.reset();
+    usleep(1000);
+  }
+
+  ASSERT_EQ(3, elementListener_.elements_.size());
+  ASSERT_TRUE(Blob(elementListener_.elements_[0]).equals(smallEncoding));
+  ASSERT_TRUE(Blob(elementListener_.elements_[1]).equals(largeEncoding));
+  ASSERT_TRUE(Blob(elementListener_.elements_[2]).equals(smallEncoding));
+}
+
+#else // NDN_CPP_HAVE_BOOST_ASIO
+
+TEST(TestAsyncSocketTransport, NoBoostAsio)
+{
+}
+
+#endif // NDN_CPP_HAVE_BOOST_ASIO
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,12 +23,14 @@
 #include "ndn-cpp/lite/util/crypto-lite.hpp"
 #include <sstream>
 #include <ndn-cpp/data.hpp>
+#include <ndn-cpp/data-template.hpp>
 #include <ndn-cpp/security/identity/memory-identity-storage.hpp>
 #include <ndn-cpp/security/identity/memory-private-key-storage.hpp>
 #include <ndn-cpp/security/policy/self-verify-policy-manager.hpp>
 #include <ndn-cpp/security/key-chain.hpp>
 #include <ndn-cpp/sha256-with-rsa-signature.hpp>
 #include <ndn-cpp/generic-signature.hpp>
+#include <ndn-cpp/digest-sha256-signature.hpp>
 #include <ndn-cpp/lite/util/crypto-lite.hpp>
 #include <ndn-cpp/lite/lp/lp-packet-lite.hpp>
 #include <ndn-cpp/encoding/tlv-wire-format.hpp>
@@ -642,6 +644,68 @@ TEST_F(TestDataMethods, FullName)
   ASSERT_FALSE(data.getFullName()->get(-1).equals(saveFullName.get(-1)));
 }
 
+TEST_F(TestDataMethods, LazyDecode)
+{
+  Data fullData;
+  fullData.wireDecode(codedData, sizeof(codedData));
+
+  Data data;
+  data.wireDecodeLazy(Blob(codedData, sizeof(codedData)));
+  ASSERT_EQ(fullData.getName(), static_cast<const Data&>(data).getName());
+
+  // The retained encoding and signed portion are the same as a full decode.
+  SignedBlob encoding = data.wireEncode();
+  ASSERT_TRUE(encoding.equals(Blob(codedData, sizeof(codedData))));
+  ASSERT_EQ(fullData.wireEncode().signedSize(), encoding.signedSize());
+  ASSERT_EQ(0, memcmp(fullData.wireEncode().signedBuf(), encoding.signedBuf(),
+                      encoding.signedSize()));
+  ASSERT_EQ(*fullData.getFullName(), *data.getFullName());
+
+  // A copy made before the other fields are decoded can decode them.
+  Data dataCopy(data);
+  ASSERT_EQ(dumpData(dataCopy), initialDump) << "Lazily decoded copy does not match original dump";
+
+  ASSERT_EQ(dumpData(data), initialDump) << "Lazily decoded data does not match original dump";
+  // Decoding the other fields doesn't change the encoding.
+  ASSERT_TRUE(data.wireEncode().equals(Blob(codedData, sizeof(codedData))));
+
+  // Changing the name after a lazy decode keeps the other fields.
+  Data renamedData;
+  renamedData.wireDecodeLazy(Blob(codedData, sizeof(codedData)));
+  renamedData.setName(Name("/renamed"));
+  ASSERT_TRUE(renamedData.getContent().equals(fullData.getContent()));
+  ASSERT_FALSE(renamedData.wireEncode().equals(Blob(codedData, sizeof(codedData))));
+
+  // A truncated packet fails when checking the outline.
+  ASSERT_THROW(data.wireDecodeLazy(Blob(codedData, 20)),
+               runtime_error);
+
+  // A lazy decode rejects the same malformed packet as a full decode, such as
+  // an unrecognized critical TLV in place of the SignatureInfo.
+  const uint8_t unrecognizedType[] = {
+    0x06, 0x0A, // Data
+      0x07, 0x03, 0x08, 0x01, 0x41, // Name=/A
+      0x1F, 0x01, 0x00, // Unrecognized type 31
+      0x17, 0x00 // SignatureValue
+  };
+  Data badData;
+  ASSERT_THROW(badData.wireDecode
+               (unrecognizedType, sizeof(unrecognizedType)), runtime_error);
+  ASSERT_THROW(badData.wireDecodeLazy
+               (Blob(unrecognizedType, sizeof(unrecognizedType))),
+               runtime_error);
+}
+
+TEST_F(TestDataMethods, LazyDecodeSelfAssignment)
+{
+  Data data;
+  data.wireDecodeLazy(Blob(codedData, sizeof(codedData)));
+  Data& sameData = data;
+  data = sameData;
+
+  ASSERT_EQ(dumpData(data), initialDump) << "Self-assigned lazily decoded data does not match original dump";
+}
+
 
 TEST_F(TestDataMethods, CongestionMark)
 {
@@ -670,6 +734,77 @@ TEST_F(TestDataMethods, CongestionMark)
   ASSERT_EQ(1, data->getCongestionMark());
 }
 
+TEST_F(TestDataMethods, DataTemplate)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  ptr_lib::shared_ptr<PibIdentity> identity = keyChain.createIdentityV2
+    (Name("/TestDataTemplate"), RsaKeyParams());
+  SigningInfo params(identity);
+
+  Data prototype(Name("/ndn/abc/%FD%01"));
+  prototype.getMetaInfo().setFreshnessPeriod(10000);
+  DataTemplate dataTemplate(prototype, keyChain, params);
+
+  const uint8_t content1[] = { 1, 2, 3 };
+  const uint8_t content2[] = { 4, 5 };
+  BlobLite contentSlices[] =
+    { BlobLite(content1, sizeof(content1)), BlobLite(content2, sizeof(content2)) };
+  Name::Component finalBlockId = Name::Component::fromSegment(9);
+  vector<uint8_t> output;
+  size_t offset = dataTemplate.wireEncode
+    (Name::Component::fromSegment(2), &finalBlockId, contentSlices, 2, output);
+
+  // Make the same Data the usual way. RSA signatures are deterministic.
+  Data expected(prototype);
+  expected.getName().appendSegment(2);
+  expected.getMetaInfo().setFinalBlockId(finalBlockId);
+  const uint8_t allContent[] = { 1, 2, 3, 4, 5 };
+  expected.setContent(Blob(allContent, sizeof(allContent)));
+  keyChain.sign(expected, params);
+
+  ASSERT_TRUE(Blob(&output[offset], output.size() - offset).equals
+              (expected.wireEncode())) <<
+              "The template encoding should match the full encoding";
+
+  // Encode again into the same buffer without a FinalBlockId.
+  offset = dataTemplate.wireEncode
+    (Name::Component::fromSegment(3), 0, allContent, sizeof(allContent), output);
+  Data decoded;
+  decoded.wireDecode(&output[offset], output.size() - offset);
+  ASSERT_EQ(Name(prototype.getName()).appendSegment(3), decoded.getName());
+  ASSERT_EQ(0, decoded.getMetaInfo().getFinalBlockId().getValue().size());
+  ASSERT_EQ(10000, decoded.getMetaInfo().getFreshnessPeriod());
+  ASSERT_TRUE(decoded.getContent().equals(expected.getContent()));
+}
+
+TEST_F(TestDataMethods, DataTemplateDigestSha256)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SigningInfo params(SigningInfo::SIGNER_TYPE_SHA256);
+
+  Data prototype(Name("/ndn/abc/%FD%01"));
+  DataTemplate dataTemplate(prototype, keyChain, params);
+
+  const uint8_t content[] = { 1, 2, 3 };
+  vector<uint8_t> output;
+  size_t offset = dataTemplate.wireEncode
+    (Name::Component::fromSegment(0), 0, content, sizeof(content), output);
+
+  ptr_lib::shared_ptr<Data> decoded(new Data());
+  decoded->wireDecode(&output[offset], output.size() - offset);
+  ASSERT_TRUE(!!dynamic_cast<const DigestSha256Signature*>
+              (decoded->getSignature())) << "Expected a DigestSha256Signature";
+  ASSERT_EQ(ndn_SHA256_DIGEST_SIZE,
+            decoded->getSignature()->getSignature().size());
+
+  VerifyCounter counter;
+  credentials.verifyData
+    (decoded, bind(&VerifyCounter::onVerified, &counter, _1),
+     bind(&VerifyCounter::onValidationFailed, &counter, _1, _2));
+  ASSERT_EQ(counter.onValidationFailedCallCount_, 0) << "Signature verification failed";
+  ASSERT_EQ(counter.onVerifiedCallCount_, 1) << "Verification callback was not used.";
+}
+
 int
 main(int argc, char **argv)
 {
@@ -27,6 +27,8 @@
 #include <ndn-cpp/security/identity/memory-private-key-storage.hpp>
 #include <ndn-cpp/security/identity/identity-manager.hpp>
 #include "../../src/encoding/der/der-node.hpp"
+#include "../../src/encoding/der/der-reader.hpp"
+#include "../../src/encoding/der/der-exception.hpp"
 
 using namespace std;
 using namespace ndn;
@@ -243,6 +245,52 @@ TEST_F(TestCertificate, Oid)
     "Incorrect decoded OID";
 }
 
+TEST_F(TestCertificate, DerReader)
+{
+  DerReader publicKeyInfo =
+    DerReader(PUBLIC_KEY, sizeof(PUBLIC_KEY)).readSequence();
+
+  DerReader algorithmId = publicKeyInfo.readSequence();
+  BlobLite oid = algorithmId.read(DerNodeType_ObjectIdentifier);
+  ASSERT_EQ("1.2.840.113549.1.1.1", DerReader::toOidString(oid));
+  ASSERT_TRUE(DerReader::oidEquals(oid, "1.2.840.113549.1.1.1"));
+  ASSERT_FALSE(DerReader::oidEquals(oid, "1.2.840.113549.1.1"));
+  ASSERT_FALSE(DerReader::oidEquals(oid, "1.2.840.113549.1.1.11"));
+  ASSERT_FALSE(DerReader::oidEquals(oid, "1.2.840.10045.2.1"));
+  const int oidIntegers[] = { 1, 2, 840, 113549, 1, 1, 1 };
+  ASSERT_TRUE(DerReader::oidEquals(oid, oidIntegers, 7));
+  ASSERT_FALSE(DerReader::oidEquals(oid, oidIntegers, 6));
+  ASSERT_EQ(DerNodeType_Null, algorithmId.peekType());
+  ASSERT_EQ(0, algorithmId.read(DerNodeType_Null).size());
+  ASSERT_TRUE(algorithmId.atEnd());
+
+  // The payload points into the input buffer.
+  BlobLite bitString = publicKeyInfo.read(DerNodeType_BitString);
+  ASSERT_EQ(PUBLIC_KEY + sizeof(PUBLIC_KEY) - 0x8b, bitString.buf());
+  ASSERT_EQ(0x8b, bitString.size());
+  ASSERT_TRUE(publicKeyInfo.atEnd());
+  ASSERT_THROW(publicKeyInfo.peekType(), DerDecodingException);
+
+  // Check the wrong type and a truncated input.
+  ASSERT_THROW
+    (DerReader(PUBLIC_KEY, sizeof(PUBLIC_KEY)).read(DerNodeType_Integer),
+     DerDecodingException);
+  ASSERT_THROW
+    (DerReader(PUBLIC_KEY, sizeof(PUBLIC_KEY) - 1).readSequence(),
+     DerDecodingException);
+  ASSERT_THROW
+    (DerReader(PUBLIC_KEY, 3).readEncoding(), DerDecodingException);
+
+  // The same OID string as DerOid.
+  DerNode::DerOid derOid("1.3.6.1.16383.2097152");
+  Blob oidEncoding = derOid.encode();
+  BlobLite oidPayload = DerReader(oidEncoding).read(DerNodeType_ObjectIdentifier);
+  ASSERT_EQ("1.3.6.1.16383.2097152", DerReader::toOidString(oidPayload));
+  Blob value = derOid.toVal();
+  ASSERT_EQ("1.3.6.1.16383.2097152",
+            string((const char*)value.buf(), value.size()));
+}
+
 TEST_F(TestCertificate, PrepareUnsignedCertificate)
 {
   ptr_lib::shared_ptr<MemoryIdentityStorage> identityStorage
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <unistd.h>
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+class TestFaceDataCache : public ::testing::Test, public FaceTestFixture {
+public:
+  /**
+   * Express an Interest for the Data name and receive the Data so that it is
+   * added to the cache.
+   */
+  void
+  fetch(const Data& data)
+  {
+    CallbackCounter counter;
+    Interest interest(data.getName());
+    interest.setMustBeFresh(false);
+    expressInterest(interest, counter);
+    receive(data.wireEncode());
+    ASSERT_EQ(1, counter.onDataCallCount_);
+  }
+
+};
+
+TEST_F(TestFaceDataCache, Disabled)
+{
+  ASSERT_EQ(0, face_.getDataCacheCapacity());
+
+  fetch(Data(Name("/test/cache")));
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/cache")), counter);
+  ASSERT_EQ(2, getSentPackets().size());
+}
+
+TEST_F(TestFaceDataCache, CacheHit)
+{
+  face_.setDataCacheCapacity(10);
+
+  Data data(Name("/test/cache/a"));
+  data.getMetaInfo().setFreshnessPeriod(10000);
+  fetch(data);
+  ASSERT_EQ(1, getSentPackets().size());
+
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/cache")), counter);
+  ASSERT_EQ(1, getSentPackets().size()) <<
+    "The Interest should be satisfied from the cache";
+  ASSERT_EQ(0, counter.onDataCallCount_) <<
+    "onData should be called from processEvents";
+  face_.processEvents();
+  ASSERT_EQ(1, counter.onDataCallCount_);
+  ASSERT_TRUE(counter.data_->getName().equals(data.getName()));
+
+  // Unsolicited Data is not cached.
+  receive(Data(Name("/test/unsolicited")).wireEncode());
+  expressInterest(Interest(Name("/test/unsolicited")), counter);
+  ASSERT_EQ(2, getSentPackets().size());
+}
+
+TEST_F(TestFaceDataCache, RemovePendingInterest)
+{
+  face_.setDataCacheCapacity(10);
+  fetch(Data(Name("/test/cache")));
+
+  CallbackCounter counter;
+  Interest interest(Name("/test/cache"));
+  interest.setMustBeFresh(false);
+  face_.removePendingInterest(expressInterest(interest, counter));
+  face_.processEvents();
+  ASSERT_EQ(0, counter.onDataCallCount_);
+}
+
+TEST_F(TestFaceDataCache, MustBeFresh)
+{
+  face_.setDataCacheCapacity(10);
+
+  Data data(Name("/test/cache"));
+  data.getMetaInfo().setFreshnessPeriod(50);
+  fetch(data);
+  Interest interest(Name("/test/cache"));
+  interest.setMustBeFresh(true);
+
+  CallbackCounter counter;
+  expressInterest(interest, counter);
+  face_.processEvents();
+  ASSERT_EQ(1, counter.onDataCallCount_);
+  ASSERT_EQ(1, getSentPackets().size());
+
+  usleep(100000);
+  expressInterest(interest, counter);
+  ASSERT_EQ(2, getSentPackets().size()) <<
+    "Stale Data should not satisfy an Interest with MustBeFresh";
+
+  // Stale Data still satisfies an Interest without MustBeFresh.
+  CallbackCounter staleCounter;
+  interest.setMustBeFresh(false);
+  expressInterest(interest, staleCounter);
+  face_.processEvents();
+  ASSERT_EQ(1, staleCounter.onDataCallCount_);
+  ASSERT_EQ(2, getSentPackets().size());
+}
+
+TEST_F(TestFaceDataCache, ChildSelector)
+{
+  face_.setDataCacheCapacity(10);
+  fetch(Data(Name("/test/cache/b")));
+  fetch(Data(Name("/test/cache/a")));
+  fetch(Data(Name("/test/cache/c")));
+
+  Interest interest(Name("/test/cache"));
+  interest.setMustBeFresh(false);
+  CallbackCounter leftCounter;
+  expressInterest(interest, leftCounter);
+  interest.setChildSelector(1);
+  CallbackCounter rightCounter;
+  expressInterest(interest, rightCounter);
+  face_.processEvents();
+
+  ASSERT_EQ(3, getSentPackets().size());
+  ASSERT_EQ(1, leftCounter.onDataCallCount_);
+  ASSERT_TRUE(leftCounter.data_->getName().equals(Name("/test/cache/a")));
+  ASSERT_EQ(1, rightCounter.onDataCallCount_);
+  ASSERT_TRUE(rightCounter.data_->getName().equals(Name("/test/cache/c")));
+}
+
+TEST_F(TestFaceDataCache, Capacity)
+{
+  face_.setDataCacheCapacity(2);
+  fetch(Data(Name("/test/cache/a")));
+  fetch(Data(Name("/test/cache/b")));
+
+  // Use /a so that /b is the least recently used.
+  Interest interestA(Name("/test/cache/a"));
+  interestA.setMustBeFresh(false);
+  CallbackCounter counter;
+  expressInterest(interestA, counter);
+  face_.processEvents();
+  ASSERT_EQ(1, counter.onDataCallCount_);
+
+  fetch(Data(Name("/test/cache/c")));
+  ASSERT_EQ(3, getSentPackets().size());
+
+  Interest interestB(Name("/test/cache/b"));
+  interestB.setMustBeFresh(false);
+  expressInterest(interestB, counter);
+  ASSERT_EQ(4, getSentPackets().size()) <<
+    "The least recently used Data should be removed";
+  expressInterest(interestA, counter);
+  ASSERT_EQ(4, getSentPackets().size());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,277 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+
+#include "gtest/gtest.h"
+#include <unistd.h>
+#include <ndn-cpp/interest.hpp>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/lite/face-lite.hpp>
+
+using namespace std;
+using namespace ndn;
+
+/**
+ * A TestTransportLite has the send and processEvents methods used by FaceLite
+ * and saves the sent packets.
+ */
+class TestTransportLite {
+public:
+  ndn_Error
+  send(const uint8_t* data, size_t dataLength)
+  {
+    sentPackets_.push_back(Blob(data, dataLength));
+    return NDN_ERROR_success;
+  }
+
+  ndn_Error
+  processEvents(uint8_t *buffer, size_t bufferLength)
+  {
+    return NDN_ERROR_success;
+  }
+
+  vector<Blob> sentPackets_;
+};
+
+class CallbackCounter {
+public:
+  CallbackCounter()
+  : onDataCallCount_(0), onTimeoutCallCount_(0), onNetworkNackCallCount_(0),
+    onInterestCallCount_(0), delayedCallCount_(0)
+  {
+  }
+
+  static void
+  onData
+    (FaceLite& face, const InterestLite& interest, const DataLite& data,
+     void* context)
+  {
+    ++((CallbackCounter*)context)->onDataCallCount_;
+  }
+
+  static void
+  onTimeout(FaceLite& face, const InterestLite& interest, void* context)
+  {
+    ++((CallbackCounter*)context)->onTimeoutCallCount_;
+  }
+
+  static void
+  onNetworkNack
+    (FaceLite& face, const InterestLite& interest,
+     const NetworkNackLite& networkNack, void* context)
+  {
+    CallbackCounter* counter = (CallbackCounter*)context;
+    ++counter->onNetworkNackCallCount_;
+    counter->networkNackReason_ = networkNack.getReason();
+  }
+
+  static void
+  onInterest
+    (FaceLite& face, const NameLite& prefix, const InterestLite& interest,
+     void* context)
+  {
+    ++((CallbackCounter*)context)->onInterestCallCount_;
+
+    // Reply with a Data packet with the same name.
+    ndn_NameComponent nameComponents[10];
+    DataLite data(nameComponents, 10, 0, 0);
+    data.getName().set(interest.getName());
+    data.getSignature().setType(ndn_SignatureType_DigestSha256Signature);
+    face.putData(data);
+  }
+
+  static void
+  onDelayedCall(FaceLite& face, void* context)
+  {
+    ++((CallbackCounter*)context)->delayedCallCount_;
+  }
+
+  int onDataCallCount_;
+  int onTimeoutCallCount_;
+  int onNetworkNackCallCount_;
+  int onInterestCallCount_;
+  int delayedCallCount_;
+  ndn_NetworkNackReason networkNackReason_;
+};
+
+class TestFaceLite : public ::testing::Test {
+public:
+  TestFaceLite()
+  : face_(transport_, pendingInterestTable_, 2, interestFilterTable_, 2,
+          delayedCallTable_, 2, encodingBuffer_, sizeof(encodingBuffer_)),
+    interest_(nameComponents_, 10, 0, 0, 0, 0)
+  {
+    interest_.getName().append("test");
+    interest_.getName().append("face-lite");
+  }
+
+  ndn_Error
+  expressInterest(CallbackCounter& counter, uint64_t* pendingInterestId = 0)
+  {
+    return face_.expressInterest
+      (interest_, &CallbackCounter::onData, &CallbackCounter::onTimeout,
+       &CallbackCounter::onNetworkNack, &counter, pendingInterestId);
+  }
+
+  void
+  receive(const Blob& encoding)
+  {
+    face_.onReceivedElement(encoding.buf(), encoding.size());
+  }
+
+  TestTransportLite transport_;
+  FaceLite::PendingInterest pendingInterestTable_[2];
+  FaceLite::InterestFilter interestFilterTable_[2];
+  FaceLite::DelayedCall delayedCallTable_[2];
+  uint8_t encodingBuffer_[MAX_NDN_PACKET_SIZE];
+  FaceLite face_;
+  ndn_NameComponent nameComponents_[10];
+  InterestLite interest_;
+};
+
+TEST_F(TestFaceLite, ExpressInterest)
+{
+  CallbackCounter counter;
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter));
+  ASSERT_EQ(1, transport_.sentPackets_.size());
+  Interest sentInterest;
+  sentInterest.wireDecode(transport_.sentPackets_[0]);
+  ASSERT_TRUE(sentInterest.getName().equals(Name("/test/face-lite")));
+
+  receive(Data(Name("/test/other")).wireEncode());
+  ASSERT_EQ(0, counter.onDataCallCount_);
+  receive(Data(Name("/test/face-lite/a")).wireEncode());
+  ASSERT_EQ(1, counter.onDataCallCount_);
+
+  // The entry was removed.
+  receive(Data(Name("/test/face-lite/a")).wireEncode());
+  ASSERT_EQ(1, counter.onDataCallCount_);
+}
+
+TEST_F(TestFaceLite, PendingInterestTableFull)
+{
+  CallbackCounter counter;
+  uint64_t pendingInterestId;
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter, &pendingInterestId));
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter));
+  ASSERT_EQ(NDN_ERROR_FaceLite_the_pending_interest_table_is_full,
+            expressInterest(counter));
+
+  face_.removePendingInterest(pendingInterestId);
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter));
+
+  receive(Data(Name("/test/face-lite")).wireEncode());
+  ASSERT_EQ(2, counter.onDataCallCount_);
+}
+
+TEST_F(TestFaceLite, Timeout)
+{
+  CallbackCounter counter;
+  interest_.setInterestLifetimeMilliseconds(50);
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter));
+
+  uint8_t buffer[100];
+  face_.processEvents(buffer, sizeof(buffer));
+  ASSERT_EQ(0, counter.onTimeoutCallCount_);
+
+  usleep(100000);
+  face_.processEvents(buffer, sizeof(buffer));
+  ASSERT_EQ(1, counter.onTimeoutCallCount_);
+
+  receive(Data(Name("/test/face-lite")).wireEncode());
+  ASSERT_EQ(0, counter.onDataCallCount_);
+}
+
+TEST_F(TestFaceLite, NetworkNack)
+{
+  CallbackCounter counter;
+  ASSERT_EQ(NDN_ERROR_success, expressInterest(counter));
+
+  // Make an LpPacket with a NoRoute Nack and the Interest as the fragment.
+  Blob interestEncoding = Interest(Name("/test/face-lite")).wireEncode();
+  vector<uint8_t> lpPacket;
+  const uint8_t lpPacketHeader[] = {
+    // LpPacket, Nack, NackReason = NoRoute, Fragment
+    100, (uint8_t)(11 + interestEncoding.size()),
+    0xfd, 0x03, 0x20, 5, 0xfd, 0x03, 0x21, 1, 150,
+    80, (uint8_t)interestEncoding.size()
+  };
+  lpPacket.insert
+    (lpPacket.end(), lpPacketHeader, lpPacketHeader + sizeof(lpPacketHeader));
+  lpPacket.insert
+    (lpPacket.end(), interestEncoding.buf(),
+     interestEncoding.buf() + interestEncoding.size());
+  receive(Blob(lpPacket));
+
+  ASSERT_EQ(1, counter.onNetworkNackCallCount_);
+  ASSERT_EQ(ndn_NetworkNackReason_NO_ROUTE, counter.networkNackReason_);
+  receive(Data(Name("/test/face-lite")).wireEncode());
+  ASSERT_EQ(0, counter.onDataCallCount_);
+}
+
+TEST_F(TestFaceLite, InterestFilter)
+{
+  CallbackCounter counter;
+  ndn_NameComponent prefixComponents[1];
+  NameLite prefix(prefixComponents, 1);
+  prefix.append("test");
+  uint64_t interestFilterId;
+  ASSERT_EQ(NDN_ERROR_success, face_.setInterestFilter
+    (prefix, &CallbackCounter::onInterest, &counter, &interestFilterId));
+
+  receive(Interest(Name("/other")).wireEncode());
+  ASSERT_EQ(0, counter.onInterestCallCount_);
+  receive(Interest(Name("/test/face-lite")).wireEncode());
+  ASSERT_EQ(1, counter.onInterestCallCount_);
+  ASSERT_EQ(1, transport_.sentPackets_.size());
+  Data sentData;
+  sentData.wireDecode(transport_.sentPackets_[0]);
+  ASSERT_TRUE(sentData.getName().equals(Name("/test/face-lite")));
+
+  face_.unsetInterestFilter(interestFilterId);
+  receive(Interest(Name("/test/face-lite")).wireEncode());
+  ASSERT_EQ(1, counter.onInterestCallCount_);
+}
+
+TEST_F(TestFaceLite, CallLater)
+{
+  CallbackCounter counter;
+  ASSERT_EQ(NDN_ERROR_success, face_.callLater
+    (50, &CallbackCounter::onDelayedCall, &counter));
+  ASSERT_EQ(NDN_ERROR_success, face_.callLater
+    (0, &CallbackCounter::onDelayedCall, &counter));
+  ASSERT_EQ(NDN_ERROR_FaceLite_the_delayed_call_table_is_full, face_.callLater
+    (0, &CallbackCounter::onDelayedCall, &counter));
+
+  uint8_t buffer[100];
+  face_.processEvents(buffer, sizeof(buffer));
+  ASSERT_EQ(1, counter.delayedCallCount_);
+  usleep(100000);
+  face_.processEvents(buffer, sizeof(buffer));
+  ASSERT_EQ(2, counter.delayedCallCount_);
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
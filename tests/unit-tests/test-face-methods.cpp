@@ -32,6 +32,8 @@
 #include <ndn-cpp/security/identity/memory-private-key-storage.hpp>
 #include <ndn-cpp/security/policy/no-verify-policy-manager.hpp>
 #include <ndn-cpp/security/key-chain.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
 
 using namespace std;
 using namespace ndn;
@@ -260,7 +262,12 @@ static const uint8_t DEFAULT_RSA_PRIVATE_KEY_DER[] = {
 class TestFaceRegisterMethods : public ::testing::Test {
 public:
   TestFaceRegisterMethods()
-  : identityStorage(new MemoryIdentityStorage()),
+  : forwarder(new LoopbackForwarder()),
+    faceIn(ptr_lib::make_shared<LoopbackTransport>(),
+           ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>(forwarder)),
+    faceOut(ptr_lib::make_shared<LoopbackTransport>(),
+            ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>(forwarder)),
+    identityStorage(new MemoryIdentityStorage()),
     privateKeyStorage(new MemoryPrivateKeyStorage()),
     keyChain(ptr_lib::make_shared<IdentityManager>(identityStorage, privateKeyStorage),
              ptr_lib::make_shared<NoVerifyPolicyManager>())
@@ -288,6 +295,8 @@ public:
     faceOut.shutdown();
   }
 
+  // Use an in-process forwarder so that the test doesn't need NFD.
+  ptr_lib::shared_ptr<LoopbackForwarder> forwarder;
   Face faceIn;
   Face faceOut;
   ptr_lib::shared_ptr<MemoryIdentityStorage> identityStorage;
@@ -365,7 +374,9 @@ TEST_F(TestFaceRegisterMethods, RegisterPrefixResponse)
 class TestFaceInterestMethods : public ::testing::Test {
 public:
   TestFaceInterestMethods()
-  : face("localhost")
+  : forwarder(new LoopbackForwarder()),
+    face(ptr_lib::make_shared<LoopbackTransport>(),
+         ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>(forwarder))
   {
   }
 
@@ -375,6 +386,7 @@ public:
     face.shutdown();
   }
 
+  ptr_lib::shared_ptr<LoopbackForwarder> forwarder;
   Face face;
 };
 
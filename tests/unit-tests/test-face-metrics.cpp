@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+class TestFaceMetrics : public ::testing::Test, public FaceTestFixture {
+};
+
+static void
+onDataThrow
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<Data>& data)
+{
+  throw runtime_error("Error in the application callback");
+}
+
+TEST_F(TestFaceMetrics, Disabled)
+{
+  ASSERT_FALSE(face_.getMetricsEnabled());
+
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/metrics")), counter);
+  receive(Data(Name("/test/metrics")).wireEncode());
+  ASSERT_EQ(1, counter.onDataCallCount_);
+
+  FaceMetrics metrics = face_.getMetrics();
+  ASSERT_EQ(0, metrics.getOutInterests());
+  ASSERT_EQ(0, metrics.getInData());
+  ASSERT_EQ(0, metrics.getInBytes());
+  ASSERT_EQ(0, metrics.getRttCount());
+}
+
+TEST_F(TestFaceMetrics, Counters)
+{
+  face_.setMetricsEnabled(true);
+
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/metrics/1")), counter);
+  expressInterest(Interest(Name("/test/metrics/2")), counter);
+  ASSERT_EQ(2, getSentPackets().size());
+
+  FaceMetrics metrics = face_.getMetrics();
+  ASSERT_EQ(2, metrics.getOutInterests());
+  ASSERT_EQ(getSentPackets()[0].size() +
+            getSentPackets()[1].size(), metrics.getOutBytes());
+  ASSERT_EQ(2, metrics.getPendingInterestCount());
+
+  Blob dataEncoding = Data(Name("/test/metrics/1")).wireEncode();
+  receive(dataEncoding);
+  ASSERT_EQ(1, counter.onDataCallCount_);
+  // There is no pending Interest for this Data.
+  receive(Data(Name("/test/other")).wireEncode());
+  receive(Interest(Name("/test/incoming")).wireEncode());
+
+  face_.putData(Data(Name("/test/incoming")));
+
+  metrics = face_.getMetrics();
+  ASSERT_EQ(2, metrics.getInData());
+  ASSERT_EQ(1, metrics.getInUnsolicitedData());
+  ASSERT_EQ(1, metrics.getInInterests());
+  ASSERT_EQ(1, metrics.getOutData());
+  ASSERT_EQ(1, metrics.getPendingInterestCount());
+  ASSERT_EQ(1, metrics.getRttCount());
+  ASSERT_TRUE(metrics.getRttMax() >= 0);
+  ASSERT_TRUE(metrics.getRttPercentile(99) >= metrics.getRttMean());
+
+  uint64_t bucketTotal = 0;
+  for (size_t i = 0; i < FaceMetrics::N_RTT_BUCKETS; ++i)
+    bucketTotal += metrics.getRttBucketCount(i);
+  ASSERT_EQ(metrics.getRttCount(), bucketTotal);
+
+  ASSERT_TRUE(metrics.toString().find("rtt_count 1\n") != string::npos);
+
+  face_.resetMetrics();
+  metrics = face_.getMetrics();
+  ASSERT_EQ(0, metrics.getInData());
+  ASSERT_EQ(0, metrics.getRttCount());
+  // Reset doesn't change the pending Interest count.
+  ASSERT_EQ(1, metrics.getPendingInterestCount());
+}
+
+TEST_F(TestFaceMetrics, DecodeError)
+{
+  face_.setMetricsEnabled(true);
+  // Make the transport connect.
+  face_.expressInterest(Name("/test/metrics"), OnData());
+
+  // An Interest (type 5) whose length is longer than the element.
+  uint8_t badInterest[] = { 0x05, 10, 0x07, 0 };
+  ASSERT_THROW
+    (receive(Blob(badInterest, sizeof(badInterest))), runtime_error);
+
+  FaceMetrics metrics = face_.getMetrics();
+  ASSERT_EQ(1, metrics.getDecodeErrors());
+  ASSERT_EQ(sizeof(badInterest), metrics.getInBytes());
+
+  // An LpPacket (type 100) whose length is longer than the element.
+  uint8_t badLpPacket[] = { 0x64, 10, 0x50, 0 };
+  ASSERT_THROW
+    (receive(Blob(badLpPacket, sizeof(badLpPacket))), runtime_error);
+  ASSERT_EQ(2, face_.getMetrics().getDecodeErrors());
+}
+
+TEST_F(TestFaceMetrics, CallbackErrorIsNotDecodeError)
+{
+  face_.setMetricsEnabled(true);
+
+  face_.expressInterest(Name("/test/metrics"), bind(&onDataThrow, _1, _2));
+  // The Node logs the exception from the application callback.
+  ASSERT_NO_THROW(receive(Data(Name("/test/metrics")).wireEncode()));
+
+  FaceMetrics metrics = face_.getMetrics();
+  ASSERT_EQ(1, metrics.getInData());
+  ASSERT_EQ(0, metrics.getDecodeErrors());
+  ASSERT_EQ(1, metrics.getRttCount());
+}
+
+TEST_F(TestFaceMetrics, LazyDecodeError)
+{
+  face_.setMetricsEnabled(true);
+  face_.setLazyDecoding(true);
+
+  // A Data packet with a good outline but a bad ContentType in the MetaInfo.
+  uint8_t badData[] = {
+    0x06, 0x1A, // Data
+      0x07, 0x0C, 0x08, 0x04, 0x74, 0x65, 0x73, 0x74,
+                  0x08, 0x04, 0x6C, 0x61, 0x7A, 0x79, // Name=/test/lazy
+      0x14, 0x03, // MetaInfo
+        0x18, 0x05, 0x00, // ContentType with a bad length
+      0x16, 0x03, 0x1B, 0x01, 0x00, // SignatureInfo
+      0x17, 0x00 // SignatureValue
+  };
+
+  // Express an Interest for another name to connect the transport.
+  CallbackCounter otherCounter;
+  expressInterest(Interest(Name("/test/other")), otherCounter);
+
+  // A lazy decode rejects a malformed packet the same as a full decode, even
+  // if it doesn't match a pending Interest.
+  ASSERT_THROW
+    (receive(Blob(badData, sizeof(badData))), runtime_error);
+  ASSERT_EQ(1, face_.getMetrics().getDecodeErrors());
+
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/lazy")), counter);
+  ASSERT_THROW
+    (receive(Blob(badData, sizeof(badData))), runtime_error);
+  ASSERT_EQ(0, counter.onDataCallCount_);
+  ASSERT_EQ(2, face_.getMetrics().getDecodeErrors());
+}
+
+TEST_F(TestFaceMetrics, BucketUpperBound)
+{
+  ASSERT_EQ(1.0, FaceMetrics::getRttBucketUpperBound(0));
+  ASSERT_EQ(10000.0, FaceMetrics::getRttBucketUpperBound
+            (FaceMetrics::N_RTT_BUCKETS - 2));
+  ASSERT_EQ(-1.0, FaceMetrics::getRttBucketUpperBound
+            (FaceMetrics::N_RTT_BUCKETS - 1));
+  ASSERT_EQ(0, FaceMetrics().getRttPercentile(50));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,458 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/ndn-cpp-config.h>
+
+#if NDN_CPP_HAVE_PROTOBUF
+
+#include <fstream>
+#include <stdexcept>
+#include <unistd.h>
+#include <ndn-cpp-tools/usersync/generalized-content.hpp>
+#include <ndn-cpp-tools/usersync/generalized-content-publisher.hpp>
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+using namespace ndntools;
+
+static bool
+fileExists(const string& filePath)
+{
+  ifstream stream(filePath.c_str());
+  bool result = (bool)stream;
+  stream.close();
+  return result;
+}
+
+static string
+getPolicyConfigDirectory()
+{
+  string policyConfigDirectory = "policy_config";
+  // Check if expected files are in this directory.
+  if (!fileExists(policyConfigDirectory + "/regex_ruleset.conf")) {
+    // Maybe we are running "make check" from the ndn-cpp root.  There may be
+    //   a way to tell "make check" to run from tests/unit-tests, but for
+    //   now just set policyConfigDirectory explicitly.
+    policyConfigDirectory = "tests/unit-tests/policy_config";
+
+    if(!fileExists(policyConfigDirectory + "/regex_ruleset.conf"))
+      throw runtime_error("Cannot find the directory for policy-config");
+  }
+
+  return policyConfigDirectory;
+}
+
+class TestGeneralizedContentPublisher : public ::testing::Test {
+public:
+  TestGeneralizedContentPublisher()
+  : prefix("/test/content")
+  {
+    metaInfo.setContentType("text/plain").setTimestamp(1000.0)
+      .setHasSegments(true);
+    for (size_t i = 0; i < 25; ++i)
+      content.push_back((uint8_t)i);
+
+    filePath = getPolicyConfigDirectory() + "/test-content.bin";
+    ofstream stream(filePath.c_str(), ios::binary);
+    stream.write((const char*)&content[0], content.size());
+  }
+
+  virtual void
+  TearDown()
+  {
+    remove(filePath.c_str());
+  }
+
+  Name prefix;
+  ContentMetaInfo metaInfo;
+  vector<uint8_t> content;
+  string filePath;
+};
+
+TEST_F(TestGeneralizedContentPublisher, Segments)
+{
+  GeneralizedContentPublisher publisher
+    (prefix, 1000.0, 0, Name(), metaInfo, filePath, 10);
+
+  ASSERT_EQ(3, publisher.getSegmentCount());
+
+  ContentMetaInfo decodedMetaInfo;
+  decodedMetaInfo.wireDecode(publisher.getMetaData()->getContent());
+  ASSERT_EQ(Name(prefix).append("_meta"), publisher.getMetaData()->getName());
+  ASSERT_EQ(string("text/plain"), decodedMetaInfo.getContentType());
+  ASSERT_EQ(content.size(), decodedMetaInfo.getContentSize());
+
+  for (uint64_t i = 0; i < 3; ++i) {
+    ptr_lib::shared_ptr<Data> segment = publisher.getSegment(i);
+    ASSERT_TRUE(!!segment);
+    ASSERT_EQ(Name(prefix).appendSegment(i), segment->getName());
+    ASSERT_EQ(2, segment->getMetaInfo().getFinalBlockId().toSegment());
+
+    size_t length = (i < 2 ? 10 : 5);
+    ASSERT_TRUE(segment->getContent().equals
+      (Blob(&content[(size_t)i * 10], length)));
+  }
+
+  ASSERT_TRUE(!publisher.getSegment(3));
+}
+
+TEST_F(TestGeneralizedContentPublisher, GetData)
+{
+  GeneralizedContentPublisher publisher
+    (prefix, 1000.0, 0, Name(), metaInfo, filePath, 10);
+
+  ASSERT_EQ(publisher.getMetaData().get(),
+            publisher.getData(Interest(Name(prefix).append("_meta"))).get());
+  ASSERT_EQ(Name(prefix).appendSegment(1),
+            publisher.getData(Interest(Name(prefix).appendSegment(1)))->getName());
+
+  // An Interest for the prefix gets the first or the final segment.
+  Interest interest(prefix);
+  ASSERT_EQ(Name(prefix).appendSegment(0),
+            publisher.getData(interest)->getName());
+  interest.setChildSelector(1);
+  ASSERT_EQ(Name(prefix).appendSegment(2),
+            publisher.getData(interest)->getName());
+
+  ASSERT_TRUE(!publisher.getData(Interest(Name("/test/other"))));
+  ASSERT_TRUE(!publisher.getData(Interest(Name(prefix).append("other"))));
+  ASSERT_TRUE(!publisher.getData
+    (Interest(Name(prefix).appendSegment(0).append("other"))));
+}
+
+TEST_F(TestGeneralizedContentPublisher, SegmentCache)
+{
+  GeneralizedContentPublisher publisher
+    (prefix, 1000.0, 0, Name(), metaInfo, filePath, 10, 2);
+
+  ptr_lib::shared_ptr<Data> segment0 = publisher.getSegment(0);
+  ASSERT_EQ(segment0.get(), publisher.getSegment(0).get());
+  publisher.getSegment(1);
+  ASSERT_EQ(2, publisher.getCachedSegmentCount());
+
+  // Segment 0 is the most recently used, so adding segment 2 evicts segment 1.
+  publisher.getSegment(0);
+  publisher.getSegment(2);
+  ASSERT_EQ(2, publisher.getCachedSegmentCount());
+  ASSERT_EQ(segment0.get(), publisher.getSegment(0).get());
+}
+
+TEST_F(TestGeneralizedContentPublisher, TruncatedFile)
+{
+  GeneralizedContentPublisher publisher
+    (prefix, 1000.0, 0, Name(), metaInfo, filePath, 10);
+
+  ASSERT_EQ(0, ::truncate(filePath.c_str(), 20));
+
+  // The segments which are still in the file can be read.
+  ASSERT_TRUE(publisher.getSegment(1)->getContent().equals
+    (Blob(&content[10], 10)));
+  // The final segment is past the end of the file.
+  ASSERT_THROW(publisher.getSegment(2), runtime_error);
+  ASSERT_EQ(1, publisher.getCachedSegmentCount());
+}
+
+TEST_F(TestGeneralizedContentPublisher, NoSegments)
+{
+  metaInfo.setHasSegments(false);
+  GeneralizedContentPublisher publisher
+    (prefix, 1000.0, 0, Name(), metaInfo, "no-such-file", 10);
+
+  ASSERT_EQ(0, publisher.getSegmentCount());
+  ASSERT_TRUE(!publisher.getData(Interest(prefix)));
+  ASSERT_THROW
+    (GeneralizedContentPublisher
+     (prefix, 1000.0, 0, Name(), metaInfo, filePath, 0), runtime_error);
+}
+
+TEST_F(TestGeneralizedContentPublisher, MissingFile)
+{
+  ASSERT_THROW
+    (GeneralizedContentPublisher
+     (prefix, 1000.0, 0, Name(), metaInfo, "no-such-file", 10), runtime_error);
+}
+
+/**
+ * A FetchResult keeps the arguments of the GeneralizedContent callbacks.
+ */
+class FetchResult {
+public:
+  FetchResult()
+  : onCompleteCallCount_(0), onErrorCallCount_(0),
+    errorCode_((GeneralizedContent::ErrorCode)0)
+  {
+  }
+
+  void
+  onComplete
+    (const ptr_lib::shared_ptr<ContentMetaInfo>& metaInfo, const Blob& content)
+  {
+    ++onCompleteCallCount_;
+    content_ = content;
+  }
+
+  void
+  onError(GeneralizedContent::ErrorCode errorCode, const string& message)
+  {
+    ++onErrorCallCount_;
+    errorCode_ = errorCode;
+  }
+
+  int onCompleteCallCount_;
+  int onErrorCallCount_;
+  GeneralizedContent::ErrorCode errorCode_;
+  Blob content_;
+};
+
+class TestGeneralizedContentFetch : public ::testing::Test,
+                                    public FaceTestFixture {
+public:
+  TestGeneralizedContentFetch()
+  : prefix("/test/content")
+  {
+    for (size_t i = 0; i < 25; ++i)
+      content.push_back((uint8_t)i);
+  }
+
+  /**
+   * Call fetchParallel for the prefix with the callbacks of result.
+   */
+  void
+  fetchParallel
+    (Milliseconds interestLifetime, size_t maxOutstandingInterests)
+  {
+    GeneralizedContent::fetchParallel
+      (face_, prefix, 0, bind(&FetchResult::onComplete, &result, _1, _2),
+       bind(&FetchResult::onError, &result, _1, _2), interestLifetime,
+       maxOutstandingInterests);
+  }
+
+  /**
+   * Receive the _meta packet with the contentSize.
+   */
+  void
+  receiveMetaInfo(uint64_t contentSize)
+  {
+    ContentMetaInfo metaInfo;
+    metaInfo.setContentType("text/plain").setTimestamp(1000.0)
+      .setHasSegments(true).setContentSize(contentSize);
+    Data data(Name(prefix).append("_meta"));
+    data.setContent(metaInfo.wireEncode());
+    receive(data.wireEncode());
+  }
+
+  /**
+   * Receive the segment of content with 10 bytes per segment.
+   * @param segmentNumber The segment number.
+   * @param finalSegmentNumber The FinalBlockId segment number, or -1 for none.
+   */
+  void
+  receiveSegment(uint64_t segmentNumber, int finalSegmentNumber = 2)
+  {
+    size_t offset = (size_t)segmentNumber * 10;
+    size_t length = min((size_t)10, content.size() - offset);
+    Data data(Name(prefix).appendSegment(segmentNumber));
+    if (finalSegmentNumber >= 0)
+      data.getMetaInfo().setFinalBlockId
+        (Name::Component::fromSegment(finalSegmentNumber));
+    data.setContent(Blob(&content[offset], length));
+    receive(data.wireEncode());
+  }
+
+  /**
+   * Get the name of the sent Interest.
+   * @param i The index in getSentPackets().
+   * @return The Interest name.
+   */
+  Name
+  getSentName(size_t i)
+  {
+    Interest interest;
+    interest.wireDecode(getSentPackets()[i]);
+    return interest.getName();
+  }
+
+  /**
+   * Call face_.processEvents until result has a callback or maxMilliseconds
+   * has passed.
+   */
+  void
+  processEventsUntilResult(int maxMilliseconds)
+  {
+    for (int i = 0; i < maxMilliseconds &&
+         result.onCompleteCallCount_ == 0 && result.onErrorCallCount_ == 0;
+         ++i) {
+      usleep(1000);
+      face_.processEvents();
+    }
+  }
+
+  Name prefix;
+  vector<uint8_t> content;
+  FetchResult result;
+};
+
+TEST_F(TestGeneralizedContentFetch, InOrder)
+{
+  fetchParallel(4000.0, 2);
+  ASSERT_EQ(1, getSentPackets().size());
+  ASSERT_EQ(Name(prefix).append("_meta"), getSentName(0));
+  receiveMetaInfo(content.size());
+
+  // Only segment 0 is fetched until it gives the segment size.
+  ASSERT_EQ(2, getSentPackets().size());
+  ASSERT_EQ(Name(prefix).appendSegment(0), getSentName(1));
+  receiveSegment(0);
+
+  ASSERT_EQ(4, getSentPackets().size());
+  ASSERT_EQ(Name(prefix).appendSegment(1), getSentName(2));
+  ASSERT_EQ(Name(prefix).appendSegment(2), getSentName(3));
+  receiveSegment(1);
+  ASSERT_EQ(0, result.onCompleteCallCount_);
+  receiveSegment(2);
+
+  ASSERT_EQ(1, result.onCompleteCallCount_);
+  ASSERT_EQ(0, result.onErrorCallCount_);
+  ASSERT_TRUE(result.content_.equals(Blob(content)));
+}
+
+TEST_F(TestGeneralizedContentFetch, OutOfOrder)
+{
+  fetchParallel(4000.0, 2);
+  receiveMetaInfo(content.size());
+  receiveSegment(0);
+
+  receiveSegment(2);
+  ASSERT_EQ(0, result.onCompleteCallCount_);
+  receiveSegment(1);
+
+  ASSERT_EQ(1, result.onCompleteCallCount_);
+  ASSERT_EQ(0, result.onErrorCallCount_);
+  ASSERT_TRUE(result.content_.equals(Blob(content)));
+}
+
+TEST_F(TestGeneralizedContentFetch, RetryAfterTimeout)
+{
+  fetchParallel(10.0, 1);
+  receiveMetaInfo(content.size());
+  receiveSegment(0);
+  ASSERT_EQ(3, getSentPackets().size());
+
+  // Wait for segment 1 to time out and be expressed again.
+  for (int i = 0; i < 2000 && getSentPackets().size() < 4; ++i) {
+    usleep(1000);
+    face_.processEvents();
+  }
+  ASSERT_EQ(4, getSentPackets().size());
+  ASSERT_EQ(Name(prefix).appendSegment(1), getSentName(3));
+
+  receiveSegment(1);
+  receiveSegment(2);
+  ASSERT_EQ(1, result.onCompleteCallCount_);
+  ASSERT_EQ(0, result.onErrorCallCount_);
+  ASSERT_TRUE(result.content_.equals(Blob(content)));
+}
+
+TEST_F(TestGeneralizedContentFetch, Timeout)
+{
+  fetchParallel(10.0, 1);
+  receiveMetaInfo(content.size());
+  receiveSegment(0);
+
+  processEventsUntilResult(2000);
+  ASSERT_EQ(1, result.onErrorCallCount_);
+  ASSERT_EQ(GeneralizedContent::INTEREST_TIMEOUT, result.errorCode_);
+  // The _meta, segment 0 and each try for segment 1.
+  ASSERT_EQ(3 + GeneralizedContent::MAX_SEGMENT_RETRIES,
+            getSentPackets().size());
+}
+
+TEST_F(TestGeneralizedContentFetch, NetworkNack)
+{
+  face_.setMetricsEnabled(true);
+  fetchParallel(4000.0, 2);
+  receiveMetaInfo(content.size());
+  receiveSegment(0);
+  ASSERT_EQ(4, getSentPackets().size());
+
+  receive(makeNack
+    (getSentPackets()[2], ndn_NetworkNackReason_NO_ROUTE));
+  ASSERT_EQ(1, result.onErrorCallCount_);
+  ASSERT_EQ(GeneralizedContent::NETWORK_NACK, result.errorCode_);
+
+  // The abort removed the Interest for segment 2.
+  receiveSegment(2);
+  ASSERT_EQ(1, face_.getMetrics().getInUnsolicitedData());
+  ASSERT_EQ(0, result.onCompleteCallCount_);
+}
+
+TEST_F(TestGeneralizedContentFetch, SizeMismatch)
+{
+  // The FinalBlockId doesn't agree with the ContentSize.
+  fetchParallel(4000.0, 2);
+  receiveMetaInfo(content.size());
+  receiveSegment(0, 5);
+  ASSERT_EQ(1, result.onErrorCallCount_);
+  ASSERT_EQ(GeneralizedContent::CONTENT_SIZE_MISMATCH, result.errorCode_);
+  ASSERT_EQ(2, getSentPackets().size());
+}
+
+TEST_F(TestGeneralizedContentFetch, SizeNotConfirmed)
+{
+  // A huge ContentSize is not allocated without a FinalBlockId to confirm it.
+  fetchParallel(4000.0, 2);
+  receiveMetaInfo(1000000000000ULL);
+  receiveSegment(0, -1);
+  ASSERT_EQ(1, result.onErrorCallCount_);
+  ASSERT_EQ(GeneralizedContent::CONTENT_SIZE_MISMATCH, result.errorCode_);
+}
+
+TEST_F(TestGeneralizedContentFetch, SegmentSizeMismatch)
+{
+  fetchParallel(4000.0, 2);
+  // The ContentSize is one byte more than the segments hold.
+  receiveMetaInfo(content.size() + 1);
+  receiveSegment(0);
+  receiveSegment(1);
+  ASSERT_EQ(0, result.onErrorCallCount_);
+  receiveSegment(2);
+  ASSERT_EQ(1, result.onErrorCallCount_);
+  ASSERT_EQ(GeneralizedContent::CONTENT_SIZE_MISMATCH, result.errorCode_);
+  ASSERT_EQ(0, result.onCompleteCallCount_);
+}
+
+#else // NDN_CPP_HAVE_PROTOBUF
+
+TEST(TestGeneralizedContent, NoProtobuf)
+{
+}
+
+#endif // NDN_CPP_HAVE_PROTOBUF
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -115,9 +115,10 @@ public:
     remove(databaseFilePath.c_str());
 
     identityStorage.reset(new BasicIdentityStorage(databaseFilePath));
+    privateKeyStorage = ptr_lib::make_shared<FilePrivateKeyStorage>
+      (getPolicyConfigDirectory() + "/test-private-keys");
     identityManager.reset(new IdentityManager
-      (identityStorage, ptr_lib::make_shared<FilePrivateKeyStorage>
-       (getPolicyConfigDirectory() + "/test-private-keys")));
+      (identityStorage, privateKeyStorage));
     policyManager.reset(new SelfVerifyPolicyManager(identityStorage.get()));
     keyChain.reset(new KeyChain(identityManager, policyManager));
   }
@@ -130,6 +131,7 @@ public:
 
   string databaseFilePath;
   ptr_lib::shared_ptr<IdentityStorage> identityStorage;
+  ptr_lib::shared_ptr<FilePrivateKeyStorage> privateKeyStorage;
   ptr_lib::shared_ptr<IdentityManager> identityManager;
   ptr_lib::shared_ptr<PolicyManager> policyManager;
   ptr_lib::shared_ptr<KeyChain> keyChain;
@@ -341,6 +343,81 @@ TEST_F(TestSqlIdentityStorage, EcdsaIdentity)
   ASSERT_FALSE(identityStorage->doesKeyExist(keyName));
 }
 
+TEST_F(TestSqlIdentityStorage, SignWithCachedKey)
+{
+  Name identityName = Name("/TestSqlIdentityStorage/CachedKey").appendVersion
+    ((uint64_t)getNowSeconds());
+  privateKeyStorage->setPrivateKeyCacheEnabled(true);
+  identityManager->setSignatureCacheEnabled(true);
+  Name certificateName = keyChain->createIdentityAndCertificate(identityName);
+  size_t cacheSize = privateKeyStorage->getPrivateKeyCacheSize();
+
+  // The second sign uses the cached signature prototype and private key.
+  for (int i = 0; i < 2; ++i) {
+    ptr_lib::shared_ptr<Data> data(new Data(Name("/test/data").appendSegment(i)));
+    keyChain->sign(*data, certificateName);
+    ASSERT_EQ(certificateName.getPrefix(-1),
+              KeyLocator::getFromSignature(data->getSignature()).getKeyName());
+
+    VerifyCounter counter;
+    keyChain->verifyData
+      (data, bind(&VerifyCounter::onVerified, &counter, _1),
+       (const OnDataValidationFailed)bind
+         (&VerifyCounter::onValidationFailed, &counter, _1, _2));
+    ASSERT_EQ(counter.onVerifiedCallCount_, 1) << "Verification callback was not used.";
+    // Generating the key pair already added it to the cache.
+    ASSERT_EQ(cacheSize, privateKeyStorage->getPrivateKeyCacheSize());
+  }
+
+  // Deleting the identity should remove the cached private key.
+  keyChain->deleteIdentity(identityName);
+  ASSERT_EQ(cacheSize - 1, privateKeyStorage->getPrivateKeyCacheSize());
+  Data data(Name("/test/data"));
+  ASSERT_THROW(keyChain->sign(data, certificateName), SecurityException);
+  ASSERT_EQ(cacheSize - 1, privateKeyStorage->getPrivateKeyCacheSize());
+}
+
+TEST_F(TestSqlIdentityStorage, SignWithKeyDeletedFromDisk)
+{
+  Name identityName = Name("/TestSqlIdentityStorage/DeletedKey").appendVersion
+    ((uint64_t)getNowSeconds());
+  Name certificateName = keyChain->createIdentityAndCertificate(identityName);
+  Name keyName = IdentityCertificate::certificateNameToPublicKeyName
+    (certificateName);
+  privateKeyStorage->setPrivateKeyCacheEnabled(true);
+  identityManager->setSignatureCacheEnabled(true);
+  Data data(Name("/test/data"));
+  keyChain->sign(data, certificateName);
+  size_t cacheSize = privateKeyStorage->getPrivateKeyCacheSize();
+
+  // Delete the key pair from the storage of another FilePrivateKeyStorage, as
+  // if from another process, so that the cache of privateKeyStorage is stale.
+  FilePrivateKeyStorage(getPolicyConfigDirectory() + "/test-private-keys")
+    .deleteKeyPair(keyName);
+  ASSERT_FALSE(privateKeyStorage->doesKeyExist(keyName, KEY_CLASS_PRIVATE));
+
+  ASSERT_THROW(keyChain->sign(data, certificateName), SecurityException);
+  // The failed sign should evict the stale key.
+  ASSERT_EQ(cacheSize - 1, privateKeyStorage->getPrivateKeyCacheSize());
+
+  keyChain->deleteIdentity(identityName);
+}
+
+TEST_F(TestSqlIdentityStorage, SignWithCacheDisabled)
+{
+  Name identityName = Name("/TestSqlIdentityStorage/NoCache").appendVersion
+    ((uint64_t)getNowSeconds());
+  Name certificateName = keyChain->createIdentityAndCertificate(identityName);
+  ASSERT_FALSE(privateKeyStorage->getPrivateKeyCacheEnabled());
+  ASSERT_FALSE(identityManager->getSignatureCacheEnabled());
+
+  Data data(Name("/test/data"));
+  keyChain->sign(data, certificateName);
+  ASSERT_EQ(0, privateKeyStorage->getPrivateKeyCacheSize());
+
+  keyChain->deleteIdentity(identityName);
+}
+
 int
 main(int argc, char **argv)
 {
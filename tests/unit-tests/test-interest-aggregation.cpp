@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <unistd.h>
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+class TestInterestAggregation : public ::testing::Test, public FaceTestFixture {
+};
+
+TEST_F(TestInterestAggregation, Disabled)
+{
+  ASSERT_FALSE(face_.getInterestAggregation());
+
+  CallbackCounter counter;
+  expressInterest(Interest(Name("/test/aggregation")), counter);
+  expressInterest(Interest(Name("/test/aggregation")), counter);
+  ASSERT_EQ(2, getSentPackets().size());
+
+  receive(Data(Name("/test/aggregation")).wireEncode());
+  ASSERT_EQ(2, counter.onDataCallCount_);
+}
+
+TEST_F(TestInterestAggregation, Aggregate)
+{
+  face_.setInterestAggregation(true);
+
+  CallbackCounter counter1;
+  CallbackCounter counter2;
+  CallbackCounter otherCounter;
+  expressInterest(Interest(Name("/test/aggregation")), counter1);
+  expressInterest(Interest(Name("/test/aggregation")), counter2);
+  ASSERT_EQ(1, getSentPackets().size()) <<
+    "An equivalent Interest should not be sent again";
+
+  // Interests with a different name or selectors are sent.
+  expressInterest(Interest(Name("/test/aggregation/other")), otherCounter);
+  Interest selectorInterest(Name("/test/aggregation"));
+  selectorInterest.setMustBeFresh(!selectorInterest.getMustBeFresh());
+  expressInterest(selectorInterest, otherCounter);
+  ASSERT_EQ(3, getSentPackets().size());
+
+  // The Data satisfies the sent Interests and the aggregated Interest.
+  receive(Data(Name("/test/aggregation")).wireEncode());
+  ASSERT_EQ(1, counter1.onDataCallCount_);
+  ASSERT_EQ(1, counter2.onDataCallCount_);
+  ASSERT_EQ(1, otherCounter.onDataCallCount_);
+
+  // The pending Interests were removed, so a new Interest is sent.
+  expressInterest(Interest(Name("/test/aggregation")), counter1);
+  ASSERT_EQ(4, getSentPackets().size());
+}
+
+TEST_F(TestInterestAggregation, SendAggregatedAfterTimeout)
+{
+  face_.setInterestAggregation(true);
+
+  CallbackCounter counter1;
+  CallbackCounter counter2;
+  Interest interest1(Name("/test/aggregation"));
+  interest1.setInterestLifetimeMilliseconds(50);
+  Interest interest2(Name("/test/aggregation"));
+  interest2.setInterestLifetimeMilliseconds(2000);
+  expressInterest(interest1, counter1);
+  expressInterest(interest2, counter2);
+  ASSERT_EQ(1, getSentPackets().size());
+
+  usleep(100000);
+  face_.processEvents();
+  ASSERT_EQ(1, counter1.onTimeoutCallCount_);
+  ASSERT_EQ(0, counter2.onTimeoutCallCount_);
+  ASSERT_EQ(2, getSentPackets().size()) <<
+    "The aggregated Interest should be sent when the first times out";
+
+  Interest sentInterest;
+  sentInterest.wireDecode(getSentPackets()[1]);
+  ASSERT_EQ(2000, sentInterest.getInterestLifetimeMilliseconds());
+
+  receive(Data(Name("/test/aggregation")).wireEncode());
+  ASSERT_EQ(0, counter1.onDataCallCount_);
+  ASSERT_EQ(1, counter2.onDataCallCount_);
+}
+
+TEST_F(TestInterestAggregation, SendAggregatedAfterRemove)
+{
+  face_.setInterestAggregation(true);
+
+  CallbackCounter counter1;
+  CallbackCounter counter2;
+  uint64_t pendingInterestId1 =
+    expressInterest(Interest(Name("/test/aggregation")), counter1);
+  expressInterest(Interest(Name("/test/aggregation")), counter2);
+  ASSERT_EQ(1, getSentPackets().size());
+
+  face_.removePendingInterest(pendingInterestId1);
+  ASSERT_EQ(2, getSentPackets().size()) <<
+    "The aggregated Interest should be sent when the sent one is removed";
+
+  receive(Data(Name("/test/aggregation")).wireEncode());
+  ASSERT_EQ(0, counter1.onDataCallCount_);
+  ASSERT_EQ(1, counter2.onDataCallCount_);
+}
+
+TEST_F(TestInterestAggregation, AggregateExclude)
+{
+  face_.setInterestAggregation(true);
+
+  CallbackCounter counter;
+  Interest interest1(Name("/test/aggregation"));
+  interest1.getExclude().appendAny().appendComponent(Name::Component("a"));
+  Interest interest2(Name("/test/aggregation"));
+  interest2.getExclude().appendAny().appendComponent(Name::Component("a"));
+  Interest interest3(Name("/test/aggregation"));
+  interest3.getExclude().appendAny().appendComponent(Name::Component("b"));
+  expressInterest(interest1, counter);
+  expressInterest(interest2, counter);
+  ASSERT_EQ(1, getSentPackets().size()) <<
+    "An Interest with an equal Exclude should be aggregated";
+  expressInterest(interest3, counter);
+  ASSERT_EQ(2, getSentPackets().size()) <<
+    "An Interest with a different Exclude should be sent";
+}
+
+TEST_F(TestInterestAggregation, NackAggregated)
+{
+  face_.setInterestAggregation(true);
+
+  CallbackCounter counter1;
+  CallbackCounter counter2;
+  CallbackCounter otherCounter;
+  expressInterest(Interest(Name("/test/aggregation")), counter1);
+  expressInterest(Interest(Name("/test/aggregation")), counter2);
+  expressInterest(Interest(Name("/test/aggregation/other")), otherCounter);
+  ASSERT_EQ(2, getSentPackets().size());
+
+  // The Nack for the sent Interest is also passed to the aggregated Interest.
+  receive(makeNack(getSentPackets()[0], 150));
+  ASSERT_EQ(1, counter1.onNetworkNackCallCount_);
+  ASSERT_EQ(1, counter2.onNetworkNackCallCount_);
+  ASSERT_EQ(0, otherCounter.onNetworkNackCallCount_);
+
+  // The Nacked Interests were removed, so a new Interest is sent.
+  expressInterest(Interest(Name("/test/aggregation")), counter1);
+  ASSERT_EQ(3, getSentPackets().size());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
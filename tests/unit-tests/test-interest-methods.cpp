@@ -30,6 +30,8 @@
 #include <ndn-cpp/digest-sha256-signature.hpp>
 #include <ndn-cpp/sha256-with-rsa-signature.hpp>
 #include <ndn-cpp/interest.hpp>
+#include <ndn-cpp/interest-template.hpp>
+#include <ndn-cpp/encoding/tlv-wire-format.hpp>
 
 using namespace std;
 using namespace ndn;
@@ -306,6 +308,82 @@ TEST_F(TestInterestMethods, CopyConstructor)
     "Interest constructed as deep copy does not match original";
 }
 
+TEST_F(TestInterestMethods, LazyDecode)
+{
+  Interest interest;
+  interest.wireDecodeLazy(Blob(codedInterest, sizeof(codedInterest)));
+  ASSERT_EQ(referenceInterest.getName(),
+            static_cast<const Interest&>(interest).getName());
+
+  // A copy made before the other fields are decoded can decode them.
+  Interest interestCopy(interest);
+  ASSERT_TRUE(interestDumpsEqual
+              (dumpInterest(interestCopy), dumpInterest(referenceInterest))) <<
+    "Lazily decoded copy does not match original";
+
+  ASSERT_TRUE(interestDumpsEqual
+              (dumpInterest(interest), dumpInterest(referenceInterest))) <<
+    "Lazily decoded interest does not match original";
+  ASSERT_TRUE(interest.wireEncode().equals
+              (Blob(codedInterest, sizeof(codedInterest))));
+
+  // Changing a selector after a lazy decode keeps the other fields.
+  Interest freshInterest;
+  freshInterest.wireDecodeLazy(Blob(codedInterest, sizeof(codedInterest)));
+  freshInterest.setMustBeFresh(false);
+  ASSERT_EQ(referenceInterest.getExclude().toUri(),
+            freshInterest.getExclude().toUri());
+  ASSERT_FALSE(freshInterest.getMustBeFresh());
+
+  // A Nonce whose length is past the end of the Interest fails when checking
+  // the outline.
+  const uint8_t badOutline[] = {
+    0x05, 0x0B, // Interest
+      0x07, 0x03, 0x08, 0x01, 0x41, // Name=/A
+      0x0A, 0x08, 0x61, 0x62, 0x61, 0x62 // Nonce with a bad length
+  };
+  Interest badInterest;
+  ASSERT_THROW(badInterest.wireDecodeLazy(Blob(badOutline, sizeof(badOutline))),
+               runtime_error);
+
+  // A lazy decode rejects the same malformed fields as a full decode, such as
+  // Selectors with a bad MinSuffixComponents.
+  const uint8_t badSelectors[] = {
+    0x05, 0x0A, // Interest
+      0x07, 0x03, 0x08, 0x01, 0x41, // Name=/A
+      0x09, 0x03, // Selectors
+        0x0D, 0x05, 0x00 // MinSuffixComponents with a bad length
+  };
+  ASSERT_THROW(badInterest.wireDecode(badSelectors, sizeof(badSelectors)),
+               runtime_error);
+  ASSERT_THROW(badInterest.wireDecodeLazy
+               (Blob(badSelectors, sizeof(badSelectors))), runtime_error);
+
+  // An unrecognized critical TLV in place of the Nonce.
+  const uint8_t unrecognizedType[] = {
+    0x05, 0x08, // Interest
+      0x07, 0x03, 0x08, 0x01, 0x41, // Name=/A
+      0x1F, 0x01, 0x00 // Unrecognized type 31
+  };
+  ASSERT_THROW(badInterest.wireDecode
+               (unrecognizedType, sizeof(unrecognizedType)), runtime_error);
+  ASSERT_THROW(badInterest.wireDecodeLazy
+               (Blob(unrecognizedType, sizeof(unrecognizedType))),
+               runtime_error);
+}
+
+TEST_F(TestInterestMethods, LazyDecodeSelfAssignment)
+{
+  Interest interest;
+  interest.wireDecodeLazy(Blob(codedInterest, sizeof(codedInterest)));
+  Interest& sameInterest = interest;
+  interest = sameInterest;
+
+  ASSERT_TRUE(interestDumpsEqual
+              (dumpInterest(interest), dumpInterest(referenceInterest))) <<
+    "Self-assigned lazily decoded interest does not match original";
+}
+
 TEST_F(TestInterestMethods, EmptyNonce)
 {
   // make sure a freshly created interest has no nonce
@@ -492,6 +570,87 @@ TEST_F(TestInterestMethods, InterestFilterMatching)
   ASSERT_EQ(true,  InterestFilter("/a", "<b><>+").doesMatch(Name("/a/b/c")));
 }
 
+TEST_F(TestInterestMethods, InterestTemplate)
+{
+  Interest prefixInterest(referenceInterest);
+  prefixInterest.setName(referenceInterest.getName().getPrefix(-1));
+  InterestTemplate interestTemplate(prefixInterest);
+  const Name::Component& finalComponent = referenceInterest.getName().get(-1);
+
+  vector<uint8_t> encoding;
+  interestTemplate.wireEncode
+    (finalComponent, referenceInterest.getNonce().buf(), encoding);
+  // Encode from scratch instead of using the cached encoding from wireDecode.
+  size_t signedPortionBeginOffset, signedPortionEndOffset;
+  ASSERT_TRUE(Blob(encoding).equals(TlvWireFormat::get()->encodeInterest
+    (referenceInterest, &signedPortionBeginOffset, &signedPortionEndOffset))) <<
+              "The template encoding should match the full encoding";
+
+  ptr_lib::shared_ptr<Interest> interest =
+    interestTemplate.makeInterest(finalComponent);
+  ASSERT_TRUE(interest->getName().equals(referenceInterest.getName()));
+  ASSERT_EQ(InterestTemplate::getNonceLength(), interest->getNonce().size());
+  SignedBlob defaultEncoding = interest->getDefaultWireEncoding();
+  ASSERT_FALSE(defaultEncoding.isNull()) <<
+               "makeInterest should set the default wire encoding";
+
+  // Compare with encoding the Interest from scratch.
+  Blob expectedEncoding = TlvWireFormat::get()->encodeInterest
+    (*interest, &signedPortionBeginOffset, &signedPortionEndOffset);
+  ASSERT_TRUE(defaultEncoding.equals(expectedEncoding));
+  ASSERT_EQ(signedPortionBeginOffset, defaultEncoding.getSignedPortionBeginOffset());
+  ASSERT_EQ(signedPortionEndOffset, defaultEncoding.getSignedPortionEndOffset());
+
+  // A new Interest should have a new nonce.
+  ASSERT_FALSE(interestTemplate.makeInterest(finalComponent)->getNonce().equals
+               (interest->getNonce()));
+
+  // makeInterest with the given nonce is the same as the full encoding.
+  ptr_lib::shared_ptr<Interest> interestWithNonce = interestTemplate.makeInterest
+    (finalComponent, referenceInterest.getNonce());
+  ASSERT_TRUE(interestWithNonce->getNonce().equals
+              (referenceInterest.getNonce()));
+  ASSERT_TRUE(interestWithNonce->getDefaultWireEncoding().equals(Blob(encoding)));
+  ASSERT_THROW(interestTemplate.makeInterest
+               (finalComponent, Blob((const uint8_t*)"abc", 3)), runtime_error);
+}
+
+TEST_F(TestInterestMethods, InterestTemplateFields)
+{
+  // The referenceInterest has a KeyLocator and Exclude, which are decoded
+  // lazily from the encoding.
+  Interest prefixInterest(referenceInterest);
+  prefixInterest.setName(referenceInterest.getName().getPrefix(-1));
+  InterestTemplate interestTemplate(prefixInterest);
+  ptr_lib::shared_ptr<Interest> interest = interestTemplate.makeInterest
+    (referenceInterest.getName().get(-1), referenceInterest.getNonce());
+  ASSERT_TRUE(interestDumpsEqual
+              (dumpInterest(*interest), dumpInterest(referenceInterest))) <<
+    "The Interest from the template does not match the original";
+
+  // A template with only selectors and a lifetime.
+  Interest simpleInterest(Name("/A/B"));
+  simpleInterest.setMinSuffixComponents(2).setMustBeFresh(false)
+    .setInterestLifetimeMilliseconds(5000);
+  Blob nonce((const uint8_t*)"abcd", 4);
+  simpleInterest.setNonce(nonce);
+  Interest simplePrefixInterest(simpleInterest);
+  simplePrefixInterest.setName(Name("/A"));
+  InterestTemplate simpleTemplate(simplePrefixInterest);
+  ptr_lib::shared_ptr<Interest> simpleFromTemplate =
+    simpleTemplate.makeInterest(Name("/A/B").get(-1), nonce);
+  ASSERT_TRUE(interestDumpsEqual
+              (dumpInterest(*simpleFromTemplate), dumpInterest(simpleInterest)));
+  ASSERT_TRUE(simpleFromTemplate->wireEncode().equals
+              (simpleInterest.wireEncode()));
+
+  // Changing a field of the new Interest invalidates the default encoding.
+  simpleFromTemplate->setInterestLifetimeMilliseconds(6000);
+  ASSERT_TRUE(simpleFromTemplate->getDefaultWireEncoding().isNull());
+  ASSERT_FALSE(simpleFromTemplate->wireEncode().equals
+               (simpleInterest.wireEncode()));
+}
+
 int
 main(int argc, char **argv)
 {
@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/util/interest-retransmitter.hpp>
+#include "face-test-fixture.hpp"
+
+using namespace std;
+using namespace ndn;
+using namespace ndn::func_lib;
+
+class TestInterestRetransmitter : public ::testing::Test, public FaceTestFixture {
+public:
+  /**
+   * Call processEvents until *count reaches expected. The tests use RTOs of a
+   * few milliseconds, so this doesn't sleep. The loop limit only stops a
+   * failing test.
+   */
+  void
+  processEventsUntil(const int* count, int expected)
+  {
+    for (int i = 0; i < 100000000 && *count < expected; ++i)
+      face_.processEvents();
+  }
+};
+
+TEST(TestRttEstimator, Measurements)
+{
+  RttEstimator estimator(1000, 200, 60000);
+  ASSERT_EQ(1000.0, estimator.getRto());
+  ASSERT_EQ(-1.0, estimator.getSmoothedRtt());
+  ASSERT_EQ(0, estimator.getMeasurementCount());
+
+  // The first measurement sets SRTT = R and RTTVAR = R/2.
+  estimator.addMeasurement(100);
+  ASSERT_EQ(100.0, estimator.getSmoothedRtt());
+  ASSERT_EQ(50.0, estimator.getRttVariation());
+  ASSERT_EQ(300.0, estimator.getRto());
+
+  estimator.addMeasurement(200);
+  ASSERT_EQ(112.5, estimator.getSmoothedRtt());
+  ASSERT_EQ(62.5, estimator.getRttVariation());
+  ASSERT_EQ(362.5, estimator.getRto());
+
+  estimator.backoff();
+  ASSERT_EQ(725.0, estimator.getRto());
+  for (int i = 0; i < 20; ++i)
+    estimator.backoff();
+  ASSERT_EQ(60000.0, estimator.getRto());
+
+  estimator.reset();
+  ASSERT_EQ(1000.0, estimator.getRto());
+  ASSERT_EQ(0, estimator.getMeasurementCount());
+
+  // A tiny RTT is limited by the minimum RTO.
+  estimator.addMeasurement(1);
+  ASSERT_EQ(200.0, estimator.getRto());
+}
+
+TEST_F(TestInterestRetransmitter, DataUpdatesEstimator)
+{
+  InterestRetransmitter retransmitter(face_);
+  CallbackCounter counter;
+
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%00")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1));
+  ASSERT_EQ(1, getSentPackets().size());
+  Interest sentInterest;
+  sentInterest.wireDecode(getSentPackets()[0]);
+  // The first Interest uses the initial RTO as its lifetime.
+  ASSERT_EQ(1000.0, sentInterest.getInterestLifetimeMilliseconds());
+
+  receive(Data(Name("/test/retransmit/%00")).wireEncode());
+  ASSERT_EQ(1, counter.onDataCallCount_);
+  ASSERT_EQ(Name("/test/retransmit/%00"), counter.interest_->getName());
+
+  // The estimator is shared by all Interests under the prefix.
+  ptr_lib::shared_ptr<RttEstimator> estimator =
+    retransmitter.getRttEstimator(Name("/test/retransmit"));
+  ASSERT_EQ(1, estimator->getMeasurementCount());
+  ASSERT_EQ(200.0, estimator->getRto());
+
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%01")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1));
+  sentInterest.wireDecode(getSentPackets()[1]);
+  ASSERT_EQ(200.0, sentInterest.getInterestLifetimeMilliseconds());
+}
+
+TEST_F(TestInterestRetransmitter, RetransmitOnTimeout)
+{
+  InterestRetransmitter retransmitter(face_, 2, 1, 1, 1000);
+  CallbackCounter counter;
+
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%00")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1));
+  processEventsUntil(&counter.onTimeoutCallCount_, 1);
+
+  ASSERT_EQ(1, counter.onTimeoutCallCount_);
+  ASSERT_EQ(0, counter.onDataCallCount_);
+  // The original transmission plus two retransmissions with backed off RTOs.
+  ASSERT_EQ(3, getSentPackets().size());
+  Interest sentInterest;
+  sentInterest.wireDecode(getSentPackets()[2]);
+  ASSERT_EQ(4.0, sentInterest.getInterestLifetimeMilliseconds());
+  ASSERT_EQ
+    (8.0, retransmitter.getRttEstimator(Name("/test/retransmit"))->getRto());
+}
+
+TEST_F(TestInterestRetransmitter, BackoffOncePerLossEvent)
+{
+  InterestRetransmitter retransmitter(face_, 1, 1, 1, 1000);
+  CallbackCounter counter;
+
+  // Both Interests are sent with the same RTO and time out together.
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%00")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1));
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%01")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1));
+  processEventsUntil(&counter.onTimeoutCallCount_, 2);
+
+  ASSERT_EQ(4, getSentPackets().size());
+  // Only the first timeout backed off the RTO, so both retransmissions use it.
+  Interest sentInterest;
+  sentInterest.wireDecode(getSentPackets()[2]);
+  ASSERT_EQ(2.0, sentInterest.getInterestLifetimeMilliseconds());
+  sentInterest.wireDecode(getSentPackets()[3]);
+  ASSERT_EQ(2.0, sentInterest.getInterestLifetimeMilliseconds());
+  // The retransmissions are a second loss event.
+  ASSERT_EQ
+    (4.0, retransmitter.getRttEstimator(Name("/test/retransmit"))->getRto());
+}
+
+TEST_F(TestInterestRetransmitter, LeastRecentlyUsedPrefix)
+{
+  InterestRetransmitter retransmitter(face_, 3, 1000, 200, 60000, 2);
+
+  retransmitter.getRttEstimator(Name("/test/a"))->addMeasurement(100);
+  retransmitter.getRttEstimator(Name("/test/b"))->addMeasurement(100);
+  // Use /test/a so that /test/b is the least recently used.
+  retransmitter.getRttEstimator(Name("/test/a"));
+  retransmitter.getRttEstimator(Name("/test/c"));
+  ASSERT_EQ(2, retransmitter.getRttEstimatorCount());
+
+  ASSERT_EQ
+    (1, retransmitter.getRttEstimator(Name("/test/a"))->getMeasurementCount());
+  // /test/b was discarded, so it gets a new RttEstimator.
+  ASSERT_EQ
+    (0, retransmitter.getRttEstimator(Name("/test/b"))->getMeasurementCount());
+  ASSERT_EQ(2, retransmitter.getRttEstimatorCount());
+}
+
+TEST_F(TestInterestRetransmitter, NetworkNack)
+{
+  InterestRetransmitter retransmitter(face_);
+  CallbackCounter counter;
+
+  retransmitter.expressInterest
+    (Interest(Name("/test/retransmit/%00")),
+     bind(&CallbackCounter::onData, &counter, _1, _2),
+     bind(&CallbackCounter::onTimeout, &counter, _1),
+     bind(&CallbackCounter::onNetworkNack, &counter, _1, _2));
+  ASSERT_EQ(1, getSentPackets().size());
+
+  // A DUPLICATE Nack is retried at once with a new nonce.
+  receive(makeNack(getSentPackets()[0], 100));
+  ASSERT_EQ(2, getSentPackets().size());
+  Interest interest0, interest1;
+  interest0.wireDecode(getSentPackets()[0]);
+  interest1.wireDecode(getSentPackets()[1]);
+  ASSERT_FALSE(interest0.getNonce().equals(interest1.getNonce()));
+
+  // A NO_ROUTE Nack is reported without retrying.
+  receive(makeNack(getSentPackets()[1], 150));
+  ASSERT_EQ(2, getSentPackets().size());
+  ASSERT_EQ(1, counter.onNetworkNackCallCount_);
+  ASSERT_EQ(0, counter.onTimeoutCallCount_);
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
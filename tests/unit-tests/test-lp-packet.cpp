@@ -0,0 +1,344 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
+#include "../../src/c/util/time.h"
+#include "../../src/lp/lp-reassembler.hpp"
+
+using namespace std;
+using namespace ndn;
+
+static const uint8_t FRAGMENT_ENCODING[] = {
+0x64, 0x14, // LpPacket
+  0x51, 0x08, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, // Sequence
+  0x52, 0x01, 0x02, // FragIndex
+  0x53, 0x01, 0x03, // FragCount
+  0x50, 0x02, 0xaa, 0xbb // Fragment
+};
+
+/**
+ * An LpFragment holds an LpPacketLite for one fragment with its own header
+ * field array.
+ */
+class LpFragment {
+public:
+  LpFragment
+    (uint64_t sequence, uint64_t fragIndex, uint64_t fragCount,
+     const vector<uint8_t>& fragment)
+  : fragment_(fragment), lpPacket_(headerFields_, 1)
+  {
+    lpPacket_.setSequence(sequence);
+    lpPacket_.setFragIndex(fragIndex);
+    lpPacket_.setFragCount(fragCount);
+    lpPacket_.setFragmentWireEncoding
+      (BlobLite(&fragment_[0], fragment_.size()));
+  }
+
+  vector<uint8_t> fragment_;
+  struct ndn_LpPacketHeaderField headerFields_[1];
+  LpPacketLite lpPacket_;
+};
+
+/**
+ * Split the packet into fragCount fragments with consecutive Sequence numbers
+ * starting from firstSequence.
+ */
+static vector<ptr_lib::shared_ptr<LpFragment> >
+makeFragments
+  (const vector<uint8_t>& packet, uint64_t firstSequence, size_t fragCount)
+{
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments;
+  size_t fragmentSize = (packet.size() + fragCount - 1) / fragCount;
+  for (size_t i = 0; i < fragCount; ++i) {
+    size_t begin = i * fragmentSize;
+    size_t end = min(begin + fragmentSize, packet.size());
+    fragments.push_back(ptr_lib::make_shared<LpFragment>
+      (firstSequence + i, i, fragCount,
+       vector<uint8_t>(packet.begin() + begin, packet.begin() + end)));
+  }
+
+  return fragments;
+}
+
+static vector<uint8_t>
+makePacket(size_t size)
+{
+  vector<uint8_t> packet(size);
+  for (size_t i = 0; i < size; ++i)
+    packet[i] = (uint8_t)i;
+  return packet;
+}
+
+TEST(TestLpPacket, EncodeFragmentFields)
+{
+  struct ndn_LpPacketHeaderField headerFields[1];
+  LpPacketLite lpPacket(headerFields, 1);
+  uint8_t fragment[] = { 0xaa, 0xbb };
+  lpPacket.setSequence(0x0102030405060708ULL);
+  lpPacket.setFragIndex(2);
+  lpPacket.setFragCount(3);
+  lpPacket.setFragmentWireEncoding(BlobLite(fragment, sizeof(fragment)));
+
+  uint8_t buffer[100];
+  DynamicUInt8ArrayLite output(buffer, sizeof(buffer), 0);
+  size_t encodingLength;
+  ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::encodeLpPacket
+    (lpPacket, output, &encodingLength));
+  ASSERT_TRUE(Blob(FRAGMENT_ENCODING, sizeof(FRAGMENT_ENCODING)).equals
+              (Blob(buffer, encodingLength)));
+}
+
+TEST(TestLpPacket, EncodeDefaultFragmentFields)
+{
+  struct ndn_LpPacketHeaderField headerFields[1];
+  LpPacketLite lpPacket(headerFields, 1);
+  uint8_t fragment[] = { 0xaa };
+  lpPacket.setSequence(0);
+  lpPacket.setFragmentWireEncoding(BlobLite(fragment, sizeof(fragment)));
+
+  uint8_t buffer[100];
+  DynamicUInt8ArrayLite output(buffer, sizeof(buffer), 0);
+  size_t encodingLength;
+  ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::encodeLpPacket
+    (lpPacket, output, &encodingLength));
+  // The FragIndex 0 and FragCount 1 are omitted.
+  uint8_t expected[] = {
+    0x64, 0x0d,
+      0x51, 0x08, 0, 0, 0, 0, 0, 0, 0, 0,
+      0x50, 0x01, 0xaa
+  };
+  ASSERT_TRUE(Blob(expected, sizeof(expected)).equals
+              (Blob(buffer, encodingLength)));
+}
+
+TEST(TestLpPacket, DecodeFragmentFields)
+{
+  struct ndn_LpPacketHeaderField headerFields[1];
+  LpPacketLite lpPacket(headerFields, 1);
+  ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::decodeLpPacket
+    (lpPacket, FRAGMENT_ENCODING, sizeof(FRAGMENT_ENCODING)));
+
+  ASSERT_TRUE(lpPacket.getHasSequence());
+  ASSERT_EQ(0x0102030405060708ULL, lpPacket.getSequence());
+  ASSERT_EQ(2, lpPacket.getFragIndex());
+  ASSERT_EQ(3, lpPacket.getFragCount());
+  ASSERT_EQ(2, lpPacket.getFragmentWireEncoding().size());
+  ASSERT_EQ(0xaa, lpPacket.getFragmentWireEncoding().buf()[0]);
+
+  // Without the fields, use the defaults.
+  uint8_t noFields[] = { 0x64, 0x03, 0x50, 0x01, 0xaa };
+  ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::decodeLpPacket
+    (lpPacket, noFields, sizeof(noFields)));
+  ASSERT_FALSE(lpPacket.getHasSequence());
+  ASSERT_EQ(0, lpPacket.getFragIndex());
+  ASSERT_EQ(1, lpPacket.getFragCount());
+}
+
+TEST(TestLpReassembler, InOrder)
+{
+  LpReassembler reassembler;
+  vector<uint8_t> packet = makePacket(1000);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments =
+    makeFragments(packet, 100, 4);
+
+  Blob reassembledPacket;
+  for (size_t i = 0; i < 3; ++i) {
+    ASSERT_FALSE(reassembler.receiveFragment
+      (fragments[i]->lpPacket_, reassembledPacket));
+    ASSERT_EQ(1, reassembler.size());
+  }
+
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments[3]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet).equals(reassembledPacket));
+  ASSERT_EQ(0, reassembler.size());
+}
+
+TEST(TestLpReassembler, OutOfOrder)
+{
+  LpReassembler reassembler;
+  vector<uint8_t> packet1 = makePacket(1000);
+  vector<uint8_t> packet2 = makePacket(500);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments1 =
+    makeFragments(packet1, 100, 3);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments2 =
+    makeFragments(packet2, 103, 2);
+
+  // Interleave the fragments of two packets in reverse order.
+  Blob reassembledPacket;
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments1[2]->lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments2[1]->lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments1[1]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(2, reassembler.size());
+
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments2[0]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet2).equals(reassembledPacket));
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments1[0]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet1).equals(reassembledPacket));
+  ASSERT_EQ(0, reassembler.size());
+}
+
+TEST(TestLpReassembler, SequenceWrap)
+{
+  LpReassembler reassembler;
+  vector<uint8_t> packet = makePacket(300);
+  // The Sequence of the second fragment wraps around to 0.
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments =
+    makeFragments(packet, 0xffffffffffffffffULL, 3);
+  ASSERT_EQ(0, fragments[1]->lpPacket_.getSequence());
+
+  Blob reassembledPacket;
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[2]->lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[1]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(1, reassembler.size());
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments[0]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet).equals(reassembledPacket));
+}
+
+TEST(TestLpReassembler, Duplicate)
+{
+  LpReassembler reassembler;
+  vector<uint8_t> packet = makePacket(200);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments =
+    makeFragments(packet, 7, 2);
+
+  Blob reassembledPacket;
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[0]->lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[0]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(1, reassembler.size());
+
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments[1]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet).equals(reassembledPacket));
+
+  // A late duplicate starts a new partial packet which later times out.
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[1]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(1, reassembler.size());
+}
+
+TEST(TestLpReassembler, InvalidFields)
+{
+  LpReassembler reassembler;
+  vector<uint8_t> fragment(10, 0);
+  Blob reassembledPacket;
+
+  LpFragment badIndex(10, 2, 2, fragment);
+  ASSERT_FALSE(reassembler.receiveFragment
+    (badIndex.lpPacket_, reassembledPacket));
+
+  LpFragment noSequence(10, 0, 2, fragment);
+  uint8_t noSequenceEncoding[] = {
+    0x64, 0x06, 0x53, 0x01, 0x02, 0x50, 0x01, 0xaa
+  };
+  ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::decodeLpPacket
+    (noSequence.lpPacket_, noSequenceEncoding, sizeof(noSequenceEncoding)));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (noSequence.lpPacket_, reassembledPacket));
+
+  ASSERT_EQ(0, reassembler.size());
+
+  // A FragCount which doesn't match the partial packet is dropped.
+  LpFragment first(20, 0, 3, fragment);
+  LpFragment mismatched(21, 1, 4, fragment);
+  ASSERT_FALSE(reassembler.receiveFragment
+    (first.lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (mismatched.lpPacket_, reassembledPacket));
+  ASSERT_EQ(1, reassembler.size());
+}
+
+TEST(TestLpReassembler, Timeout)
+{
+  LpReassembler reassembler(64, 500.0);
+  vector<uint8_t> packet = makePacket(200);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments =
+    makeFragments(packet, 7, 2);
+
+  Blob reassembledPacket;
+  MillisecondsSince1970 now = ndn_getNowMilliseconds();
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[0]->lpPacket_, reassembledPacket));
+
+  // The partial packet is not expired before the reassembly timeout.
+  reassembler.removeExpired(now + 400.0);
+  ASSERT_EQ(1, reassembler.size());
+
+  // Without a new fragment, removeExpired drops the partial packet.
+  reassembler.removeExpired(now + 1000.0);
+  ASSERT_EQ(0, reassembler.size());
+
+  // The remaining fragment starts a new partial packet.
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments[1]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(1, reassembler.size());
+}
+
+TEST(TestLpReassembler, Eviction)
+{
+  LpReassembler reassembler(2, 500.0);
+  vector<uint8_t> packet = makePacket(200);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments1 =
+    makeFragments(packet, 100, 2);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments2 =
+    makeFragments(packet, 200, 2);
+  vector<ptr_lib::shared_ptr<LpFragment> > fragments3 =
+    makeFragments(packet, 300, 2);
+
+  Blob reassembledPacket;
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments1[0]->lpPacket_, reassembledPacket));
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments2[0]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(2, reassembler.size());
+
+  // The table is full, so the third packet evicts one partial packet.
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments3[0]->lpPacket_, reassembledPacket));
+  ASSERT_EQ(2, reassembler.size());
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments3[1]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(Blob(packet).equals(reassembledPacket));
+
+  // The first packet had the earliest expiration time, so it was evicted.
+  ASSERT_FALSE(reassembler.receiveFragment
+    (fragments1[1]->lpPacket_, reassembledPacket));
+  ASSERT_TRUE(!!reassembler.receiveFragment
+    (fragments2[1]->lpPacket_, reassembledPacket));
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -24,6 +24,8 @@
 #include "gtest/gtest.h"
 #include <algorithm>
 #include <ndn-cpp/name.hpp>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/sha256-with-rsa-signature.hpp>
 #include <ndn-cpp/encoding/tlv-wire-format.hpp>
 
 using namespace std;
@@ -273,6 +275,33 @@ TEST_F(TestNameMethods, EncodeDecode)
   ASSERT_EQ(decodedName2, name2);
 }
 
+TEST_F(TestNameMethods, EncodeDecodeLongName)
+{
+  // More components than the fixed arrays used for encoding and decoding.
+  Name name;
+  for (int i = 0; i < 200; ++i)
+    name.appendSegment(i);
+
+  Blob encoding = name.wireEncode(*TlvWireFormat::get());
+  Name decodedName;
+  decodedName.wireDecode(encoding, *TlvWireFormat::get());
+  ASSERT_EQ(name, decodedName);
+
+  // Check a long name and key name in a Data packet.
+  Data data(name);
+  data.setContent(Blob((const uint8_t*)"SUCCESS!", 8));
+  Sha256WithRsaSignature signature;
+  signature.getKeyLocator().setType(ndn_KeyLocatorType_KEYNAME);
+  signature.getKeyLocator().setKeyName(name);
+  data.setSignature(signature);
+
+  Data decodedData;
+  decodedData.wireDecode(data.wireEncode());
+  ASSERT_EQ(name, decodedData.getName());
+  ASSERT_EQ(name, KeyLocator::getFromSignature
+            (decodedData.getSignature()).getKeyName());
+}
+
 TEST_F(TestNameMethods, ImplicitSha256Digest)
 {
   Name name;
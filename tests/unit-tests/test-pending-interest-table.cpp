@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/data.hpp>
+#include "../../src/impl/pending-interest-table.hpp"
+#include "../../src/impl/nonce-pool.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class TestPendingInterestTable : public ::testing::Test {
+public:
+  ptr_lib::shared_ptr<PendingInterestTable::Entry>
+  add(uint64_t pendingInterestId, const Name& name)
+  {
+    return table_.add
+      (pendingInterestId, ptr_lib::make_shared<Interest>(name), OnData(),
+       OnTimeout(), OnNetworkNack());
+  }
+
+  PendingInterestTable table_;
+};
+
+TEST_F(TestPendingInterestTable, ExtractEntry)
+{
+  // Add out of order, which must keep the table sorted for the binary search.
+  uint64_t ids[] = { 5, 3, 9, 1, 7 };
+  for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); ++i)
+    ASSERT_TRUE(!!add(ids[i], Name("/test").appendSegment(ids[i])));
+  ASSERT_EQ(5, table_.size());
+
+  ASSERT_FALSE(table_.extractEntry(4));
+  ASSERT_FALSE(table_.extractEntry(10));
+  ASSERT_EQ(5, table_.size());
+
+  uint64_t extractOrder[] = { 9, 1, 5, 7, 3 };
+  for (size_t i = 0; i < sizeof(extractOrder) / sizeof(extractOrder[0]); ++i) {
+    ptr_lib::shared_ptr<PendingInterestTable::Entry> entry =
+      table_.extractEntry(extractOrder[i]);
+    ASSERT_TRUE(!!entry);
+    ASSERT_EQ(extractOrder[i], entry->getPendingInterestId());
+    ASSERT_TRUE(Name("/test").appendSegment(extractOrder[i]).equals
+                (entry->getInterest()->getName()));
+    ASSERT_TRUE(entry->getIsRemoved());
+    // Extracting again finds nothing.
+    ASSERT_FALSE(table_.extractEntry(extractOrder[i]));
+  }
+  ASSERT_EQ(0, table_.size());
+}
+
+TEST_F(TestPendingInterestTable, ExtractAfterData)
+{
+  add(1, Name("/a"));
+  add(2, Name("/b"));
+  add(3, Name("/a"));
+
+  vector<ptr_lib::shared_ptr<PendingInterestTable::Entry> > entries;
+  table_.extractEntriesForExpressedInterest(Data(Name("/a/1")), entries);
+  ASSERT_EQ(2, entries.size());
+  ASSERT_EQ(1, table_.size());
+
+  // The timeout for a satisfied entry doesn't find it.
+  ASSERT_FALSE(table_.extractEntry(1));
+  ASSERT_FALSE(table_.extractEntry(3));
+  ASSERT_TRUE(!!table_.extractEntry(2));
+}
+
+TEST_F(TestPendingInterestTable, RemoveBeforeAdd)
+{
+  add(1, Name("/a"));
+  table_.removePendingInterest(1);
+  ASSERT_EQ(0, table_.size());
+
+  // Removing an ID before it is added prevents adding it.
+  table_.removePendingInterest(2);
+  ASSERT_FALSE(add(2, Name("/b")));
+  ASSERT_EQ(0, table_.size());
+  // The removal request is used only once.
+  ASSERT_TRUE(!!add(2, Name("/b")));
+}
+
+TEST(TestNoncePool, ReuseReleasedNonce)
+{
+  NoncePool pool;
+  Blob nonce1 = pool.getNextNonce();
+  ASSERT_EQ(NoncePool::getNonceLength(), nonce1.size());
+  const uint8_t* buffer1 = nonce1.buf();
+
+  // A nonce which is still held is not rewritten.
+  vector<uint8_t> savedNonce1(nonce1.buf(), nonce1.buf() + nonce1.size());
+  Blob nonce2 = pool.getNextNonce();
+  ASSERT_TRUE(nonce2.buf() != buffer1);
+  ASSERT_TRUE(Blob(savedNonce1).equals(nonce1));
+  ASSERT_EQ(2, pool.getPooledNonceCount());
+
+  // After releasing the nonce, its buffer is reused for a new nonce.
+  nonce1 = Blob();
+  Blob nonce3 = pool.getNextNonce();
+  ASSERT_EQ(buffer1, nonce3.buf());
+  ASSERT_EQ(2, pool.getPooledNonceCount());
+}
+
+TEST(TestNoncePool, MaxPooledNonces)
+{
+  NoncePool pool(4);
+  vector<Blob> nonces;
+  for (int i = 0; i < 10; ++i)
+    nonces.push_back(pool.getNextNonce());
+  ASSERT_EQ(4, pool.getPooledNonceCount());
+
+  // The nonces are random. Allow for one unlikely pair of equal nonces.
+  int nEqual = 0;
+  for (size_t i = 0; i < nonces.size(); ++i) {
+    for (size_t j = i + 1; j < nonces.size(); ++j) {
+      if (nonces[i].equals(nonces[j]))
+        ++nEqual;
+    }
+  }
+  ASSERT_TRUE(nEqual <= 1);
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -337,6 +337,37 @@ TEST_F(TestConfigPolicyManager, InterestTimestamp)
     "Verification failure callback called " << vr.failureCount_ << " times instead of 1";
 }
 
+TEST_F(TestConfigPolicyManager, KeyTimestampTtl)
+{
+  // Use a TTL which is shorter than the grace interval.
+  policyManager_.reset(new ConfigPolicyManager
+    (policyConfigDirectory_ + "/simple_rules.conf",
+     ptr_lib::make_shared<CertificateCacheV2>(), 5, 3000, 1000));
+  keyChain_.reset(new KeyChain(pibImpl_, tpmBackEnd_, policyManager_));
+
+  Name certName = keyChain_->getPib().getIdentity(identityName_)
+    ->getKey(keyName_)->getDefaultCertificate()->getName();
+  Face face("localhost");
+  face.setCommandSigningInfo(*keyChain_, certName);
+
+  ptr_lib::shared_ptr<Interest> interest
+    (new Interest(Name("/ndn/ucla/edu/something")));
+  face.makeCommandInterest(*interest);
+  // The interest timestamp is older than the TTL but within the grace interval.
+  usleep(1500000);
+
+  VerificationResult vr = doVerify(*policyManager_, interest);
+  ASSERT_EQ(vr.successCount_, 1) <<
+    "Verification of the first interest failed";
+
+  // The key was just used, so its timestamp is kept and the replay fails.
+  vr = doVerify(*policyManager_, interest);
+  ASSERT_EQ(vr.successCount_, 0) <<
+    "Verification of the replayed interest succeeded";
+  ASSERT_EQ(vr.failureCount_, 1) <<
+    "Verification failure callback called " << vr.failureCount_ << " times instead of 1";
+}
+
 TEST_F(TestConfigPolicyManager, Refresh10s)
 {
   ifstream dataFile((policyConfigDirectory_ + "/testData").c_str());
@@ -462,6 +462,73 @@ TEST_F(TestConfigPolicyManager, Refresh10s)
     "ConfigPolicyManager did not verify valid signed data";
 }
 
+TEST_F(TestConfigPolicyManager, CertificateCache)
+{
+  ptr_lib::shared_ptr<IdentityCertificate> certificate =
+    identityManager_->selfSign(keyName_);
+  Name certificateName = certificate->getName().getPrefix(-1);
+  MillisecondsSince1970 now = getNowSeconds() * 1000.0;
+  certificate->setNotBefore(now + 1000 * 1000.0);
+  certificate->setNotAfter(now + 3600 * 1000.0);
+  Name trustAnchorName("/TestConfigPolicyManager/anchor/KEY/ksk-1/ID-CERT");
+
+  CertificateCache cache;
+  cache.insertCertificate(*certificate, trustAnchorName);
+  ASSERT_FALSE(!!cache.getCertificate(certificateName)) <<
+    "The certificate should not be returned before its NotBefore time";
+
+  cache.setNowOffsetMilliseconds_(2000 * 1000.0);
+  ptr_lib::shared_ptr<IdentityCertificate> found =
+    cache.getCertificate(certificateName);
+  ASSERT_TRUE(!!found);
+  ASSERT_TRUE(found->getName().equals(certificate->getName()));
+  ASSERT_EQ(found.get(), cache.getCertificate(certificateName).get()) <<
+    "The cache should return the same decoded certificate";
+  ASSERT_TRUE(cache.getTrustAnchorName(certificateName).equals(trustAnchorName));
+
+  cache.setNowOffsetMilliseconds_(4000 * 1000.0);
+  ASSERT_FALSE(!!cache.getCertificate(certificateName)) <<
+    "The certificate should be removed after its NotAfter time";
+  ASSERT_EQ(0, cache.getTrustAnchorName(certificateName).size());
+
+  cache.insertCertificate(*certificate, trustAnchorName);
+  ASSERT_FALSE(!!cache.getCertificate(certificateName)) <<
+    "An expired certificate should not be inserted";
+
+  // A trust anchor does not expire.
+  cache.insertCertificate(*certificate);
+  ASSERT_TRUE(!!cache.getCertificate(certificateName));
+  ASSERT_EQ(0, cache.getTrustAnchorName(certificateName).size());
+}
+
+TEST_F(TestConfigPolicyManager, RemovedTrustAnchor)
+{
+  ptr_lib::shared_ptr<CertificateCache> certificateCache(new CertificateCache());
+  ConfigPolicyManager policyManager("", certificateCache);
+
+  // Use the default certificate of identityName_ as a fixed trust anchor.
+  Name anchorName =
+    identityManager_->getDefaultCertificateNameForIdentity(identityName_);
+  certificateCache->insertCertificate
+    (*identityManager_->getCertificate(anchorName));
+
+  // Make a certificate which is signed by the trust anchor.
+  IdentityCertificate certificate(*identityManager_->getCertificate(anchorName));
+  certificate.setName
+    (Name("/TestConfigPolicyManager/other/KEY/ksk-1/ID-CERT").appendVersion(1));
+  keyChain_->signByIdentity(certificate, identityName_);
+  Name certificateName = certificate.getName().getPrefix(-1);
+  policyManager.insertVerifiedCertificate(certificate);
+
+  Name trustAnchorName;
+  ASSERT_TRUE(!!policyManager.findCertificate(certificateName, trustAnchorName));
+  ASSERT_TRUE(trustAnchorName.equals(anchorName.getPrefix(-1)));
+
+  certificateCache->deleteCertificate(anchorName.getPrefix(-1));
+  ASSERT_FALSE(!!policyManager.findCertificate(certificateName)) <<
+    "A certificate should not be found after its trust anchor is removed";
+}
+
 int
 main(int argc, char **argv)
 {
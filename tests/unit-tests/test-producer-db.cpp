@@ -76,6 +76,9 @@ public:
   TearDown()
   {
     remove(databaseFilePath.c_str());
+    // In case the test enabled write-ahead logging.
+    remove((databaseFilePath + "-wal").c_str());
+    remove((databaseFilePath + "-shm").c_str());
   }
 
   string databaseFilePath;
@@ -131,6 +134,68 @@ TEST_F(TestProducerDb, DatabaseFunctions)
   database.deleteContentKey(point4);
 }
 
+TEST_F(TestProducerDb, Transaction)
+{
+  Sqlite3ProducerDb database(databaseFilePath);
+
+  AesKeyParams params(128);
+  Blob keyBlob = AesAlgorithm::generateKey(params).getKeyBits();
+  MillisecondsSince1970 point1 = fromIsoString("20150101T100000");
+  MillisecondsSince1970 point2 = fromIsoString("20150102T100000");
+
+  // A rolled back transaction leaves no keys.
+  database.beginTransaction();
+  database.addContentKey(point1, keyBlob);
+  ASSERT_EQ(true, database.hasContentKey(point1));
+  database.rollbackTransaction();
+  ASSERT_EQ(false, database.hasContentKey(point1));
+
+  // Only the outermost commit of nested transactions writes the keys.
+  database.beginTransaction();
+  database.addContentKey(point1, keyBlob);
+  database.beginTransaction();
+  database.addContentKey(point2, keyBlob);
+  database.commitTransaction();
+  database.commitTransaction();
+
+  ASSERT_THROW(database.commitTransaction(), ProducerDb::Error)
+    << "commitTransaction did not throw an exception";
+
+  // The keys are visible from a new connection.
+  Sqlite3ProducerDb database2(databaseFilePath);
+  ASSERT_EQ(true, database2.hasContentKey(point1));
+  ASSERT_EQ(true, database2.hasContentKey(point2));
+}
+
+TEST_F(TestProducerDb, WriteAheadLogging)
+{
+  AesKeyParams params(128);
+  Blob keyBlob = AesAlgorithm::generateKey(params).getKeyBits();
+  MillisecondsSince1970 point1 = fromIsoString("20150101T100000");
+  MillisecondsSince1970 point2 = fromIsoString("20150102T100000");
+
+  {
+    // By default, the database uses the rollback journal.
+    Sqlite3ProducerDb database(databaseFilePath);
+    database.addContentKey(point1, keyBlob);
+    ASSERT_FALSE(fileExists(databaseFilePath + "-wal"));
+
+    ASSERT_THROW(database.enableWriteAheadLogging("SOMETIMES"),
+                 ProducerDb::Error);
+    database.beginTransaction();
+    ASSERT_THROW(database.enableWriteAheadLogging(), ProducerDb::Error);
+    database.rollbackTransaction();
+
+    database.enableWriteAheadLogging("FULL");
+    database.addContentKey(point2, keyBlob);
+    ASSERT_TRUE(fileExists(databaseFilePath + "-wal"));
+  }
+
+  Sqlite3ProducerDb database(databaseFilePath);
+  ASSERT_EQ(true, database.hasContentKey(point1));
+  ASSERT_EQ(true, database.hasContentKey(point2));
+}
+
 int
 main(int argc, char **argv)
 {
@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/ndn-cpp-config.h>
+
+#if NDN_CPP_HAVE_PROTOBUF
+
+#include <stdexcept>
+#include <ndn-cpp/encoding/protobuf-tlv.hpp>
+#include <ndn-cpp/encoding/protobuf-tlv-codec.hpp>
+#include "../../examples/fib-entry.pb.h"
+#include "../../examples/face-status.pb.h"
+
+using namespace std;
+using namespace ndn;
+
+static const uint8_t FIB_ENTRY_ENCODING[] = {
+0x80, 0x15, // FibEntry
+  0x07, 0x0b, // Name
+    0x08, 0x03, 0x6e, 0x64, 0x6e, // "ndn"
+    0x08, 0x04, 0x75, 0x63, 0x6c, 0x61, // "ucla"
+  0x81, 0x06, // NextHopRecord
+    0x69, 0x01, 0x10, // FaceId = 16
+    0x6a, 0x01, 0x01 // Cost = 1
+};
+
+class TestProtobufTlv : public ::testing::Test {
+public:
+  TestProtobufTlv()
+  {
+    message.mutable_fib_entry()->mutable_name()->add_component("ndn");
+    message.mutable_fib_entry()->mutable_name()->add_component("ucla");
+    ndn_message::FibEntryMessage_NextHopRecord& nextHopRecord =
+      *message.mutable_fib_entry()->add_next_hop_records();
+    nextHopRecord.set_face_id(16);
+    nextHopRecord.set_cost(1);
+  }
+
+  ndn_message::FibEntryMessage message;
+};
+
+TEST_F(TestProtobufTlv, Encode)
+{
+  Blob encoding = ProtobufTlv::encode(message);
+  ASSERT_TRUE(encoding.equals
+    (Blob(FIB_ENTRY_ENCODING, sizeof(FIB_ENTRY_ENCODING))))
+    << "ProtobufTlv::encode did not produce the expected encoding";
+}
+
+TEST_F(TestProtobufTlv, Decode)
+{
+  ndn_message::FibEntryMessage decodedMessage;
+  ProtobufTlv::decode
+    (decodedMessage, FIB_ENTRY_ENCODING, sizeof(FIB_ENTRY_ENCODING));
+
+  ASSERT_EQ("/ndn/ucla",
+            ProtobufTlv::toName(decodedMessage.fib_entry().name()).toUri());
+  ASSERT_EQ(1, decodedMessage.fib_entry().next_hop_records_size());
+  ASSERT_EQ(16, decodedMessage.fib_entry().next_hop_records(0).face_id());
+  ASSERT_EQ(1, decodedMessage.fib_entry().next_hop_records(0).cost());
+
+  // Re-encoding should give the same encoding.
+  ASSERT_TRUE(ProtobufTlv::encode(decodedMessage).equals
+    (Blob(FIB_ENTRY_ENCODING, sizeof(FIB_ENTRY_ENCODING))));
+}
+
+TEST_F(TestProtobufTlv, DecodeMissingRequired)
+{
+  // The NextHopRecord is missing the required Cost.
+  const uint8_t encoding[] = {
+    0x80, 0x12,
+      0x07, 0x0b,
+        0x08, 0x03, 0x6e, 0x64, 0x6e,
+        0x08, 0x04, 0x75, 0x63, 0x6c, 0x61,
+      0x81, 0x03,
+        0x69, 0x01, 0x10
+  };
+
+  ndn_message::FibEntryMessage decodedMessage;
+  ASSERT_THROW
+    (ProtobufTlv::decode(decodedMessage, encoding, sizeof(encoding)),
+     runtime_error);
+}
+
+#if NDN_CPP_HAVE_PROTOBUF_TLV_CODEGEN
+
+TEST_F(TestProtobufTlv, GeneratedCodec)
+{
+  // The generated fib-entry.tlv.cc should register its codec.
+  ProtobufTlvCodec::EncodeFunction encode;
+  ProtobufTlvCodec::DecodeFunction decode;
+  ASSERT_TRUE(ProtobufTlvCodec::findCodec(message, encode, decode))
+    << "The codec generated by protoc-gen-ndntlv is not registered";
+
+  // The generated encoding should be the same as the reflection encoding.
+  Blob encoding = encode(message);
+  ASSERT_TRUE(encoding.equals(ProtobufTlv::encodeWithReflection(message)));
+  ASSERT_TRUE(encoding.equals(ProtobufTlv::encode(message)));
+
+  // The generated decoding should be the same as the reflection decoding.
+  ndn_message::FibEntryMessage generatedMessage;
+  decode(generatedMessage, encoding.buf(), encoding.size());
+  ndn_message::FibEntryMessage reflectionMessage;
+  ProtobufTlv::decodeWithReflection
+    (reflectionMessage, encoding.buf(), encoding.size());
+  ASSERT_EQ(reflectionMessage.SerializeAsString(),
+            generatedMessage.SerializeAsString());
+}
+
+TEST(TestProtobufTlvCodec, GeneratedStringAndOptionalFields)
+{
+  ndn_message::FaceStatusMessage message;
+  for (int i = 0; i < 2; ++i) {
+    ndn_message::FaceStatusMessage_FaceStatus& faceStatus =
+      *message.add_face_status();
+    faceStatus.set_face_id(260 + i);
+    faceStatus.set_uri("udp4://127.0.0.1:6363");
+    faceStatus.set_local_uri("");
+    faceStatus.set_face_scope(0);
+    faceStatus.set_face_persistency(1);
+    faceStatus.set_link_type(0);
+    faceStatus.set_n_in_interests(70000);
+    faceStatus.set_n_in_datas(0);
+    faceStatus.set_n_in_nacks(1);
+    faceStatus.set_n_out_interests(255);
+    faceStatus.set_n_out_datas(256);
+    faceStatus.set_n_out_nacks(0);
+    faceStatus.set_n_in_bytes(5000000000ULL);
+    faceStatus.set_n_out_bytes(65536);
+    // Only set the optional field in the first FaceStatus.
+    if (i == 0)
+      faceStatus.set_expiration_period(0);
+  }
+
+  ProtobufTlvCodec::EncodeFunction encode;
+  ProtobufTlvCodec::DecodeFunction decode;
+  ASSERT_TRUE(ProtobufTlvCodec::findCodec(message, encode, decode));
+
+  Blob encoding = encode(message);
+  ASSERT_TRUE(encoding.equals(ProtobufTlv::encodeWithReflection(message)));
+
+  ndn_message::FaceStatusMessage generatedMessage;
+  decode(generatedMessage, encoding.buf(), encoding.size());
+  ndn_message::FaceStatusMessage reflectionMessage;
+  ProtobufTlv::decodeWithReflection
+    (reflectionMessage, encoding.buf(), encoding.size());
+  ASSERT_EQ(message.SerializeAsString(), generatedMessage.SerializeAsString());
+  ASSERT_EQ(reflectionMessage.SerializeAsString(),
+            generatedMessage.SerializeAsString());
+}
+
+#endif // NDN_CPP_HAVE_PROTOBUF_TLV_CODEGEN
+
+TEST(TestProtobufTlvCodec, EncoderDecoder)
+{
+  string value("value");
+  size_t valueLength =
+    ProtobufTlvCodec::Encoder::sizeOfNonNegativeIntegerTlv(105, 300) +
+    ProtobufTlvCodec::Encoder::sizeOfBlobTlv(8, value.size());
+  size_t length =
+    ProtobufTlvCodec::Encoder::sizeOfTypeAndLength(128, valueLength) +
+    valueLength;
+
+  ProtobufTlvCodec::Encoder encoder(length);
+  encoder.writeTypeAndLength(128, valueLength);
+  encoder.writeNonNegativeIntegerTlv(105, 300);
+  encoder.writeBlobTlv(8, value);
+  Blob encoding = encoder.finish();
+  ASSERT_EQ(length, encoding.size());
+
+  ProtobufTlvCodec::Decoder decoder(encoding.buf(), encoding.size());
+  size_t endOffset = decoder.readNestedTlvsStart(128);
+  ASSERT_TRUE(decoder.peekType(105, endOffset));
+  ASSERT_EQ(300, decoder.readNonNegativeIntegerTlv(105));
+  ASSERT_FALSE(decoder.peekType(105, endOffset));
+  struct ndn_Blob decodedValue = decoder.readBlobTlv(8);
+  ASSERT_EQ(value, string((const char*)decodedValue.value, decodedValue.length));
+  decoder.finishNestedTlvs(endOffset);
+}
+
+TEST(TestProtobufTlvCodec, EncoderLengthMismatch)
+{
+  size_t length = ProtobufTlvCodec::Encoder::sizeOfNonNegativeIntegerTlv(105, 1);
+
+  // Write less than the precomputed length.
+  ProtobufTlvCodec::Encoder encoder(length + 1);
+  encoder.writeNonNegativeIntegerTlv(105, 1);
+  ASSERT_THROW(encoder.finish(), runtime_error);
+}
+
+#else // NDN_CPP_HAVE_PROTOBUF
+
+TEST(TestProtobufTlv, NoProtobuf)
+{
+}
+
+#endif // NDN_CPP_HAVE_PROTOBUF
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -32,6 +32,8 @@
 #include <ndn-cpp/security/identity/memory-private-key-storage.hpp>
 #include <ndn-cpp/security/policy/self-verify-policy-manager.hpp>
 #include <ndn-cpp/security/key-chain.hpp>
+#include <ndn-cpp/transport/loopback-forwarder.hpp>
+#include <ndn-cpp/transport/loopback-transport.hpp>
 
 using namespace std;
 using namespace ndn;
@@ -75,7 +77,12 @@ public:
 class TestRegistrationCallbacks : public ::testing::Test {
 public:
   TestRegistrationCallbacks()
+  : face(ptr_lib::make_shared<LoopbackTransport>(),
+         ptr_lib::make_shared<LoopbackTransport::ConnectionInfo>
+           (ptr_lib::make_shared<LoopbackForwarder>())),
+    keyChain("pib-memory:", "tpm-memory:")
   {
+    keyChain.createIdentityV2(Name("/test/identity"));
     face.setCommandSigningInfo(keyChain, keyChain.getDefaultCertificateName());
   }
 
@@ -85,6 +92,7 @@ public:
     face.shutdown();
   }
 
+  // Use an in-process forwarder so that the test doesn't need NFD.
   Face face;
   KeyChain keyChain;
 };
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include "../../src/impl/slab-pool.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class PooledValue {
+public:
+  PooledValue(int value)
+  : value_(value)
+  {
+  }
+
+  int value_;
+  uint8_t padding_[20];
+};
+
+TEST(TestSlabPool, ReuseFreedBlock)
+{
+  SlabPool pool(4);
+  ASSERT_EQ(0, pool.getSlabCount());
+
+  void* block1 = pool.allocate(24);
+  void* block2 = pool.allocate(24);
+  ASSERT_TRUE(block1 != block2);
+  ASSERT_EQ(1, pool.getSlabCount());
+
+  // A freed block is reused by the next allocation of the same size class.
+  pool.deallocate(block1, 24);
+  ASSERT_EQ(block1, pool.allocate(20));
+  ASSERT_EQ(1, pool.getSlabCount());
+}
+
+TEST(TestSlabPool, SizeClasses)
+{
+  SlabPool pool(4);
+  void* small = pool.allocate(16);
+  void* large = pool.allocate(17);
+  // Each size class has its own slab.
+  ASSERT_EQ(2, pool.getSlabCount());
+  ASSERT_EQ(0, (size_t)small % 16);
+  ASSERT_EQ(0, (size_t)large % 16);
+
+  // A block larger than the maximum is not pooled.
+  void* huge = pool.allocate(SlabPool::getMaxBlockSize() + 1);
+  ASSERT_EQ(2, pool.getSlabCount());
+  pool.deallocate(huge, SlabPool::getMaxBlockSize() + 1);
+}
+
+TEST(TestSlabPool, NewSlab)
+{
+  SlabPool pool(2);
+  vector<void*> blocks;
+  for (int i = 0; i < 5; ++i)
+    blocks.push_back(pool.allocate(32));
+  ASSERT_EQ(3, pool.getSlabCount());
+
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    for (size_t j = i + 1; j < blocks.size(); ++j)
+      ASSERT_TRUE(blocks[i] != blocks[j]);
+  }
+
+  // After freeing all blocks, allocating the same number doesn't add a slab.
+  for (size_t i = 0; i < blocks.size(); ++i)
+    pool.deallocate(blocks[i], 32);
+  for (int i = 0; i < 5; ++i)
+    pool.allocate(32);
+  ASSERT_EQ(3, pool.getSlabCount());
+}
+
+TEST(TestSlabPool, AllocateShared)
+{
+  ptr_lib::shared_ptr<SlabPool> pool = ptr_lib::make_shared<SlabPool>(4);
+
+  vector<ptr_lib::shared_ptr<PooledValue> > values;
+  for (int i = 0; i < 4; ++i)
+    values.push_back(ptr_lib::allocate_shared<PooledValue>
+      (SlabAllocator<PooledValue>(pool), i));
+  size_t slabCount = pool->getSlabCount();
+  ASSERT_TRUE(slabCount > 0);
+
+  // Replacing the values at a steady rate reuses the freed blocks.
+  for (int n = 0; n < 100; ++n) {
+    values[n % 4].reset();
+    values[n % 4] = ptr_lib::allocate_shared<PooledValue>
+      (SlabAllocator<PooledValue>(pool), n);
+  }
+  ASSERT_EQ(slabCount, pool->getSlabCount());
+  ASSERT_EQ(99, values[3]->value_);
+
+  // The allocator keeps the pool alive while a value is allocated from it.
+  ptr_lib::weak_ptr<SlabPool> weakPool(pool);
+  pool.reset();
+  ASSERT_FALSE(weakPool.expired());
+  values.clear();
+  ASSERT_TRUE(weakPool.expired());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
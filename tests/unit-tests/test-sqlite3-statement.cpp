@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include "../../src/util/sqlite3-statement.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class TestSqlite3Statement : public ::testing::Test {
+public:
+  /**
+   * TestError is the exception type given to the Sqlite3StatementCache.
+   */
+  class TestError : public runtime_error {
+  public:
+    TestError(const string& message)
+    : runtime_error(message)
+    {
+    }
+  };
+
+  TestSqlite3Statement()
+  {
+    sqlite3_open(":memory:", &database_);
+    sqlite3_exec
+      (database_, "CREATE TABLE items(value INTEGER)", NULL, NULL, NULL);
+    cache_.reset(new Sqlite3StatementCache
+      (database_, &Sqlite3StatementCache::throwError<TestError>));
+  }
+
+  ~TestSqlite3Statement()
+  {
+    cache_.reset();
+    sqlite3_close(database_);
+  }
+
+  void
+  insert(int value)
+  {
+    Sqlite3Statement statement(*cache_, "INSERT INTO items (value) values (?)");
+    statement.bind(1, value);
+    statement.step();
+  }
+
+  int
+  count()
+  {
+    Sqlite3Statement statement(*cache_, "SELECT count(*) FROM items");
+    statement.step();
+    return statement.getInt(0);
+  }
+
+  sqlite3* database_;
+  ptr_lib::shared_ptr<Sqlite3StatementCache> cache_;
+};
+
+TEST_F(TestSqlite3Statement, ErrorType)
+{
+  ASSERT_THROW(cache_->prepare("SELECT bad syntax FROM"), TestError);
+  ASSERT_THROW(cache_->commitTransaction(), TestError);
+}
+
+TEST_F(TestSqlite3Statement, ReleaseOnException)
+{
+  sqlite3_stmt* first;
+  try {
+    Sqlite3Statement statement(*cache_, "SELECT count(*) FROM items");
+    first = statement;
+    throw runtime_error("Error while using the statement");
+  } catch (const runtime_error&) {
+  }
+
+  // The destructor returned the statement to the cache, so it is reused.
+  Sqlite3Statement statement(*cache_, "SELECT count(*) FROM items");
+  ASSERT_EQ(first, (sqlite3_stmt*)statement);
+}
+
+TEST_F(TestSqlite3Statement, TransactionGuard)
+{
+  try {
+    Sqlite3Transaction transaction(*cache_);
+    insert(1);
+    throw runtime_error("Error before commit");
+  } catch (const runtime_error&) {
+  }
+  // The destructor rolled back.
+  ASSERT_EQ(0, count());
+
+  {
+    Sqlite3Transaction transaction(*cache_);
+    insert(1);
+    transaction.commit();
+  }
+  ASSERT_EQ(1, count());
+  // The transaction is finished, so there is nothing to commit.
+  ASSERT_THROW(cache_->commitTransaction(), TestError);
+}
+
+TEST_F(TestSqlite3Statement, NestedRollback)
+{
+  cache_->beginTransaction();
+  insert(1);
+
+  cache_->beginTransaction();
+  insert(2);
+  cache_->rollbackTransaction();
+  ASSERT_EQ(1, count());
+
+  // Rolling back the nested transaction doesn't end the outer transaction.
+  insert(3);
+  ASSERT_NO_THROW(cache_->commitTransaction());
+  ASSERT_EQ(2, count());
+  ASSERT_THROW(cache_->commitTransaction(), TestError);
+
+  // A nested guard which is not committed only rolls back its own changes.
+  {
+    Sqlite3Transaction outer(*cache_);
+    insert(4);
+    {
+      Sqlite3Transaction inner(*cache_);
+      insert(5);
+    }
+    outer.commit();
+  }
+  ASSERT_EQ(3, count());
+}
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
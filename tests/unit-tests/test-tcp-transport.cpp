@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/ndn-cpp-config.h>
+
+#if NDN_CPP_HAVE_UNISTD_H
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/transport/tcp-transport.hpp>
+#include "../../src/encoding/element-listener.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class RecordingElementListener : public ElementListener {
+public:
+  virtual void
+  onReceivedElement(const uint8_t *element, size_t elementLength)
+  {
+    elements_.push_back(Blob(element, elementLength));
+  }
+
+  vector<Blob> elements_;
+};
+
+class TestTcpTransport : public ::testing::Test {
+public:
+  TestTcpTransport()
+  : listenSocket_(-1), serverSocket_(-1)
+  {
+  }
+
+  ~TestTcpTransport()
+  {
+    transport_.close();
+    if (serverSocket_ >= 0)
+      ::close(serverSocket_);
+    if (listenSocket_ >= 0)
+      ::close(listenSocket_);
+  }
+
+  /**
+   * Listen on the loopback interface, connect the transport and accept the
+   * connection as serverSocket_.
+   */
+  void
+  connect()
+  {
+    listenSocket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_TRUE(listenSocket_ >= 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ASSERT_EQ(0, ::bind
+      (listenSocket_, (struct sockaddr *)&address, sizeof(address)));
+    ASSERT_EQ(0, ::listen(listenSocket_, 1));
+    socklen_t addressLength = sizeof(address);
+    ASSERT_EQ(0, ::getsockname
+      (listenSocket_, (struct sockaddr *)&address, &addressLength));
+
+    // The listen backlog completes the connection before accept.
+    transport_.connect
+      (TcpTransport::ConnectionInfo("127.0.0.1", ntohs(address.sin_port)),
+       elementListener_, Transport::OnConnected());
+    serverSocket_ = ::accept(listenSocket_, 0, 0);
+    ASSERT_TRUE(serverSocket_ >= 0);
+  }
+
+  void
+  sendToClient(const uint8_t* data, size_t dataLength)
+  {
+    ASSERT_EQ(dataLength, ::send(serverSocket_, data, dataLength, 0));
+  }
+
+  int listenSocket_;
+  int serverSocket_;
+  TcpTransport transport_;
+  RecordingElementListener elementListener_;
+};
+
+TEST_F(TestTcpTransport, ProcessEventsDrainsSocket)
+{
+  connect();
+
+  // processEvents returns at once when there is no data.
+  transport_.processEvents();
+  ASSERT_EQ(0, elementListener_.elements_.size());
+
+  // Send more than the 64 KiB receive buffer in one write so that one
+  // processEvents must loop over several non-blocking recv calls.
+  const int nPackets = 100;
+  vector<uint8_t> stream;
+  for (int i = 0; i < nPackets; ++i) {
+    Data data(Name("/test").appendSegment(i));
+    data.setContent(Blob(vector<uint8_t>(1000, (uint8_t)i)));
+    Blob encoding = data.wireEncode();
+    stream.insert(stream.end(), encoding.buf(), encoding.buf() + encoding.size());
+  }
+  ASSERT_TRUE(stream.size() > 64 * 1024);
+  sendToClient(&stream[0], stream.size());
+  // Give the loopback interface time to deliver the bytes.
+  usleep(10000);
+
+  transport_.processEvents();
+  ASSERT_EQ(nPackets, elementListener_.elements_.size());
+  for (int i = 0; i < nPackets; ++i) {
+    Data data;
+    data.wireDecode(elementListener_.elements_[i]);
+    ASSERT_EQ(Name("/test").appendSegment(i), data.getName());
+  }
+}
+
+TEST_F(TestTcpTransport, ReceiveSplitElement)
+{
+  connect();
+
+  Data data(Name("/test/split"));
+  data.setContent(Blob(vector<uint8_t>(3000, 0x55)));
+  Blob encoding = data.wireEncode();
+
+  // Send the first part. processEvents keeps the partial element.
+  sendToClient(encoding.buf(), 1000);
+  usleep(10000);
+  transport_.processEvents();
+  ASSERT_EQ(0, elementListener_.elements_.size());
+
+  sendToClient(encoding.buf() + 1000, encoding.size() - 1000);
+  for (int i = 0; i < 1000 && elementListener_.elements_.size() < 1; ++i) {
+    transport_.processEvents();
+    usleep(1000);
+  }
+  ASSERT_EQ(1, elementListener_.elements_.size());
+  ASSERT_TRUE(encoding.equals(elementListener_.elements_[0]));
+
+  // When the peer closes the connection, processEvents returns without error.
+  ::close(serverSocket_);
+  serverSocket_ = -1;
+  usleep(10000);
+  ASSERT_NO_THROW(transport_.processEvents());
+}
+
+#else // NDN_CPP_HAVE_UNISTD_H
+
+TEST(TestTcpTransport, NoUnixSockets)
+{
+}
+
+#endif // NDN_CPP_HAVE_UNISTD_H
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -182,6 +182,60 @@ TEST_F(TestTrustAnchorContainer, DynamicAnchorFromDirectory)
   ASSERT_EQ(0, anchorContainer.getGroup("group").size());
 }
 
+/**
+ * Call anchorContainer.find(keyName), which refreshes the dynamic groups whose
+ * refresh period has expired, until the anchor is found (or not found) as
+ * expected, or until the timeout.
+ * @param refreshPeriod The refresh period of the dynamic group in milliseconds.
+ * @return True if the anchor is found (or not found) as expected.
+ */
+static bool
+pollFind
+  (const TrustAnchorContainer& anchorContainer, const Name& keyName,
+   bool expectFound, Milliseconds refreshPeriod)
+{
+  for (int i = 0; i < 200; ++i) {
+    // Wait for the refresh period to expire.
+    usleep((useconds_t)(refreshPeriod * 1000) + 1000);
+    if (!!anchorContainer.find(keyName) == expectFound)
+      return true;
+  }
+
+  return false;
+}
+
+TEST_F(TestTrustAnchorContainer, DynamicAnchorChangedFiles)
+{
+  const Milliseconds refreshPeriod = 10.0;
+  anchorContainer.insert("group", certificateDirectoryPath, refreshPeriod, true);
+  ASSERT_EQ(2, anchorContainer.getGroup("group").size());
+
+  // Overwrite the first file with the second certificate.
+  fixture.saveCertificateToFile(*certificate2, certificatePath1);
+  ASSERT_TRUE(pollFind
+    (anchorContainer, identity1->getName(), false, refreshPeriod));
+  ASSERT_TRUE(!!anchorContainer.find(identity2->getName()));
+  ASSERT_EQ(1, anchorContainer.getGroup("group").size());
+
+  // The second certificate is still in the first file. This waits for one
+  // refresh which should keep it.
+  remove(certificatePath2.c_str());
+  ASSERT_TRUE(pollFind
+    (anchorContainer, identity2->getName(), true, refreshPeriod));
+  ASSERT_EQ(1, anchorContainer.getGroup("group").size());
+
+  // A file which is not a certificate is ignored.
+  {
+    ofstream file(certificatePath2.c_str());
+    file << "not a certificate";
+  }
+  fixture.saveCertificateToFile(*certificate1, certificatePath1);
+  ASSERT_TRUE(pollFind
+    (anchorContainer, identity1->getName(), true, refreshPeriod));
+  ASSERT_TRUE(!anchorContainer.find(identity2->getName()));
+  ASSERT_EQ(1, anchorContainer.getGroup("group").size());
+}
+
 TEST_F(TestTrustAnchorContainer, FindByInterest)
 {
   anchorContainer.insert("group1", certificatePath1, 400.0);
@@ -0,0 +1,342 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include "gtest/gtest.h"
+#include <ndn-cpp/ndn-cpp-config.h>
+
+#if NDN_CPP_HAVE_UNISTD_H
+
+#include <string.h>
+#include <stdexcept>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <ndn-cpp/data.hpp>
+#include <ndn-cpp/transport/udp-transport.hpp>
+#include <ndn-cpp/lite/transport/udp-transport-lite.hpp>
+#include <ndn-cpp/lite/util/dynamic-malloc-uint8-array-lite.hpp>
+#include <ndn-cpp/lite/encoding/tlv-0_2-wire-format-lite.hpp>
+#include "../../src/encoding/element-listener.hpp"
+#include "../../src/lp/lp-reassembler.hpp"
+
+using namespace std;
+using namespace ndn;
+
+class RecordingElementListener : public ElementListener {
+public:
+  virtual void
+  onReceivedElement(const uint8_t *element, size_t elementLength)
+  {
+    elements_.push_back(Blob(element, elementLength));
+  }
+
+  vector<Blob> elements_;
+};
+
+class RecordingElementListenerLite : public ElementListenerLite {
+public:
+  RecordingElementListenerLite()
+  : ElementListenerLite(&onReceivedElement)
+  {
+  }
+
+  static void
+  onReceivedElement
+    (ElementListenerLite *self, const uint8_t *element, size_t elementLength)
+  {
+    ((RecordingElementListenerLite*)self)->elements_.push_back
+      (Blob(element, elementLength));
+  }
+
+  vector<Blob> elements_;
+};
+
+class TestUdpTransport : public ::testing::Test {
+public:
+  TestUdpTransport()
+  : serverSocket_(-1), serverPort_(0), clientAddressLength_(0)
+  {
+  }
+
+  ~TestUdpTransport()
+  {
+    transport_.close();
+    if (serverSocket_ >= 0)
+      ::close(serverSocket_);
+  }
+
+  /**
+   * Bind a server socket on the loopback interface, connect the transport to
+   * it and send one datagram from the transport so that the server learns the
+   * transport's address.
+   */
+  void
+  connect()
+  {
+    bindServer();
+    transport_.connect
+      (UdpTransport::ConnectionInfo("127.0.0.1", serverPort_),
+       elementListener_, Transport::OnConnected());
+    uint8_t hello = 0;
+    transport_.send(&hello, 1);
+    receiveHello();
+  }
+
+  /**
+   * Bind a server socket on the loopback interface and set serverPort_.
+   */
+  void
+  bindServer()
+  {
+    serverSocket_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_TRUE(serverSocket_ >= 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ASSERT_EQ(0, ::bind
+      (serverSocket_, (struct sockaddr *)&address, sizeof(address)));
+    socklen_t addressLength = sizeof(address);
+    ASSERT_EQ(0, ::getsockname
+      (serverSocket_, (struct sockaddr *)&address, &addressLength));
+    serverPort_ = ntohs(address.sin_port);
+  }
+
+  /**
+   * Receive the one-byte datagram sent by the client and save its address.
+   */
+  void
+  receiveHello()
+  {
+    clientAddressLength_ = sizeof(clientAddress_);
+    uint8_t buffer[10];
+    ASSERT_EQ(1, ::recvfrom
+      (serverSocket_, buffer, sizeof(buffer), 0,
+       (struct sockaddr *)&clientAddress_, &clientAddressLength_));
+  }
+
+  void
+  sendToClient(const uint8_t* data, size_t dataLength)
+  {
+    ASSERT_EQ(dataLength, ::sendto
+      (serverSocket_, data, dataLength, 0, (struct sockaddr *)&clientAddress_,
+       clientAddressLength_));
+  }
+
+  int serverSocket_;
+  unsigned short serverPort_;
+  struct sockaddr_storage clientAddress_;
+  socklen_t clientAddressLength_;
+  UdpTransport transport_;
+  RecordingElementListener elementListener_;
+};
+
+TEST_F(TestUdpTransport, ReceiveBatch)
+{
+  transport_.setReceiveBufferSize(1024 * 1024);
+  connect();
+
+  // Send more datagrams than one batch, with an oversize datagram in the
+  // middle which should be dropped.
+  const int nPackets = 100;
+  for (int i = 0; i < nPackets; ++i) {
+    Data data(Name("/test").appendSegment(i));
+    data.setContent(Blob(vector<uint8_t>(1000, (uint8_t)i)));
+    Blob encoding = data.wireEncode();
+    sendToClient(encoding.buf(), encoding.size());
+
+    if (i == nPackets / 2) {
+      vector<uint8_t> oversize(MAX_NDN_PACKET_SIZE + 100, 0x55);
+      sendToClient(&oversize[0], oversize.size());
+    }
+  }
+
+  for (int i = 0;
+       i < 1000 && elementListener_.elements_.size() < nPackets; ++i) {
+    transport_.processEvents();
+    usleep(1000);
+  }
+
+  ASSERT_EQ(nPackets, elementListener_.elements_.size());
+  for (int i = 0; i < nPackets; ++i) {
+    Data data;
+    data.wireDecode(elementListener_.elements_[i]);
+    ASSERT_EQ(Name("/test").appendSegment(i), data.getName());
+    ASSERT_EQ(1000, data.getContent().size());
+  }
+}
+
+TEST_F(TestUdpTransport, ReceiveOneAtATime)
+{
+  // A buffer with room for only one packet receives one datagram at a time.
+  // An oversize datagram should be dropped, the same as in a batch.
+  DynamicMallocUInt8ArrayLite elementBuffer(1000);
+  UdpTransportLite transport(elementBuffer);
+  RecordingElementListenerLite elementListener;
+  bindServer();
+  ASSERT_EQ(NDN_ERROR_success, transport.connect
+    ("127.0.0.1", serverPort_, elementListener));
+  uint8_t hello = 0;
+  ASSERT_EQ(NDN_ERROR_success, transport.send(&hello, 1));
+  receiveHello();
+
+  const int nPackets = 3;
+  for (int i = 0; i < nPackets; ++i) {
+    Data data(Name("/test").appendSegment(i));
+    Blob encoding = data.wireEncode();
+    sendToClient(encoding.buf(), encoding.size());
+
+    if (i == 0) {
+      vector<uint8_t> oversize(MAX_NDN_PACKET_SIZE + 100, 0x55);
+      sendToClient(&oversize[0], oversize.size());
+    }
+  }
+
+  vector<uint8_t> buffer(MAX_NDN_PACKET_SIZE);
+  for (int i = 0;
+       i < 1000 && elementListener.elements_.size() < nPackets; ++i) {
+    ASSERT_EQ(NDN_ERROR_success, transport.processEvents
+      (&buffer[0], buffer.size()));
+    usleep(1000);
+  }
+  transport.close();
+
+  ASSERT_EQ(nPackets, elementListener.elements_.size());
+  for (int i = 0; i < nPackets; ++i) {
+    Data data;
+    data.wireDecode(elementListener.elements_[i]);
+    ASSERT_EQ(Name("/test").appendSegment(i), data.getName());
+  }
+}
+
+TEST_F(TestUdpTransport, SendFragments)
+{
+  const size_t mtu = 1000;
+  ASSERT_THROW(transport_.setMtu(10), runtime_error);
+  transport_.setMtu(mtu);
+  connect();
+
+  Data data(Name("/test/fragments"));
+  data.setContent(Blob(vector<uint8_t>(3500, 0x55)));
+  Blob encoding = data.wireEncode();
+  transport_.send(encoding.buf(), encoding.size());
+
+  // Receive each fragment and reassemble.
+  LpReassembler reassembler;
+  Blob reassembledPacket;
+  ptr_lib::shared_ptr<LpPacket> header;
+  vector<uint8_t> buffer(2 * mtu);
+  uint64_t expectedSequence = 0;
+  size_t expectedFragCount = 0;
+  for (size_t fragIndex = 0; !header; ++fragIndex) {
+    ssize_t nBytes = ::recv(serverSocket_, &buffer[0], buffer.size(), 0);
+    ASSERT_TRUE(nBytes > 0);
+    ASSERT_TRUE((size_t)nBytes <= mtu);
+
+    struct ndn_LpPacketHeaderField headerFields[5];
+    LpPacketLite lpPacket(headerFields, 5);
+    ASSERT_EQ(NDN_ERROR_success, Tlv0_2WireFormatLite::decodeLpPacket
+      (lpPacket, &buffer[0], nBytes));
+    ASSERT_TRUE(lpPacket.getHasSequence());
+    ASSERT_EQ(fragIndex, lpPacket.getFragIndex());
+    if (fragIndex == 0) {
+      expectedSequence = lpPacket.getSequence();
+      expectedFragCount = lpPacket.getFragCount();
+      ASSERT_EQ(4, expectedFragCount);
+    }
+    // The fragments of one packet have consecutive Sequence numbers.
+    ASSERT_EQ(expectedSequence + fragIndex, lpPacket.getSequence());
+    ASSERT_EQ(expectedFragCount, lpPacket.getFragCount());
+
+    header = reassembler.receiveFragment(lpPacket, reassembledPacket);
+    if (!header)
+      ASSERT_TRUE(fragIndex + 1 < expectedFragCount);
+  }
+
+  ASSERT_TRUE(encoding.equals(reassembledPacket));
+
+  // A packet which fits in the MTU is sent without the LpPacket.
+  Data smallData(Name("/test/small"));
+  Blob smallEncoding = smallData.wireEncode();
+  transport_.send(smallEncoding.buf(), smallEncoding.size());
+  ssize_t nBytes = ::recv(serverSocket_, &buffer[0], buffer.size(), 0);
+  ASSERT_TRUE(smallEncoding.equals(Blob(&buffer[0], nBytes)));
+}
+
+/**
+ * Encode an LpPacket with a fragment of fragmentSize bytes and the FragIndex
+ * and FragCount with their largest encoding.
+ * @return The encoding length.
+ */
+static size_t
+encodeLargestLpPacket(size_t fragmentSize)
+{
+  vector<uint8_t> fragment(fragmentSize, 0x55);
+  LpPacketLite lpPacket(0, 0);
+  lpPacket.setSequence(0);
+  lpPacket.setFragIndex((uint64_t)1 << 32);
+  lpPacket.setFragCount(((uint64_t)1 << 32) + 1);
+  lpPacket.setFragmentWireEncoding(BlobLite(&fragment[0], fragment.size()));
+
+  DynamicMallocUInt8ArrayLite output(fragmentSize + 100);
+  size_t encodingLength;
+  if (Tlv0_2WireFormatLite::encodeLpPacket(lpPacket, output, &encodingLength))
+    throw runtime_error("Error encoding the LpPacket");
+  return encodingLength;
+}
+
+TEST_F(TestUdpTransport, MaxFragmentSize)
+{
+  ASSERT_EQ(0, UdpTransport::getMaxFragmentSize(10));
+
+  // Check MTUs around where the TLV length fields grow from 1 to 3 bytes and
+  // from 3 to 5 bytes.
+  const size_t mtus[] = {
+    100, 252, 253, 290, 291, 292, 300, 65535, 65536, 65569, 65570, 65571,
+    65572, 65600, 70000
+  };
+  for (size_t i = 0; i < sizeof(mtus) / sizeof(mtus[0]); ++i) {
+    size_t mtu = mtus[i];
+    size_t maxFragmentSize = UdpTransport::getMaxFragmentSize(mtu);
+    ASSERT_TRUE(maxFragmentSize > 0);
+    ASSERT_TRUE(encodeLargestLpPacket(maxFragmentSize) <= mtu) <<
+      "The fragment exceeds MTU " << mtu;
+    ASSERT_TRUE(encodeLargestLpPacket(maxFragmentSize + 1) > mtu) <<
+      "The fragment is not the largest for MTU " << mtu;
+  }
+}
+
+#else // NDN_CPP_HAVE_UNISTD_H
+
+TEST(TestUdpTransport, NoUnixSockets)
+{
+}
+
+#endif // NDN_CPP_HAVE_UNISTD_H
+
+int
+main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -436,6 +436,55 @@ TEST_F(TestValidationPolicyCommandInterest, LimitedRecords)
     "Should succeed despite timestamp is reordered, because the record has been evicted");
 }
 
+TEST_F(TestValidationPolicyCommandInterest, LimitedRecordsRefresh)
+{
+  fixture_.reset(new ValidationPolicyCommandInterestFixture
+    (ValidationPolicyCommandInterest::Options(15 * 1000.0, 3)));
+
+  ptr_lib::shared_ptr<PibIdentity> identity1 = fixture_->addSubCertificate
+    ("/Security/V2/ValidatorFixture/Sub1", fixture_->identity_);
+  fixture_->cache_.insert(*identity1->getDefaultKey()->getDefaultCertificate());
+  ptr_lib::shared_ptr<PibIdentity> identity2 = fixture_->addSubCertificate
+    ("/Security/V2/ValidatorFixture/Sub2", fixture_->identity_);
+  fixture_->cache_.insert(*identity2->getDefaultKey()->getDefaultCertificate());
+  ptr_lib::shared_ptr<PibIdentity> identity3 = fixture_->addSubCertificate
+    ("/Security/V2/ValidatorFixture/Sub3", fixture_->identity_);
+  fixture_->cache_.insert(*identity3->getDefaultKey()->getDefaultCertificate());
+  ptr_lib::shared_ptr<PibIdentity> identity4 = fixture_->addSubCertificate
+    ("/Security/V2/ValidatorFixture/Sub4", fixture_->identity_);
+  fixture_->cache_.insert(*identity4->getDefaultKey()->getDefaultCertificate());
+
+  // Signed at 0 seconds.
+  ptr_lib::shared_ptr<Interest> interest00 = fixture_->makeCommandInterest
+    (identity1);
+  ptr_lib::shared_ptr<Interest> interest1 = fixture_->makeCommandInterest
+    (identity2);
+  ptr_lib::shared_ptr<Interest> interest2 = fixture_->makeCommandInterest
+    (identity3);
+  ptr_lib::shared_ptr<Interest> interest3 = fixture_->makeCommandInterest
+    (identity4);
+  // Signed at +1 seconds.
+  fixture_->setNowOffsetMilliseconds(1 * 1000.0);
+  ptr_lib::shared_ptr<Interest> interest01 = fixture_->makeCommandInterest
+    (identity1);
+
+  validateExpectSuccess(*interest00, "Should succeed");
+
+  validateExpectSuccess(*interest1, "Should succeed");
+
+  validateExpectSuccess(*interest2, "Should succeed");
+
+  validateExpectSuccess(*interest01, "Should succeed, refreshes identity1");
+
+  validateExpectSuccess(*interest3, "Should succeed, forgets identity2");
+
+  validateExpectFailure(*interest00,
+    "Should fail, timestamp is reordered because identity1 was refreshed");
+
+  validateExpectSuccess(*interest1,
+    "Should succeed despite timestamp is reordered, because the record has been evicted");
+}
+
 TEST_F(TestValidationPolicyCommandInterest, UnlimitedRecords)
 {
   fixture_.reset(new ValidationPolicyCommandInterestFixture
@@ -296,6 +296,30 @@ TEST_F(TestValidator, TrustedCertificateCaching)
   fixture_.face_.sentInterests_.clear();
 }
 
+TEST_F(TestValidator, TrustAnchorOfCachedCertificate)
+{
+  Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data"));
+  fixture_.keyChain_.sign(data, SigningInfo(fixture_.subIdentity_));
+  validateExpectSuccess
+    (data, "Should get accepted, as signed by the policy-compliant certificate");
+
+  const CertificateV2& subCertificate =
+    *fixture_.subIdentity_->getDefaultKey()->getDefaultCertificate();
+  const Name& anchorName =
+    fixture_.identity_->getDefaultKey()->getDefaultCertificate()->getName();
+  ASSERT_TRUE(fixture_.validator_.getVerifiedCertificateCache()
+    .getTrustAnchorName(subCertificate.getName()).equals(anchorName));
+
+  // The chain stops at the verified certificate, which keeps its trust anchor.
+  Name trustAnchorName;
+  ptr_lib::shared_ptr<CertificateV2> found =
+    fixture_.validator_.findTrustedCertificate
+      (Interest(subCertificate.getName()), trustAnchorName);
+  ASSERT_TRUE(!!found);
+  ASSERT_TRUE(found->getName().equals(subCertificate.getName()));
+  ASSERT_TRUE(trustAnchorName.equals(anchorName));
+}
+
 TEST_F(TestValidator, ResetVerifiedCertificates)
 {
   Data data(Name("/Security/V2/ValidatorFixture/Sub1/Sub2/Data"));
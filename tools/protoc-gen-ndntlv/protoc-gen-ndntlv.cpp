@@ -0,0 +1,699 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+/**
+ * protoc-gen-ndntlv is a protoc plugin which generates type-specialized NDN-TLV
+ * encode and decode functions for the messages in a .proto file, with the same
+ * wire format as the reflection-based ProtobufTlv. Use it with:
+ * protoc --plugin=protoc-gen-ndntlv=/path/to/protoc-gen-ndntlv --ndntlv_out=. my.proto
+ * For my.proto, this writes my.tlv.h and my.tlv.cc. See ProtobufTlvCodec.
+ *
+ * This only needs libprotobuf (not libprotoc), so it reads the
+ * CodeGeneratorRequest and writes the CodeGeneratorResponse using the Protobuf
+ * wire format directly.
+ */
+
+#include <ndn-cpp/ndn-cpp-config.h>
+#include <iostream>
+
+#if NDN_CPP_HAVE_PROTOBUF
+
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using namespace std;
+using namespace google::protobuf;
+using google::protobuf::internal::WireFormatLite;
+
+// The field numbers in google/protobuf/compiler/plugin.proto.
+static const int REQUEST_FILE_TO_GENERATE = 1;
+static const int REQUEST_PROTO_FILE = 15;
+static const int RESPONSE_ERROR = 1;
+static const int RESPONSE_SUPPORTED_FEATURES = 2;
+static const int RESPONSE_FILE = 15;
+static const int RESPONSE_FILE_NAME = 1;
+static const int RESPONSE_FILE_CONTENT = 15;
+static const uint64_t FEATURE_PROTO3_OPTIONAL = 1;
+
+/**
+ * A GeneratorError is thrown for a .proto file that we can't generate code for.
+ */
+class GeneratorError : public runtime_error {
+public:
+  GeneratorError(const string& message)
+  : runtime_error(message)
+  {
+  }
+};
+
+static const char* cppKeywords[] = {
+  "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+  "bool", "break", "case", "catch", "char", "class", "compl", "const",
+  "constexpr", "const_cast", "continue", "decltype", "default", "delete", "do",
+  "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern",
+  "false", "float", "for", "friend", "goto", "if", "inline", "int", "long",
+  "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+  "operator", "or", "or_eq", "private", "protected", "public", "register",
+  "reinterpret_cast", "return", "short", "signed", "sizeof", "static",
+  "static_assert", "static_cast", "struct", "switch", "template", "this",
+  "thread_local", "throw", "true", "try", "typedef", "typeid", "typename",
+  "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t",
+  "while", "xor", "xor_eq"
+};
+
+/**
+ * Get the name that protoc's C++ generator uses for the field's accessors.
+ */
+static string
+fieldName(const FieldDescriptor* field)
+{
+  static set<string> keywords
+    (cppKeywords, cppKeywords + sizeof(cppKeywords) / sizeof(cppKeywords[0]));
+
+  string result = field->name();
+  for (size_t i = 0; i < result.size(); ++i)
+    result[i] = tolower(result[i]);
+  if (keywords.count(result) > 0)
+    result += "_";
+  return result;
+}
+
+/**
+ * Get the C++ class name of the message type, relative to its package
+ * namespace, such as Outer_Inner for a nested message.
+ */
+static string
+className(const Descriptor* descriptor)
+{
+  if (descriptor->containing_type())
+    return className(descriptor->containing_type()) + "_" + descriptor->name();
+  else
+    return descriptor->name();
+}
+
+/**
+ * Get the fully-qualified C++ name of the enum type.
+ */
+static string
+enumName(const EnumDescriptor* descriptor)
+{
+  string name = descriptor->name();
+  if (descriptor->containing_type())
+    name = className(descriptor->containing_type()) + "_" + name;
+
+  string package = descriptor->file()->package();
+  string result = "::";
+  for (size_t i = 0; i < package.size(); ++i) {
+    if (package[i] == '.')
+      result += "::";
+    else
+      result += package[i];
+  }
+  if (!package.empty())
+    result += "::";
+  return result + name;
+}
+
+static string
+stripProto(const string& fileName)
+{
+  if (fileName.size() > 6 &&
+      fileName.compare(fileName.size() - 6, 6, ".proto") == 0)
+    return fileName.substr(0, fileName.size() - 6);
+  else
+    return fileName;
+}
+
+/**
+ * Get all message types in the file, with nested types before the types which
+ * contain them.
+ */
+static void
+getMessages(const Descriptor* descriptor, vector<const Descriptor*>& messages)
+{
+  for (int i = 0; i < descriptor->nested_type_count(); ++i)
+    getMessages(descriptor->nested_type(i), messages);
+  messages.push_back(descriptor);
+}
+
+/**
+ * Check if the field tracks presence with a generated has_ method, the same as
+ * FieldDescriptor::has_presence.
+ */
+static bool
+hasPresence(const FieldDescriptor* field)
+{
+#if NDN_CPP_HAVE_PROTOBUF_HAS_PRESENCE
+  return field->has_presence();
+#else
+  // Before Protobuf 3.12 there is no proto3 optional, so a singular field has
+  // presence if it is proto2, a message or a member of a oneof.
+  if (field->is_repeated())
+    return false;
+  return field->file()->syntax() == FileDescriptor::SYNTAX_PROTO2 ||
+         field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE ||
+         field->containing_oneof() != 0;
+#endif
+}
+
+/**
+ * Get the C++ expression to test whether the non-repeated field is present,
+ * the same as Reflection::HasField.
+ */
+static string
+hasField(const FieldDescriptor* field)
+{
+  string name = fieldName(field);
+  if (hasPresence(field))
+    return "message.has_" + name + "()";
+  else if (field->type() == FieldDescriptor::TYPE_BYTES ||
+           field->type() == FieldDescriptor::TYPE_STRING)
+    return "!message." + name + "().empty()";
+  else if (field->type() == FieldDescriptor::TYPE_BOOL)
+    return "message." + name + "()";
+  else
+    return "message." + name + "() != 0";
+}
+
+static bool
+isSupportedType(FieldDescriptor::Type type)
+{
+  return type == FieldDescriptor::TYPE_MESSAGE ||
+         type == FieldDescriptor::TYPE_UINT32 ||
+         type == FieldDescriptor::TYPE_UINT64 ||
+         type == FieldDescriptor::TYPE_ENUM ||
+         type == FieldDescriptor::TYPE_BYTES ||
+         type == FieldDescriptor::TYPE_STRING ||
+         type == FieldDescriptor::TYPE_BOOL;
+}
+
+/**
+ * Write the code to add the encoding length of one value of the field to
+ * "length", where value is the C++ expression for the value.
+ */
+static void
+writeValueLength
+  (ostream& out, const string& indent, const FieldDescriptor* field,
+   const string& value)
+{
+  int type = field->number();
+  switch (field->type()) {
+  case FieldDescriptor::TYPE_MESSAGE:
+    out << indent << "{\n"
+        << indent << "  size_t valueLength = tlvValueLength(" << value << ");\n"
+        << indent << "  length += ProtobufTlvCodec::Encoder::sizeOfTypeAndLength\n"
+        << indent << "    (" << type << ", valueLength) + valueLength;\n"
+        << indent << "}\n";
+    break;
+  case FieldDescriptor::TYPE_UINT32:
+  case FieldDescriptor::TYPE_UINT64:
+    out << indent << "length += ProtobufTlvCodec::Encoder::sizeOfNonNegativeIntegerTlv\n"
+        << indent << "  (" << type << ", (uint64_t)" << value << ");\n";
+    break;
+  case FieldDescriptor::TYPE_ENUM:
+    out << indent << "length += ProtobufTlvCodec::Encoder::sizeOfNonNegativeIntegerTlv\n"
+        << indent << "  (" << type << ", enumTlvValue(" << value << "));\n";
+    break;
+  case FieldDescriptor::TYPE_BYTES:
+  case FieldDescriptor::TYPE_STRING:
+    out << indent << "length += ProtobufTlvCodec::Encoder::sizeOfBlobTlv\n"
+        << indent << "  (" << type << ", " << value << ".size());\n";
+    break;
+  case FieldDescriptor::TYPE_BOOL:
+    out << indent << "if (" << value << ")\n"
+        << indent << "  length += ProtobufTlvCodec::Encoder::sizeOfTypeAndLength("
+        << type << ", 0);\n";
+    break;
+  default:
+    out << indent << "throw runtime_error(\"ProtobufTlv::encode: Unknown "
+        << (field->is_repeated() ? "repeated " : "") << "field type\");\n";
+  }
+}
+
+/**
+ * Write the code to encode one value of the field, where value is the C++
+ * expression for the value.
+ */
+static void
+writeEncodeValue
+  (ostream& out, const string& indent, const FieldDescriptor* field,
+   const string& value)
+{
+  int type = field->number();
+  switch (field->type()) {
+  case FieldDescriptor::TYPE_MESSAGE:
+    out << indent << "encoder.writeTypeAndLength(" << type << ", tlvValueLength("
+        << value << "));\n"
+        << indent << "encodeTlvValue(" << value << ", encoder);\n";
+    break;
+  case FieldDescriptor::TYPE_UINT32:
+  case FieldDescriptor::TYPE_UINT64:
+    out << indent << "encoder.writeNonNegativeIntegerTlv(" << type
+        << ", (uint64_t)" << value << ");\n";
+    break;
+  case FieldDescriptor::TYPE_ENUM:
+    out << indent << "encoder.writeNonNegativeIntegerTlv(" << type
+        << ", enumTlvValue(" << value << "));\n";
+    break;
+  case FieldDescriptor::TYPE_BYTES:
+  case FieldDescriptor::TYPE_STRING:
+    out << indent << "encoder.writeBlobTlv(" << type << ", " << value << ");\n";
+    break;
+  case FieldDescriptor::TYPE_BOOL:
+    out << indent << "if (" << value << ")\n"
+        << indent << "  encoder.writeTypeAndLength(" << type << ", 0);\n";
+    break;
+  default:
+    out << indent << "throw runtime_error(\"ProtobufTlv::encode: Unknown "
+        << (field->is_repeated() ? "repeated " : "") << "field type\");\n";
+  }
+}
+
+/**
+ * Write the code to decode one value of the field and set it in the message,
+ * or add it if the field is repeated.
+ */
+static void
+writeDecodeValue
+  (ostream& out, const string& indent, const FieldDescriptor* field)
+{
+  int type = field->number();
+  string name = fieldName(field);
+  string setter = (field->is_repeated() ? "add_" : "set_") + name;
+  switch (field->type()) {
+  case FieldDescriptor::TYPE_MESSAGE:
+    out << indent << "size_t innerEndOffset = decoder.readNestedTlvsStart("
+        << type << ");\n"
+        << indent << "decodeTlvValue\n"
+        << indent << "  (*message." << (field->is_repeated() ? "add_" : "mutable_")
+        << name << "(), decoder, innerEndOffset);\n"
+        << indent << "decoder.finishNestedTlvs(innerEndOffset);\n";
+    break;
+  case FieldDescriptor::TYPE_UINT32:
+    out << indent << "message." << setter
+        << "((uint32_t)decoder.readNonNegativeIntegerTlv(" << type << "));\n";
+    break;
+  case FieldDescriptor::TYPE_UINT64:
+    out << indent << "message." << setter
+        << "(decoder.readNonNegativeIntegerTlv(" << type << "));\n";
+    break;
+  case FieldDescriptor::TYPE_ENUM: {
+    string enumType = enumName(field->enum_type());
+    out << indent << "uint64_t value = decoder.readNonNegativeIntegerTlv("
+        << type << ");\n"
+        << indent << "if (value > INT_MAX || !" << enumType
+        << "_IsValid((int)value))\n"
+        << indent << "  throw runtime_error(\"ProtobufTlv::decode: Unrecognized ENUM value\");\n"
+        << indent << "message." << setter << "((" << enumType << ")value);\n";
+    break;
+  }
+  case FieldDescriptor::TYPE_BYTES:
+  case FieldDescriptor::TYPE_STRING:
+    out << indent << "struct ndn_Blob value = decoder.readBlobTlv(" << type
+        << ");\n"
+        << indent << "message." << setter
+        << "((const char*)value.value, value.length);\n";
+    break;
+  case FieldDescriptor::TYPE_BOOL:
+    out << indent << "message." << setter << "(decoder.readBooleanTlv("
+        << type << ", endOffset));\n";
+    break;
+  default:
+    out << indent << "throw runtime_error(\"ProtobufTlv::decode: Unknown "
+        << (field->is_repeated() ? "repeated " : "") << "field type\");\n";
+  }
+}
+
+/**
+ * Write the tlvValueLength, encodeTlvValue and decodeTlvValue functions for the
+ * message type.
+ */
+static void
+writeMessageFunctions(ostream& out, const Descriptor* descriptor)
+{
+  string name = className(descriptor);
+
+  out << "static size_t\n"
+      << "tlvValueLength(const " << name << "& message)\n"
+      << "{\n"
+      << "  size_t length = 0;\n";
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    string fieldNameString = fieldName(field);
+    if (field->is_repeated()) {
+      out << "  for (int i = 0; i < message." << fieldNameString
+          << "_size(); ++i) {\n";
+      writeValueLength
+        (out, "    ", field, "message." + fieldNameString + "(i)");
+      out << "  }\n";
+    }
+    else {
+      out << "  if (" << hasField(field) << ") {\n";
+      writeValueLength(out, "    ", field, "message." + fieldNameString + "()");
+      out << "  }\n";
+    }
+  }
+  out << "  return length;\n"
+      << "}\n\n";
+
+  out << "static void\n"
+      << "encodeTlvValue(const " << name
+      << "& message, ProtobufTlvCodec::Encoder& encoder)\n"
+      << "{\n";
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    string fieldNameString = fieldName(field);
+    if (field->is_repeated()) {
+      out << "  for (int i = 0; i < message." << fieldNameString
+          << "_size(); ++i) {\n";
+      writeEncodeValue
+        (out, "    ", field, "message." + fieldNameString + "(i)");
+      out << "  }\n";
+    }
+    else {
+      out << "  if (" << hasField(field) << ") {\n";
+      writeEncodeValue(out, "    ", field, "message." + fieldNameString + "()");
+      out << "  }\n";
+    }
+  }
+  out << "}\n\n";
+
+  // Decode the fields in the same order as ProtobufTlv::decode.
+  out << "static void\n"
+      << "decodeTlvValue\n"
+      << "  (" << name << "& message, ProtobufTlvCodec::Decoder& decoder,\n"
+      << "   size_t endOffset)\n"
+      << "{\n";
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_repeated()) {
+      out << "  while (decoder.peekType(" << field->number()
+          << ", endOffset)) {\n";
+      writeDecodeValue(out, "    ", field);
+      out << "  }\n";
+    }
+    else if (field->is_optional()) {
+      out << "  if (decoder.peekType(" << field->number() << ", endOffset)) {\n";
+      writeDecodeValue(out, "    ", field);
+      out << "  }\n";
+    }
+    else {
+      out << "  {\n";
+      writeDecodeValue(out, "    ", field);
+      out << "  }\n";
+    }
+  }
+  out << "}\n\n";
+}
+
+/**
+ * Generate the .tlv.h and .tlv.cc for the file.
+ * @param file The file descriptor.
+ * @param header Set this to the header contents.
+ * @param source Set this to the source contents.
+ * @throws GeneratorError if the file has a field which we can't generate code
+ * for.
+ */
+static void
+generate(const FileDescriptor* file, string& header, string& source)
+{
+  string baseName = stripProto(file->name());
+  vector<const Descriptor*> messages;
+  for (int i = 0; i < file->message_type_count(); ++i)
+    getMessages(file->message_type(i), messages);
+
+  bool hasEnum = false;
+  for (size_t i = 0; i < messages.size(); ++i) {
+    for (int j = 0; j < messages[i]->field_count(); ++j) {
+      const FieldDescriptor* field = messages[i]->field(j);
+      if (field->is_map())
+        throw GeneratorError
+          (file->name() + ": " + field->full_name() +
+           ": Map fields are not supported by ProtobufTlv");
+      if (field->type() == FieldDescriptor::TYPE_ENUM)
+        hasEnum = true;
+    }
+  }
+
+  vector<string> namespaces;
+  string package = file->package();
+  for (size_t start = 0; !package.empty(); ) {
+    size_t end = package.find('.', start);
+    namespaces.push_back(package.substr(start, end - start));
+    if (end == string::npos)
+      break;
+    start = end + 1;
+  }
+
+  string guard = "NDN_PROTOBUF_TLV_" + baseName + "_TLV_H";
+  for (size_t i = 0; i < guard.size(); ++i) {
+    if (isalnum(guard[i]))
+      guard[i] = toupper(guard[i]);
+    else
+      guard[i] = '_';
+  }
+
+  ostringstream h;
+  h << "// Generated by protoc-gen-ndntlv from " << file->name()
+    << ". DO NOT EDIT.\n\n"
+    << "#ifndef " << guard << "\n"
+    << "#define " << guard << "\n\n"
+    << "#include <ndn-cpp/util/blob.hpp>\n"
+    << "#include \"" << baseName << ".pb.h\"\n\n";
+  for (size_t i = 0; i < namespaces.size(); ++i)
+    h << "namespace " << namespaces[i] << " {\n";
+  if (!namespaces.empty())
+    h << "\n";
+  for (size_t i = 0; i < messages.size(); ++i) {
+    string name = className(messages[i]);
+    h << "/**\n"
+      << " * Encode the " << name << " as NDN-TLV, the same as ProtobufTlv::encode.\n"
+      << " */\n"
+      << "ndn::Blob\n"
+      << "encodeTlv(const " << name << "& message);\n\n"
+      << "/**\n"
+      << " * Decode the input as NDN-TLV and update the fields of the " << name
+      << ",\n"
+      << " * the same as ProtobufTlv::decode.\n"
+      << " */\n"
+      << "void\n"
+      << "decodeTlv\n"
+      << "  (" << name << "& message, const uint8_t *input, size_t inputLength);\n\n";
+  }
+  for (size_t i = 0; i < namespaces.size(); ++i)
+    h << "}\n";
+  h << "\n#endif\n";
+  header = h.str();
+
+  ostringstream cc;
+  cc << "// Generated by protoc-gen-ndntlv from " << file->name()
+     << ". DO NOT EDIT.\n\n"
+     << "#include <climits>\n"
+     << "#include <stdexcept>\n"
+     << "#include <typeinfo>\n"
+     << "#include <ndn-cpp/encoding/protobuf-tlv-codec.hpp>\n"
+     << "#include \"" << baseName << ".tlv.h\"\n\n"
+     << "using namespace std;\n"
+     << "using ndn::ProtobufTlvCodec;\n\n";
+  for (size_t i = 0; i < namespaces.size(); ++i)
+    cc << "namespace " << namespaces[i] << " {\n";
+  if (!namespaces.empty())
+    cc << "\n";
+
+  if (hasEnum)
+    cc << "static uint64_t\n"
+       << "enumTlvValue(int number)\n"
+       << "{\n"
+       << "  if (number < 0)\n"
+       << "    throw runtime_error(\"ProtobufTlv::encode: ENUM value may not be negative\");\n"
+       << "  return (uint64_t)number;\n"
+       << "}\n\n";
+
+  // Declare all the functions first since messages can refer to each other.
+  for (size_t i = 0; i < messages.size(); ++i) {
+    string name = className(messages[i]);
+    cc << "static size_t\n"
+       << "tlvValueLength(const " << name << "& message);\n"
+       << "static void\n"
+       << "encodeTlvValue(const " << name
+       << "& message, ProtobufTlvCodec::Encoder& encoder);\n"
+       << "static void\n"
+       << "decodeTlvValue\n"
+       << "  (" << name << "& message, ProtobufTlvCodec::Decoder& decoder,\n"
+       << "   size_t endOffset);\n";
+  }
+  cc << "\n";
+
+  for (size_t i = 0; i < messages.size(); ++i)
+    writeMessageFunctions(cc, messages[i]);
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    string name = className(messages[i]);
+    cc << "ndn::Blob\n"
+       << "encodeTlv(const " << name << "& message)\n"
+       << "{\n"
+       << "  message.CheckInitialized();\n"
+       << "  ProtobufTlvCodec::Encoder encoder(tlvValueLength(message));\n"
+       << "  encodeTlvValue(message, encoder);\n"
+       << "  return encoder.finish();\n"
+       << "}\n\n"
+       << "void\n"
+       << "decodeTlv\n"
+       << "  (" << name << "& message, const uint8_t *input, size_t inputLength)\n"
+       << "{\n"
+       << "  ProtobufTlvCodec::Decoder decoder(input, inputLength);\n"
+       << "  decodeTlvValue(message, decoder, inputLength);\n"
+       << "}\n\n"
+       << "static ndn::Blob\n"
+       << "encodeMessage_" << name
+       << "(const google::protobuf::Message& message)\n"
+       << "{\n"
+       << "  return encodeTlv(static_cast<const " << name << "&>(message));\n"
+       << "}\n\n"
+       << "static void\n"
+       << "decodeMessage_" << name << "\n"
+       << "  (google::protobuf::Message& message, const uint8_t *input,\n"
+       << "   size_t inputLength)\n"
+       << "{\n"
+       << "  decodeTlv(static_cast<" << name
+       << "&>(message), input, inputLength);\n"
+       << "}\n\n"
+       << "static const bool isRegistered_" << name
+       << " = ProtobufTlvCodec::registerCodec\n"
+       << "  (typeid(" << name << "), &encodeMessage_" << name
+       << ", &decodeMessage_" << name << ");\n\n";
+  }
+
+  for (size_t i = 0; i < namespaces.size(); ++i)
+    cc << "}\n";
+  source = cc.str();
+}
+
+/**
+ * Append the CodeGeneratorResponse.File with the name and content to the
+ * response.
+ */
+static void
+writeResponseFile
+  (io::CodedOutputStream& response, const string& name, const string& content)
+{
+  string file;
+  {
+    io::StringOutputStream fileStream(&file);
+    io::CodedOutputStream fileOutput(&fileStream);
+    WireFormatLite::WriteString(RESPONSE_FILE_NAME, name, &fileOutput);
+    WireFormatLite::WriteString(RESPONSE_FILE_CONTENT, content, &fileOutput);
+  }
+  WireFormatLite::WriteBytes(RESPONSE_FILE, file, &response);
+}
+
+int
+main(int argc, char** argv)
+{
+  string request((istreambuf_iterator<char>(cin)), istreambuf_iterator<char>());
+
+  // Parse the CodeGeneratorRequest.
+  vector<string> filesToGenerate;
+  DescriptorPool pool;
+  {
+    io::CodedInputStream input((const uint8_t*)request.data(), request.size());
+    while (true) {
+      uint32_t tag = input.ReadTag();
+      if (tag == 0)
+        break;
+
+      int fieldNumber = WireFormatLite::GetTagFieldNumber(tag);
+      if (fieldNumber == REQUEST_FILE_TO_GENERATE) {
+        string fileName;
+        if (!WireFormatLite::ReadString(&input, &fileName)) {
+          cerr << "protoc-gen-ndntlv: Error reading the request" << endl;
+          return 1;
+        }
+        filesToGenerate.push_back(fileName);
+      }
+      else if (fieldNumber == REQUEST_PROTO_FILE) {
+        string fileBytes;
+        FileDescriptorProto fileProto;
+        if (!WireFormatLite::ReadBytes(&input, &fileBytes) ||
+            !fileProto.ParseFromString(fileBytes)) {
+          cerr << "protoc-gen-ndntlv: Error reading the request" << endl;
+          return 1;
+        }
+        // protoc sends the files in dependency order.
+        if (!pool.BuildFile(fileProto)) {
+          cerr << "protoc-gen-ndntlv: Error building " << fileProto.name()
+               << endl;
+          return 1;
+        }
+      }
+      else if (!WireFormatLite::SkipField(&input, tag)) {
+        cerr << "protoc-gen-ndntlv: Error reading the request" << endl;
+        return 1;
+      }
+    }
+  }
+
+  // Write the CodeGeneratorResponse.
+  string response;
+  {
+    io::StringOutputStream responseStream(&response);
+    io::CodedOutputStream output(&responseStream);
+    WireFormatLite::WriteUInt64
+      (RESPONSE_SUPPORTED_FEATURES, FEATURE_PROTO3_OPTIONAL, &output);
+
+    try {
+      for (size_t i = 0; i < filesToGenerate.size(); ++i) {
+        const FileDescriptor* file = pool.FindFileByName(filesToGenerate[i]);
+        if (!file)
+          throw GeneratorError("Can't find " + filesToGenerate[i]);
+
+        string header, source;
+        generate(file, header, source);
+        string baseName = stripProto(file->name());
+        writeResponseFile(output, baseName + ".tlv.h", header);
+        writeResponseFile(output, baseName + ".tlv.cc", source);
+      }
+    } catch (const GeneratorError& ex) {
+      WireFormatLite::WriteString(RESPONSE_ERROR, ex.what(), &output);
+    }
+  }
+
+  cout.write(response.data(), response.size());
+  return cout ? 0 : 1;
+}
+
+#else // NDN_CPP_HAVE_PROTOBUF
+
+int
+main(int argc, char** argv)
+{
+  std::cerr << "protoc-gen-ndntlv: This program was not built with Protobuf"
+            << std::endl;
+  return 1;
+}
+
+#endif // NDN_CPP_HAVE_PROTOBUF
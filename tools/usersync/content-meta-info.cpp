@@ -41,6 +41,7 @@ ContentMetaInfo::clear()
   timestamp_ = -1;
   hasSegments_ = false;
   other_ = Blob();
+  contentSize_ = 0;
 }
 
 Blob
@@ -55,6 +56,8 @@ ContentMetaInfo::wireEncode() const
   meta.mutable_content_meta_info()->set_has_segments(hasSegments_);
   if (!other_.isNull())
     meta.mutable_content_meta_info()->set_other(other_.buf(), other_.size());
+  if (contentSize_ > 0)
+    meta.mutable_content_meta_info()->set_content_size(contentSize_);
 
   return ProtobufTlv::encode(meta);
 }
@@ -74,6 +77,8 @@ ContentMetaInfo::wireDecode(const uint8_t *input, size_t inputLength)
   hasSegments_ = meta.has_segments();
   if (meta.has_other())
     other_ = Blob((const uint8_t*)&meta.other()[0], meta.other().size());
+  if (meta.has_content_size())
+    contentSize_ = meta.content_size();
 }
 
 }
@@ -0,0 +1,799 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: content-meta-info.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_content_2dmeta_2dinfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_content_2dmeta_2dinfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_content_2dmeta_2dinfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_content_2dmeta_2dinfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_content_2dmeta_2dinfo_2eproto;
+namespace ndn_message {
+class ContentMetaInfoMessage;
+struct ContentMetaInfoMessageDefaultTypeInternal;
+extern ContentMetaInfoMessageDefaultTypeInternal _ContentMetaInfoMessage_default_instance_;
+class ContentMetaInfoMessage_ContentMetaInfo;
+struct ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal;
+extern ContentMetaInfoMessage_ContentMetaInfoDefaultTypeInternal _ContentMetaInfoMessage_ContentMetaInfo_default_instance_;
+}  // namespace ndn_message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ndn_message::ContentMetaInfoMessage* Arena::CreateMaybeMessage<::ndn_message::ContentMetaInfoMessage>(Arena*);
+template<> ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* Arena::CreateMaybeMessage<::ndn_message::ContentMetaInfoMessage_ContentMetaInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ndn_message {
+
+// ===================================================================
+
+class ContentMetaInfoMessage_ContentMetaInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ContentMetaInfoMessage.ContentMetaInfo) */ {
+ public:
+  inline ContentMetaInfoMessage_ContentMetaInfo() : ContentMetaInfoMessage_ContentMetaInfo(nullptr) {}
+  ~ContentMetaInfoMessage_ContentMetaInfo() override;
+  explicit PROTOBUF_CONSTEXPR ContentMetaInfoMessage_ContentMetaInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ContentMetaInfoMessage_ContentMetaInfo(const ContentMetaInfoMessage_ContentMetaInfo& from);
+  ContentMetaInfoMessage_ContentMetaInfo(ContentMetaInfoMessage_ContentMetaInfo&& from) noexcept
+    : ContentMetaInfoMessage_ContentMetaInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ContentMetaInfoMessage_ContentMetaInfo& operator=(const ContentMetaInfoMessage_ContentMetaInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ContentMetaInfoMessage_ContentMetaInfo& operator=(ContentMetaInfoMessage_ContentMetaInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ContentMetaInfoMessage_ContentMetaInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContentMetaInfoMessage_ContentMetaInfo* internal_default_instance() {
+    return reinterpret_cast<const ContentMetaInfoMessage_ContentMetaInfo*>(
+               &_ContentMetaInfoMessage_ContentMetaInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ContentMetaInfoMessage_ContentMetaInfo& a, ContentMetaInfoMessage_ContentMetaInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ContentMetaInfoMessage_ContentMetaInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ContentMetaInfoMessage_ContentMetaInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ContentMetaInfoMessage_ContentMetaInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContentMetaInfoMessage_ContentMetaInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContentMetaInfoMessage_ContentMetaInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContentMetaInfoMessage_ContentMetaInfo& from) {
+    ContentMetaInfoMessage_ContentMetaInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ContentMetaInfoMessage_ContentMetaInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ContentMetaInfoMessage.ContentMetaInfo";
+  }
+  protected:
+  explicit ContentMetaInfoMessage_ContentMetaInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentTypeFieldNumber = 129,
+    kOtherFieldNumber = 132,
+    kTimestampFieldNumber = 130,
+    kContentSizeFieldNumber = 133,
+    kHasSegmentsFieldNumber = 131,
+  };
+  // required string content_type = 129;
+  bool has_content_type() const;
+  private:
+  bool _internal_has_content_type() const;
+  public:
+  void clear_content_type();
+  const std::string& content_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content_type();
+  PROTOBUF_NODISCARD std::string* release_content_type();
+  void set_allocated_content_type(std::string* content_type);
+  private:
+  const std::string& _internal_content_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content_type(const std::string& value);
+  std::string* _internal_mutable_content_type();
+  public:
+
+  // optional bytes other = 132;
+  bool has_other() const;
+  private:
+  bool _internal_has_other() const;
+  public:
+  void clear_other();
+  const std::string& other() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_other(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_other();
+  PROTOBUF_NODISCARD std::string* release_other();
+  void set_allocated_other(std::string* other);
+  private:
+  const std::string& _internal_other() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_other(const std::string& value);
+  std::string* _internal_mutable_other();
+  public:
+
+  // required uint64 timestamp = 130;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // optional uint64 content_size = 133;
+  bool has_content_size() const;
+  private:
+  bool _internal_has_content_size() const;
+  public:
+  void clear_content_size();
+  uint64_t content_size() const;
+  void set_content_size(uint64_t value);
+  private:
+  uint64_t _internal_content_size() const;
+  void _internal_set_content_size(uint64_t value);
+  public:
+
+  // required bool has_segments = 131;
+  bool has_has_segments() const;
+  private:
+  bool _internal_has_has_segments() const;
+  public:
+  void clear_has_segments();
+  bool has_segments() const;
+  void set_has_segments(bool value);
+  private:
+  bool _internal_has_segments() const;
+  void _internal_set_has_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ContentMetaInfoMessage.ContentMetaInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr other_;
+    uint64_t timestamp_;
+    uint64_t content_size_;
+    bool has_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_content_2dmeta_2dinfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ContentMetaInfoMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ndn_message.ContentMetaInfoMessage) */ {
+ public:
+  inline ContentMetaInfoMessage() : ContentMetaInfoMessage(nullptr) {}
+  ~ContentMetaInfoMessage() override;
+  explicit PROTOBUF_CONSTEXPR ContentMetaInfoMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ContentMetaInfoMessage(const ContentMetaInfoMessage& from);
+  ContentMetaInfoMessage(ContentMetaInfoMessage&& from) noexcept
+    : ContentMetaInfoMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ContentMetaInfoMessage& operator=(const ContentMetaInfoMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ContentMetaInfoMessage& operator=(ContentMetaInfoMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ContentMetaInfoMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContentMetaInfoMessage* internal_default_instance() {
+    return reinterpret_cast<const ContentMetaInfoMessage*>(
+               &_ContentMetaInfoMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ContentMetaInfoMessage& a, ContentMetaInfoMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ContentMetaInfoMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ContentMetaInfoMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ContentMetaInfoMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContentMetaInfoMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContentMetaInfoMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContentMetaInfoMessage& from) {
+    ContentMetaInfoMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ContentMetaInfoMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ndn_message.ContentMetaInfoMessage";
+  }
+  protected:
+  explicit ContentMetaInfoMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ContentMetaInfoMessage_ContentMetaInfo ContentMetaInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentMetaInfoFieldNumber = 128,
+  };
+  // required .ndn_message.ContentMetaInfoMessage.ContentMetaInfo content_meta_info = 128;
+  bool has_content_meta_info() const;
+  private:
+  bool _internal_has_content_meta_info() const;
+  public:
+  void clear_content_meta_info();
+  const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo& content_meta_info() const;
+  PROTOBUF_NODISCARD ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* release_content_meta_info();
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* mutable_content_meta_info();
+  void set_allocated_content_meta_info(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* content_meta_info);
+  private:
+  const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo& _internal_content_meta_info() const;
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* _internal_mutable_content_meta_info();
+  public:
+  void unsafe_arena_set_allocated_content_meta_info(
+      ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* content_meta_info);
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* unsafe_arena_release_content_meta_info();
+
+  // @@protoc_insertion_point(class_scope:ndn_message.ContentMetaInfoMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* content_meta_info_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_content_2dmeta_2dinfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ContentMetaInfoMessage_ContentMetaInfo
+
+// required string content_type = 129;
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_content_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_content_type() const {
+  return _internal_has_content_type();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::clear_content_type() {
+  _impl_.content_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ContentMetaInfoMessage_ContentMetaInfo::content_type() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type)
+  return _internal_content_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ContentMetaInfoMessage_ContentMetaInfo::set_content_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type)
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::mutable_content_type() {
+  std::string* _s = _internal_mutable_content_type();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type)
+  return _s;
+}
+inline const std::string& ContentMetaInfoMessage_ContentMetaInfo::_internal_content_type() const {
+  return _impl_.content_type_.Get();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::_internal_set_content_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::_internal_mutable_content_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::release_content_type() {
+  // @@protoc_insertion_point(field_release:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type)
+  if (!_internal_has_content_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_type_.IsDefault()) {
+    _impl_.content_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::set_allocated_content_type(std::string* content_type) {
+  if (content_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_type_.SetAllocated(content_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_type_.IsDefault()) {
+    _impl_.content_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_type)
+}
+
+// required uint64 timestamp = 130;
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ContentMetaInfoMessage_ContentMetaInfo::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t ContentMetaInfoMessage_ContentMetaInfo::timestamp() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.timestamp)
+  return _internal_timestamp();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.timestamp_ = value;
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.timestamp)
+}
+
+// required bool has_segments = 131;
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_has_segments() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_has_segments() const {
+  return _internal_has_has_segments();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::clear_has_segments() {
+  _impl_.has_segments_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_segments() const {
+  return _impl_.has_segments_;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_segments() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.has_segments)
+  return _internal_has_segments();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::_internal_set_has_segments(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.has_segments_ = value;
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::set_has_segments(bool value) {
+  _internal_set_has_segments(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.has_segments)
+}
+
+// optional bytes other = 132;
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_other() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_other() const {
+  return _internal_has_other();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::clear_other() {
+  _impl_.other_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ContentMetaInfoMessage_ContentMetaInfo::other() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.other)
+  return _internal_other();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ContentMetaInfoMessage_ContentMetaInfo::set_other(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.other_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.other)
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::mutable_other() {
+  std::string* _s = _internal_mutable_other();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.other)
+  return _s;
+}
+inline const std::string& ContentMetaInfoMessage_ContentMetaInfo::_internal_other() const {
+  return _impl_.other_.Get();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::_internal_set_other(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.other_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::_internal_mutable_other() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.other_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ContentMetaInfoMessage_ContentMetaInfo::release_other() {
+  // @@protoc_insertion_point(field_release:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.other)
+  if (!_internal_has_other()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.other_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.other_.IsDefault()) {
+    _impl_.other_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::set_allocated_other(std::string* other) {
+  if (other != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.other_.SetAllocated(other, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.other_.IsDefault()) {
+    _impl_.other_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.other)
+}
+
+// optional uint64 content_size = 133;
+inline bool ContentMetaInfoMessage_ContentMetaInfo::_internal_has_content_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ContentMetaInfoMessage_ContentMetaInfo::has_content_size() const {
+  return _internal_has_content_size();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::clear_content_size() {
+  _impl_.content_size_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ContentMetaInfoMessage_ContentMetaInfo::_internal_content_size() const {
+  return _impl_.content_size_;
+}
+inline uint64_t ContentMetaInfoMessage_ContentMetaInfo::content_size() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_size)
+  return _internal_content_size();
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::_internal_set_content_size(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.content_size_ = value;
+}
+inline void ContentMetaInfoMessage_ContentMetaInfo::set_content_size(uint64_t value) {
+  _internal_set_content_size(value);
+  // @@protoc_insertion_point(field_set:ndn_message.ContentMetaInfoMessage.ContentMetaInfo.content_size)
+}
+
+// -------------------------------------------------------------------
+
+// ContentMetaInfoMessage
+
+// required .ndn_message.ContentMetaInfoMessage.ContentMetaInfo content_meta_info = 128;
+inline bool ContentMetaInfoMessage::_internal_has_content_meta_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.content_meta_info_ != nullptr);
+  return value;
+}
+inline bool ContentMetaInfoMessage::has_content_meta_info() const {
+  return _internal_has_content_meta_info();
+}
+inline void ContentMetaInfoMessage::clear_content_meta_info() {
+  if (_impl_.content_meta_info_ != nullptr) _impl_.content_meta_info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo& ContentMetaInfoMessage::_internal_content_meta_info() const {
+  const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* p = _impl_.content_meta_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo&>(
+      ::ndn_message::_ContentMetaInfoMessage_ContentMetaInfo_default_instance_);
+}
+inline const ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo& ContentMetaInfoMessage::content_meta_info() const {
+  // @@protoc_insertion_point(field_get:ndn_message.ContentMetaInfoMessage.content_meta_info)
+  return _internal_content_meta_info();
+}
+inline void ContentMetaInfoMessage::unsafe_arena_set_allocated_content_meta_info(
+    ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* content_meta_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.content_meta_info_);
+  }
+  _impl_.content_meta_info_ = content_meta_info;
+  if (content_meta_info) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ndn_message.ContentMetaInfoMessage.content_meta_info)
+}
+inline ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* ContentMetaInfoMessage::release_content_meta_info() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* temp = _impl_.content_meta_info_;
+  _impl_.content_meta_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* ContentMetaInfoMessage::unsafe_arena_release_content_meta_info() {
+  // @@protoc_insertion_point(field_release:ndn_message.ContentMetaInfoMessage.content_meta_info)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* temp = _impl_.content_meta_info_;
+  _impl_.content_meta_info_ = nullptr;
+  return temp;
+}
+inline ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* ContentMetaInfoMessage::_internal_mutable_content_meta_info() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.content_meta_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ndn_message::ContentMetaInfoMessage_ContentMetaInfo>(GetArenaForAllocation());
+    _impl_.content_meta_info_ = p;
+  }
+  return _impl_.content_meta_info_;
+}
+inline ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* ContentMetaInfoMessage::mutable_content_meta_info() {
+  ::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* _msg = _internal_mutable_content_meta_info();
+  // @@protoc_insertion_point(field_mutable:ndn_message.ContentMetaInfoMessage.content_meta_info)
+  return _msg;
+}
+inline void ContentMetaInfoMessage::set_allocated_content_meta_info(::ndn_message::ContentMetaInfoMessage_ContentMetaInfo* content_meta_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.content_meta_info_;
+  }
+  if (content_meta_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(content_meta_info);
+    if (message_arena != submessage_arena) {
+      content_meta_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, content_meta_info, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_meta_info_ = content_meta_info;
+  // @@protoc_insertion_point(field_set_allocated:ndn_message.ContentMetaInfoMessage.content_meta_info)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ndn_message
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_content_2dmeta_2dinfo_2eproto
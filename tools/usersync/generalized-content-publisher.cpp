@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/**
+ * Copyright (C) 2018 Regents of the University of California.
+ * @author: Jeff Thompson <jefft0@remap.ucla.edu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with the additional exemption that
+ * compiling, linking, and/or using OpenSSL is allowed.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ * A copy of the GNU Lesser General Public License is in the file COPYING.
+ */
+
+#include <stdexcept>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <ndn-cpp/util/logging.hpp>
+#include <ndn-cpp-tools/usersync/generalized-content-publisher.hpp>
+
+using namespace std;
+using namespace ndn;
+
+INIT_LOGGER("ndntools.GeneralizedContentPublisher");
+
+namespace ndntools {
+
+GeneralizedContentPublisher::GeneralizedContentPublisher
+  (const Name& prefix, Milliseconds freshnessPeriod, KeyChain* signingKeyChain,
+   const Name& signingCertificateName, const ContentMetaInfo& metaInfo,
+   const string& filePath, size_t contentSegmentSize,
+   size_t maxSignedSegmentCount)
+: prefix_(prefix), freshnessPeriod_(freshnessPeriod),
+  signingKeyChain_(signingKeyChain), contentSegmentSize_(contentSegmentSize),
+  maxSignedSegmentCount_(maxSignedSegmentCount), fileDescriptor_(-1),
+  contentSize_(0), segmentCount_(0)
+{
+  if (contentSegmentSize_ == 0)
+    throw runtime_error
+      ("GeneralizedContentPublisher: contentSegmentSize must not be zero");
+  if (maxSignedSegmentCount_ == 0)
+    maxSignedSegmentCount_ = 1;
+
+  if (metaInfo.getHasSegments())
+    openFile(filePath);
+
+  try {
+    // Sign the _meta packet now so that it is ready for the first Interest.
+    metaData_.reset(new Data(prefix));
+    metaData_->getName().append("_meta");
+    metaData_->getMetaInfo().setFreshnessPeriod(freshnessPeriod);
+    // Include the content size so that a fetcher can preallocate the buffer.
+    ContentMetaInfo sizedMetaInfo(metaInfo);
+    if (metaInfo.getHasSegments() && metaInfo.getContentSize() == 0)
+      sizedMetaInfo.setContentSize(contentSize_);
+    metaData_->setContent(sizedMetaInfo.wireEncode());
+    if (signingKeyChain) {
+      if (signingCertificateName.size() > 0)
+        signingKeyChain->sign(*metaData_, signingCertificateName);
+      else
+        signingKeyChain->sign(*metaData_);
+    }
+  } catch (...) {
+    // The destructor won't be called, so close here.
+    if (fileDescriptor_ >= 0)
+      ::close(fileDescriptor_);
+    throw;
+  }
+}
+
+void
+GeneralizedContentPublisher::openFile(const string& filePath)
+{
+  int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+    throw runtime_error
+      ("GeneralizedContentPublisher: Cannot open the file " + filePath);
+  struct stat fileStat;
+  if (::fstat(fileDescriptor, &fileStat) != 0) {
+    ::close(fileDescriptor);
+    throw runtime_error
+      ("GeneralizedContentPublisher: Cannot get the size of the file " + filePath);
+  }
+  if ((uint64_t)fileStat.st_size > (uint64_t)SIZE_MAX) {
+    ::close(fileDescriptor);
+    throw runtime_error
+      ("GeneralizedContentPublisher: The file is too large to address " + filePath);
+  }
+
+  contentSize_ = (size_t)fileStat.st_size;
+  if (contentSize_ > 0) {
+    fileDescriptor_ = fileDescriptor;
+#ifdef POSIX_FADV_SEQUENTIAL
+    // Segments are usually fetched in order.
+    ::posix_fadvise(fileDescriptor_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    segmentCount_ =
+      ((uint64_t)contentSize_ + contentSegmentSize_ - 1) / contentSegmentSize_;
+    finalBlockId_ = Name().appendSegment(segmentCount_ - 1).get(0);
+  }
+  else
+    ::close(fileDescriptor);
+}
+
+GeneralizedContentPublisher::~GeneralizedContentPublisher()
+{
+  if (fileDescriptor_ >= 0)
+    ::close(fileDescriptor_);
+}
+
+void
+GeneralizedContentPublisher::onInterest
+  (const ptr_lib::shared_ptr<const Name>& prefix,
+   const ptr_lib::shared_ptr<const Interest>& interest, Face& face,
+   uint64_t interestFilterId,
+   const ptr_lib::shared_ptr<const InterestFilter>& filter)
+{
+  ptr_lib::shared_ptr<Data> data;
+  try {
+    data = getData(*interest);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("GeneralizedContentPublisher::onInterest: Error making the Data packet: " <<
+               ex.what());
+    return;
+  }
+
+  if (data)
+    face.putData(*data);
+}
+
+ptr_lib::shared_ptr<Data>
+GeneralizedContentPublisher::getData(const Interest& interest)
+{
+  const Name& name = interest.getName();
+  if (!prefix_.match(name))
+    return ptr_lib::shared_ptr<Data>();
+
+  if (name.size() == prefix_.size()) {
+    if (segmentCount_ == 0)
+      return ptr_lib::shared_ptr<Data>();
+    return getSegment(interest.getChildSelector() == 1 ? segmentCount_ - 1 : 0);
+  }
+  if (name.size() != prefix_.size() + 1)
+    return ptr_lib::shared_ptr<Data>();
+
+  const Name::Component& component = name.get(-1);
+  if (component == metaData_->getName().get(-1))
+    return metaData_;
+  if (!component.isSegment())
+    return ptr_lib::shared_ptr<Data>();
+
+  return getSegment(component.toSegment());
+}
+
+ptr_lib::shared_ptr<Data>
+GeneralizedContentPublisher::getSegment(uint64_t segmentNumber)
+{
+  if (segmentNumber >= segmentCount_)
+    return ptr_lib::shared_ptr<Data>();
+
+  map<uint64_t, SegmentList::iterator>::iterator cached =
+    segmentCache_.find(segmentNumber);
+  if (cached != segmentCache_.end()) {
+    // Move the segment to the front as the most recently used.
+    segmentLru_.splice(segmentLru_.begin(), segmentLru_, cached->second);
+    return cached->second->second;
+  }
+
+  ptr_lib::shared_ptr<Data> data = makeSegment(segmentNumber);
+  segmentLru_.push_front(make_pair(segmentNumber, data));
+  segmentCache_[segmentNumber] = segmentLru_.begin();
+  if (segmentLru_.size() > maxSignedSegmentCount_) {
+    segmentCache_.erase(segmentLru_.back().first);
+    segmentLru_.pop_back();
+  }
+
+  return data;
+}
+
+ptr_lib::shared_ptr<Data>
+GeneralizedContentPublisher::makeSegment(uint64_t segmentNumber)
+{
+  size_t offset = (size_t)(segmentNumber * contentSegmentSize_);
+  size_t length = contentSize_ - offset;
+  if (length > contentSegmentSize_)
+    length = contentSegmentSize_;
+
+  // Read only the bytes of this segment. Unlike a memory map, reading a file
+  // which was truncated after the constructor fails with an error instead of
+  // raising SIGBUS.
+  ptr_lib::shared_ptr<vector<uint8_t> > content(new vector<uint8_t>(length));
+  size_t nRead = 0;
+  while (nRead < length) {
+    ssize_t result = ::pread
+      (fileDescriptor_, &(*content)[nRead], length - nRead, offset + nRead);
+    if (result < 0 && errno == EINTR)
+      continue;
+    if (result <= 0)
+      throw runtime_error
+        ("GeneralizedContentPublisher: Cannot read the segment from the file. It may have been truncated");
+    nRead += (size_t)result;
+  }
+
+  ptr_lib::shared_ptr<Data> data(new Data(prefix_));
+  data->getName().appendSegment(segmentNumber);
+  data->getMetaInfo().setFreshnessPeriod(freshnessPeriod_);
+  data->getMetaInfo().setFinalBlockId(finalBlockId_);
+  data->setContent(Blob(content, false));
+  if (signingKeyChain_)
+    // Only the _meta packet has a KeyChain signature. A SHA256 digest keeps
+    // signing a segment on request fast.
+    signingKeyChain_->signWithSha256(*data);
+
+  return data;
+}
+
+}
@@ -19,6 +19,13 @@
  * A copy of the GNU Lesser General Public License is in the file COPYING.
  */
 
+#include <fstream>
+#include <sstream>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../../src/c/util/ndn_memory.h"
 #include <ndn-cpp/util/logging.hpp>
 #include <ndn-cpp-tools/usersync/generalized-content.hpp>
 
@@ -30,6 +37,8 @@ INIT_LOGGER("ndntools.GeneralizedContent");
 
 namespace ndntools {
 
+const int GeneralizedContent::MAX_SEGMENT_RETRIES;
+
 void
 GeneralizedContent::publish
   (MemoryContentCache& contentCache, const Name& prefix,
@@ -37,11 +46,15 @@ GeneralizedContent::publish
    const Name& signingCertificateName, const ContentMetaInfo& metaInfo,
    const Blob& content, size_t contentSegmentSize)
 {
-  // Add the _meta Data packet to the contentCache.
+  // Add the _meta Data packet to the contentCache. Include the content size so
+  // that a fetcher can preallocate the content buffer.
+  ContentMetaInfo sizedMetaInfo(metaInfo);
+  if (metaInfo.getHasSegments() && metaInfo.getContentSize() == 0)
+    sizedMetaInfo.setContentSize(content.size());
   Data data(prefix);
   data.getName().append("_meta");
   data.getMetaInfo().setFreshnessPeriod(freshnessPeriod);
-  data.setContent(metaInfo.wireEncode());
+  data.setContent(sizedMetaInfo.wireEncode());
   if (signingKeyChain)
     signingKeyChain->sign(data);
   contentCache.add(data);
@@ -93,6 +106,29 @@ GeneralizedContent::fetch
   contentFetcher->fetchMetaInfo();
 }
 
+void
+GeneralizedContent::fetchParallel
+  (Face& face, const Name& prefix, KeyChain* validatorKeyChain,
+   const OnComplete& onComplete, const OnError& onError,
+   Milliseconds interestLifetimeMilliseconds, size_t maxOutstandingInterests,
+   const string& outputFilePath)
+{
+  // Make a shared_ptr because we make callbacks with bind using
+  //   shared_from_this() so the object remains allocated.
+  ptr_lib::shared_ptr<GeneralizedContent> contentFetcher
+    (new GeneralizedContent
+     (face, prefix, validatorKeyChain, onComplete, onError,
+      interestLifetimeMilliseconds,
+      maxOutstandingInterests > 0 ? maxOutstandingInterests : 1,
+      outputFilePath));
+  contentFetcher->fetchMetaInfo();
+}
+
+GeneralizedContent::~GeneralizedContent()
+{
+  releaseOutput();
+}
+
 void
 GeneralizedContent::fetchMetaInfo()
 {
@@ -140,6 +176,8 @@ GeneralizedContent::onMetaInfoReceived
       _LOG_ERROR("GeneralizedContent::onTimeout: Error in onComplete.");
     }
   }
+  else if (maxOutstandingInterests_ > 0 && metaInfo_->getContentSize() > 0)
+    startParallelFetch();
   else {
     // Fetch the segments.
     Interest baseInterest(prefix_);
@@ -170,8 +208,27 @@ GeneralizedContent::onMetaInfoTimeout
 void
 GeneralizedContent::onContentReceived(const Blob& content)
 {
+  if (!outputFilePath_.empty()) {
+    // fetchParallel fell back to SegmentFetcher, so write the output file here.
+    ofstream file(outputFilePath_.c_str(), ios::binary | ios::trunc);
+    file.write((const char*)content.buf(), content.size());
+    file.close();
+    if (!file) {
+      try {
+        onError_
+          (ErrorCode::OUTPUT_FILE_ERROR,
+           "Cannot write the output file " + outputFilePath_);
+      } catch (const std::exception& ex) {
+        _LOG_ERROR("GeneralizedContent::onContentReceived: Error in onError: " << ex.what());
+      } catch (...) {
+        _LOG_ERROR("GeneralizedContent::onContentReceived: Error in onError.");
+      }
+      return;
+    }
+  }
+
   try {
-    onComplete_(metaInfo_, content);
+    onComplete_(metaInfo_, outputFilePath_.empty() ? content : Blob());
   } catch (const std::exception& ex) {
     _LOG_ERROR("GeneralizedContent::onTimeout: Error in onComplete: " << ex.what());
   } catch (...) {
@@ -201,4 +258,282 @@ GeneralizedContent::onSegmentFetcherError
   }
 }
 
+void
+GeneralizedContent::startParallelFetch()
+{
+  if (metaInfo_->getContentSize() > (uint64_t)SIZE_MAX) {
+    abortParallelFetch
+      (ErrorCode::CONTENT_SIZE_MISMATCH,
+       "The ContentSize in the _meta info is too large to fetch into memory");
+    return;
+  }
+  contentSize_ = (size_t)metaInfo_->getContentSize();
+
+  Interest interest(prefix_);
+  interest.setInterestLifetimeMilliseconds(interestLifetimeMilliseconds_);
+  // The template pre-encodes the prefix and lifetime, so that each segment
+  // Interest only needs to encode the segment number and nonce.
+  segmentInterestTemplate_.reset(new InterestTemplate(interest));
+
+  // We need segment 0 to learn the segment size and to confirm the ContentSize
+  // before allocating the output and fetching in parallel.
+  nextSegmentNumber_ = 1;
+  expressSegmentInterest(0);
+}
+
+bool
+GeneralizedContent::allocateOutput()
+{
+  if (outputFilePath_.empty()) {
+    contentBuffer_.reset(new vector<uint8_t>(contentSize_));
+    output_ = &(*contentBuffer_)[0];
+    return true;
+  }
+
+  int fileDescriptor = ::open
+    (outputFilePath_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fileDescriptor < 0) {
+    abortParallelFetch
+      (ErrorCode::OUTPUT_FILE_ERROR,
+       "Cannot create the output file " + outputFilePath_);
+    return false;
+  }
+  void* mapped = MAP_FAILED;
+  if (::ftruncate(fileDescriptor, (off_t)contentSize_) == 0)
+    mapped = ::mmap
+      (0, contentSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+  // The mapping remains valid after closing the file descriptor.
+  ::close(fileDescriptor);
+  if (mapped == MAP_FAILED) {
+    abortParallelFetch
+      (ErrorCode::OUTPUT_FILE_ERROR,
+       "Cannot map the output file " + outputFilePath_);
+    return false;
+  }
+  output_ = (uint8_t*)mapped;
+  isOutputMapped_ = true;
+  return true;
+}
+
+void
+GeneralizedContent::fetchMoreSegments()
+{
+  while (pendingInterestIds_.size() < maxOutstandingInterests_ &&
+         nextSegmentNumber_ < segmentCount_) {
+    if (!isSegmentReceived_[nextSegmentNumber_])
+      expressSegmentInterest(nextSegmentNumber_);
+    ++nextSegmentNumber_;
+  }
+}
+
+void
+GeneralizedContent::expressSegmentInterest(uint64_t segmentNumber)
+{
+  pendingInterestIds_[segmentNumber] = face_.expressInterest
+    (*segmentInterestTemplate_, Name::Component::fromSegment(segmentNumber),
+     bind(&GeneralizedContent::onParallelSegmentReceived, shared_from_this(),
+          _1, _2),
+     bind(&GeneralizedContent::onParallelSegmentTimeout, shared_from_this(),
+          _1),
+     bind(&GeneralizedContent::onParallelSegmentNetworkNack, shared_from_this(),
+          _1, _2));
+}
+
+void
+GeneralizedContent::onParallelSegmentReceived
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<Data>& data)
+{
+  pendingInterestIds_.erase(interest->getName().get(-1).toSegment());
+  if (isFinished_)
+    return;
+
+  if (validatorKeyChain_)
+    validatorKeyChain_->verifyData
+      (data,
+       bind(&GeneralizedContent::onParallelSegmentVerified, shared_from_this(),
+            _1),
+       // Cast to disambiguate from the deprecated OnVerifyFailed.
+       (const OnDataValidationFailed)bind
+         (&GeneralizedContent::onParallelSegmentValidationFailed,
+          shared_from_this(), _1, _2));
+  else
+    onParallelSegmentVerified(data);
+}
+
+void
+GeneralizedContent::onParallelSegmentVerified(const ptr_lib::shared_ptr<Data>& data)
+{
+  if (isFinished_)
+    return;
+
+  const Name& name = data->getName();
+  if (name.size() != prefix_.size() + 1 || !name.get(-1).isSegment()) {
+    abortParallelFetch
+      (ErrorCode::DATA_HAS_NO_SEGMENT,
+       "Got an unexpected packet without a segment number: " + name.toUri());
+    return;
+  }
+  uint64_t segmentNumber = name.get(-1).toSegment();
+  const Blob& content = data->getContent();
+
+  if (segmentSize_ == 0) {
+    // This is segment 0, which sets the segment size for the others.
+    if (segmentNumber != 0 || content.size() == 0) {
+      abortParallelFetch
+        (ErrorCode::CONTENT_SIZE_MISMATCH,
+         "The first segment is not a non-empty segment 0: " + name.toUri());
+      return;
+    }
+    segmentSize_ = content.size();
+    segmentCount_ = (contentSize_ + segmentSize_ - 1) / segmentSize_;
+    // The segments bound the content size by the number of segments times the
+    // segment size, so only trust the ContentSize if the FinalBlockId agrees.
+    const Name::Component& finalBlockId =
+      data->getMetaInfo().getFinalBlockId();
+    if (!finalBlockId.isSegment() ||
+        finalBlockId.toSegment() != segmentCount_ - 1) {
+      abortParallelFetch
+        (ErrorCode::CONTENT_SIZE_MISMATCH,
+         "The FinalBlockId of " + name.toUri() +
+         " does not match the ContentSize in the _meta info");
+      return;
+    }
+    if (!allocateOutput())
+      return;
+    isSegmentReceived_.assign(segmentCount_, false);
+  }
+
+  if (segmentNumber >= segmentCount_) {
+    abortParallelFetch
+      (ErrorCode::CONTENT_SIZE_MISMATCH,
+       "The segment number is beyond the ContentSize in the _meta info: " +
+       name.toUri());
+    return;
+  }
+  size_t offset = (size_t)segmentNumber * segmentSize_;
+  size_t expectedSize = contentSize_ - offset;
+  if (expectedSize > segmentSize_)
+    expectedSize = segmentSize_;
+  if (content.size() != expectedSize) {
+    abortParallelFetch
+      (ErrorCode::CONTENT_SIZE_MISMATCH,
+       "The content size of " + name.toUri() +
+       " does not match the ContentSize in the _meta info");
+    return;
+  }
+
+  if (!isSegmentReceived_[segmentNumber]) {
+    // Write the segment in place.
+    ndn_memcpy(output_ + offset, content.buf(), content.size());
+    isSegmentReceived_[segmentNumber] = true;
+    ++receivedSegmentCount_;
+  }
+
+  if (receivedSegmentCount_ < segmentCount_) {
+    fetchMoreSegments();
+    return;
+  }
+
+  // We are finished.
+  isFinished_ = true;
+  Blob result;
+  if (isOutputMapped_)
+    releaseOutput();
+  else {
+    result = Blob(contentBuffer_, false);
+    contentBuffer_.reset();
+  }
+  try {
+    onComplete_(metaInfo_, result);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("GeneralizedContent::onParallelSegmentVerified: Error in onComplete: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("GeneralizedContent::onParallelSegmentVerified: Error in onComplete.");
+  }
+}
+
+void
+GeneralizedContent::onParallelSegmentValidationFailed
+  (const ptr_lib::shared_ptr<Data>& data, const string& reason)
+{
+  if (isFinished_)
+    return;
+
+  abortParallelFetch
+    (ErrorCode::SEGMENT_VERIFICATION_FAILED,
+     "Segment verification failed for " + data->getName().toUri() +
+     " . Reason: " + reason);
+}
+
+void
+GeneralizedContent::onParallelSegmentTimeout
+  (const ptr_lib::shared_ptr<const Interest>& interest)
+{
+  uint64_t segmentNumber = interest->getName().get(-1).toSegment();
+  pendingInterestIds_.erase(segmentNumber);
+  if (isFinished_)
+    return;
+
+  int& retryCount = retryCounts_[segmentNumber];
+  if (retryCount < MAX_SEGMENT_RETRIES) {
+    ++retryCount;
+    _LOG_DEBUG("GeneralizedContent: Retry " << retryCount << " for interest " <<
+               interest->getName().toUri());
+    expressSegmentInterest(segmentNumber);
+    return;
+  }
+
+  abortParallelFetch
+    (ErrorCode::INTEREST_TIMEOUT,
+     "Time out for interest " + interest->getName().toUri());
+}
+
+void
+GeneralizedContent::onParallelSegmentNetworkNack
+  (const ptr_lib::shared_ptr<const Interest>& interest,
+   const ptr_lib::shared_ptr<NetworkNack>& networkNack)
+{
+  pendingInterestIds_.erase(interest->getName().get(-1).toSegment());
+  if (isFinished_)
+    return;
+
+  ostringstream message;
+  message << "Network Nack for interest " << interest->getName().toUri() <<
+    " with reason " << networkNack->getReason();
+  abortParallelFetch(ErrorCode::NETWORK_NACK, message.str());
+}
+
+void
+GeneralizedContent::abortParallelFetch
+  (ErrorCode errorCode, const string& message)
+{
+  isFinished_ = true;
+  // Remove the other segment Interests so that we don't get their callbacks.
+  for (map<uint64_t, uint64_t>::iterator i = pendingInterestIds_.begin();
+       i != pendingInterestIds_.end(); ++i)
+    face_.removePendingInterest(i->second);
+  pendingInterestIds_.clear();
+  releaseOutput();
+  contentBuffer_.reset();
+
+  try {
+    onError_(errorCode, message);
+  } catch (const std::exception& ex) {
+    _LOG_ERROR("GeneralizedContent::abortParallelFetch: Error in onError: " << ex.what());
+  } catch (...) {
+    _LOG_ERROR("GeneralizedContent::abortParallelFetch: Error in onError.");
+  }
+}
+
+void
+GeneralizedContent::releaseOutput()
+{
+  if (isOutputMapped_) {
+    ::munmap(output_, contentSize_);
+    isOutputMapped_ = false;
+  }
+  output_ = 0;
+}
+
 }
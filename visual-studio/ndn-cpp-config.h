@@ -54,6 +54,11 @@
 #define NDN_CPP_HAVE_HTONLL 0
 #endif
 
+/* 1 if have `inotify'. */
+#ifndef NDN_CPP_HAVE_INOTIFY
+#define NDN_CPP_HAVE_INOTIFY 0
+#endif
+
 /* Define to 1 if you have the <inttypes.h> header file. */
 #ifndef NDN_CPP_HAVE_INTTYPES_H
 #define NDN_CPP_HAVE_INTTYPES_H 1
@@ -113,6 +118,21 @@
 #define NDN_CPP_HAVE_PROTOBUF 0
 #endif
 
+/* 1 if have Protobuf FieldDescriptor::has_presence. */
+#ifndef NDN_CPP_HAVE_PROTOBUF_HAS_PRESENCE
+#define NDN_CPP_HAVE_PROTOBUF_HAS_PRESENCE 0
+#endif
+
+/* 1 if protoc-gen-ndntlv generates the ProtobufTlv codecs. */
+#ifndef NDN_CPP_HAVE_PROTOBUF_TLV_CODEGEN
+#define NDN_CPP_HAVE_PROTOBUF_TLV_CODEGEN 0
+#endif
+
+/* 1 if have `recvmmsg'. */
+#ifndef NDN_CPP_HAVE_RECVMMSG
+#define NDN_CPP_HAVE_RECVMMSG 0
+#endif
+
 /* Define to 1 if you have the `round' function. */
 #ifndef NDN_CPP_HAVE_ROUND
 #define NDN_CPP_HAVE_ROUND 1